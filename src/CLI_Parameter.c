@@ -19,6 +19,7 @@
 #include "String_Tools.h"
 #include "Defines.h"
 #include "Misc.h"
+#include "Intersection_Approaches.h"
 #include "Error_Handling/Dynamic_Memory.h"
 
 
@@ -86,11 +87,11 @@ const char* const GLOBAL_ADDITIONAL_PROGRAM_DESCRIPTION =
 #error "The macro \"GLOBAL_RUN_ALL_TEST_FUNCTIONS_DEFAULT\" is already defined !"
 #endif /* GLOBAL_RUN_ALL_TEST_FUNCTIONS_DEFAULT */
 
-#ifndef GLOBAL_CLI_SHOW_TOO_LONG_TOKENS_DEFAULT
-#define GLOBAL_CLI_SHOW_TOO_LONG_TOKENS_DEFAULT false
+#ifndef GLOBAL_CLI_SHOW_LONG_TOKENS_DEFAULT
+#define GLOBAL_CLI_SHOW_LONG_TOKENS_DEFAULT false
 #else
-#error "The macro \"GLOBAL_CLI_SHOW_TOO_LONG_TOKENS_DEFAULT\" is already defined !"
-#endif /* GLOBAL_CLI_SHOW_TOO_LONG_TOKENS_DEFAULT */
+#error "The macro \"GLOBAL_CLI_SHOW_LONG_TOKENS_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_SHOW_LONG_TOKENS_DEFAULT */
 
 #ifndef GLOBAL_CLI_NO_PART_MATCHES_DEFAULT
 #define GLOBAL_CLI_NO_PART_MATCHES_DEFAULT false
@@ -134,22 +135,91 @@ const char* const GLOBAL_ADDITIONAL_PROGRAM_DESCRIPTION =
 #error "The macro \"GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON_DEFAULT\" is already defined !"
 #endif /* GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON_DEFAULT */
 
+#ifndef GLOBAL_CLI_INVERTED_INDEX_DEFAULT
+#define GLOBAL_CLI_INVERTED_INDEX_DEFAULT false
+#else
+#error "The macro \"GLOBAL_CLI_INVERTED_INDEX_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_INVERTED_INDEX_DEFAULT */
+
+#ifndef GLOBAL_CLI_SORTED_MERGE_DEFAULT
+#define GLOBAL_CLI_SORTED_MERGE_DEFAULT false
+#else
+#error "The macro \"GLOBAL_CLI_SORTED_MERGE_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_SORTED_MERGE_DEFAULT */
+
+#ifndef GLOBAL_CLI_DOC_MAJOR_DEFAULT
+#define GLOBAL_CLI_DOC_MAJOR_DEFAULT false
+#else
+#error "The macro \"GLOBAL_CLI_DOC_MAJOR_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_DOC_MAJOR_DEFAULT */
+
+#ifndef GLOBAL_CLI_FREQUENCY_IDS_DEFAULT
+#define GLOBAL_CLI_FREQUENCY_IDS_DEFAULT false
+#else
+#error "The macro \"GLOBAL_CLI_FREQUENCY_IDS_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_FREQUENCY_IDS_DEFAULT */
+
+#ifndef GLOBAL_CLI_THREADS_DEFAULT
+#define GLOBAL_CLI_THREADS_DEFAULT 1
+#else
+#error "The macro \"GLOBAL_CLI_THREADS_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_THREADS_DEFAULT */
+
+#ifndef GLOBAL_CLI_KERNEL_DEFAULT
+#define GLOBAL_CLI_KERNEL_DEFAULT NULL
+#else
+#error "The macro \"GLOBAL_CLI_KERNEL_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_KERNEL_DEFAULT */
+
+#ifndef GLOBAL_CLI_SAVE_VOCAB_DEFAULT
+#define GLOBAL_CLI_SAVE_VOCAB_DEFAULT NULL
+#else
+#error "The macro \"GLOBAL_CLI_SAVE_VOCAB_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_SAVE_VOCAB_DEFAULT */
+
+#ifndef GLOBAL_CLI_LOAD_VOCAB_DEFAULT
+#define GLOBAL_CLI_LOAD_VOCAB_DEFAULT NULL
+#else
+#error "The macro \"GLOBAL_CLI_LOAD_VOCAB_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_LOAD_VOCAB_DEFAULT */
+
+#ifndef GLOBAL_CLI_STATS_JSON_DEFAULT
+#define GLOBAL_CLI_STATS_JSON_DEFAULT NULL
+#else
+#error "The macro \"GLOBAL_CLI_STATS_JSON_DEFAULT\" is already defined !"
+#endif /* GLOBAL_CLI_STATS_JSON_DEFAULT */
+
+#ifndef MAX_THREADS
+#define MAX_THREADS 1024 ///< Upper limit for the number of threads
+#else
+#error "The macro \"MAX_THREADS\" is already defined !"
+#endif /* MAX_THREADS */
+
 // Variables for the parsed CLI parameter
 const char* GLOBAL_CLI_INPUT_FILE                   = GLOBAL_CLI_INPUT_FILE_DEFAULT;
 const char* GLOBAL_CLI_INPUT_FILE2                  = GLOBAL_CLI_INPUT_FILE_DEFAULT_2;
 const char* GLOBAL_CLI_OUTPUT_FILE                  = GLOBAL_CLI_OUTPUT_FILE_DEFAULT;
-_Bool GLOBAL_CLI_FORMAT_OUTPUT                      = GLOBAL_CLI_FORMAT_OUTPUT_DEFAULT;
-_Bool GLOBAL_CLI_SENTENCE_OFFSET                    = GLOBAL_CLI_SENTENCE_OFFSET_DEFAULT;
-_Bool GLOBAL_CLI_WORD_OFFSET                        = GLOBAL_CLI_WORD_OFFSET_DEFAULT;
-_Bool GLOBAL_RUN_ALL_TEST_FUNCTIONS                 = GLOBAL_RUN_ALL_TEST_FUNCTIONS_DEFAULT;
-_Bool GLOBAL_CLI_SHOW_TOO_LONG_TOKENS               = GLOBAL_CLI_SHOW_TOO_LONG_TOKENS_DEFAULT;
-_Bool GLOBAL_CLI_NO_PART_MATCHES                    = GLOBAL_CLI_NO_PART_MATCHES_DEFAULT;
-_Bool GLOBAL_CLI_NO_FULL_MATCHES                    = GLOBAL_CLI_NO_FULL_MATCHES_DEFAULT;
-_Bool GLOBAL_CLI_NO_TIMESTAMP                       = GLOBAL_CLI_NO_TIMESTAMP_DEFAULT;
-_Bool GLOBAL_CLI_NO_CPU_EXTENSIONS                  = GLOBAL_CLI_NO_CPU_EXTENSIONS_DEFAULT;
-_Bool GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN        = GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN_DEFAULT;
+int GLOBAL_CLI_FORMAT_OUTPUT                        = GLOBAL_CLI_FORMAT_OUTPUT_DEFAULT;
+int GLOBAL_CLI_SENTENCE_OFFSET                      = GLOBAL_CLI_SENTENCE_OFFSET_DEFAULT;
+int GLOBAL_CLI_WORD_OFFSET                          = GLOBAL_CLI_WORD_OFFSET_DEFAULT;
+int GLOBAL_RUN_ALL_TEST_FUNCTIONS                   = GLOBAL_RUN_ALL_TEST_FUNCTIONS_DEFAULT;
+int GLOBAL_CLI_SHOW_LONG_TOKENS                     = GLOBAL_CLI_SHOW_LONG_TOKENS_DEFAULT;
+int GLOBAL_CLI_NO_PART_MATCHES                      = GLOBAL_CLI_NO_PART_MATCHES_DEFAULT;
+int GLOBAL_CLI_NO_FULL_MATCHES                      = GLOBAL_CLI_NO_FULL_MATCHES_DEFAULT;
+int GLOBAL_CLI_NO_TIMESTAMP                         = GLOBAL_CLI_NO_TIMESTAMP_DEFAULT;
+int GLOBAL_CLI_NO_CPU_EXTENSIONS                    = GLOBAL_CLI_NO_CPU_EXTENSIONS_DEFAULT;
+int GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN          = GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN_DEFAULT;
 float GLOBAL_ABORT_PROCESS_PERCENT                  = GLOBAL_ABORT_PROCESS_PERCENT_DEFAULT;
-_Bool GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON    = GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON_DEFAULT;
+int GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON      = GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON_DEFAULT;
+int GLOBAL_CLI_INVERTED_INDEX                       = GLOBAL_CLI_INVERTED_INDEX_DEFAULT;
+int GLOBAL_CLI_SORTED_MERGE                         = GLOBAL_CLI_SORTED_MERGE_DEFAULT;
+int GLOBAL_CLI_DOC_MAJOR                            = GLOBAL_CLI_DOC_MAJOR_DEFAULT;
+int GLOBAL_CLI_FREQUENCY_IDS                        = GLOBAL_CLI_FREQUENCY_IDS_DEFAULT;
+int GLOBAL_CLI_THREADS                              = GLOBAL_CLI_THREADS_DEFAULT;
+const char* GLOBAL_CLI_KERNEL                       = GLOBAL_CLI_KERNEL_DEFAULT;
+const char* GLOBAL_CLI_SAVE_VOCAB                   = GLOBAL_CLI_SAVE_VOCAB_DEFAULT;
+const char* GLOBAL_CLI_LOAD_VOCAB                   = GLOBAL_CLI_LOAD_VOCAB_DEFAULT;
+const char* GLOBAL_CLI_STATS_JSON                   = GLOBAL_CLI_STATS_JSON_DEFAULT;
 
 
 
@@ -168,6 +238,12 @@ void Check_CLI_Parameter_Logical_Consistency (void)
                 " because the results will alwas be empty sets !\n");
         EXIT(1);
     }
+    if (GLOBAL_CLI_INVERTED_INDEX && GLOBAL_CLI_DOC_MAJOR)
+    {
+        FPRINTF_FFLUSH_NO_VA_ARGS(stderr, "\nThe --inverted_index in combination with --doc_major makes no sense,"
+                " because both options determine the candidates of the intersections !\n");
+        EXIT(1);
+    }
 
     const size_t length_input_file_1 = (GLOBAL_CLI_INPUT_FILE != NULL) ? strlen (GLOBAL_CLI_INPUT_FILE) : 0;
     const size_t length_input_file_2 = (GLOBAL_CLI_INPUT_FILE2 != NULL) ? strlen (GLOBAL_CLI_INPUT_FILE2) : 0;
@@ -323,6 +399,40 @@ void Check_CLI_Parameter_GLOBAL_ABORT_PROCESS_PERCENT (void)
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Test function for the number of threads.
+ */
+void Check_CLI_Parameter_GLOBAL_CLI_THREADS (void)
+{
+    if (GLOBAL_CLI_THREADS < 1 || GLOBAL_CLI_THREADS > MAX_THREADS)
+    {
+        FPRINTF_FFLUSH(stderr, "Number of threads (%d) is not in the range [1, %d] !\n", GLOBAL_CLI_THREADS,
+                MAX_THREADS)
+        EXIT (1);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test function for the intersection kernel. The kernel will be selected in this function.
+ */
+void Check_CLI_Parameter_GLOBAL_CLI_KERNEL (void)
+{
+    if (! IntersectionApproach_SelectKernel(GLOBAL_CLI_KERNEL))
+    {
+        FPRINTF_FFLUSH(stderr, "The kernel \"%s\" is unknown or not supported by the host CPU ! "
+                "(Valid: auto, avx2, avx, sse4_1, sse2, mmx, none)\n", GLOBAL_CLI_KERNEL)
+        EXIT (1);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 /**
  * @brief Set all CLI parameter to the default values.
  *
@@ -337,7 +447,7 @@ extern void Set_CLI_Parameter_To_Default_Values (void)
     GLOBAL_CLI_SENTENCE_OFFSET                      = GLOBAL_CLI_SENTENCE_OFFSET_DEFAULT;
     GLOBAL_CLI_WORD_OFFSET                          = GLOBAL_CLI_WORD_OFFSET_DEFAULT;
     GLOBAL_RUN_ALL_TEST_FUNCTIONS                   = GLOBAL_RUN_ALL_TEST_FUNCTIONS_DEFAULT;
-    GLOBAL_CLI_SHOW_TOO_LONG_TOKENS                 = GLOBAL_CLI_SHOW_TOO_LONG_TOKENS_DEFAULT;
+    GLOBAL_CLI_SHOW_LONG_TOKENS                     = GLOBAL_CLI_SHOW_LONG_TOKENS_DEFAULT;
     GLOBAL_CLI_NO_PART_MATCHES                      = GLOBAL_CLI_NO_PART_MATCHES_DEFAULT;
     GLOBAL_CLI_NO_FULL_MATCHES                      = GLOBAL_CLI_NO_FULL_MATCHES_DEFAULT;
     GLOBAL_CLI_NO_TIMESTAMP                         = GLOBAL_CLI_NO_TIMESTAMP_DEFAULT;
@@ -345,6 +455,15 @@ extern void Set_CLI_Parameter_To_Default_Values (void)
     GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN          = GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN_DEFAULT;
     GLOBAL_ABORT_PROCESS_PERCENT                    = GLOBAL_ABORT_PROCESS_PERCENT_DEFAULT;
     GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON    = GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON_DEFAULT;
+    GLOBAL_CLI_INVERTED_INDEX                       = GLOBAL_CLI_INVERTED_INDEX_DEFAULT;
+    GLOBAL_CLI_SORTED_MERGE                         = GLOBAL_CLI_SORTED_MERGE_DEFAULT;
+    GLOBAL_CLI_DOC_MAJOR                            = GLOBAL_CLI_DOC_MAJOR_DEFAULT;
+    GLOBAL_CLI_FREQUENCY_IDS                        = GLOBAL_CLI_FREQUENCY_IDS_DEFAULT;
+    GLOBAL_CLI_THREADS                              = GLOBAL_CLI_THREADS_DEFAULT;
+    GLOBAL_CLI_KERNEL                               = GLOBAL_CLI_KERNEL_DEFAULT;
+    GLOBAL_CLI_SAVE_VOCAB                           = GLOBAL_CLI_SAVE_VOCAB_DEFAULT;
+    GLOBAL_CLI_LOAD_VOCAB                           = GLOBAL_CLI_LOAD_VOCAB_DEFAULT;
+    GLOBAL_CLI_STATS_JSON                           = GLOBAL_CLI_STATS_JSON_DEFAULT;
 
     return;
 }
@@ -380,9 +499,9 @@ extern void Set_CLI_Parameter_To_Default_Values (void)
 #undef GLOBAL_RUN_ALL_TEST_FUNCTIONS_DEFAULT
 #endif /* GLOBAL_RUN_ALL_TEST_FUNCTIONS_DEFAULT */
 
-#ifdef GLOBAL_CLI_SHOW_TOO_LONG_TOKENS_DEFAULT
-#undef GLOBAL_CLI_SHOW_TOO_LONG_TOKENS_DEFAULT
-#endif /* GLOBAL_CLI_SHOW_TOO_LONG_TOKENS_DEFAULT */
+#ifdef GLOBAL_CLI_SHOW_LONG_TOKENS_DEFAULT
+#undef GLOBAL_CLI_SHOW_LONG_TOKENS_DEFAULT
+#endif /* GLOBAL_CLI_SHOW_LONG_TOKENS_DEFAULT */
 
 #ifdef GLOBAL_CLI_NO_PART_MATCHES_DEFAULT
 #undef GLOBAL_CLI_NO_PART_MATCHES_DEFAULT
@@ -411,3 +530,43 @@ extern void Set_CLI_Parameter_To_Default_Values (void)
 #ifdef GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON_DEFAULT
 #undef GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON_DEFAULT
 #endif /* GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON_DEFAULT */
+
+#ifdef GLOBAL_CLI_INVERTED_INDEX_DEFAULT
+#undef GLOBAL_CLI_INVERTED_INDEX_DEFAULT
+#endif /* GLOBAL_CLI_INVERTED_INDEX_DEFAULT */
+
+#ifdef GLOBAL_CLI_SORTED_MERGE_DEFAULT
+#undef GLOBAL_CLI_SORTED_MERGE_DEFAULT
+#endif /* GLOBAL_CLI_SORTED_MERGE_DEFAULT */
+
+#ifdef GLOBAL_CLI_DOC_MAJOR_DEFAULT
+#undef GLOBAL_CLI_DOC_MAJOR_DEFAULT
+#endif /* GLOBAL_CLI_DOC_MAJOR_DEFAULT */
+
+#ifdef GLOBAL_CLI_FREQUENCY_IDS_DEFAULT
+#undef GLOBAL_CLI_FREQUENCY_IDS_DEFAULT
+#endif /* GLOBAL_CLI_FREQUENCY_IDS_DEFAULT */
+
+#ifdef GLOBAL_CLI_THREADS_DEFAULT
+#undef GLOBAL_CLI_THREADS_DEFAULT
+#endif /* GLOBAL_CLI_THREADS_DEFAULT */
+
+#ifdef GLOBAL_CLI_KERNEL_DEFAULT
+#undef GLOBAL_CLI_KERNEL_DEFAULT
+#endif /* GLOBAL_CLI_KERNEL_DEFAULT */
+
+#ifdef GLOBAL_CLI_SAVE_VOCAB_DEFAULT
+#undef GLOBAL_CLI_SAVE_VOCAB_DEFAULT
+#endif /* GLOBAL_CLI_SAVE_VOCAB_DEFAULT */
+
+#ifdef GLOBAL_CLI_LOAD_VOCAB_DEFAULT
+#undef GLOBAL_CLI_LOAD_VOCAB_DEFAULT
+#endif /* GLOBAL_CLI_LOAD_VOCAB_DEFAULT */
+
+#ifdef GLOBAL_CLI_STATS_JSON_DEFAULT
+#undef GLOBAL_CLI_STATS_JSON_DEFAULT
+#endif /* GLOBAL_CLI_STATS_JSON_DEFAULT */
+
+#ifdef MAX_THREADS
+#undef MAX_THREADS
+#endif /* MAX_THREADS */
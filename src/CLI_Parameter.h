@@ -35,31 +35,58 @@ extern const char* GLOBAL_CLI_INPUT_FILE2; ///< Second input file
 
 extern const char* GLOBAL_CLI_OUTPUT_FILE; ///< Output file
 
-extern _Bool GLOBAL_CLI_FORMAT_OUTPUT; ///< Format the output ?
+// The flags of the OPT_BOOLEAN options are int and not _Bool, because argparse writes the value of an OPT_BOOLEAN
+// option as int
+extern int GLOBAL_CLI_FORMAT_OUTPUT; ///< Format the output ?
 
-extern _Bool GLOBAL_RUN_ALL_TEST_FUNCTIONS; ///< Run all test functions ?
+extern int GLOBAL_RUN_ALL_TEST_FUNCTIONS; ///< Run all test functions ?
 
-extern _Bool GLOBAL_CLI_SENTENCE_OFFSET; ///< Create sentence offsets in the calculation ?
+extern int GLOBAL_CLI_SENTENCE_OFFSET; ///< Create sentence offsets in the calculation ?
 
-extern _Bool GLOBAL_CLI_WORD_OFFSET; ///< Create word offsets in the calculation ?
+extern int GLOBAL_CLI_WORD_OFFSET; ///< Create word offsets in the calculation ?
 
-extern _Bool GLOBAL_CLI_SHOW_TOO_LONG_TOKENS; ///< Show too long tokens in the result file
+extern int GLOBAL_CLI_SHOW_LONG_TOKENS; ///< Show the long tokens (longer than MAX_TOKEN_LENGTH - 1 chars) in the result file
 
-extern _Bool GLOBAL_CLI_NO_PART_MATCHES; ///< Do not show part matches in the result file
+extern int GLOBAL_CLI_NO_PART_MATCHES; ///< Do not show part matches in the result file
 
-extern _Bool GLOBAL_CLI_NO_FULL_MATCHES; ///< Do not show full matches in the result file
+extern int GLOBAL_CLI_NO_FULL_MATCHES; ///< Do not show full matches in the result file
 
-extern _Bool GLOBAL_CLI_NO_TIMESTAMP; ///< Don't save the creation timestamp of the export file in the General JSON block
+extern int GLOBAL_CLI_NO_TIMESTAMP; ///< Don't save the creation timestamp of the export file in the General JSON block
 
-extern _Bool GLOBAL_CLI_NO_CPU_EXTENSIONS; ///< Don't use any CPU extensions, even there are available on the host
+extern int GLOBAL_CLI_NO_CPU_EXTENSIONS; ///< Don't use any CPU extensions, even there are available on the host
 
-extern _Bool GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON; ///< Do a case-insensitive token comparison ?
+extern int GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON; ///< Do a case-insensitive token comparison ?
 
 /**
  * @brief Shall be results with only one token written in the result file ? In normal cases such information are
  * useless.
  */
-extern _Bool GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN;
+extern int GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN;
+
+/**
+ * @brief Use posting lists (inverted index) of the first file to find the data sets with intersections, instead of
+ * comparing every data set of the second file with every data set of the first file ?
+ */
+extern int GLOBAL_CLI_INVERTED_INDEX;
+
+/**
+ * @brief Sort every data set once and intersect two data sets with a merge of the sorted tokens, instead of comparing
+ * every token with every other token ?
+ */
+extern int GLOBAL_CLI_SORTED_MERGE;
+
+/**
+ * @brief Index the data sets of the second file and read every data set of the first file only once to determine the
+ * candidates (doc-major mode), instead of visiting all data sets of the first file for every data set of the second
+ * file ?
+ */
+extern int GLOBAL_CLI_DOC_MAJOR;
+
+/**
+ * @brief Renumber the mapped tokens after the loading, so that the tokens with the highest document frequency get the
+ * smallest integers ?
+ */
+extern int GLOBAL_CLI_FREQUENCY_IDS;
 
 /**
  * @brief On which percent in the calculation should be aborted ? This is for development and debugging purposes useful
@@ -67,6 +94,41 @@ extern _Bool GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN;
  */
 extern float GLOBAL_ABORT_PROCESS_PERCENT;
 
+/**
+ * @brief Number of threads for the intersection calculation. The data sets of the second file will be distributed to
+ * the threads. The order in the result file is independent of this value.
+ *
+ * The same number of threads will be used for the construction of the token int mapping.
+ */
+extern int GLOBAL_CLI_THREADS;
+
+/**
+ * @brief Name of the intersection kernel, that will be used instead of the automatic selection with the CPUID results.
+ * (NULL or "auto": Automatic selection)
+ */
+extern const char* GLOBAL_CLI_KERNEL;
+
+/**
+ * @brief Save the token int mapping after the loading of both files as vocabulary snapshot in this file. (NULL: No
+ * snapshot)
+ */
+extern const char* GLOBAL_CLI_SAVE_VOCAB;
+
+/**
+ * @brief Start with the token int mapping of this vocabulary snapshot instead of an empty mapping. (NULL: No snapshot)
+ *
+ * The results are the same like without a snapshot: In the case-insensitive mode the first spelling of a token in this
+ * run replaces the spelling of the snapshot. This spelling is used in the result file and it determines the stop word
+ * flag (E.g. "II" is a stop word, "ii" is not).
+ */
+extern const char* GLOBAL_CLI_LOAD_VOCAB;
+
+/**
+ * @brief Save the statistics of the token int mapping (vocabulary, hash table quality and lookup times) as JSON in this
+ * file. (NULL: No statistics)
+ */
+extern const char* GLOBAL_CLI_STATS_JSON;
+
 
 
 /**
@@ -96,6 +158,16 @@ extern void Check_CLI_Parameter_CLI_OUTPUT_FILE (void);
  */
 extern void Check_CLI_Parameter_GLOBAL_ABORT_PROCESS_PERCENT (void);
 
+/**
+ * @brief Test function for the number of threads.
+ */
+extern void Check_CLI_Parameter_GLOBAL_CLI_THREADS (void);
+
+/**
+ * @brief Test function for the intersection kernel. The kernel will be selected in this function.
+ */
+extern void Check_CLI_Parameter_GLOBAL_CLI_KERNEL (void);
+
 /**
  * @brief Set all CLI parameter to the default values.
  *
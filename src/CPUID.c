@@ -186,9 +186,50 @@ extern _Bool CPUID_IsSSE4_1Available
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Check, whether the operating system saves the XMM and the YMM registers on a context switch.
+ *
+ * Without this support from the operating system every AVX instruction leads to a SIGILL, even if the CPU supports
+ * AVX. The check needs the OSXSAVE bit (The XGETBV instruction is only available with this bit) and the XMM and YMM
+ * state bits in the XCR0 register.
+ *
+ * @return true, if the XMM and YMM state is enabled by the operating system, otherwise false
+ */
+extern _Bool CPUID_IsAVXStateEnabledByOS
+(
+        void
+)
+{
+    volatile struct CPUID_Register input = { .eax = 1, .ebx = 0, .ecx = 0, .edx = 0 };
+    const volatile struct CPUID_Register result_register = CPUID_ExecWithGivenValues(input);
+
+    if (! (result_register.ecx & (1 << 27)))
+    {
+        return false;
+    }
+
+    volatile uint32_t xcr0_low = 0;
+    volatile uint32_t xcr0_high = 0;
+
+    __asm__ volatile
+    (
+            "xgetbv" NT
+
+            : "=a" (xcr0_low), "=d" (xcr0_high)
+            : "c" (0)
+            :
+    );
+
+    return (xcr0_low & 0x6) == 0x6;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 /**
  * @brief Get the bit, that shows whether the host CPU supports the AVX extension or not.
  *
+ * The result is only true, if the operating system enabled the AVX state, too. (See CPUID_IsAVXStateEnabledByOS())
+ *
  * @return true for AVX support, otherwise false
  */
 extern _Bool CPUID_IsAVXAvailable
@@ -199,7 +240,7 @@ extern _Bool CPUID_IsAVXAvailable
     volatile struct CPUID_Register input = { .eax = 1, .ebx = 0, .ecx = 0, .edx = 0 };
     const volatile struct CPUID_Register result_register = CPUID_ExecWithGivenValues(input);
 
-    return result_register.ecx & (1 << 28);
+    return (result_register.ecx & (1 << 28)) && CPUID_IsAVXStateEnabledByOS();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -207,6 +248,8 @@ extern _Bool CPUID_IsAVXAvailable
 /**
  * @brief Get the bit, that shows whether the host CPU supports the AVX2 extension or not.
  *
+ * The result is only true, if the operating system enabled the AVX state, too. (See CPUID_IsAVXStateEnabledByOS())
+ *
  * @return true for AVX2 support, otherwise false
  */
 extern _Bool CPUID_IsAVX2Available
@@ -217,7 +260,7 @@ extern _Bool CPUID_IsAVX2Available
     volatile struct CPUID_Register input = { .eax = 7, .ebx = 0, .ecx = 0, .edx = 0 };
     const volatile struct CPUID_Register result_register = CPUID_ExecWithGivenValues(input);
 
-    return result_register.ebx & (1 << 5);
+    return (result_register.ebx & (1 << 5)) && CPUID_IsAVXStateEnabledByOS();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -325,6 +368,17 @@ extern _Bool CPUID_IsSSE4_1Available
 
 //---------------------------------------------------------------------------------------------------------------------
 
+extern _Bool CPUID_IsAVXStateEnabledByOS
+(
+        void
+)
+{
+    ASSERT_MSG(false, ERR_MSG);
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 extern _Bool CPUID_IsAVXAvailable
 (
         void
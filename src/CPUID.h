@@ -109,9 +109,24 @@ extern _Bool CPUID_IsSSE4_1Available
         void
 );
 
+/**
+ * @brief Check, whether the operating system saves the XMM and the YMM registers on a context switch.
+ *
+ * Without this support from the operating system every AVX instruction leads to a SIGILL, even if the CPU supports
+ * AVX.
+ *
+ * @return true, if the XMM and YMM state is enabled by the operating system, otherwise false
+ */
+extern _Bool CPUID_IsAVXStateEnabledByOS
+(
+        void
+);
+
 /**
  * @brief Get the bit, that shows whether the host CPU supports the AVX extension or not.
  *
+ * The result is only true, if the operating system enabled the AVX state, too.
+ *
  * @return true for AVX support, otherwise false
  */
 extern _Bool CPUID_IsAVXAvailable
@@ -122,6 +137,8 @@ extern _Bool CPUID_IsAVXAvailable
 /**
  * @brief Get the bit, that shows whether the host CPU supports the AVX2 extension or not.
  *
+ * The result is only true, if the operating system enabled the AVX state, too.
+ *
  * @return true for AVX2 support, otherwise false
  */
 extern _Bool CPUID_IsAVX2Available
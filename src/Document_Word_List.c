@@ -38,8 +38,10 @@
  */
 #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
 _Static_assert(INT_ALLOCATION_STEP_SIZE > 0, "The marco \"INT_ALLOCATION_STEP_SIZE\" is zero !");
+_Static_assert(SIGNATURE_WORDS > 0, "The marco \"SIGNATURE_WORDS\" is zero !");
 
 IS_TYPE(INT_ALLOCATION_STEP_SIZE, int)
+IS_TYPE(SIGNATURE_WORDS, int)
 #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
 
 /**
@@ -247,7 +249,7 @@ DocumentWordList_DeleteObject
         free(object->data_struct.data [i]);
         // FREE_AND_SET_TO_NULL(object->data_struct.data [i]);
     }
-    GLOBAL_free_calls += object->number_of_arrays;
+    DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_free_calls, object->number_of_arrays);
     if (object->intersection_data)
     {
         for (uint_fast32_t i = 0; i < object->number_of_arrays; ++ i)
@@ -259,11 +261,11 @@ DocumentWordList_DeleteObject
             free(object->data_struct.word_offsets [i]);
             // FREE_AND_SET_TO_NULL(object->data_struct.word_offsets [i]);
         }
-        GLOBAL_free_calls += 3 * object->number_of_arrays;
+        DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_free_calls, 3 * object->number_of_arrays);
     }
     free(object->data_struct.data);
     // FREE_AND_SET_TO_NULL(object->data_struct.data);
-    ++ GLOBAL_free_calls;
+    DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_free_calls, 1);
 
     if (object->intersection_data)
     {
@@ -273,7 +275,13 @@ DocumentWordList_DeleteObject
         // FREE_AND_SET_TO_NULL(object->data_struct.sentence_offsets);
         free(object->data_struct.word_offsets);
         // FREE_AND_SET_TO_NULL(object->data_struct.word_offsets);
-        GLOBAL_free_calls += 3;
+        DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_free_calls, 3);
+    }
+
+    if (object->signatures != NULL)
+    {
+        free(object->signatures);
+        DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_free_calls, 1);
     }
 
     free(object->allocated_array_size);
@@ -282,7 +290,7 @@ DocumentWordList_DeleteObject
     // FREE_AND_SET_TO_NULL(object->arrays_lengths);
     free(object);
     // FREE_AND_SET_TO_NULL(object);
-    GLOBAL_free_calls += 3;
+    DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_free_calls, 3);
 
     return;
 }
@@ -445,6 +453,35 @@ DocumentWordList_AppendOneValueAsNewDataSet
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Add an empty data set to a Document_Word_List.
+ *
+ * The data set has no values. So the following data sets keep their indices (e.g. aligned with the dataset IDs of a
+ * Token_List_Container).
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Document_Word_List
+ */
+extern void
+DocumentWordList_AppendEmptyDataSet
+(
+        struct Document_Word_List* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Object is NULL !");
+    ASSERT_FMSG(object->number_of_arrays > (size_t) object->next_free_array, "All arrays are in use ! (%zu arrays)",
+            object->number_of_arrays);
+
+    object->arrays_lengths [object->next_free_array] = 0;
+    object->next_free_array ++;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 /**
  * @brief Put one value to a Document_Word_List.
  *
@@ -588,6 +625,10 @@ DocumentWordList_GetAllocatedMemSize
     }
     result += sizeof (struct Document_Word_List);
     result += object->number_of_arrays * sizeof (uint_fast32_t*);
+    if (object->signatures != NULL)
+    {
+        result += object->next_free_array * SIGNATURE_WORDS * sizeof (uint64_t);
+    }
 
     return result;
 }
@@ -730,6 +771,220 @@ DocumentWordList_IntersectWithData
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Add the document frequency of every token to the given counter array.
+ *
+ * The document frequency is the number of data sets, that contain the token. A token, that occurs multiple times in a
+ * data set, will be counted only once for this data set.
+ *
+ * Asserts:
+ *      object != NULL
+ *      document_frequencies != NULL
+ *      Every token < number_of_tokens
+ *
+ * @param[in] object Document_Word_List
+ * @param[in, out] document_frequencies Counter array (Needs number_of_tokens elements)
+ * @param[in] number_of_tokens Number of different tokens (Every token needs to be smaller than this value)
+ */
+extern void
+DocumentWordList_CountDocumentFrequencies
+(
+        const struct Document_Word_List* const restrict object,
+        size_t* const restrict document_frequencies,
+        const size_t number_of_tokens
+)
+{
+    ASSERT_MSG(object != NULL, "Object is NULL !");
+    ASSERT_MSG(document_frequencies != NULL, "Document frequency array is NULL !");
+
+    // Last data set (+ 1), in which the token was counted. So every token will be counted only once per data set
+    const size_t counter_length = (number_of_tokens > 0) ? number_of_tokens : 1;
+    uint_fast32_t* last_counted_data_set = (uint_fast32_t*) CALLOC(counter_length, sizeof (uint_fast32_t));
+    ASSERT_ALLOC(last_counted_data_set, "Cannot allocate memory for the document frequency calculation !",
+            counter_length * sizeof (uint_fast32_t));
+
+    for (uint_fast32_t i = 0; i < object->next_free_array; ++ i)
+    {
+        for (size_t i2 = 0; i2 < object->arrays_lengths [i]; ++ i2)
+        {
+            const DATA_TYPE token = object->data_struct.data [i][i2];
+            ASSERT_FMSG((size_t) token < number_of_tokens, "Token %" PRIuFAST32 " is out of range !",
+                    (uint_fast32_t) token);
+
+            if (last_counted_data_set [token] != i + 1)
+            {
+                last_counted_data_set [token] = i + 1;
+                ++ document_frequencies [token];
+            }
+        }
+    }
+    FREE_AND_SET_TO_NULL(last_counted_data_set);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Replace every token in the data sets with the value from a remap table. (token -> remap_table [token])
+ *
+ * The signatures need to be recreated after this call.
+ *
+ * Asserts:
+ *      object != NULL
+ *      remap_table != NULL
+ *      Every token < remap_table_length
+ *
+ * @param[in] object Document_Word_List
+ * @param[in] remap_table New value for every token
+ * @param[in] remap_table_length Number of elements in the remap table
+ */
+extern void
+DocumentWordList_RemapData
+(
+        struct Document_Word_List* const restrict object,
+        const DATA_TYPE* const restrict remap_table,
+        const size_t remap_table_length
+)
+{
+    ASSERT_MSG(object != NULL, "Object is NULL !");
+    ASSERT_MSG(remap_table != NULL, "Remap table is NULL !");
+
+    for (uint_fast32_t i = 0; i < object->next_free_array; ++ i)
+    {
+        for (size_t i2 = 0; i2 < object->arrays_lengths [i]; ++ i2)
+        {
+            const DATA_TYPE token = object->data_struct.data [i][i2];
+            ASSERT_FMSG((size_t) token < remap_table_length, "Token %" PRIuFAST32 " is out of range !",
+                    (uint_fast32_t) token);
+
+            object->data_struct.data [i][i2] = remap_table [token];
+        }
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create the token signature of every used data set.
+ *
+ * Tokens, for which the optional ignore function returns true, will not be added to the signatures. (E.g. stop words,
+ * that are never a valid intersection token) Then a false result of DocumentWordList_SignaturesIntersect() means, that
+ * the data sets have no common token, that is not ignored.
+ *
+ * The signatures need to be recreated, when data was changed after this call.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Document_Word_List
+ * @param[in] ignore_token Optional function, that decides whether a token will be ignored (NULL: no token is ignored)
+ * @param[in] ignore_token_data Optional parameter for the ignore function
+ */
+extern void
+DocumentWordList_CreateSignatures
+(
+        struct Document_Word_List* const object,
+        _Bool (*ignore_token)
+        (
+                const DATA_TYPE token,
+                const void* data
+        ),
+        const void* ignore_token_data
+)
+{
+    ASSERT_MSG(object != NULL, "Object is NULL !");
+
+    const size_t number_of_data_sets = MAX_WITH_TYPE_CHECK((size_t) object->next_free_array, (size_t) 1);
+    const size_t number_of_words = number_of_data_sets * SIGNATURE_WORDS;
+
+    if (object->signatures == NULL)
+    {
+        object->signatures = (uint64_t*) CALLOC(number_of_words, sizeof (uint64_t));
+        ASSERT_ALLOC(object->signatures, "Cannot create the token signatures !", number_of_words * sizeof (uint64_t));
+        ++ object->malloc_calloc_calls;
+    }
+    else
+    {
+        uint64_t* tmp_ptr = (uint64_t*) REALLOC(object->signatures, number_of_words * sizeof (uint64_t));
+        ASSERT_ALLOC(tmp_ptr, "Cannot reallocate the token signatures !", number_of_words * sizeof (uint64_t));
+        object->signatures = tmp_ptr;
+        memset(object->signatures, '\0', number_of_words * sizeof (uint64_t));
+        ++ object->realloc_calls;
+    }
+
+    for (uint_fast32_t i = 0; i < object->next_free_array; ++ i)
+    {
+        uint64_t* const signature = object->signatures + (i * SIGNATURE_WORDS);
+        for (size_t i2 = 0; i2 < object->arrays_lengths [i]; ++ i2)
+        {
+            if (ignore_token != NULL && ignore_token(object->data_struct.data [i][i2], ignore_token_data)) { continue; }
+
+            // Multiplicative hashing (the upper bits of the product are well mixed, also for consecutive tokens)
+            // followed by a range reduction to the number of bits in a signature
+            const uint32_t hash = (uint32_t) object->data_struct.data [i][i2] * UINT32_C(2654435761);
+            const size_t bit = (size_t) (((uint64_t) hash * (SIGNATURE_WORDS * 64)) >> 32);
+            signature [bit >> 6] |= UINT64_C(1) << (bit & 63);
+        }
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Can two data sets have a common token ? (Check with the token signatures)
+ *
+ * A false result is always correct. A true result is only a hint, because more than one token can set the same bit.
+ *
+ * Asserts:
+ *      object_1 != NULL
+ *      object_1->signatures != NULL
+ *      data_set_index_1 < object_1->next_free_array
+ *      object_2 != NULL
+ *      object_2->signatures != NULL
+ *      data_set_index_2 < object_2->next_free_array
+ *
+ * @param[in] object_1 First Document_Word_List
+ * @param[in] data_set_index_1 Index of the data set in the first object
+ * @param[in] object_2 Second Document_Word_List
+ * @param[in] data_set_index_2 Index of the data set in the second object
+ *
+ * @return false, if the data sets have no common token, otherwise true
+ */
+extern _Bool
+DocumentWordList_SignaturesIntersect
+(
+        const struct Document_Word_List* const restrict object_1,
+        const uint_fast32_t data_set_index_1,
+        const struct Document_Word_List* const restrict object_2,
+        const uint_fast32_t data_set_index_2
+)
+{
+    ASSERT_MSG(object_1 != NULL, "Object 1 is NULL !");
+    ASSERT_MSG(object_1->signatures != NULL, "Object 1 has no signatures !");
+    ASSERT_MSG(data_set_index_1 < object_1->next_free_array, "Data set index 1 is too large !");
+    ASSERT_MSG(object_2 != NULL, "Object 2 is NULL !");
+    ASSERT_MSG(object_2->signatures != NULL, "Object 2 has no signatures !");
+    ASSERT_MSG(data_set_index_2 < object_2->next_free_array, "Data set index 2 is too large !");
+
+    const uint64_t* const signature_1 = object_1->signatures + (data_set_index_1 * SIGNATURE_WORDS);
+    const uint64_t* const signature_2 = object_2->signatures + (data_set_index_2 * SIGNATURE_WORDS);
+
+    uint64_t common_bits = 0;
+    for (size_t i = 0; i < SIGNATURE_WORDS; ++ i)
+    {
+        common_bits |= signature_1 [i] & signature_2 [i];
+    }
+
+    return common_bits != 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 /**
  * @brief Is there data in a Document_Word_List?
  *
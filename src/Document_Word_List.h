@@ -27,6 +27,15 @@ extern "C"
 
 
 
+/**
+ * @brief Number of 64 bit words in the token signature of a data set. (8 words -> 512 bit)
+ */
+#ifndef SIGNATURE_WORDS
+#define SIGNATURE_WORDS 8
+#else
+#error "The macro \"SIGNATURE_WORDS\" is already defined !"
+#endif /* SIGNATURE_WORDS */
+
 //=====================================================================================================================
 
 enum Intersection_Mode
@@ -53,6 +62,15 @@ struct Document_Word_List
     size_t max_array_length;        ///< Max length of all data arrays
     size_t number_of_arrays;        ///< Number of arrays
 
+    /**
+     * @brief Token signature of every data set (Bloom filter like bitmap; NULL, if not created).
+     *
+     * The signature of the data set i are the SIGNATURE_WORDS words beginning at signatures [i * SIGNATURE_WORDS].
+     * Every token sets one bit. When the signatures of two data sets have no common bit, then the data sets cannot
+     * have a common token.
+     */
+    uint64_t* signatures;
+
     size_t malloc_calloc_calls;     ///< How many malloc / calloc calls were done with this object ?
     size_t realloc_calls;           ///< How many realloc calls were done with this object ?
 
@@ -224,6 +242,23 @@ DocumentWordList_AppendOneValueAsNewDataSet
         const DATA_TYPE new_value
 );
 
+/**
+ * @brief Add an empty data set to a Document_Word_List.
+ *
+ * The data set has no values. So the following data sets keep their indices (e.g. aligned with the dataset IDs of a
+ * Token_List_Container).
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Document_Word_List
+ */
+extern void
+DocumentWordList_AppendEmptyDataSet
+(
+        struct Document_Word_List* const object
+);
+
 /**
  * @brief Put one value to a Document_Word_List.
  *
@@ -366,6 +401,108 @@ DocumentWordList_IntersectWithData
         const enum Intersection_Mode mode
 );
 
+/**
+ * @brief Add the document frequency of every token to the given counter array.
+ *
+ * The document frequency is the number of data sets, that contain the token. A token, that occurs multiple times in a
+ * data set, will be counted only once for this data set.
+ *
+ * Asserts:
+ *      object != NULL
+ *      document_frequencies != NULL
+ *      Every token < number_of_tokens
+ *
+ * @param[in] object Document_Word_List
+ * @param[in, out] document_frequencies Counter array (Needs number_of_tokens elements)
+ * @param[in] number_of_tokens Number of different tokens (Every token needs to be smaller than this value)
+ */
+extern void
+DocumentWordList_CountDocumentFrequencies
+(
+        const struct Document_Word_List* const restrict object,
+        size_t* const restrict document_frequencies,
+        const size_t number_of_tokens
+);
+
+/**
+ * @brief Replace every token in the data sets with the value from a remap table. (token -> remap_table [token])
+ *
+ * The signatures need to be recreated after this call.
+ *
+ * Asserts:
+ *      object != NULL
+ *      remap_table != NULL
+ *      Every token < remap_table_length
+ *
+ * @param[in] object Document_Word_List
+ * @param[in] remap_table New value for every token
+ * @param[in] remap_table_length Number of elements in the remap table
+ */
+extern void
+DocumentWordList_RemapData
+(
+        struct Document_Word_List* const restrict object,
+        const DATA_TYPE* const restrict remap_table,
+        const size_t remap_table_length
+);
+
+/**
+ * @brief Create the token signature of every used data set.
+ *
+ * Tokens, for which the optional ignore function returns true, will not be added to the signatures. (E.g. stop words,
+ * that are never a valid intersection token) Then a false result of DocumentWordList_SignaturesIntersect() means, that
+ * the data sets have no common token, that is not ignored.
+ *
+ * The signatures need to be recreated, when data was changed after this call.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Document_Word_List
+ * @param[in] ignore_token Optional function, that decides whether a token will be ignored (NULL: no token is ignored)
+ * @param[in] ignore_token_data Optional parameter for the ignore function
+ */
+extern void
+DocumentWordList_CreateSignatures
+(
+        struct Document_Word_List* const object,
+        _Bool (*ignore_token)
+        (
+                const DATA_TYPE token,
+                const void* data
+        ),
+        const void* ignore_token_data
+);
+
+/**
+ * @brief Can two data sets have a common token ? (Check with the token signatures)
+ *
+ * A false result is always correct. A true result is only a hint, because more than one token can set the same bit.
+ *
+ * Asserts:
+ *      object_1 != NULL
+ *      object_1->signatures != NULL
+ *      data_set_index_1 < object_1->next_free_array
+ *      object_2 != NULL
+ *      object_2->signatures != NULL
+ *      data_set_index_2 < object_2->next_free_array
+ *
+ * @param[in] object_1 First Document_Word_List
+ * @param[in] data_set_index_1 Index of the data set in the first object
+ * @param[in] object_2 Second Document_Word_List
+ * @param[in] data_set_index_2 Index of the data set in the second object
+ *
+ * @return false, if the data sets have no common token, otherwise true
+ */
+extern _Bool
+DocumentWordList_SignaturesIntersect
+(
+        const struct Document_Word_List* const restrict object_1,
+        const uint_fast32_t data_set_index_1,
+        const struct Document_Word_List* const restrict object_2,
+        const uint_fast32_t data_set_index_2
+);
+
 /**
  * @brief Is there data in a Document_Word_List?
  *
@@ -29,11 +29,40 @@ extern "C"
 #include "Assert_Msg.h"
 
 
+/**
+ * @brief Type of the counter variables.
+ *
+ * The intersection calculation can use the macros from more than one thread, so the counters need atomic updates.
+ * C99 does not know _Atomic; there the GCC builtin __atomic_fetch_add() will be used (-> DYNAMIC_MEMORY_COUNTER_ADD).
+ */
+#ifndef DYNAMIC_MEMORY_COUNTER_TYPE
+    #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && ! defined(__STDC_NO_ATOMICS__)
+        #define DYNAMIC_MEMORY_COUNTER_TYPE _Atomic uint_fast64_t
+    #else
+        #define DYNAMIC_MEMORY_COUNTER_TYPE uint_fast64_t
+    #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && ! defined(__STDC_NO_ATOMICS__) */
+#else
+    #error "The macro \"DYNAMIC_MEMORY_COUNTER_TYPE\" is already defined !"
+#endif /* DYNAMIC_MEMORY_COUNTER_TYPE */
+
+/**
+ * @brief Increase a counter variable atomically.
+ */
+#ifndef DYNAMIC_MEMORY_COUNTER_ADD
+    #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && ! defined(__STDC_NO_ATOMICS__)
+        #define DYNAMIC_MEMORY_COUNTER_ADD(counter, value) (counter) += (value)
+    #else
+        #define DYNAMIC_MEMORY_COUNTER_ADD(counter, value) __atomic_fetch_add(&(counter), (value), __ATOMIC_RELAXED)
+    #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && ! defined(__STDC_NO_ATOMICS__) */
+#else
+    #error "The macro \"DYNAMIC_MEMORY_COUNTER_ADD\" is already defined !"
+#endif /* DYNAMIC_MEMORY_COUNTER_ADD */
+
 // Global variables to count the malloc (), calloc (), realloc () and free () calls
-extern uint_fast64_t GLOBAL_malloc_calls;   ///< Number of executed malloc calls
-extern uint_fast64_t GLOBAL_calloc_calls;   ///< Number of executed calloc calls
-extern uint_fast64_t GLOBAL_realloc_calls;  ///< Number of executed realloc calls
-extern uint_fast64_t GLOBAL_free_calls;     ///< Number of executed free calls
+extern DYNAMIC_MEMORY_COUNTER_TYPE GLOBAL_malloc_calls;     ///< Number of executed malloc calls
+extern DYNAMIC_MEMORY_COUNTER_TYPE GLOBAL_calloc_calls;     ///< Number of executed calloc calls
+extern DYNAMIC_MEMORY_COUNTER_TYPE GLOBAL_realloc_calls;    ///< Number of executed realloc calls
+extern DYNAMIC_MEMORY_COUNTER_TYPE GLOBAL_free_calls;       ///< Number of executed free calls
 
 
 
@@ -63,7 +92,7 @@ extern int_fast64_t Missing_Free_Calls (void);
 #ifndef MALLOC
     #define MALLOC(memory_size)                                                                                         \
         malloc (memory_size);                                                                                           \
-        ++ GLOBAL_malloc_calls;                                                                                         \
+        DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_malloc_calls, 1);                                                             \
         IS_INT(memory_size)
 #else
     #error "The macro \"MALLOC\" is already defined !"
@@ -77,7 +106,7 @@ extern int_fast64_t Missing_Free_Calls (void);
 #ifndef CALLOC
     #define CALLOC(number_of_elements, element_size)                                                                    \
         calloc (number_of_elements, element_size);                                                                      \
-        ++ GLOBAL_calloc_calls;                                                                                         \
+        DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_calloc_calls, 1);                                                             \
         IS_INT(number_of_elements)                                                                                      \
         IS_INT(element_size)
 #else
@@ -97,11 +126,11 @@ extern int_fast64_t Missing_Free_Calls (void);
 #ifndef REALLOC
     #define REALLOC(pointer, element_size)                                                                              \
         realloc (pointer, element_size);                                                                                \
-        ++ GLOBAL_malloc_calls;                                                                                         \
+        DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_malloc_calls, 1);                                                             \
         if (pointer != NULL)                                                                                            \
         {                                                                                                               \
-            ++ GLOBAL_realloc_calls;                                                                                    \
-            ++ GLOBAL_free_calls;                                                                                       \
+            DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_realloc_calls, 1);                                                        \
+            DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_free_calls, 1);                                                           \
         }                                                                                                               \
         IS_INT(element_size)
 #else
@@ -123,7 +152,7 @@ extern int_fast64_t Missing_Free_Calls (void);
         {                                                                                                               \
             free (pointer);                                                                                             \
             pointer = NULL;                                                                                             \
-            ++ GLOBAL_free_calls;                                                                                       \
+            DYNAMIC_MEMORY_COUNTER_ADD(GLOBAL_free_calls, 1);                                                           \
         }
 #else
     #error "The macro \"FREE_AND_SET_TO_NULL\" is already defined !"
@@ -38,7 +38,13 @@ enum Exec_Config_Types
     NO_CREATION_TIME            = 1 << 10,  ///< Don't show the creation time in the general info block.
     NO_PROGRAM_VERSION          = 1 << 11,  ///< Don't show the program version in the general info block.
     KEEP_SINGLE_TOKEN_RESULTS   = 1 << 12,  ///< Keep results with only one token
-    SHOW_TOO_LONG_TOKENS        = 1 << 13   ///< Show and save too long tokens in the result file
+    SHOW_LONG_TOKENS            = 1 << 13,  ///< Show and save the long tokens in the result file
+
+    // Calculation settings
+    INVERTED_INDEX              = 1 << 14,  ///< Use posting lists to find the data sets with intersections
+    SORTED_MERGE                = 1 << 15,  ///< Intersect the data sets with a merge of the sorted data sets
+    DOC_MAJOR                   = 1 << 16,  ///< Determine the candidates with one pass over the data sets of the first file
+    FULL_MATCH_ONLY             = 1 << 17   ///< Determine only full match candidates (rarest token first)
 };
 
 /**
@@ -129,11 +135,36 @@ enum Exec_Config_Types
 #error "The macro \"KEEP_SINGLE_TOKEN_RESULTS_BIT\" is already defined !"
 #endif /* KEEP_SINGLE_TOKEN_RESULTS_BIT */
 
-#ifndef SHOW_TOO_LONG_TOKENS_BIT
-#define SHOW_TOO_LONG_TOKENS_BIT(input) ((input) & SHOW_TOO_LONG_TOKENS) ///< Is SHOW_TOO_LONG_TOKENS bit set ?
+#ifndef SHOW_LONG_TOKENS_BIT
+#define SHOW_LONG_TOKENS_BIT(input) ((input) & SHOW_LONG_TOKENS) ///< Is SHOW_LONG_TOKENS bit set ?
+#else
+#error "The macro \"SHOW_LONG_TOKENS_BIT\" is already defined !"
+#endif /* SHOW_LONG_TOKENS_BIT */
+
+// > Calculation settings <
+#ifndef INVERTED_INDEX_BIT
+#define INVERTED_INDEX_BIT(input) ((input) & INVERTED_INDEX) ///< Is INVERTED_INDEX bit set ?
+#else
+#error "The macro \"INVERTED_INDEX_BIT\" is already defined !"
+#endif /* INVERTED_INDEX_BIT */
+
+#ifndef SORTED_MERGE_BIT
+#define SORTED_MERGE_BIT(input) ((input) & SORTED_MERGE) ///< Is SORTED_MERGE bit set ?
+#else
+#error "The macro \"SORTED_MERGE_BIT\" is already defined !"
+#endif /* SORTED_MERGE_BIT */
+
+#ifndef DOC_MAJOR_BIT
+#define DOC_MAJOR_BIT(input) ((input) & DOC_MAJOR) ///< Is DOC_MAJOR bit set ?
+#else
+#error "The macro \"DOC_MAJOR_BIT\" is already defined !"
+#endif /* DOC_MAJOR_BIT */
+
+#ifndef FULL_MATCH_ONLY_BIT
+#define FULL_MATCH_ONLY_BIT(input) ((input) & FULL_MATCH_ONLY) ///< Is FULL_MATCH_ONLY bit set ?
 #else
-#error "The macro \"SHOW_TOO_LONG_TOKENS_BIT\" is already defined !"
-#endif /* SHOW_TOO_LONG_TOKENS_BIT */
+#error "The macro \"FULL_MATCH_ONLY_BIT\" is already defined !"
+#endif /* FULL_MATCH_ONLY_BIT */
 
 
 
@@ -12,11 +12,15 @@
 #include <time.h>
 #include <math.h>
 #include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include "CLI_Parameter.h"
 #include "File_Reader.h"
 #include "Token_Int_Mapping.h"
 #include "Document_Word_List.h"
 #include "Intersection_Approaches.h"
+#include "Inverted_Index.h"
+#include "Sorted_Data_Sets.h"
 #include "Misc.h"
 #include "Defines.h"
 #include "Error_Handling/Dynamic_Memory.h"
@@ -123,14 +127,25 @@
 #error "The macro \"IN_STOP_WORD_LIST\" is already defined !"
 #endif /* IN_STOP_WORD_LIST */
 
+/**
+ * @brief Number of data sets of the second file per thread in one batch of the multi threaded calculation.
+ */
+#ifndef DATA_SETS_PER_THREAD_AND_BATCH
+#define DATA_SETS_PER_THREAD_AND_BATCH 64
+#else
+#error "The macro \"DATA_SETS_PER_THREAD_AND_BATCH\" is already defined !"
+#endif /* DATA_SETS_PER_THREAD_AND_BATCH */
+
 #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
 _Static_assert(CJSON_PRINT_BUFFER_SIZE > 0, "The macro \"CJSON_PRINT_BUFFER_SIZE\" needs to be at least 1 !");
 _Static_assert(RESULT_FILE_BUFFER_SIZE > 0, "The macro \"RESULT_FILE_BUFFER_SIZE\" needs to be at least 1 !");
 _Static_assert(IN_STOP_WORD_LIST > 0, "The macro \"IN_STOP_WORD_LIST\" needs to be at least 1 !");
+_Static_assert(DATA_SETS_PER_THREAD_AND_BATCH > 0, "The macro \"DATA_SETS_PER_THREAD_AND_BATCH\" needs to be at least 1 !");
 
 IS_TYPE(CJSON_PRINT_BUFFER_SIZE, int)
 IS_TYPE(RESULT_FILE_BUFFER_SIZE, int)
 IS_TYPE(IN_STOP_WORD_LIST, DATA_TYPE)
+IS_TYPE(DATA_SETS_PER_THREAD_AND_BATCH, int)
 #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
 
 
@@ -160,6 +175,82 @@ IS_CONST_STR(INTERSECTIONS)
 
 
 
+/**
+ * @brief Data, that all intersection workers use. After the creation the data will be only read.
+ */
+struct Intersection_Shared_Data
+{
+    const struct Token_List_Container* token_container_input_1; ///< Tokens of the first file
+    const struct Token_List_Container* token_container_input_2; ///< Tokens of the second file
+    const struct Document_Word_List* source_int_values_1;       ///< Mapped tokens of the first file
+    const struct Document_Word_List* source_int_values_2;       ///< Mapped tokens of the second file
+    const struct Token_Int_Mapping* token_int_mapping;          ///< Used token int mapping
+    const struct Sorted_Data_Sets* sorted_data_sets_1;          ///< Sorted data sets of the first file (or NULL)
+    const struct Sorted_Data_Sets* sorted_data_sets_2;          ///< Sorted data sets of the second file (or NULL)
+    const struct Inverted_Index_Candidate_Lists* doc_major_candidates; ///< Candidates of the doc-major mode (or NULL)
+    unsigned int intersection_settings;                         ///< Settings for the intersection process
+    size_t min_token_left_for_valid_data_set;                   ///< Min. number of tokens for a valid data set
+    _Bool scalar_kernel_order;                                  ///< Create the results of the engines in the order of
+                                                                ///< the kernel without CPU extensions ?
+};
+
+/**
+ * @brief Data sets of the second file, that will be calculated from the threads before the results will be written.
+ *
+ * The threads will be created once for all batches. Between two batches they wait at the barriers.
+ */
+struct Intersection_Batch
+{
+    atomic_uint_fast32_t next_data_set; ///< Next data set, that is not taken by a thread
+    uint_fast32_t begin;                ///< First data set of the batch
+    uint_fast32_t end;                  ///< End of the batch (exclusive)
+    char** export_strings;              ///< JSON strings of the data sets (Index: data set - begin)
+    _Bool finished;                     ///< Are all batches done ? (-> The threads will be terminated)
+    pthread_barrier_t begin_barrier;    ///< All threads start the calculation of the next batch
+    pthread_barrier_t end_barrier;      ///< All threads finished the calculation of the current batch
+};
+
+/**
+ * @brief Temporary memory and counter of one thread in the intersection calculation.
+ */
+struct Intersection_Worker
+{
+    const struct Intersection_Shared_Data* shared;      ///< Data, that all workers use
+    struct Document_Word_List* intersection_result;     ///< Result object for temporary result data
+    struct Inverted_Index* inverted_index;              ///< Own object for the posting lists (NULL, if not used)
+    _Bool* stop_word_flags;                             ///< Stop word flag of every token in the current data set
+    uint32_t* merge_matches;                            ///< Match memory for the sorted merge (NULL, if not used)
+    struct Intersection_Guards* intersection_guards;    ///< Duplicate guards for the intersection kernel
+
+    size_t cJSON_mem_counter;                           ///< Memory usage of the created cJSON objects
+    uint_fast64_t counter_partial_sets;                 ///< Number of sets with partial matches
+    uint_fast64_t counter_full_sets;                    ///< Number of sets with full matches
+    uint_fast64_t counter_tokens_in_partial_sets;       ///< Sum of all tokens in all partial matches
+    uint_fast64_t counter_tokens_in_full_sets;          ///< Sum of all tokens in all full matches
+    uint_fast64_t counter_prefilter_checks;             ///< Number of signature checks before a intersection
+    uint_fast64_t counter_prefilter_rejections;         ///< Number of intersections skipped by the signature check
+
+    struct Intersection_Batch* batch;                   ///< Current batch (only in the multi threaded calculation)
+    pthread_t thread;                                   ///< Thread of the worker
+};
+
+/**
+ * @brief Progress information of the single threaded calculation.
+ */
+struct Intersection_Progress
+{
+    size_t intersection_calls_before_last_output;       ///< How many calls were done since the last process print ?
+    size_t intersection_call_counter;                   ///< Counter of all calls since the execution was started
+    uint_fast32_t number_of_intersection_calls;         ///< Number of all intersection calls
+    uint_fast32_t print_steps;                          ///< Calls between two process prints
+    size_t* result_file_size;                           ///< Current size of the result file
+    float abort_progress_percent;                       ///< After this progress value the process will be stopped
+    _Bool abort_progress_percent_given;                 ///< Is the abort percent value valid ?
+    _Bool aborted;                                      ///< Was the calculation stopped ?
+};
+
+
+
 /**
  * @brief Add general information to the export cJSON object.
  *
@@ -214,7 +305,27 @@ Add_Counter_To_Export_File
 );
 
 /**
- * @brief Add too long tokens from the two input file to a JSON block. (One array for each file)
+ * @brief Save the statistics of the token int mapping (vocabulary, hash table quality and the work of the calls) as
+ * JSON file.
+ *
+ * Asserts:
+ *      token_int_mapping != NULL
+ *      file_name != NULL
+ *      The file can be written
+ *
+ * @param[in] token_int_mapping Token_Int_Mapping object
+ * @param[in] file_name Name of the JSON file
+ */
+static void
+Export_Token_Int_Mapping_Statistics
+(
+        const struct Token_Int_Mapping* const restrict token_int_mapping,
+        const char* const restrict file_name
+);
+
+/**
+ * @brief Add the long tokens (longer than MAX_TOKEN_LENGTH - 1 chars) from the two input file to a JSON block. (One
+ * array for each file)
  *
  * Asserts:
  *      export_results != NULL
@@ -226,7 +337,7 @@ Add_Counter_To_Export_File
  * @param token_container_input_2 Token_List_Container of the first file
  */
 static void
-Add_Too_Long_Tokens_To_Export_File
+Add_Long_Tokens_To_Export_File
 (
         cJSON* const export_results,
         const struct Token_List_Container* const restrict token_container_input_1,
@@ -255,72 +366,27 @@ Append_cJSON_Object_To_Result_File
 );
 
 /**
- * @brief Append the data from a Token_List_Container object (-> data from a input file) to the Token_Int_Mapping.
- *
- * Asserts:
- *      token_list_container != NULL
- *      token_int_mapping != NULL
- *
- * @param token_list_container Token_List_Container object (information from a input file)
- * @param token_int_mapping Token_Int_Mapping
- *
- * @return Number of token that were added to the Token_Int_Mapping
- */
-static uint_fast32_t
-Append_Token_List_Container_Data_To_Token_Int_Mapping
-(
-        const struct Token_List_Container* const token_list_container,
-        struct Token_Int_Mapping* const restrict token_int_mapping
-);
-
-/**
- * @brief This function fills the Document_Word_List with data. But this data are the mapped integer values. The mapping
- * information will be uses from the given Token_Int_Mapping.
+ * @brief Fill the Document_Word_List with the mapped integers and the offsets of a Token_List_Container, that was
+ * created with the direct-to-id ingestion.
  *
- * This will prepare the Document_Word_List for the intersection process.
+ * The tokens were already interned while parsing the input file. So only the mapped integers and the offsets need to
+ * be copied. This will prepare the Document_Word_List for the intersection process.
  *
  * Asserts:
- *      token_int_mapping != NULL
  *      token_list_container != NULL
+ *      token_list_container->token_int_mapping != NULL
  *      document_word_list != NULL
  *
- * @param token_int_mapping Token_Int_Mapping object (contains the used mapping information)
- * @param token_list_container Token_List_Container object (contains tokens from a input file)
+ * @param token_list_container Token_List_Container object (contains the mapped tokens from a input file)
  * @param document_word_list Document_Word_List object (result object for the mapped data)
  */
 static void
-Append_Token_Int_Mapping_Data_To_Document_Word_List
+Append_Mapped_Token_List_Container_To_Document_Word_List
 (
-        const struct Token_Int_Mapping* const restrict token_int_mapping,
         const struct Token_List_Container* const restrict token_list_container,
         struct Document_Word_List* const restrict document_word_list
 );
 
-/**
- * @brief A function, that will be used to show the token int mapping process.
- *
- * The time calculation is a approximate time calculation with time interval information. If the calculation is not
- * linear (this is the normal case), then the calculated time will be in- and decrease while doing the operations.
- *
- * Asserts:
- *      N/A
- *
- * @param print_step_size Number of inner loop calls, that needs to be done, for a new process print
- * @param actual Counter since last process print
- * @param hundred_percent The number of all inner loop calls (see the intersection code)
- * @param interval_begin clock_t value at the begin of the last process print
- * @param interval_end clock_t value since the last process print
- */
-static void
-Exec_Add_Token_To_Mapping_Process_Print_Function
-(
-        const size_t print_step_size,
-        const size_t actual,
-        const size_t hundred_percent,
-        const clock_t interval_begin,
-        const clock_t interval_end
-);
-
 /**
  * @brief A function, that will be used to show the intersection calculation process.
  *
@@ -428,6 +494,147 @@ Print_Counter
         const unsigned int intersection_settings
 );
 
+/**
+ * @brief Is a mapped token a stop word ? (Ignore function for DocumentWordList_CreateSignatures())
+ *
+ * Asserts:
+ *      data != NULL
+ *
+ * @param[in] token Mapped token
+ * @param[in] data Used token int mapping (const struct Token_Int_Mapping*)
+ *
+ * @return true, if the token is a stop word, otherwise false
+ */
+static _Bool
+Is_Stop_Word_Token
+(
+        const DATA_TYPE token,
+        const void* data
+);
+
+/**
+ * @brief Create the temporary memory of a intersection worker.
+ *
+ * Asserts:
+ *      worker != NULL
+ *      shared_data != NULL
+ *      max_data_set_length > 0
+ *
+ * @param[out] worker Worker, that will be initialized
+ * @param[in] shared_data Data, that all workers use
+ * @param[in] inverted_index Inverted_Index of the first file (NULL, if it will not be used)
+ * @param[in] max_data_set_length Length of the longest data set in both files
+ */
+static void
+Create_Intersection_Worker
+(
+        struct Intersection_Worker* const restrict worker,
+        const struct Intersection_Shared_Data* const restrict shared_data,
+        const struct Inverted_Index* const restrict inverted_index,
+        const size_t max_data_set_length
+);
+
+/**
+ * @brief Delete the temporary memory of a intersection worker.
+ *
+ * Asserts:
+ *      worker != NULL
+ *
+ * @param[in] worker Worker
+ */
+static void
+Delete_Intersection_Worker
+(
+        struct Intersection_Worker* const worker
+);
+
+/**
+ * @brief Calculate the intersections between one data set of the second file and all data sets of the first file.
+ *
+ * The result is the JSON string (cJSON_PrintBuffered()) of the data set with all intersections. The counter of the
+ * worker will be updated.
+ *
+ * If progress information is given, the progress will be printed and the abort percent value will be checked in the
+ * inner loop. This is only possible in the single threaded calculation.
+ *
+ * Asserts:
+ *      worker != NULL
+ *
+ * @param[in] worker Worker with the temporary memory for the calculation
+ * @param[in] selected_data_2_array Index of the data set in the second file
+ * @param[in] progress Progress information (NULL in the multi threaded calculation)
+ *
+ * @return The JSON string or NULL, if no intersections were found (or the calculation was aborted). The memory was
+ * allocated from the JSON lib !
+ */
+static char*
+Determine_Intersections_Of_Data_Set
+(
+        struct Intersection_Worker* const restrict worker,
+        const uint_fast32_t selected_data_2_array,
+        struct Intersection_Progress* const restrict progress
+);
+
+/**
+ * @brief Calculate all free data sets of the current batch.
+ *
+ * Asserts:
+ *      worker != NULL
+ *      worker->batch != NULL
+ *
+ * @param[in] worker Worker, that takes the next free data sets of the batch
+ */
+static void
+Calculate_Free_Data_Sets_Of_Batch
+(
+        struct Intersection_Worker* const worker
+);
+
+/**
+ * @brief Thread function of a intersection worker: Calculate the free data sets of every batch, until all batches are
+ * done.
+ *
+ * The thread waits at the begin barrier of the batch for the next batch and at the end barrier after the calculation.
+ *
+ * Asserts:
+ *      worker != NULL
+ *      worker->batch != NULL
+ *
+ * @param[in] worker Worker (struct Intersection_Worker*)
+ *
+ * @return Always NULL
+ */
+static void*
+Intersection_Worker_Thread
+(
+        void* worker
+);
+
+/**
+ * @brief Append the JSON string of a data set to the result file.
+ *
+ * The JSON string will be deleted after the writing.
+ *
+ * Asserts:
+ *      result_file != NULL
+ *      json_export_str != NULL
+ *
+ * @param[in] result_file Already opened result file
+ * @param[in] json_export_str JSON string of the data set (Result of Determine_Intersections_Of_Data_Set())
+ * @param[in] first_result_dataset_written Was a data set already written ? (-> A separator is necessary)
+ * @param[in] export_settings Global export settings (This is necessary to determine, if a formatted output is expected)
+ *
+ * @return The number of written bytes
+ */
+static size_t
+Append_Data_Set_To_Result_File
+(
+        FILE* restrict result_file,
+        char* restrict json_export_str,
+        const _Bool first_result_dataset_written,
+        const unsigned int export_settings
+);
+
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -443,11 +650,10 @@ Print_Counter
  *         intersection process, because integer comparisons are significant faster than string comparisons, especially
  *         with long strings)
  *      -- Also every token will be unique in the mapping object
- *      -- To avoid searching in the full data, a pseudo hash function was implemented. There are 100 data buckets
- *      -- The "hash sum" of a string is the sum of all char mod 100
- *      -- The integer values have the chosen bucket encoded in it itself
- *      -- the first two lowest digits (in decimal system) encodes the bucket. E.g.: xxx10 means, that this integer can
- *         found in the 11. bucket, when it exists in the mapping data
+ *      -- The tokens will be found with an open-addressing hash table (linear probing); every slot saves the hash value
+ *         and the length of its token, so most of the other tokens will be skipped without a string comparison
+ *      -- The integer values are dense: The n-th new token gets the value n - 1. So the reverse mapping (int -> token)
+ *         is only an array access
  *
  * - Use the token int mapping for the creation of a mapped token container (Two Documen@param[in]t_Word_List)
  *      -- A Document_Word_List contains a 2 dimensional integer array
@@ -531,32 +737,44 @@ Exec_Intersection
     const unsigned int intersection_settings = Create_Intersection_Settings_With_CLI_Parameter();
     int result = 0;
 
-    // >>> Read files and extract the tokens <<<
-    struct Token_List_Container* token_container_input_1 = TokenListContainer_CreateObject (GLOBAL_CLI_INPUT_FILE);
+    // >>> Create a token int mapping list <<<
+    struct Token_Int_Mapping* token_int_mapping = NULL;
+    if (GLOBAL_CLI_LOAD_VOCAB != NULL)
+    {
+        // The known tokens of the snapshot can be used without a rehash; new tokens will be added as an overlay
+        token_int_mapping = TokenIntMapping_CreateObjectFromSnapshot(GLOBAL_CLI_LOAD_VOCAB);
+        ASSERT_FMSG(token_int_mapping->case_sensitive == ((CASE_SENSITIVE_BIT(intersection_settings)) ? true : false),
+                "The vocabulary snapshot \"%s\" was created with a different case sensitivity !",
+                GLOBAL_CLI_LOAD_VOCAB);
+        PRINTF_FFLUSH ("\nVocabulary snapshot \"%s\": " ANSI_TEXT_BOLD ANSI_TEXT_ITALIC "%zu tokens" ANSI_RESET_ALL
+                " loaded\n", GLOBAL_CLI_LOAD_VOCAB, token_int_mapping->number_of_tokens);
+    }
+    else
+    {
+        token_int_mapping = TokenIntMapping_CreateObjectWithCaseSensitivity
+                ((CASE_SENSITIVE_BIT(intersection_settings)) ? true : false);
+    }
+    // The time measurement of the calls is only necessary for the statistics
+    token_int_mapping->measure_time = (GLOBAL_CLI_STATS_JSON != NULL);
+
+    // >>> Read files and intern the tokens directly in the token int mapping <<<
+    // The containers hold only the mapped integers, the offsets and the dataset IDs; the chars of the tokens are only
+    // saved once in the mapping
+    ASSERT_FMSG(GLOBAL_CLI_THREADS > 0, "Invalid number of threads: %d !", GLOBAL_CLI_THREADS);
+    const size_t tokens_before_input_1 = token_int_mapping->number_of_tokens;
+    struct Token_List_Container* token_container_input_1 = TokenListContainer_CreateObjectWithMapping
+            (GLOBAL_CLI_INPUT_FILE, (size_t) GLOBAL_CLI_THREADS, token_int_mapping);
     TokenListContainer_ShowAttributes (token_container_input_1);
-    struct Token_List_Container* token_container_input_2 = TokenListContainer_CreateObject (GLOBAL_CLI_INPUT_FILE2);
+    const size_t tokens_before_input_2 = token_int_mapping->number_of_tokens;
+    PRINTF_FFLUSH ("\nAfter token container 1: " ANSI_TEXT_BOLD ANSI_TEXT_ITALIC "%zu elements" ANSI_RESET_ALL
+            " added to token int mapping\n", tokens_before_input_2 - tokens_before_input_1);
+    struct Token_List_Container* token_container_input_2 = TokenListContainer_CreateObjectWithMapping
+            (GLOBAL_CLI_INPUT_FILE2, (size_t) GLOBAL_CLI_THREADS, token_int_mapping);
     TokenListContainer_ShowAttributes (token_container_input_2);
+    PRINTF_FFLUSH ("\nAfter token container 2: " ANSI_TEXT_BOLD ANSI_TEXT_ITALIC "%zu elements" ANSI_RESET_ALL
+            " added to token int mapping\n", token_int_mapping->number_of_tokens - tokens_before_input_2);
 
-
-
-    // >>> Create a token int mapping list <<<
-    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObjectWithGivenCmpFunction
-            ((CASE_SENSITIVE_BIT(intersection_settings)) ? &strncmp : &strncasecmp_diy);
-
-    // ... and fill them with all tokens (Content from the first file)
-    uint_fast32_t token_added_to_mapping =
-            Append_Token_List_Container_Data_To_Token_Int_Mapping (token_container_input_1, token_int_mapping);
-    PRINTF_FFLUSH ("\nAfter token container 1: " ANSI_TEXT_BOLD ANSI_TEXT_ITALIC "%" PRIuFAST32 " elements" ANSI_RESET_ALL
-            " added to token int mapping\n", token_added_to_mapping);
-    // Content from the second file
-    token_added_to_mapping +=
-            Append_Token_List_Container_Data_To_Token_Int_Mapping (token_container_input_2, token_int_mapping);
-    PRINTF_FFLUSH ("\nAfter token container 2: " ANSI_TEXT_BOLD ANSI_TEXT_ITALIC "%" PRIuFAST32 " elements" ANSI_RESET_ALL
-            " added to token int mapping\n", token_added_to_mapping);
-
-
-
-    // >>> Use the token int mapping for the creation of a mapped token container <<<
+    // >>> Use the mapped token containers for the creation of the document word lists <<<
     const size_t length_of_longest_token_container = MAX_WITH_TYPE_CHECK(TokenListContainer_GetLenghOfLongestTokenList(token_container_input_1),
             TokenListContainer_GetLenghOfLongestTokenList(token_container_input_2));
 
@@ -567,24 +785,112 @@ Exec_Intersection
     // will be created with the worst case in the memory usage. This is massive inefficient, but for the development it
     // is okay.
     // => ! It will be changed for real use cases ! <=
-    PRINTF_NO_VA_ARGS_FFLUSH("\nCreate document word lists ...");
     struct Document_Word_List* source_int_values_1 =
             DocumentWordList_CreateObjectAsIntersectionResult(token_container_input_1->next_free_element, length_of_longest_token_container);
     struct Document_Word_List* source_int_values_2 =
             DocumentWordList_CreateObjectAsIntersectionResult(token_container_input_2->next_free_element, length_of_longest_token_container);
+    Append_Mapped_Token_List_Container_To_Document_Word_List(token_container_input_1, source_int_values_1);
+    Append_Mapped_Token_List_Container_To_Document_Word_List(token_container_input_2, source_int_values_2);
 
-    Append_Token_Int_Mapping_Data_To_Document_Word_List(token_int_mapping, token_container_input_1,
-            source_int_values_1);
-    Append_Token_Int_Mapping_Data_To_Document_Word_List(token_int_mapping, token_container_input_2,
-            source_int_values_2);
+    // From now on only the dataset IDs and the long tokens of the containers are necessary
+    TokenListContainer_DeleteTokens(token_container_input_1);
+    TokenListContainer_DeleteTokens(token_container_input_2);
+
+    if (GLOBAL_CLI_FREQUENCY_IDS)
+    {
+        PRINTF_NO_VA_ARGS_FFLUSH("\nRenumber the tokens by their document frequency ...");
+        // The most frequent tokens get the smallest mapped integers. So the hot integers are close together
+        const size_t number_of_tokens = MAX_WITH_TYPE_CHECK(token_int_mapping->number_of_tokens, (size_t) 1);
+        size_t* document_frequencies = (size_t*) CALLOC(number_of_tokens, sizeof (size_t));
+        ASSERT_ALLOC(document_frequencies, "Cannot allocate memory for the document frequencies !",
+                number_of_tokens * sizeof (size_t));
+        DATA_TYPE* remap_table = (DATA_TYPE*) MALLOC(number_of_tokens * sizeof (DATA_TYPE));
+        ASSERT_ALLOC(remap_table, "Cannot allocate memory for the remap table !",
+                number_of_tokens * sizeof (DATA_TYPE));
+
+        DocumentWordList_CountDocumentFrequencies(source_int_values_1, document_frequencies,
+                token_int_mapping->number_of_tokens);
+        DocumentWordList_CountDocumentFrequencies(source_int_values_2, document_frequencies,
+                token_int_mapping->number_of_tokens);
+        TokenIntMapping_RenumberByFrequency(token_int_mapping, document_frequencies, remap_table);
+        DocumentWordList_RemapData(source_int_values_1, remap_table, token_int_mapping->number_of_tokens);
+        DocumentWordList_RemapData(source_int_values_2, remap_table, token_int_mapping->number_of_tokens);
+
+        FREE_AND_SET_TO_NULL(remap_table);
+        FREE_AND_SET_TO_NULL(document_frequencies);
+        PUTS_FFLUSH(" Done");
+    }
+    if (GLOBAL_CLI_SAVE_VOCAB != NULL)
+    {
+        PRINTF_FFLUSH ("\nSave the vocabulary snapshot \"%s\" ...", GLOBAL_CLI_SAVE_VOCAB);
+        TokenIntMapping_SaveSnapshot(token_int_mapping, GLOBAL_CLI_SAVE_VOCAB);
+        PUTS_FFLUSH(" Done");
+    }
+
+    PRINTF_NO_VA_ARGS_FFLUSH("\nCreate signatures ...");
+    // With the signatures most of the data set pairs without a common token can be skipped before the intersection
+    // Stop words are no valid intersection tokens. So they will not be a part of the signatures
+    DocumentWordList_CreateSignatures(source_int_values_1, Is_Stop_Word_Token, token_int_mapping);
+    DocumentWordList_CreateSignatures(source_int_values_2, Is_Stop_Word_Token, token_int_mapping);
     PUTS_FFLUSH(" Done");
 
     DocumentWordList_ShowAttributes(source_int_values_1);
     DocumentWordList_ShowAttributes(source_int_values_2);
     puts("");
     TokenIntMapping_ShowMemoryUsage(token_int_mapping);
+    TokenIntMapping_ShowHashTableStatistics(token_int_mapping);
     puts("");
 
+    // Posting lists of the first file
+    // With them only the data sets of the first file, that have intersections with the current data set of the second
+    // file, needs to be visited in the inner loop
+    struct Inverted_Index* inverted_index = NULL;
+    if (INVERTED_INDEX_BIT(intersection_settings))
+    {
+        PRINTF_NO_VA_ARGS_FFLUSH("Create inverted index ...");
+        inverted_index = InvertedIndex_CreateObject(source_int_values_1);
+        PUTS_FFLUSH(" Done");
+        InvertedIndex_ShowAttributes(inverted_index);
+        puts("");
+    }
+    if (FULL_MATCH_ONLY_BIT(intersection_settings))
+    {
+        PUTS_FFLUSH("--no_part_matches: Only the full match candidates will be intersected. The numbers of found tokens"
+                " and sets exclude the partial matches.\n");
+    }
+
+    // Sort every data set of both files only once
+    // With them the intersection of two data sets is a merge of the sorted tokens
+    struct Sorted_Data_Sets* sorted_data_sets_1 = NULL;
+    struct Sorted_Data_Sets* sorted_data_sets_2 = NULL;
+    if (SORTED_MERGE_BIT(intersection_settings))
+    {
+        PRINTF_NO_VA_ARGS_FFLUSH("Create sorted data sets ...");
+        sorted_data_sets_1 = SortedDataSets_CreateObject(source_int_values_1);
+        sorted_data_sets_2 = SortedDataSets_CreateObject(source_int_values_2);
+        PUTS_FFLUSH(" Done");
+        SortedDataSets_ShowAttributes(sorted_data_sets_1);
+        SortedDataSets_ShowAttributes(sorted_data_sets_2);
+        puts("");
+    }
+
+    // Doc-major mode: The posting lists will be built over the second file. Then every data set of the first file will
+    // be read only once to determine the candidates of all data sets of the second file
+    struct Inverted_Index_Candidate_Lists* doc_major_candidates = NULL;
+    if (DOC_MAJOR_BIT(intersection_settings))
+    {
+        PRINTF_NO_VA_ARGS_FFLUSH("Create doc-major candidates ...");
+        struct Inverted_Index* inverted_index_2 = InvertedIndex_CreateObject(source_int_values_2);
+        doc_major_candidates = InvertedIndex_CreateCandidateLists(inverted_index_2, source_int_values_1,
+                Is_Stop_Word_Token, token_int_mapping,
+                (KEEP_SINGLE_TOKEN_RESULTS_BIT(intersection_settings)) ? 1 : 2);
+        PUTS_FFLUSH(" Done");
+        InvertedIndex_ShowAttributes(inverted_index_2);
+        InvertedIndex_DeleteObject(inverted_index_2);
+        inverted_index_2 = NULL;
+        printf ("Doc-major candidates: %zu\n\n", doc_major_candidates->number_of_candidates);
+    }
+
 
 
     // >>> Create the intersections and save the information in the output file <<<
@@ -602,33 +908,6 @@ Exec_Intersection
             (((uint_fast32_t) number_of_intersection_calls / count_steps) == 0) ?
                     1 : ((uint_fast32_t) number_of_intersection_calls / count_steps);
 
-    // How many calls were done since the last calculation step was printed ?
-    size_t intersection_calls_before_last_output    = 0;
-    // Counter of all calls were done since the execution was started
-    size_t intersection_call_counter                = 0;
-
-//    char dataset_id_1 [DATASET_ID_LENGTH];
-//    memset(dataset_id_1, '\0', sizeof (dataset_id_1));
-    char dataset_id_2 [DATASET_ID_LENGTH];
-    memset(dataset_id_2, '\0', sizeof (dataset_id_2));
-
-    // Objects for exporting the intersection results as JSON file
-    cJSON* src_token                        = NULL; // Token from a source file
-    cJSON* src_token_no_stop_word           = NULL; // Token from a source file (no stop word)
-    cJSON* src_tokens_array                 = NULL; // Array of tokens, which are from a source file
-    cJSON* src_tokens_array_wo_stop_words   = NULL; // Array of tokens, which are from a source file (no stop words)
-    cJSON* token                            = NULL; // Token
-    cJSON* char_offset_array                = NULL; // Offset (number of char) of the intersection tokens
-    cJSON* sentence_offset_array            = NULL; // Offset (number of sentences) of the intersection tokens
-    cJSON* word_offset_array                = NULL; // Offset of the words focused on the original data (comparable
-                                                    // to char_offset_array and sentence_offset_array)
-    cJSON* tokens_array                     = NULL; // Array of tokens
-    cJSON* intersections_partial_match      = NULL; // Intersections with a partial match (An intersection does not
-                                                    // contain a full source set)
-    cJSON* intersections_full_match         = NULL; // Intersections with a full match (An intersection contains a full
-                                                    // source set)
-    cJSON* outer_object                     = NULL; // Outer object, that contains the intersections and token arrays
-    cJSON* export_results                   = NULL;
 
 
 
@@ -648,17 +927,17 @@ Exec_Intersection
     result_file_size += Append_cJSON_Object_To_Result_File(result_file, general_information, intersection_settings);
     cJSON_FULL_FREE_AND_SET_TO_NULL(general_information);
 
-    // Create a list with too long token and append them to the result file
-    if (SHOW_TOO_LONG_TOKENS_BIT(intersection_settings))
+    // Create a list with the long tokens and append them to the result file
+    if (SHOW_LONG_TOKENS_BIT(intersection_settings))
     {
-        cJSON* too_long_tokens = cJSON_CreateObject();
-        cJSON_NOT_NULL(too_long_tokens);
-        Add_Too_Long_Tokens_To_Export_File(too_long_tokens, token_container_input_1, token_container_input_2);
-        result_file_size += Append_cJSON_Object_To_Result_File(result_file, too_long_tokens, intersection_settings);
-        cJSON_FULL_FREE_AND_SET_TO_NULL(too_long_tokens);
+        cJSON* long_tokens = cJSON_CreateObject();
+        cJSON_NOT_NULL(long_tokens);
+        Add_Long_Tokens_To_Export_File(long_tokens, token_container_input_1, token_container_input_2);
+        result_file_size += Append_cJSON_Object_To_Result_File(result_file, long_tokens, intersection_settings);
+        cJSON_FULL_FREE_AND_SET_TO_NULL(long_tokens);
     }
 
-    // To have a newline after the general information and after the too long tokens
+    // To have a newline after the general information and after the long tokens
     // In the formatted mode this is not necessary
     if (! FORMATTING_ENABLED(intersection_settings))
     {
@@ -668,70 +947,618 @@ Exec_Intersection
         ++ result_file_size;
     }
 
-    size_t cJSON_mem_counter    = 0;
     clock_t start               = 0;
     clock_t end                 = 0;
 
+    // Determine the intersections
+    CLOCK_WITH_RETURN_CHECK(start);
+
+    // Data, that all workers use
+    const struct Intersection_Shared_Data shared_data =
+    {
+            .token_container_input_1            = token_container_input_1,
+            .token_container_input_2            = token_container_input_2,
+            .source_int_values_1                = source_int_values_1,
+            .source_int_values_2                = source_int_values_2,
+            .token_int_mapping                  = token_int_mapping,
+            .sorted_data_sets_1                 = sorted_data_sets_1,
+            .sorted_data_sets_2                 = sorted_data_sets_2,
+            .doc_major_candidates               = doc_major_candidates,
+            .intersection_settings              = intersection_settings,
+            // How many tokens needs to be left for a valid data set?
+            .min_token_left_for_valid_data_set  = (KEEP_SINGLE_TOKEN_RESULTS_BIT(intersection_settings)) ? 1 : 2,
+            // The kernel without CPU extensions creates the results in the order of the first data set
+            .scalar_kernel_order                = IntersectionApproach_IsScalarKernelUsed()
+    };
+
+    // Every thread has its own worker with the temporary memory for the calculation
+    ASSERT_FMSG(GLOBAL_CLI_THREADS > 0, "Invalid number of threads: %d !", GLOBAL_CLI_THREADS);
+    const size_t number_of_threads = (size_t) GLOBAL_CLI_THREADS;
+    struct Intersection_Worker* workers = (struct Intersection_Worker*) CALLOC(number_of_threads,
+            sizeof (struct Intersection_Worker));
+    ASSERT_ALLOC(workers, "Cannot allocate memory for the intersection workers !",
+            number_of_threads * sizeof (struct Intersection_Worker));
+    for (size_t i = 0; i < number_of_threads; ++ i)
+    {
+        Create_Intersection_Worker(&workers [i], &shared_data, inverted_index, length_of_longest_token_container);
+    }
+
+    struct Intersection_Progress progress =
+    {
+            .intersection_calls_before_last_output  = 0,
+            .intersection_call_counter              = 0,
+            .number_of_intersection_calls           = number_of_intersection_calls,
+            .print_steps                            = print_steps,
+            .result_file_size                       = &result_file_size,
+            .abort_progress_percent                 = abort_progress_percent,
+            .abort_progress_percent_given           = ! isnan(abort_progress_percent),
+            .aborted                                = false
+    };
+
+    // ===== ===== ===== ===== ===== ===== ===== ===== BEGIN Outer loop ===== ===== ===== ===== ===== ===== ===== =====
+    // Flag, if the first result set was written (This information is necessary to decide, whether a comma need to be
+    // printed or not
+    _Bool first_result_dataset_written = false;
+
+    if (number_of_threads == 1)
+    {
+        for (uint_fast32_t selected_data_2_array = 0; selected_data_2_array < source_int_values_2->next_free_array;
+                ++ selected_data_2_array)
+        {
+            char* json_export_str = Determine_Intersections_Of_Data_Set(&workers [0], selected_data_2_array, &progress);
+
+            // Debugging end of the calculations
+            if (progress.aborted) { break; }
+
+            // Only append the objects from the current outer loop run, when data was found in the inner loop
+            if (json_export_str != NULL)
+            {
+                result_file_size += Append_Data_Set_To_Result_File(result_file, json_export_str,
+                        first_result_dataset_written, intersection_settings);
+                first_result_dataset_written = true;
+            }
+        }
+    }
+    else
+    {
+        // The threads use only the stop word flags of the Token_Int_Mapping. So the stop word list itself will not be
+        // accessed in the threads
+
+        // The data sets of the second file will be calculated in batches. In a batch the threads take the next free
+        // data set, until all data sets of the batch are calculated. After that the results will be written in the
+        // original order to the result file. So the result file is independent of the number of threads
+        const uint_fast32_t batch_size = (uint_fast32_t) number_of_threads * DATA_SETS_PER_THREAD_AND_BATCH;
+        struct Intersection_Batch batch;
+        batch.export_strings = (char**) CALLOC(batch_size, sizeof (char*));
+        ASSERT_ALLOC(batch.export_strings, "Cannot allocate memory for the export strings of a batch !",
+                batch_size * sizeof (char*));
+        batch.begin     = 0;
+        batch.end       = 0;
+        batch.finished  = false;
+        atomic_init(&batch.next_data_set, 0);
+
+        // The threads will be created only once; the current thread is also a worker
+        int pthread_ret_value = pthread_barrier_init(&batch.begin_barrier, NULL, (unsigned int) number_of_threads);
+        ASSERT_FMSG(pthread_ret_value == 0, "Cannot create a barrier for the intersection calculation: %s !",
+                strerror(pthread_ret_value));
+        pthread_ret_value = pthread_barrier_init(&batch.end_barrier, NULL, (unsigned int) number_of_threads);
+        ASSERT_FMSG(pthread_ret_value == 0, "Cannot create a barrier for the intersection calculation: %s !",
+                strerror(pthread_ret_value));
+        for (size_t i = 0; i < number_of_threads; ++ i)
+        {
+            workers [i].batch = &batch;
+        }
+        for (size_t i = 1; i < number_of_threads; ++ i)
+        {
+            pthread_ret_value = pthread_create(&workers [i].thread, NULL, Intersection_Worker_Thread, &workers [i]);
+            ASSERT_FMSG(pthread_ret_value == 0, "Cannot create a thread for the intersection calculation: %s !",
+                    strerror(pthread_ret_value));
+        }
+
+        for (uint_fast32_t batch_begin = 0; batch_begin < source_int_values_2->next_free_array;
+                batch_begin += batch_size)
+        {
+            // Program exit after a given progress
+            // In the multi threaded calculation this check can only be done between two batches
+            if (progress.abort_progress_percent_given)
+            {
+                if (Determine_Percent(progress.intersection_call_counter, number_of_intersection_calls) >
+                        abort_progress_percent)
+                {
+                    PRINTF_FFLUSH("\nCalculation stopped intended after %.4f %% !\n", abort_progress_percent);
+                    break;
+                }
+            }
+
+            batch.begin = batch_begin;
+            batch.end   = MIN(batch_begin + batch_size, source_int_values_2->next_free_array);
+            atomic_store(&batch.next_data_set, batch_begin);
+
+            // The barriers make the batch data visible for the threads and the results visible for the writing
+            (void) pthread_barrier_wait(&batch.begin_barrier);
+            Calculate_Free_Data_Sets_Of_Batch(&workers [0]);
+            (void) pthread_barrier_wait(&batch.end_barrier);
+
+            // Write the results of the batch in the original order
+            for (uint_fast32_t i = 0; i < (batch.end - batch.begin); ++ i)
+            {
+                if (batch.export_strings [i] != NULL)
+                {
+                    result_file_size += Append_Data_Set_To_Result_File(result_file, batch.export_strings [i],
+                            first_result_dataset_written, intersection_settings);
+                    batch.export_strings [i] = NULL;
+                    first_result_dataset_written = true;
+                }
+            }
+
+            // Print calculation steps
+            // The step size is the number of intersection calls of the whole batch
+            const size_t batch_intersection_calls = (batch.end - batch.begin) * source_int_values_1->next_free_array;
+            progress.intersection_call_counter += batch_intersection_calls;
+            Process_Printer(batch_intersection_calls, batch_intersection_calls, progress.intersection_call_counter,
+                    number_of_intersection_calls, true, Exec_Intersection_Process_Print_Function, &result_file_size,
+                    Print_Export_File_Size);
+        }
+
+        // Wake up the waiting threads for the termination
+        batch.finished = true;
+        (void) pthread_barrier_wait(&batch.begin_barrier);
+        for (size_t i = 1; i < number_of_threads; ++ i)
+        {
+            pthread_ret_value = pthread_join(workers [i].thread, NULL);
+            ASSERT_FMSG(pthread_ret_value == 0, "Cannot join a thread of the intersection calculation: %s !",
+                    strerror(pthread_ret_value));
+        }
+        (void) pthread_barrier_destroy(&batch.begin_barrier);
+        (void) pthread_barrier_destroy(&batch.end_barrier);
+
+        FREE_AND_SET_TO_NULL(batch.export_strings);
+    }
+    // ===== ===== ===== ===== ===== ===== ===== ===== END Outer loop ===== ===== ===== ===== ===== ===== ===== =====
+
+    CLOCK_WITH_RETURN_CHECK(end);
+
+    size_t cJSON_mem_counter                        = 0;
     uint_fast64_t counter_partial_sets              = 0;
     uint_fast64_t counter_full_sets                 = 0;
     uint_fast64_t counter_tokens_in_partital_sets   = 0;
     uint_fast64_t counter_tokens_in_full_sets       = 0;
+    uint_fast64_t counter_prefilter_checks          = 0;
+    uint_fast64_t counter_prefilter_rejections      = 0;
 
-    // Determine the intersections
-    CLOCK_WITH_RETURN_CHECK(start);
+    for (size_t i = 0; i < number_of_threads; ++ i)
+    {
+        cJSON_mem_counter               += workers [i].cJSON_mem_counter;
+        counter_partial_sets            += workers [i].counter_partial_sets;
+        counter_full_sets               += workers [i].counter_full_sets;
+        counter_tokens_in_partital_sets += workers [i].counter_tokens_in_partial_sets;
+        counter_tokens_in_full_sets     += workers [i].counter_tokens_in_full_sets;
+        counter_prefilter_checks        += workers [i].counter_prefilter_checks;
+        counter_prefilter_rejections    += workers [i].counter_prefilter_rejections;
+
+        Delete_Intersection_Worker(&workers [i]);
+    }
+    FREE_AND_SET_TO_NULL(workers);
+    if (inverted_index != NULL)
+    {
+        InvertedIndex_DeleteObject(inverted_index);
+        inverted_index = NULL;
+    }
+    if (sorted_data_sets_1 != NULL)
+    {
+        SortedDataSets_DeleteObject(sorted_data_sets_1);
+        sorted_data_sets_1 = NULL;
+        SortedDataSets_DeleteObject(sorted_data_sets_2);
+        sorted_data_sets_2 = NULL;
+    }
+    if (doc_major_candidates != NULL)
+    {
+        InvertedIndex_DeleteCandidateLists(doc_major_candidates);
+        doc_major_candidates = NULL;
+    }
+
+    // If no intersections were found after the whole operation: An ',' too much will remain in the result file
+    // -> Remove them by moving the file pointer one char back
+    if ((counter_tokens_in_full_sets + counter_tokens_in_partital_sets) == 0)
+    {
+        file_operation_ret_value = fseek(result_file, -1, SEEK_CUR);
+        ASSERT_FMSG(file_operation_ret_value != EOF, "Error while removing a char from the file stream for file \"%s\": %s",
+                GLOBAL_CLI_OUTPUT_FILE, strerror(errno));
+        result_file_size --;
+    }
+
+    const char* end_file_string = ((! FORMATTING_ENABLED(intersection_settings)) ? "}" : "\n}");
+
+    file_operation_ret_value = fputs(end_file_string, result_file);
+    ASSERT_FMSG(file_operation_ret_value != EOF, "Error while writing in the file \"%s\": %s", GLOBAL_CLI_OUTPUT_FILE,
+            strerror(errno));
+    result_file_size += STATIC_STRLEN ((! FORMATTING_ENABLED(intersection_settings)) ? "}" : "\n}");
+    FCLOSE_AND_SET_TO_NULL(result_file);
+    printf ("\nDone !");
+
+    // Print the counter
+    Print_Counter(counter_tokens_in_partital_sets, counter_tokens_in_full_sets, counter_partial_sets, counter_full_sets, intersection_settings);
+    if (counter_prefilter_checks > 0)
+    {
+        printf ("Prefilter rejections:       %" PRIuFAST64 " of %" PRIuFAST64 " (%.2f %%)\n\n",
+                counter_prefilter_rejections, counter_prefilter_checks,
+                (double) Determine_Percent((size_t) counter_prefilter_rejections, (size_t) counter_prefilter_checks));
+    }
+
+    printf ("cJSON objects memory usage: ");
+    Print_Memory_Size_As_B_KB_MB(cJSON_mem_counter);
+
+    printf ("\n=> Result file: " ANSI_TEXT_BOLD "%s" ANSI_RESET_ALL, GLOBAL_CLI_OUTPUT_FILE);
+    printf ("\n=> Result file size: " ANSI_TEXT_BOLD);
+    Print_Memory_Size_As_B_KB_MB(result_file_size);
+    printf (ANSI_RESET_ALL);
+
+    const uint_fast64_t intersection_tokens_found_counter = counter_tokens_in_full_sets + counter_tokens_in_partital_sets;
+    const uint_fast64_t intersection_sets_found_counter = counter_full_sets + counter_partial_sets;
+    if (number_of_intersection_tokens != NULL)
+    {
+        *number_of_intersection_tokens = intersection_tokens_found_counter;
+    }
+    if (number_of_intersection_sets != NULL)
+    {
+        *number_of_intersection_sets = intersection_sets_found_counter;
+    }
+
+    DocumentWordList_DeleteObject(source_int_values_1);
+    source_int_values_1 = NULL;
+    DocumentWordList_DeleteObject(source_int_values_2);
+    source_int_values_2 = NULL;
+    TokenListContainer_DeleteObject(token_container_input_1);
+    token_container_input_1 = NULL;
+    TokenListContainer_DeleteObject(token_container_input_2);
+    token_container_input_2 = NULL;
+    if (GLOBAL_CLI_STATS_JSON != NULL)
+    {
+        Export_Token_Int_Mapping_Statistics(token_int_mapping, GLOBAL_CLI_STATS_JSON);
+        printf ("\n=> Statistics file: " ANSI_TEXT_BOLD "%s" ANSI_RESET_ALL, GLOBAL_CLI_STATS_JSON);
+    }
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the name of the intersection engine, that Exec_Intersection() will use with the current CLI
+ * parameter.
+ *
+ * The name will be determined with the same intersection settings as in Exec_Intersection(). So the selected kernel
+ * needs to be known before the call.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Name of the intersection engine (Static string)
+ */
+extern const char*
+Exec_Intersection_Engine_Name
+(
+        void
+)
+{
+    // Second index: Without / with sorted merge
+    static const char* const engine_names [][2] =
+    {
+            { "full match (rarest token first)",    "full match (rarest token first) + sorted merge" },
+            { "inverted index",                     "inverted index + sorted merge" },
+            { "doc-major",                          "doc-major + sorted merge" },
+            { "nested loops",                       "nested loops + sorted merge" }
+    };
+
+    const unsigned int intersection_settings = Create_Intersection_Settings_With_CLI_Parameter();
+    size_t engine = 3;
+
+    // Same order of the checks as in the intersection of one data set of the second file
+    if (DOC_MAJOR_BIT(intersection_settings))
+    {
+        engine = 2;
+    }
+    else if (FULL_MATCH_ONLY_BIT(intersection_settings))
+    {
+        engine = 0;
+    }
+    else if (INVERTED_INDEX_BIT(intersection_settings))
+    {
+        engine = 1;
+    }
+
+    return engine_names [engine][(SORTED_MERGE_BIT(intersection_settings)) ? 1 : 0];
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Create the temporary memory of a intersection worker.
+ *
+ * Asserts:
+ *      worker != NULL
+ *      shared_data != NULL
+ *      max_data_set_length > 0
+ *
+ * @param[out] worker Worker, that will be initialized
+ * @param[in] shared_data Data, that all workers use
+ * @param[in] inverted_index Inverted_Index of the first file (NULL, if it will not be used)
+ * @param[in] max_data_set_length Length of the longest data set in both files
+ */
+static void
+Create_Intersection_Worker
+(
+        struct Intersection_Worker* const restrict worker,
+        const struct Intersection_Shared_Data* const restrict shared_data,
+        const struct Inverted_Index* const restrict inverted_index,
+        const size_t max_data_set_length
+)
+{
+    ASSERT_MSG(worker != NULL, "Intersection worker is NULL !");
+    ASSERT_MSG(shared_data != NULL, "Shared data is NULL !");
+    ASSERT_MSG(max_data_set_length > 0, "Max. data set length is 0 !");
+
+    memset(worker, '\0', sizeof (struct Intersection_Worker));
+    worker->shared = shared_data;
+    worker->intersection_result = DocumentWordList_CreateObjectAsIntersectionResult(1, 10);
+    worker->intersection_guards = IntersectionApproach_CreateGuards(max_data_set_length, max_data_set_length);
+
+    if (inverted_index != NULL)
+    {
+        // The posting lists will be shared; only the temporary memory is per worker
+        worker->inverted_index = InvertedIndex_CreateSharedObject(inverted_index);
+        worker->stop_word_flags = (_Bool*) CALLOC(max_data_set_length, sizeof (_Bool));
+        ASSERT_ALLOC(worker->stop_word_flags, "Cannot allocate memory for the stop word flags !",
+                max_data_set_length * sizeof (_Bool));
+    }
+    if (shared_data->sorted_data_sets_2 != NULL)
+    {
+        // The match memory needs the length of the data set, whose order the results will have
+        worker->merge_matches = SortedDataSets_CreateMatchMemory((shared_data->scalar_kernel_order) ?
+                shared_data->sorted_data_sets_1 : shared_data->sorted_data_sets_2);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete the temporary memory of a intersection worker.
+ *
+ * Asserts:
+ *      worker != NULL
+ *
+ * @param[in] worker Worker
+ */
+static void
+Delete_Intersection_Worker
+(
+        struct Intersection_Worker* const worker
+)
+{
+    ASSERT_MSG(worker != NULL, "Intersection worker is NULL !");
+
+    DocumentWordList_DeleteObject(worker->intersection_result);
+    worker->intersection_result = NULL;
+    IntersectionApproach_DeleteGuards(worker->intersection_guards);
+    worker->intersection_guards = NULL;
+    if (worker->inverted_index != NULL)
+    {
+        InvertedIndex_DeleteObject(worker->inverted_index);
+        worker->inverted_index = NULL;
+        FREE_AND_SET_TO_NULL(worker->stop_word_flags);
+    }
+    if (worker->merge_matches != NULL)
+    {
+        FREE_AND_SET_TO_NULL(worker->merge_matches);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Calculate the intersections between one data set of the second file and all data sets of the first file.
+ *
+ * The result is the JSON string (cJSON_PrintBuffered()) of the data set with all intersections. The counter of the
+ * worker will be updated.
+ *
+ * If progress information is given, the progress will be printed and the abort percent value will be checked in the
+ * inner loop. This is only possible in the single threaded calculation.
+ *
+ * Asserts:
+ *      worker != NULL
+ *
+ * @param[in] worker Worker with the temporary memory for the calculation
+ * @param[in] selected_data_2_array Index of the data set in the second file
+ * @param[in] progress Progress information (NULL in the multi threaded calculation)
+ *
+ * @return The JSON string or NULL, if no intersections were found (or the calculation was aborted). The memory was
+ * allocated from the JSON lib !
+ */
+static char*
+Determine_Intersections_Of_Data_Set
+(
+        struct Intersection_Worker* const restrict worker,
+        const uint_fast32_t selected_data_2_array,
+        struct Intersection_Progress* const restrict progress
+)
+{
+    ASSERT_MSG(worker != NULL, "Intersection worker is NULL !");
+
+    // Short names for the data of the worker
+    const struct Token_List_Container* const token_container_input_1    = worker->shared->token_container_input_1;
+    const struct Token_List_Container* const token_container_input_2    = worker->shared->token_container_input_2;
+    const struct Document_Word_List* const source_int_values_1          = worker->shared->source_int_values_1;
+    const struct Document_Word_List* const source_int_values_2          = worker->shared->source_int_values_2;
+    const struct Token_Int_Mapping* const token_int_mapping             = worker->shared->token_int_mapping;
+    const unsigned int intersection_settings                            = worker->shared->intersection_settings;
+    const size_t min_token_left_for_valid_data_set                      = worker->shared->min_token_left_for_valid_data_set;
+    struct Document_Word_List* const intersection_result                = worker->intersection_result;
+    struct Inverted_Index* const inverted_index                         = worker->inverted_index;
+    _Bool* const stop_word_flags                                        = worker->stop_word_flags;
+    uint32_t* const merge_matches                                       = worker->merge_matches;
+
+    char dataset_id_2 [DATASET_ID_LENGTH];
+    memset(dataset_id_2, '\0', sizeof (dataset_id_2));
 
     uint_fast32_t last_used_selected_data_2_array = UINT_FAST32_MAX;
+    size_t cJSON_mem_counter = 0;
+    char* json_export_str = NULL;
+
+    // Objects for exporting the intersection results as JSON file
+    cJSON* src_token                        = NULL; // Token from a source file
+    cJSON* src_token_no_stop_word           = NULL; // Token from a source file (no stop word)
+    cJSON* src_tokens_array                 = NULL; // Array of tokens, which are from a source file
+    cJSON* src_tokens_array_wo_stop_words   = NULL; // Array of tokens, which are from a source file (no stop words)
+    cJSON* token                            = NULL; // Token
+    cJSON* char_offset_array                = NULL; // Offset (number of char) of the intersection tokens
+    cJSON* sentence_offset_array            = NULL; // Offset (number of sentences) of the intersection tokens
+    cJSON* word_offset_array                = NULL; // Offset of the words focused on the original data (comparable
+                                                    // to char_offset_array and sentence_offset_array)
+    cJSON* tokens_array                     = NULL; // Array of tokens
+    cJSON* intersections_partial_match      = NULL; // Intersections with a partial match (An intersection does not
+                                                    // contain a full source set)
+    cJSON* intersections_full_match         = NULL; // Intersections with a full match (An intersection contains a full
+                                                    // source set)
+    cJSON* outer_object                     = NULL; // Outer object, that contains the intersections and token arrays
+    cJSON* export_results                   = NULL;
 
-    // How many tokens needs to be left for a valid data set?
-    register const size_t min_token_left_for_valid_data_set = (KEEP_SINGLE_TOKEN_RESULTS_BIT(intersection_settings)) ? 1 : 2;
-    const _Bool abort_progress_percent_given = ! isnan(abort_progress_percent);
+    cJSON_NEW_OBJ_CHECK(export_results);
 
-    // This is the result object for temporary result data
-    struct Document_Word_List* intersection_result = DocumentWordList_CreateObjectAsIntersectionResult(1, 10);
+    if (PART_MATCH_BIT(intersection_settings))  { cJSON_NEW_OBJ_CHECK(intersections_partial_match); }
+    if (FULL_MATCH_BIT(intersection_settings))  { cJSON_NEW_OBJ_CHECK(intersections_full_match); }
+    cJSON_NEW_OBJ_CHECK(outer_object);
+    _Bool data_found = false;
 
-    // ===== ===== ===== ===== ===== ===== ===== ===== BEGIN Outer loop ===== ===== ===== ===== ===== ===== ===== =====
-    // Flag, if the first result set was written (This information is necessary to decide, whether a comma need to be
-    // printed or not
-    _Bool first_result_dataset_written = false;
+    strncpy (dataset_id_2, token_container_input_2->token_lists [selected_data_2_array].dataset_id,
+            COUNT_ARRAY_ELEMENTS(dataset_id_2) - 1);
+    dataset_id_2 [COUNT_ARRAY_ELEMENTS(dataset_id_2) - 1] = '\0';
 
-    for (uint_fast32_t selected_data_2_array = 0; selected_data_2_array < source_int_values_2->next_free_array;
-            ++ selected_data_2_array)
+    // Without the inverted index (or the doc-major candidates) every data set of the first file will be visited
+    uint_fast32_t number_of_inner_loop_runs = source_int_values_1->next_free_array;
+    const uint32_t* candidates = NULL;
+    if (DOC_MAJOR_BIT(intersection_settings))
+    {
+        const struct Inverted_Index_Candidate_Lists* const doc_major_candidates = worker->shared->doc_major_candidates;
+        candidates = doc_major_candidates->candidates + doc_major_candidates->list_starts [selected_data_2_array];
+        number_of_inner_loop_runs = (uint_fast32_t) (doc_major_candidates->list_starts [selected_data_2_array + 1] -
+                doc_major_candidates->list_starts [selected_data_2_array]);
+    }
+    else if (INVERTED_INDEX_BIT(intersection_settings))
     {
-        cJSON_NEW_OBJ_CHECK(export_results);
+        const DATA_TYPE* const data_2 = source_int_values_2->data_struct.data [selected_data_2_array];
+        const size_t data_2_length = source_int_values_2->arrays_lengths [selected_data_2_array];
+
+        // Stop words are no valid intersection tokens. So they cannot make a data set to a candidate
+        for (size_t i = 0; i < data_2_length; ++ i)
+        {
+            stop_word_flags [i] = TokenIntMapping_IsStopWord(token_int_mapping, data_2 [i]);
+        }
+
+        // An empty data set (See Append_Mapped_Token_List_Container_To_Document_Word_List()) has no candidates
+        if (data_2_length == 0)
+        {
+            number_of_inner_loop_runs = 0;
+        }
+        else if (FULL_MATCH_ONLY_BIT(intersection_settings))
+        {
+            number_of_inner_loop_runs = (uint_fast32_t) InvertedIndex_DetermineFullMatchCandidates(inverted_index,
+                    data_2, data_2_length, stop_word_flags, min_token_left_for_valid_data_set);
+        }
+        else
+        {
+            number_of_inner_loop_runs = (uint_fast32_t) InvertedIndex_DetermineCandidates(inverted_index, data_2,
+                    data_2_length, stop_word_flags, min_token_left_for_valid_data_set);
+        }
+        candidates = inverted_index->candidates;
+    }
 
-        if (PART_MATCH_BIT(intersection_settings))  { cJSON_NEW_OBJ_CHECK(intersections_partial_match); }
-        if (FULL_MATCH_BIT(intersection_settings))  { cJSON_NEW_OBJ_CHECK(intersections_full_match); }
-        cJSON_NEW_OBJ_CHECK(outer_object);
-        _Bool data_found = false;
+    // ===== ===== ===== ===== ===== BEGIN Inner loop ===== ===== ===== ===== =====
+    for (uint_fast32_t inner_loop_run = 0; inner_loop_run < number_of_inner_loop_runs; ++ inner_loop_run)
+    {
+        const uint_fast32_t selected_data_1_array = (candidates != NULL) ? candidates [inner_loop_run] :
+                inner_loop_run;
 
-        // ===== ===== ===== ===== ===== BEGIN Inner loop ===== ===== ===== ===== =====
-        for (uint_fast32_t selected_data_1_array = 0; selected_data_1_array < source_int_values_1->next_free_array;
-                ++ selected_data_1_array, ++ intersection_call_counter, ++ intersection_calls_before_last_output)
+        // The progress will be only printed and checked in the single threaded calculation
+        if (progress != NULL)
         {
             // Program exit after a given progress
             // This is only for debugging purposes to avoid a complete program execution
-            if (abort_progress_percent_given)
+            if (progress->abort_progress_percent_given)
             {
-                if (Determine_Percent(intersection_call_counter, number_of_intersection_calls) > abort_progress_percent)
+                if (Determine_Percent(progress->intersection_call_counter, progress->number_of_intersection_calls) >
+                        progress->abort_progress_percent)
                 {
-                    PRINTF_FFLUSH("\nCalculation stopped intended after %.4f %% !\n", abort_progress_percent);
-                    goto abort_label;
+                    PRINTF_FFLUSH("\nCalculation stopped intended after %.4f %% !\n", progress->abort_progress_percent);
+                    progress->aborted = true;
+                    break;
                 }
             }
 
             // Print calculation steps
-            intersection_calls_before_last_output = Process_Printer(print_steps, intersection_calls_before_last_output,
-                    intersection_call_counter, number_of_intersection_calls, true,
+            progress->intersection_calls_before_last_output = Process_Printer(progress->print_steps,
+                    progress->intersection_calls_before_last_output, progress->intersection_call_counter,
+                    progress->number_of_intersection_calls, true,
                     Exec_Intersection_Process_Print_Function,
-                    &result_file_size,
+                    progress->result_file_size,
                     Print_Export_File_Size);
 
-            // Determine the current intersection
-            // The second array (source_int_values_2->data_struct.data [selected_data_array]) will be used for every data array in
-            // source_int_values_1 !
+            ++ progress->intersection_call_counter;
+            ++ progress->intersection_calls_before_last_output;
+        }
+
+        // The candidates of the inverted index have always a common token. So the check is only useful without them
+        if (candidates == NULL)
+        {
+            ++ worker->counter_prefilter_checks;
+            if (! DocumentWordList_SignaturesIntersect(source_int_values_1, selected_data_1_array, source_int_values_2,
+                    selected_data_2_array))
+            {
+                ++ worker->counter_prefilter_rejections;
+                continue;
+            }
+        }
+
+        // Determine the current intersection
+        // The second array (source_int_values_2->data_struct.data [selected_data_array]) will be used for every data array in
+        // source_int_values_1 !
+        if (SORTED_MERGE_BIT(intersection_settings))
+        {
+            SortedDataSets_IntersectDataSets
+            (
+                    worker->shared->sorted_data_sets_1,
+                    (uint32_t) selected_data_1_array,
+                    worker->shared->sorted_data_sets_2,
+                    (uint32_t) selected_data_2_array,
+                    merge_matches,
+                    intersection_result,
+                    worker->shared->scalar_kernel_order
+            );
+        }
+        else if (INVERTED_INDEX_BIT(intersection_settings))
+        {
+            InvertedIndex_IntersectWithDataSet
+            (
+                    inverted_index,
+                    intersection_result,
+                    (uint32_t) selected_data_1_array,
+
+                    source_int_values_2->data_struct.data [selected_data_2_array],
+                    source_int_values_2->arrays_lengths [selected_data_2_array],
+                    worker->shared->scalar_kernel_order
+            );
+        }
+        else
+        {
             IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
             (
                     intersection_result,
+                    worker->intersection_guards,
 
                     source_int_values_1->data_struct.data [selected_data_1_array],
                     source_int_values_1->data_struct.char_offsets [selected_data_1_array],
@@ -742,297 +1569,349 @@ Exec_Intersection
                     source_int_values_2->data_struct.data [selected_data_2_array],
                     source_int_values_2->arrays_lengths [selected_data_2_array]
             );
+        }
 
 
-            // Remove stop words from the result
-            const size_t array_length = intersection_result->arrays_lengths [0];
-            size_t tokens_left = array_length;
-            for (size_t i = 0; i < array_length; ++ i)
+        // Remove stop words from the result
+        const size_t array_length = intersection_result->arrays_lengths [0];
+        size_t tokens_left = array_length;
+        for (size_t i = 0; i < array_length; ++ i)
+        {
+            // Is the token in the list with the stop words ? (The flag was determined, when the token was mapped)
+            if (TokenIntMapping_IsStopWord(token_int_mapping, intersection_result->data_struct.data [0][i]))
             {
-                // Reverse the mapping to get the original token (int -> token)
-                const char* int_to_token_mem = TokenIntMapping_IntToTokenStaticMem(token_int_mapping,
-                        intersection_result->data_struct.data [0][i]);
-
-                // Is the token in the list with the stop words ?
-                if (Is_Word_In_Stop_Word_List(int_to_token_mem, strlen (int_to_token_mem), ENG))
-                {
-                    // Override the mapped int value
-                    intersection_result->data_struct.data [0][i] = IN_STOP_WORD_LIST;
-                    -- tokens_left;
-                }
+                // Override the mapped int value
+                intersection_result->data_struct.data [0][i] = IN_STOP_WORD_LIST;
+                -- tokens_left;
             }
+        }
 
-            // Show only the data block, if there are a valid number of intersection results
-            // In default cases a valid data block needs to contain at least 2 (!) tokens
-            if (DocumentWordList_IsDataInObject(intersection_result) && tokens_left >= min_token_left_for_valid_data_set)
+        // Show only the data block, if there are a valid number of intersection results
+        // In default cases a valid data block needs to contain at least 2 (!) tokens
+        if (DocumentWordList_IsDataInObject(intersection_result) && tokens_left >= min_token_left_for_valid_data_set)
+        {
+            // "selected_data_2_array" is the counter for the outer loop
+            // This test has the effect, that the tokens array only appear once for each outer element
+            if (selected_data_2_array != last_used_selected_data_2_array)
             {
-                // "selected_data_2_array" is the counter for the outer loop
-                // This test has the effect, that the tokens array only appear once for each outer element
-                if (selected_data_2_array != last_used_selected_data_2_array)
-                {
-                    last_used_selected_data_2_array = selected_data_2_array;
+                last_used_selected_data_2_array = selected_data_2_array;
 
-                    cJSON_NEW_ARR_CHECK(src_tokens_array);
-                    cJSON_NEW_ARR_CHECK(src_tokens_array_wo_stop_words);
+                cJSON_NEW_ARR_CHECK(src_tokens_array);
+                cJSON_NEW_ARR_CHECK(src_tokens_array_wo_stop_words);
 
-                    for (size_t i = 0; i < source_int_values_2->arrays_lengths [selected_data_2_array]; ++ i)
+                for (size_t i = 0; i < source_int_values_2->arrays_lengths [selected_data_2_array]; ++ i)
+                {
+                    const DATA_TYPE src_token_int = source_int_values_2->data_struct.data [selected_data_2_array][i];
+                    // Reverse the mapping to get the original token (int -> token)
+                    const char* int_to_token_mem = TokenIntMapping_IntToTokenPtr(token_int_mapping, src_token_int);
+
+                    // Is the token a stop word ?
+                    if (! TokenIntMapping_IsStopWord(token_int_mapping, src_token_int))
                     {
-                        // Reverse the mapping to get the original token (int -> token)
-                        const char* int_to_token_mem = TokenIntMapping_IntToTokenStaticMem(token_int_mapping,
-                                source_int_values_2->data_struct.data [selected_data_2_array][i]);
-
-                        // Is the token a stop word ?
-                        if (! Is_Word_In_Stop_Word_List(int_to_token_mem, strlen (int_to_token_mem), ENG))
-                        {
-                            cJSON_NEW_STR_CHECK(src_token_no_stop_word, int_to_token_mem);
-                            cJSON_ADD_ITEM_TO_ARRAY_CHECK(src_tokens_array_wo_stop_words, src_token_no_stop_word);
-                        }
-                        cJSON_NEW_STR_CHECK(src_token, int_to_token_mem);
-                        cJSON_ADD_ITEM_TO_ARRAY_CHECK(src_tokens_array, src_token);
+                        cJSON_NEW_STR_CHECK(src_token_no_stop_word, int_to_token_mem);
+                        cJSON_ADD_ITEM_TO_ARRAY_CHECK(src_tokens_array_wo_stop_words, src_token_no_stop_word);
                     }
-                    cJSON_ADD_ITEM_TO_OBJECT_CHECK(outer_object, "tokens", src_tokens_array);
-                    cJSON_ADD_ITEM_TO_OBJECT_CHECK(outer_object, "tokens w/o stop words", src_tokens_array_wo_stop_words);
+                    cJSON_NEW_STR_CHECK(src_token, int_to_token_mem);
+                    cJSON_ADD_ITEM_TO_ARRAY_CHECK(src_tokens_array, src_token);
                 }
+                cJSON_ADD_ITEM_TO_OBJECT_CHECK(outer_object, "tokens", src_tokens_array);
+                cJSON_ADD_ITEM_TO_OBJECT_CHECK(outer_object, "tokens w/o stop words", src_tokens_array_wo_stop_words);
+            }
 
-                cJSON_NEW_ARR_CHECK(char_offset_array);
-                if (SENTENCE_OFFSET_BIT(intersection_settings)) { cJSON_NEW_ARR_CHECK(sentence_offset_array); }
-                if (WORD_OFFSET_BIT(intersection_settings))     { cJSON_NEW_ARR_CHECK(word_offset_array); }
-                cJSON_NEW_ARR_CHECK(tokens_array);
-
-                //fputs("Found tokens_array in:\n", result_file);
-                // In the intersection result is always only one array ! Therefore a second loop is not necessary
-                for (size_t i = 0; i < intersection_result->arrays_lengths [0]; ++ i)
-                {
-                    if (intersection_result->data_struct.data [0][i] == IN_STOP_WORD_LIST) { continue; }
-
-                    // Reverse the mapping to get the original token (int -> token)
-                    const char* int_to_token_mem = TokenIntMapping_IntToTokenStaticMem(token_int_mapping,
-                            intersection_result->data_struct.data [0][i]);
+            cJSON_NEW_ARR_CHECK(char_offset_array);
+            if (SENTENCE_OFFSET_BIT(intersection_settings)) { cJSON_NEW_ARR_CHECK(sentence_offset_array); }
+            if (WORD_OFFSET_BIT(intersection_settings))     { cJSON_NEW_ARR_CHECK(word_offset_array); }
+            cJSON_NEW_ARR_CHECK(tokens_array);
 
-                    cJSON* sentence_offset = NULL;
-                    cJSON* word_offset = NULL;
-                    cJSON* char_offset = cJSON_CreateNumber(intersection_result->data_struct.char_offsets [0][i]);
-                    ASSERT_MSG(char_offset != NULL, "char offset is NULL !");
+            //fputs("Found tokens_array in:\n", result_file);
+            // In the intersection result is always only one array ! Therefore a second loop is not necessary
+            for (size_t i = 0; i < intersection_result->arrays_lengths [0]; ++ i)
+            {
+                if (intersection_result->data_struct.data [0][i] == IN_STOP_WORD_LIST) { continue; }
 
-                    if (SENTENCE_OFFSET_BIT(intersection_settings))
-                    {
-                        sentence_offset = cJSON_CreateNumber(intersection_result->data_struct.sentence_offsets [0][i]);
-                        ASSERT_MSG(sentence_offset != NULL, "sentence offset is NULL !");
-                    }
-                    if (WORD_OFFSET_BIT(intersection_settings))
-                    {
-                        word_offset = cJSON_CreateNumber(intersection_result->data_struct.word_offsets [0][i]);
-                        ASSERT_MSG(word_offset != NULL, "word offset is NULL !");
-                    }
+                // Reverse the mapping to get the original token (int -> token)
+                const char* int_to_token_mem = TokenIntMapping_IntToTokenPtr(token_int_mapping,
+                        intersection_result->data_struct.data [0][i]);
 
-                    cJSON_NEW_STR_CHECK(token, int_to_token_mem);
-                    cJSON_ADD_ITEM_TO_ARRAY_CHECK(char_offset_array, char_offset);
-                    if (SENTENCE_OFFSET_BIT(intersection_settings)) { cJSON_ADD_ITEM_TO_ARRAY_CHECK(sentence_offset_array, sentence_offset); }
-                    if (WORD_OFFSET_BIT(intersection_settings))     { cJSON_ADD_ITEM_TO_ARRAY_CHECK(word_offset_array, word_offset); }
-                    cJSON_ADD_ITEM_TO_ARRAY_CHECK(tokens_array, token);
-                }
+                cJSON* sentence_offset = NULL;
+                cJSON* word_offset = NULL;
+                cJSON* char_offset = cJSON_CreateNumber(intersection_result->data_struct.char_offsets [0][i]);
+                ASSERT_MSG(char_offset != NULL, "char offset is NULL !");
 
-                // Create a object for the tow arrays (tokens / offset)
-                cJSON* two_array_container = NULL;
-                cJSON_NEW_OBJ_CHECK(two_array_container);
-                cJSON_AddItemToObject(two_array_container, "tokens", tokens_array);
-                cJSON_AddItemToObject(two_array_container, "char " OFFSET, char_offset_array);
-                cJSON_AddItemToObject(two_array_container, "sentence " OFFSET, sentence_offset_array);
-                cJSON_AddItemToObject(two_array_container, "word " OFFSET, word_offset_array);
-
-                // Add data to the specific cJSON object
-                // For the comparison it is important to use "src_tokens_array_wo_stop_words" instead of
-                // "src_tokens_array"; Because a full match means a equalness with the list, that contains NO stop
-                // words !
-                const int tokens_array_size = cJSON_GetArraySize(tokens_array);
-                if (tokens_array_size == cJSON_GetArraySize(src_tokens_array_wo_stop_words))
+                if (SENTENCE_OFFSET_BIT(intersection_settings))
                 {
-                    if (FULL_MATCH_BIT(intersection_settings))
-                    {
-                        cJSON_ADD_ITEM_TO_OBJECT_CHECK(intersections_full_match,
-                                token_container_input_1->token_lists [selected_data_1_array].dataset_id, two_array_container);
-                    }
-                    else
-                    {
-                        // If full matches are not allowed for the result file, the two_array_container cJSON object
-                        // will loose the connection to other cJSON files and cannot be deleted at the end of the outer
-                        // loop
-                        cJSON_FULL_FREE_AND_SET_TO_NULL(two_array_container);
-                    }
-                    counter_full_sets ++;
-                    counter_tokens_in_full_sets += (uint_fast64_t) tokens_array_size;
+                    sentence_offset = cJSON_CreateNumber(intersection_result->data_struct.sentence_offsets [0][i]);
+                    ASSERT_MSG(sentence_offset != NULL, "sentence offset is NULL !");
                 }
-                else
+                if (WORD_OFFSET_BIT(intersection_settings))
                 {
-                    if (PART_MATCH_BIT(intersection_settings))
-                    {
-                        cJSON_ADD_ITEM_TO_OBJECT_CHECK(intersections_partial_match,
-                                token_container_input_1->token_lists [selected_data_1_array].dataset_id, two_array_container);
-                    }
-                    else
-                    {
-                        // If part matches are not allowed for the result file, the two_array_container cJSON object
-                        // will loose the connection to other cJSON files and cannot be deleted at the end of the outer
-                        // loop
-                        cJSON_FULL_FREE_AND_SET_TO_NULL(two_array_container);
-                    }
-                    counter_partial_sets ++;
-                    counter_tokens_in_partital_sets += (uint_fast64_t) tokens_array_size;
+                    word_offset = cJSON_CreateNumber(intersection_result->data_struct.word_offsets [0][i]);
+                    ASSERT_MSG(word_offset != NULL, "word offset is NULL !");
                 }
-            }
 
-            if ((selected_data_1_array + 1) >= source_int_values_1->next_free_array)
-            {
-                strncpy (dataset_id_2, token_container_input_2->token_lists [selected_data_2_array].dataset_id,
-                        COUNT_ARRAY_ELEMENTS(dataset_id_2) - 1);
-                dataset_id_2 [COUNT_ARRAY_ELEMENTS(dataset_id_2) - 1] = '\0';
+                cJSON_NEW_STR_CHECK(token, int_to_token_mem);
+                cJSON_ADD_ITEM_TO_ARRAY_CHECK(char_offset_array, char_offset);
+                if (SENTENCE_OFFSET_BIT(intersection_settings)) { cJSON_ADD_ITEM_TO_ARRAY_CHECK(sentence_offset_array, sentence_offset); }
+                if (WORD_OFFSET_BIT(intersection_settings))     { cJSON_ADD_ITEM_TO_ARRAY_CHECK(word_offset_array, word_offset); }
+                cJSON_ADD_ITEM_TO_ARRAY_CHECK(tokens_array, token);
             }
-        }
-        // ===== ===== ===== ===== ===== END Inner loop ===== ===== ===== ===== =====
 
-        data_found = Update_Data_Found_Flag (intersection_settings, intersections_partial_match,
-                intersections_full_match);
-
-        // Only append the objects from the current outer loop run, when data was found in the inner loop
-        if (data_found)
-        {
-            if (PART_MATCH_BIT(intersection_settings))
-            { cJSON_ADD_ITEM_TO_OBJECT_CHECK(outer_object, INTERSECTIONS " (partial)", intersections_partial_match); }
-            if (FULL_MATCH_BIT(intersection_settings))
-            { cJSON_ADD_ITEM_TO_OBJECT_CHECK(outer_object, INTERSECTIONS " (full)", intersections_full_match); }
-            cJSON_ADD_ITEM_TO_OBJECT_CHECK(export_results, dataset_id_2, outer_object);
-
-            if (FORMATTING_ENABLED(intersection_settings))
+            // Create a object for the tow arrays (tokens / offset)
+            cJSON* two_array_container = NULL;
+            cJSON_NEW_OBJ_CHECK(two_array_container);
+            cJSON_AddItemToObject(two_array_container, "tokens", tokens_array);
+            cJSON_AddItemToObject(two_array_container, "char " OFFSET, char_offset_array);
+            cJSON_AddItemToObject(two_array_container, "sentence " OFFSET, sentence_offset_array);
+            cJSON_AddItemToObject(two_array_container, "word " OFFSET, word_offset_array);
+
+            // Add data to the specific cJSON object
+            // For the comparison it is important to use "src_tokens_array_wo_stop_words" instead of
+            // "src_tokens_array"; Because a full match means a equalness with the list, that contains NO stop
+            // words !
+            const int tokens_array_size = cJSON_GetArraySize(tokens_array);
+            if (tokens_array_size == cJSON_GetArraySize(src_tokens_array_wo_stop_words))
             {
-                if (first_result_dataset_written)
+                if (FULL_MATCH_BIT(intersection_settings))
+                {
+                    cJSON_ADD_ITEM_TO_OBJECT_CHECK(intersections_full_match,
+                            token_container_input_1->token_lists [selected_data_1_array].dataset_id, two_array_container);
+                }
+                else
                 {
-                    file_operation_ret_value = fputc(',', result_file);
-                    ASSERT_FMSG(file_operation_ret_value != EOF, "Error while writing in the file \"%s\": %s",
-                            GLOBAL_CLI_OUTPUT_FILE, strerror(errno));
-                    ++ result_file_size;
+                    // If full matches are not allowed for the result file, the two_array_container cJSON object
+                    // will loose the connection to other cJSON files and cannot be deleted at the end of the outer
+                    // loop
+                    cJSON_FULL_FREE_AND_SET_TO_NULL(two_array_container);
                 }
+                worker->counter_full_sets ++;
+                worker->counter_tokens_in_full_sets += (uint_fast64_t) tokens_array_size;
             }
             else
             {
-                if (first_result_dataset_written)
+                if (PART_MATCH_BIT(intersection_settings))
                 {
-                    file_operation_ret_value = fputs(",\n", result_file);
-                    ASSERT_FMSG(file_operation_ret_value != EOF, "Error while writing in the file \"%s\": %s",
-                            GLOBAL_CLI_OUTPUT_FILE, strerror(errno));
-                    result_file_size += STATIC_STRLEN(",\n");
-                }
-            }
-
-            // In theory it is possible to create the string of our cJSON structure at the end of all calculations
-            // But the problem is, that all temporary data needs to be saved until the end of calculations. With bigger
-            // files more than 15 GB are possible !
-            // Second problem: The string, that will be created from cJSON_PrintBuffered, is in some cases too large for
-            // a single call at the end.
-            // So the only possibility: Intermediate calls
-            char* json_export_str = cJSON_PrintBuffered(export_results, CJSON_PRINT_BUFFER_SIZE,
-                    FORMATTING_ENABLED(intersection_settings)); // No shorten output => Use formatting
-
-            ASSERT_MSG(json_export_str != NULL, "JSON export string is NULL !");
-            const size_t json_export_str_len = strlen (json_export_str);
-
-            // Removing the trailing closing bracket and the newline (in a formatted output)
-            // These steps are necessary, because the string objects meant to be stand alone JSON objects
-            // But in our case we concatenate these JSON objects. So it is necessary to modify the objects for a valid
-            // JSON result file
-            json_export_str [json_export_str_len - 1] = '\0';
-            // Remove the newline in a formatted output
-            if (FORMATTING_ENABLED(intersection_settings))
-            { json_export_str [json_export_str_len - 2] = '\0'; }
-
-            // Ignore the first char (The opening bracket)
-            file_operation_ret_value = fputs(json_export_str + 1, result_file);
-            ASSERT_FMSG(file_operation_ret_value != EOF, "Error while writing in the file \"%s\": %s",
-                    GLOBAL_CLI_OUTPUT_FILE, strerror(errno));
-            result_file_size = result_file_size + (json_export_str_len - ((FORMATTING_ENABLED(intersection_settings)) ? 3 : 2));
-
-            // Don't use the macro "FREE_AND_SET_TO_NULL" because it increases the free counter. But this memory was
-            // allocated from the JSON lib !
-            free(json_export_str);
-            json_export_str = NULL;
-
-            // Delete the full object will all child-objectsintersection_sets_found_counter
-            // This is the reason why this call is enough to cleanup the full structure
-            cJSON_FULL_FREE_AND_SET_TO_NULL(export_results);
-
-            first_result_dataset_written = true;
+                    cJSON_ADD_ITEM_TO_OBJECT_CHECK(intersections_partial_match,
+                            token_container_input_1->token_lists [selected_data_1_array].dataset_id, two_array_container);
+                }
+                else
+                {
+                    // If part matches are not allowed for the result file, the two_array_container cJSON object
+                    // will loose the connection to other cJSON files and cannot be deleted at the end of the outer
+                    // loop
+                    cJSON_FULL_FREE_AND_SET_TO_NULL(two_array_container);
+                }
+                worker->counter_partial_sets ++;
+                worker->counter_tokens_in_partial_sets += (uint_fast64_t) tokens_array_size;
+            }
         }
-        else
+    }
+    // ===== ===== ===== ===== ===== END Inner loop ===== ===== ===== ===== =====
+
+    if (progress != NULL)
+    {
+        if (progress->aborted)
         {
-            // When there are no new data, there is no connection between these four objects. So every object needs to
-            // be deleted manually
+            // Data of a incomplete inner loop will not be exported
             cJSON_FULL_FREE_AND_SET_TO_NULL(intersections_partial_match);
             cJSON_FULL_FREE_AND_SET_TO_NULL(intersections_full_match);
             cJSON_FULL_FREE_AND_SET_TO_NULL(outer_object);
             cJSON_FULL_FREE_AND_SET_TO_NULL(export_results);
+            worker->cJSON_mem_counter += cJSON_mem_counter;
+
+            return NULL;
         }
-    }
-    // ===== ===== ===== ===== ===== ===== ===== ===== END Outer loop ===== ===== ===== ===== ===== ===== ===== =====
 
-    // Label for a debugging end of the calculations
-abort_label:
-    CLOCK_WITH_RETURN_CHECK(end);
+        // The skipped data sets (no candidates of the inverted index) are also part of the calculation progress
+        progress->intersection_call_counter += source_int_values_1->next_free_array - number_of_inner_loop_runs;
+        progress->intersection_calls_before_last_output += source_int_values_1->next_free_array - number_of_inner_loop_runs;
+    }
 
-    DocumentWordList_DeleteObject(intersection_result);
-    intersection_result = NULL;
+    data_found = Update_Data_Found_Flag (intersection_settings, intersections_partial_match,
+            intersections_full_match);
 
-    // If no intersections were found after the whole operation: An ',' too much will remain in the result file
-    // -> Remove them by moving the file pointer one char back
-    if ((counter_tokens_in_full_sets + counter_tokens_in_partital_sets) == 0)
+    // Only append the objects from the current outer loop run, when data was found in the inner loop
+    if (data_found)
     {
-        file_operation_ret_value = fseek(result_file, -1, SEEK_CUR);
-        ASSERT_FMSG(file_operation_ret_value != EOF, "Error while removing a char from the file stream for file \"%s\": %s",
-                GLOBAL_CLI_OUTPUT_FILE, strerror(errno));
-        result_file_size --;
+        if (PART_MATCH_BIT(intersection_settings))
+        { cJSON_ADD_ITEM_TO_OBJECT_CHECK(outer_object, INTERSECTIONS " (partial)", intersections_partial_match); }
+        if (FULL_MATCH_BIT(intersection_settings))
+        { cJSON_ADD_ITEM_TO_OBJECT_CHECK(outer_object, INTERSECTIONS " (full)", intersections_full_match); }
+        cJSON_ADD_ITEM_TO_OBJECT_CHECK(export_results, dataset_id_2, outer_object);
+
+        // In theory it is possible to create the string of our cJSON structure at the end of all calculations
+        // But the problem is, that all temporary data needs to be saved until the end of calculations. With bigger
+        // files more than 15 GB are possible !
+        // Second problem: The string, that will be created from cJSON_PrintBuffered, is in some cases too large for
+        // a single call at the end.
+        // So the only possibility: Intermediate calls
+        json_export_str = cJSON_PrintBuffered(export_results, CJSON_PRINT_BUFFER_SIZE,
+                FORMATTING_ENABLED(intersection_settings)); // No shorten output => Use formatting
+        ASSERT_MSG(json_export_str != NULL, "JSON export string is NULL !");
+
+        // Delete the full object will all child-objects
+        // This is the reason why this call is enough to cleanup the full structure
+        cJSON_FULL_FREE_AND_SET_TO_NULL(export_results);
+    }
+    else
+    {
+        // When there are no new data, there is no connection between these four objects. So every object needs to
+        // be deleted manually
+        cJSON_FULL_FREE_AND_SET_TO_NULL(intersections_partial_match);
+        cJSON_FULL_FREE_AND_SET_TO_NULL(intersections_full_match);
+        cJSON_FULL_FREE_AND_SET_TO_NULL(outer_object);
+        cJSON_FULL_FREE_AND_SET_TO_NULL(export_results);
     }
+    worker->cJSON_mem_counter += cJSON_mem_counter;
 
-    const char* end_file_string = ((! FORMATTING_ENABLED(intersection_settings)) ? "}" : "\n}");
+    return json_export_str;
+}
 
-    file_operation_ret_value = fputs(end_file_string, result_file);
-    ASSERT_FMSG(file_operation_ret_value != EOF, "Error while writing in the file \"%s\": %s", GLOBAL_CLI_OUTPUT_FILE,
-            strerror(errno));
-    result_file_size += STATIC_STRLEN ((! FORMATTING_ENABLED(intersection_settings)) ? "}" : "\n}");
-    FCLOSE_AND_SET_TO_NULL(result_file);
-    printf ("\nDone !");
+//---------------------------------------------------------------------------------------------------------------------
 
-    // Print the counter
-    Print_Counter(counter_tokens_in_partital_sets, counter_tokens_in_full_sets, counter_partial_sets, counter_full_sets, intersection_settings);
+/**
+ * @brief Calculate all free data sets of the current batch.
+ *
+ * Asserts:
+ *      worker != NULL
+ *      worker->batch != NULL
+ *
+ * @param[in] worker Worker, that takes the next free data sets of the batch
+ */
+static void
+Calculate_Free_Data_Sets_Of_Batch
+(
+        struct Intersection_Worker* const worker
+)
+{
+    ASSERT_MSG(worker != NULL, "Intersection worker is NULL !");
+    struct Intersection_Batch* const batch = worker->batch;
+    ASSERT_MSG(batch != NULL, "Batch of the intersection worker is NULL !");
 
-    printf ("cJSON objects memory usage: ");
-    Print_Memory_Size_As_B_KB_MB(cJSON_mem_counter);
+    while (true)
+    {
+        const uint_fast32_t selected_data_2_array = atomic_fetch_add(&batch->next_data_set, 1);
+        if (selected_data_2_array >= batch->end) { break; }
 
-    printf ("\n=> Result file: " ANSI_TEXT_BOLD "%s" ANSI_RESET_ALL, GLOBAL_CLI_OUTPUT_FILE);
-    printf ("\n=> Result file size: " ANSI_TEXT_BOLD);
-    Print_Memory_Size_As_B_KB_MB(result_file_size);
-    printf (ANSI_RESET_ALL);
+        batch->export_strings [selected_data_2_array - batch->begin] =
+                Determine_Intersections_Of_Data_Set(worker, selected_data_2_array, NULL);
+    }
 
-    const uint_fast64_t intersection_tokens_found_counter = counter_tokens_in_full_sets + counter_tokens_in_partital_sets;
-    const uint_fast64_t intersection_sets_found_counter = counter_full_sets + counter_partial_sets;
-    if (number_of_intersection_tokens != NULL)
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Thread function of a intersection worker: Calculate the free data sets of every batch, until all batches are
+ * done.
+ *
+ * The thread waits at the begin barrier of the batch for the next batch and at the end barrier after the calculation.
+ *
+ * Asserts:
+ *      worker != NULL
+ *      worker->batch != NULL
+ *
+ * @param[in] worker Worker (struct Intersection_Worker*)
+ *
+ * @return Always NULL
+ */
+static void*
+Intersection_Worker_Thread
+(
+        void* worker
+)
+{
+    ASSERT_MSG(worker != NULL, "Intersection worker is NULL !");
+    struct Intersection_Worker* const intersection_worker = (struct Intersection_Worker*) worker;
+    struct Intersection_Batch* const batch = intersection_worker->batch;
+    ASSERT_MSG(batch != NULL, "Batch of the intersection worker is NULL !");
+
+    while (true)
     {
-        *number_of_intersection_tokens = intersection_tokens_found_counter;
+        (void) pthread_barrier_wait(&batch->begin_barrier);
+        if (batch->finished) { break; }
+
+        Calculate_Free_Data_Sets_Of_Batch(intersection_worker);
+        (void) pthread_barrier_wait(&batch->end_barrier);
     }
-    if (number_of_intersection_sets != NULL)
+
+    return NULL;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Append the JSON string of a data set to the result file.
+ *
+ * The JSON string will be deleted after the writing.
+ *
+ * Asserts:
+ *      result_file != NULL
+ *      json_export_str != NULL
+ *
+ * @param[in] result_file Already opened result file
+ * @param[in] json_export_str JSON string of the data set (Result of Determine_Intersections_Of_Data_Set())
+ * @param[in] first_result_dataset_written Was a data set already written ? (-> A separator is necessary)
+ * @param[in] export_settings Global export settings (This is necessary to determine, if a formatted output is expected)
+ *
+ * @return The number of written bytes
+ */
+static size_t
+Append_Data_Set_To_Result_File
+(
+        FILE* restrict result_file,
+        char* restrict json_export_str,
+        const _Bool first_result_dataset_written,
+        const unsigned int export_settings
+)
+{
+    ASSERT_MSG(result_file != NULL, "Result file is NULL !");
+    ASSERT_MSG(json_export_str != NULL, "JSON export string is NULL !");
+
+    int file_operation_ret_value = 0;
+    size_t result_file_size = 0;
+
+    if (first_result_dataset_written)
     {
-        *number_of_intersection_sets = intersection_sets_found_counter;
+        if (FORMATTING_ENABLED(export_settings))
+        {
+            file_operation_ret_value = fputc(',', result_file);
+            ASSERT_FMSG(file_operation_ret_value != EOF, "Error while writing in the file \"%s\": %s",
+                    GLOBAL_CLI_OUTPUT_FILE, strerror(errno));
+            ++ result_file_size;
+        }
+        else
+        {
+            file_operation_ret_value = fputs(",\n", result_file);
+            ASSERT_FMSG(file_operation_ret_value != EOF, "Error while writing in the file \"%s\": %s",
+                    GLOBAL_CLI_OUTPUT_FILE, strerror(errno));
+            result_file_size += STATIC_STRLEN(",\n");
+        }
     }
 
-    DocumentWordList_DeleteObject(source_int_values_1);
-    source_int_values_1 = NULL;
-    DocumentWordList_DeleteObject(source_int_values_2);
-    source_int_values_2 = NULL;
-    TokenListContainer_DeleteObject(token_container_input_1);
-    token_container_input_1 = NULL;
-    TokenListContainer_DeleteObject(token_container_input_2);
-    token_container_input_2 = NULL;
-    TokenIntMapping_DeleteObject(token_int_mapping);
-    token_int_mapping = NULL;
+    const size_t json_export_str_len = strlen (json_export_str);
 
-    return result;
+    // Removing the trailing closing bracket and the newline (in a formatted output)
+    // These steps are necessary, because the string objects meant to be stand alone JSON objects
+    // But in our case we concatenate these JSON objects. So it is necessary to modify the objects for a valid
+    // JSON result file
+    json_export_str [json_export_str_len - 1] = '\0';
+    // Remove the newline in a formatted output
+    if (FORMATTING_ENABLED(export_settings))
+    { json_export_str [json_export_str_len - 2] = '\0'; }
+
+    // Ignore the first char (The opening bracket)
+    file_operation_ret_value = fputs(json_export_str + 1, result_file);
+    ASSERT_FMSG(file_operation_ret_value != EOF, "Error while writing in the file \"%s\": %s",
+            GLOBAL_CLI_OUTPUT_FILE, strerror(errno));
+    result_file_size = result_file_size + (json_export_str_len - ((FORMATTING_ENABLED(export_settings)) ? 3 : 2));
+
+    // Don't use the macro "FREE_AND_SET_TO_NULL" because it increases the free counter. But this memory was
+    // allocated from the JSON lib !
+    free(json_export_str);
+    json_export_str = NULL;
+
+    return result_file_size;
 }
 
 //=====================================================================================================================
@@ -1217,7 +2096,124 @@ Add_Counter_To_Export_File
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Add too long tokens from the two input file to a JSON block. (One array for each file)
+ * @brief Save the statistics of the token int mapping (vocabulary, hash table quality and the work of the calls) as
+ * JSON file.
+ *
+ * Asserts:
+ *      token_int_mapping != NULL
+ *      file_name != NULL
+ *      The file can be written
+ *
+ * @param[in] token_int_mapping Token_Int_Mapping object
+ * @param[in] file_name Name of the JSON file
+ */
+static void
+Export_Token_Int_Mapping_Statistics
+(
+        const struct Token_Int_Mapping* const restrict token_int_mapping,
+        const char* const restrict file_name
+)
+{
+    ASSERT_MSG(token_int_mapping != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_MSG(file_name != NULL, "File name of the statistics is NULL !");
+
+    struct Token_Int_Mapping_Statistics statistics;
+    TokenIntMapping_GetStatistics(token_int_mapping, &statistics);
+
+    cJSON* export_statistics = cJSON_CreateObject();
+    cJSON_NOT_NULL(export_statistics);
+
+    // "cJSON_CreateNumber()" can only create double values ! The vendored cJSON prints every value in the int range
+    // without the fractional part; so the ratios will be printed as raw JSON numbers
+    const struct
+    {
+        const char* name;
+        double value;
+        _Bool ratio;
+    } numbers [] =
+    {
+            { "distinct_tokens",            (double) statistics.number_of_tokens,           false },
+            { "hash_table_slots",           (double) statistics.number_of_slots,            false },
+            { "load_factor",                statistics.load_factor,                         true },
+            { "avg_probe_length",           statistics.avg_probe_length,                    true },
+            { "max_probe_length",           (double) statistics.max_probe_length,           false },
+            { "intern_calls",               (double) statistics.intern_calls,               false },
+            { "intern_hits",                (double) statistics.intern_hits,                false },
+            { "intern_hit_rate",            statistics.intern_hit_rate,                     true },
+            { "avg_intern_probe_length",    statistics.avg_intern_probe_length,             true },
+            { "max_intern_probe_length",    (double) statistics.max_intern_probe_length,    false },
+            { "lookup_calls",               (double) statistics.lookup_calls,               false },
+            { "lookup_hits",                (double) statistics.lookup_hits,                false },
+            { "lookup_hit_rate",            statistics.lookup_hit_rate,                     true },
+            { "token_memory_bytes",         (double) statistics.token_memory_used,          false },
+            { "memory_bytes",               (double) statistics.memory_used,                false },
+            { "bytes_per_token",            statistics.bytes_per_token,                     true },
+            { "intern_seconds",             statistics.intern_seconds,                      true },
+            { "lookup_seconds",             statistics.lookup_seconds,                      true }
+    };
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(numbers); ++ i)
+    {
+        cJSON* number = NULL;
+        if (numbers [i].ratio)
+        {
+            // NaN and Inf are no valid JSON numbers
+            char raw_number [32];
+            const int snprintf_ret_value = snprintf(raw_number, sizeof (raw_number), "%.9g",
+                    (isfinite(numbers [i].value)) ? numbers [i].value : 0.0);
+            ASSERT_FMSG(snprintf_ret_value > 0 && (size_t) snprintf_ret_value < sizeof (raw_number),
+                    "Cannot print the statistic value \"%s\" !", numbers [i].name);
+            number = cJSON_AddRawToObject(export_statistics, numbers [i].name, raw_number);
+        }
+        else
+        {
+            number = cJSON_AddNumberToObject(export_statistics, numbers [i].name, numbers [i].value);
+        }
+        cJSON_NOT_NULL(number);
+    }
+
+    // Bucket i: Saved tokens with the probe length i + 1 (The last bucket contains all longer probes, too)
+    cJSON* histogram = cJSON_CreateArray();
+    cJSON_NOT_NULL(histogram);
+    for (size_t i = 0; i < PROBE_LENGTH_HISTOGRAM_SIZE; ++ i)
+    {
+        cJSON* bucket = cJSON_CreateNumber((double) statistics.probe_length_histogram [i]);
+        cJSON_NOT_NULL(bucket);
+        cJSON_ADD_ITEM_TO_ARRAY_CHECK(histogram, bucket);
+    }
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(export_statistics, "probe_length_histogram", histogram);
+
+    cJSON* time_measured = cJSON_AddBoolToObject(export_statistics, "time_measured", statistics.time_measured);
+    cJSON_NOT_NULL(time_measured);
+    cJSON* from_snapshot = cJSON_AddBoolToObject(export_statistics, "from_snapshot", statistics.from_snapshot);
+    cJSON_NOT_NULL(from_snapshot);
+
+    char* export_statistics_as_str = cJSON_Print(export_statistics);
+    ASSERT_MSG(export_statistics_as_str != NULL, "JSON statistics string is NULL !");
+
+    FILE* statistics_file = fopen(file_name, "w");
+    ASSERT_FMSG(statistics_file != NULL, "Cannot open/create the statistics file: \"%s\" !", file_name);
+    int file_operation_ret_value = fputs(export_statistics_as_str, statistics_file);
+    ASSERT_FMSG(file_operation_ret_value != EOF, "Error while writing in the file \"%s\": %s", file_name,
+            strerror(errno));
+    file_operation_ret_value = fputc('\n', statistics_file);
+    ASSERT_FMSG(file_operation_ret_value != EOF, "Error while writing in the file \"%s\": %s", file_name,
+            strerror(errno));
+    FCLOSE_AND_SET_TO_NULL(statistics_file);
+
+    // Don't use the macro "FREE_AND_SET_TO_NULL" because it increases the free counter. But this memory was
+    // allocated from the JSON lib !
+    free(export_statistics_as_str);
+    export_statistics_as_str = NULL;
+    cJSON_FULL_FREE_AND_SET_TO_NULL(export_statistics);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Add the long tokens (longer than MAX_TOKEN_LENGTH - 1 chars) from the two input file to a JSON block. (One
+ * array for each file)
  *
  * Asserts:
  *      export_results != NULL
@@ -1229,7 +2225,7 @@ Add_Counter_To_Export_File
  * @param token_container_input_2 Token_List_Container of the first file
  */
 static void
-Add_Too_Long_Tokens_To_Export_File
+Add_Long_Tokens_To_Export_File
 (
         cJSON* const export_results,
         const struct Token_List_Container* const restrict token_container_input_1,
@@ -1240,32 +2236,32 @@ Add_Too_Long_Tokens_To_Export_File
     ASSERT_MSG(token_container_input_1 != NULL, "First Token_List_Container is NULL !");
     ASSERT_MSG(token_container_input_2 != NULL, "Second Token_List_Container is NULL !");
 
-    cJSON* too_long_token_list = cJSON_CreateObject();
-    cJSON_NOT_NULL(too_long_token_list);
+    cJSON* long_token_list = cJSON_CreateObject();
+    cJSON_NOT_NULL(long_token_list);
     cJSON* list_first_file = cJSON_CreateArray();
     cJSON_NOT_NULL(list_first_file);
     cJSON* list_second_file = cJSON_CreateArray();
     cJSON_NOT_NULL(list_second_file);
 
-    // Too long tokens from the first Token_Container_List
-    for (size_t i = 0; i < token_container_input_1->list_of_too_long_token->next_free_c_str; ++ i)
+    // Long tokens from the first Token_Container_List
+    for (size_t i = 0; i < token_container_input_1->list_of_long_tokens->next_free_c_str; ++ i)
     {
-        cJSON* cjson_str = cJSON_CreateString(token_container_input_1->list_of_too_long_token->data [i]);
+        cJSON* cjson_str = cJSON_CreateString(token_container_input_1->list_of_long_tokens->data [i]);
         cJSON_NOT_NULL(cjson_str);
         cJSON_ADD_ITEM_TO_ARRAY_CHECK(list_first_file, cjson_str);
     }
 
-    // Too long tokens from the second Token_Container_List
-    for (size_t i = 0; i < token_container_input_2->list_of_too_long_token->next_free_c_str; ++ i)
+    // Long tokens from the second Token_Container_List
+    for (size_t i = 0; i < token_container_input_2->list_of_long_tokens->next_free_c_str; ++ i)
     {
-        cJSON* cjson_str = cJSON_CreateString(token_container_input_2->list_of_too_long_token->data [i]);
+        cJSON* cjson_str = cJSON_CreateString(token_container_input_2->list_of_long_tokens->data [i]);
         cJSON_NOT_NULL(cjson_str);
         cJSON_ADD_ITEM_TO_ARRAY_CHECK(list_second_file, cjson_str);
     }
 
-    cJSON_ADD_ITEM_TO_OBJECT_CHECK(too_long_token_list, "In first file", list_first_file);
-    cJSON_ADD_ITEM_TO_OBJECT_CHECK(too_long_token_list, "In second file", list_second_file);
-    cJSON_ADD_ITEM_TO_OBJECT_CHECK(export_results, "Too long tokens", too_long_token_list);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(long_token_list, "In first file", list_first_file);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(long_token_list, "In second file", list_second_file);
+    cJSON_ADD_ITEM_TO_OBJECT_CHECK(export_results, "Too long tokens", long_token_list);
 
     return;
 }
@@ -1337,137 +2333,64 @@ Append_cJSON_Object_To_Result_File
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Append the data from a Token_List_Container object (-> data from a input file) to the Token_Int_Mapping.
- *
- * Asserts:
- *      token_list_container != NULL
- *      token_int_mapping != NULL
- *
- * @param token_list_container Token_List_Container object (information from a input file)
- * @param token_int_mapping Token_Int_Mapping
- *
- * @return Number of token that were added to the Token_Int_Mapping
- */
-static uint_fast32_t
-Append_Token_List_Container_Data_To_Token_Int_Mapping
-(
-        const struct Token_List_Container* const restrict token_list_container,
-        struct Token_Int_Mapping* const restrict token_int_mapping
-)
-{
-    ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
-    ASSERT_MSG(token_int_mapping != NULL, "Token_Int_Mapping is NULL !");
-
-    const uint_fast8_t count_steps  = 100;
-    uint_fast32_t inner_loop_runs   = 0;
-    for (uint_fast32_t i = 0; i < token_list_container->next_free_element; ++ i)
-    {
-        inner_loop_runs += token_list_container->token_lists [i].next_free_element;
-    }
-    const uint_fast32_t print_steps = (((uint_fast32_t) inner_loop_runs / count_steps) == 0) ? 1 :
-            ((uint_fast32_t) inner_loop_runs / count_steps);
-    uint_fast32_t inner_loop_runs_before_last_print = 0;
-    uint_fast32_t inner_loop_counter                = 0;
-    uint_fast32_t token_added_to_mapping            = 0;
-
-    _Bool element_added = false;
-    for (uint_fast32_t i = 0; i < token_list_container->next_free_element; ++ i)
-    {
-        for (uint_fast32_t i2 = 0; i2 < token_list_container->token_lists [i].next_free_element; ++ i2)
-        {
-            // Print calculation steps
-            inner_loop_runs_before_last_print = (uint_fast32_t) Process_Printer(print_steps, 
-                    inner_loop_runs_before_last_print, inner_loop_counter, inner_loop_runs, true,
-                    Exec_Add_Token_To_Mapping_Process_Print_Function,
-                    NULL,
-                    NULL);
-
-            char* token = TokenListContainer_GetToken (token_list_container, i, i2);
-            element_added = TokenIntMapping_AddToken(token_int_mapping, token, strlen(token));
-            if (element_added) { ++ token_added_to_mapping; }
-
-            ++ inner_loop_counter;
-            ++ inner_loop_runs_before_last_print;
-        }
-    }
-
-    return token_added_to_mapping;
-}
-
-//---------------------------------------------------------------------------------------------------------------------
-
-/**
- * @brief This function fills the Document_Word_List with data. But this data are the mapped integer values. The mapping
- * information will be uses from the given Token_Int_Mapping.
+ * @brief Fill the Document_Word_List with the mapped integers and the offsets of a Token_List_Container, that was
+ * created with the direct-to-id ingestion.
  *
- * This will prepare the Document_Word_List for the intersection process.
+ * The tokens were already interned while parsing the input file. So only the mapped integers and the offsets need to
+ * be copied. This will prepare the Document_Word_List for the intersection process.
  *
  * Asserts:
- *      token_int_mapping != NULL
  *      token_list_container != NULL
+ *      token_list_container->token_int_mapping != NULL
  *      document_word_list != NULL
  *
- * @param token_int_mapping Token_Int_Mapping object (contains the used mapping information)
- * @param token_list_container Token_List_Container object (contains tokens from a input file)
+ * @param token_list_container Token_List_Container object (contains the mapped tokens from a input file)
  * @param document_word_list Document_Word_List object (result object for the mapped data)
  */
 static void
-Append_Token_Int_Mapping_Data_To_Document_Word_List
+Append_Mapped_Token_List_Container_To_Document_Word_List
 (
-        const struct Token_Int_Mapping* const restrict token_int_mapping,
         const struct Token_List_Container* const restrict token_list_container,
         struct Document_Word_List* const restrict document_word_list
 )
 {
-    ASSERT_MSG(token_int_mapping != NULL, "Token_Int_Mapping is NULL !");
     ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
+    ASSERT_MSG(token_list_container->token_int_mapping != NULL,
+            "Token_List_Container was created without direct-to-id ingestion !");
     ASSERT_MSG(document_word_list != NULL, "Document_Word_List is NULL !");
 
-    const size_t length_of_longest_token_container = TokenListContainer_GetLenghOfLongestTokenList(token_list_container);
-
     // Temp memory for appending data in a block
     // This avoids appending operations for each single value
-    DATA_TYPE* token_int_values = (DATA_TYPE*) CALLOC(length_of_longest_token_container,
-            sizeof (DATA_TYPE));
+    const size_t length_of_longest_token_list = TokenListContainer_GetLenghOfLongestTokenList(token_list_container);
+    DATA_TYPE* token_int_values = (DATA_TYPE*) MALLOC(MAX(length_of_longest_token_list, 1) * sizeof (DATA_TYPE));
     ASSERT_ALLOC(token_int_values, "Cannot allocate memory for token int mapping values !",
-            length_of_longest_token_container * sizeof (DATA_TYPE));
-
-    uint_fast32_t next_free_value = 0;
+            MAX(length_of_longest_token_list, 1) * sizeof (DATA_TYPE));
 
     for (uint_fast32_t i = 0; i < token_list_container->next_free_element; ++ i)
     {
-        memset(token_int_values, '\0', length_of_longest_token_container * sizeof (DATA_TYPE));
-        next_free_value = 0;
-
-        // Map token to int
-        for (uint_fast32_t i2 = 0; i2 < token_list_container->token_lists [i].next_free_element; ++ i2)
+        const struct Token_List* const token_list = &(token_list_container->token_lists [i]);
+        // The data sets of the Document_Word_List need to be aligned with the Token_List objects (See the dataset IDs)
+        if (token_list->next_free_element == 0)
         {
-            char* token = TokenListContainer_GetToken (token_list_container, i, i2);
-            token_int_values [next_free_value] = TokenIntMapping_TokenToInt(token_int_mapping, token, strlen(token));
-            // Is the current token in the dictionary ?
-            ASSERT_FMSG(token_int_values [next_free_value] != IN_STOP_WORD_LIST, "Token \"%s\" is not in the dictionary !",
-                    token);
-            ++ next_free_value;
+            DocumentWordList_AppendEmptyDataSet(document_word_list);
+            continue;
         }
 
-        // Append data
-        if (next_free_value > 0)
+        for (uint_fast32_t i2 = 0; i2 < token_list->next_free_element; ++ i2)
         {
-            // Without sentence offsets and word offsets
-//            DocumentWordList_AppendDataWithOffsets(document_word_list, token_int_values,
-//                    token_list_container->token_lists [i].char_offsets, NULL, next_free_value);
-
-            // With sentence offsets and word offsets
-            DocumentWordList_AppendDataWithThreeTypeOffsets
-            (
-                    document_word_list,
-                    token_int_values,
-                    token_list_container->token_lists [i].char_offsets,
-                    token_list_container->token_lists [i].sentence_offsets,
-                    token_list_container->token_lists [i].word_offsets,
-                    next_free_value
-            );
+            token_int_values [i2] = TokenListContainer_GetTokenIntValue(token_list_container, i, i2);
         }
+
+        // With sentence offsets and word offsets
+        DocumentWordList_AppendDataWithThreeTypeOffsets
+        (
+                document_word_list,
+                token_int_values,
+                token_list->char_offsets,
+                token_list->sentence_offsets,
+                token_list->word_offsets,
+                token_list->next_free_element
+        );
     }
     FREE_AND_SET_TO_NULL(token_int_values);
 
@@ -1476,48 +2399,6 @@ Append_Token_Int_Mapping_Data_To_Document_Word_List
 
 //---------------------------------------------------------------------------------------------------------------------
 
-/**
- * @brief A function, that will be used to show the token int mapping process.
- *
- * The time calculation is a approximate time calculation with time interval information. If the calculation is not
- * linear (this is the normal case), then the calculated time will be in- and decrease while doing the operations.
- *
- * Asserts:
- *      N/A
- *
- * @param print_step_size Number of inner loop calls, that needs to be done, for a new process print
- * @param actual Counter since last process print
- * @param hundred_percent The number of all inner loop calls (see the intersection code)
- * @param interval_begin clock_t value at the begin of the last process print
- * @param interval_end clock_t value since the last process print
- */
-static void
-Exec_Add_Token_To_Mapping_Process_Print_Function
-(
-        const size_t print_step_size,
-        const size_t actual,
-        const size_t hundred_percent,
-        const clock_t interval_begin,
-        const clock_t interval_end
-)
-{
-    const size_t call_counter_interval_begin    = (actual > hundred_percent) ? hundred_percent : actual;
-    const size_t all_calls                      = hundred_percent;
-    const size_t call_counter_interval_end      = (call_counter_interval_begin + print_step_size > all_calls) ?
-            all_calls : (call_counter_interval_begin + print_step_size);
-
-    const float percent     = Determine_Percent(call_counter_interval_begin, all_calls);
-    const float time_left   = Determine_Time_Left(call_counter_interval_begin, call_counter_interval_end,
-            all_calls, interval_end - interval_begin);
-
-    PRINTF_FFLUSH("Add data to token int mapping (%3.2f %% | %.2f sec.)",
-            ceil(Replace_NaN_And_Inf_With_Zero(percent)), Replace_NaN_And_Inf_With_Zero(time_left));
-
-    return;
-}
-
-//---------------------------------------------------------------------------------------------------------------------
-
 #ifndef TIME_LEFT_COUNTER
 #define TIME_LEFT_COUNTER (uint_fast32_t) 20
 #else
@@ -1705,14 +2586,33 @@ Create_Intersection_Settings_With_CLI_Parameter
     {
         intersection_settings |= NO_CREATION_TIME;
     }
-    if (GLOBAL_CLI_SHOW_TOO_LONG_TOKENS)
+    if (GLOBAL_CLI_SHOW_LONG_TOKENS)
     {
-        intersection_settings |= SHOW_TOO_LONG_TOKENS;
+        intersection_settings |= SHOW_LONG_TOKENS;
     }
     if (GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON)
     {
         intersection_settings |= CASE_SENSITIVE;
     }
+    if (GLOBAL_CLI_INVERTED_INDEX)
+    {
+        intersection_settings |= INVERTED_INDEX;
+    }
+    if (GLOBAL_CLI_SORTED_MERGE)
+    {
+        intersection_settings |= SORTED_MERGE;
+    }
+    if (GLOBAL_CLI_DOC_MAJOR)
+    {
+        intersection_settings |= DOC_MAJOR;
+    }
+    // Without part matches only the data sets with all tokens are interesting. The full match candidates will be
+    // determined with the posting lists of the first file. The partial matches will not be calculated; so they are
+    // not part of the counters. (The doc-major mode calculates every candidate and counts the partial matches)
+    if (GLOBAL_CLI_NO_PART_MATCHES && ! GLOBAL_CLI_DOC_MAJOR)
+    {
+        intersection_settings |= FULL_MATCH_ONLY | INVERTED_INDEX;
+    }
 
     return intersection_settings;
 }
@@ -1827,6 +2727,31 @@ Print_Counter
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Is a mapped token a stop word ? (Ignore function for DocumentWordList_CreateSignatures())
+ *
+ * Asserts:
+ *      data != NULL
+ *
+ * @param[in] token Mapped token
+ * @param[in] data Used token int mapping (const struct Token_Int_Mapping*)
+ *
+ * @return true, if the token is a stop word, otherwise false
+ */
+static _Bool
+Is_Stop_Word_Token
+(
+        const DATA_TYPE token,
+        const void* data
+)
+{
+    ASSERT_MSG(data != NULL, "Token int mapping is NULL !");
+
+    return TokenIntMapping_IsStopWord((const struct Token_Int_Mapping*) data, token);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 
 
 #ifdef cJSON_NOT_NULL
@@ -1876,3 +2801,7 @@ Print_Counter
 #ifdef INTERSECTIONS
 #undef INTERSECTIONS
 #endif /* INTERSECTIONS */
+
+#ifdef DATA_SETS_PER_THREAD_AND_BATCH
+#undef DATA_SETS_PER_THREAD_AND_BATCH
+#endif /* DATA_SETS_PER_THREAD_AND_BATCH */
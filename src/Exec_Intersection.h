@@ -77,6 +77,24 @@ Exec_Intersection
         uint_fast64_t* const restrict number_of_intersection_sets
 );
 
+/**
+ * @brief Determine the name of the intersection engine, that Exec_Intersection() will use with the current CLI
+ * parameter.
+ *
+ * The name will be determined with the same intersection settings as in Exec_Intersection(). So the selected kernel
+ * needs to be known before the call.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Name of the intersection engine (Static string)
+ */
+extern const char*
+Exec_Intersection_Engine_Name
+(
+        void
+);
+
 
 
 #ifdef __cplusplus
@@ -22,37 +22,67 @@
 #include "Error_Handling/_Generics.h"
 #include "Print_Tools.h"
 #include "Misc.h"
-#include "JSON_Parser/cJSON.h"
 #include "str2int.h"
 #include "int2str.h"
 #include "Token_Int_Mapping.h"
 #include "String_Tools.h"
 #include "UTF8/utf8.h"
 #include "ANSI_Esc_Seq.h"
+#include "Stop_Words/Stop_Words.h"
+#include <pthread.h>
+#include <stdatomic.h>
 
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
 
 
+
+/**
+ * @brief Number of tokens in a Token_List after the first allocation.
+ *
+ * If a reallocation is necessary, the number will be doubled.
+ */
+#ifndef TOKENS_INITIAL_SIZE
+#define TOKENS_INITIAL_SIZE 16
+#else
+#error "The macro \"TOKENS_INITIAL_SIZE\" is already defined !"
+#endif /* TOKENS_INITIAL_SIZE */
+
+/**
+ * @brief Bytes of one token in the memory block of a Token_List: The handle and the three offsets.
+ */
+#ifndef TOKEN_LIST_BYTES_PER_TOKEN
+#define TOKEN_LIST_BYTES_PER_TOKEN (sizeof (struct Token_Handle) + sizeof (CHAR_OFFSET_TYPE) + \
+        sizeof (WORD_OFFSET_TYPE) + sizeof (SENTENCE_OFFSET_TYPE))
+#else
+#error "The macro \"TOKEN_LIST_BYTES_PER_TOKEN\" is already defined !"
+#endif /* TOKEN_LIST_BYTES_PER_TOKEN */
+
 /**
- * @brief Number of tokens in a Token_List
+ * @brief Initial size of the token memory of a Token_List_Container in bytes.
  *
- * It is also the allocation step size, if a reallocation is necessary.
+ * If a reallocation is necessary, the size will be doubled.
  */
-#ifndef TOKENS_ALLOCATION_STEP_SIZE
-#define TOKENS_ALLOCATION_STEP_SIZE 15
+#ifndef TOKEN_MEMORY_INITIAL_SIZE
+#define TOKEN_MEMORY_INITIAL_SIZE (64 * 1024)
 #else
-#error "The macro \"TOKENS_ALLOCATION_STEP_SIZE\" is already defined !"
-#endif /* TOKENS_ALLOCATION_STEP_SIZE */
+#error "The macro \"TOKEN_MEMORY_INITIAL_SIZE\" is already defined !"
+#endif /* TOKEN_MEMORY_INITIAL_SIZE */
 
 /**
- * @brief Number of Token_Lists in a Token_List_Container
+ * @brief Number of Token_Lists in a new Token_List_Container
  *
- * It is also the allocation step size, if a reallocation is necessary.
+ * If a reallocation is necessary, the number will be doubled.
  */
-#ifndef TOKEN_CONTAINER_ALLOCATION_STEP_SIZE
-#define TOKEN_CONTAINER_ALLOCATION_STEP_SIZE 4
+#ifndef TOKEN_CONTAINER_INITIAL_SIZE
+#define TOKEN_CONTAINER_INITIAL_SIZE 16
 #else
-#error "The macro \"TOKEN_CONTAINER_ALLOCATION_STEP_SIZE\" is already defined !"
-#endif /* TOKEN_CONTAINER_ALLOCATION_STEP_SIZE */
+#error "The macro \"TOKEN_CONTAINER_INITIAL_SIZE\" is already defined !"
+#endif /* TOKEN_CONTAINER_INITIAL_SIZE */
 
 /**
  * @brief Name of the JSON array with the tokens.
@@ -72,15 +102,103 @@
 #error "The macro \"JSON_CHAR_OFFSET_ARRAY_NAME\" is already defined !"
 #endif /* JSON_CHAR_OFFSET_ARRAY_NAME */
 
+/**
+ * @brief Initial size of the line buffer in bytes. (Holds the copies of the text lines and the lines of the buffered
+ * reading)
+ *
+ * If a reallocation is necessary, the size will be doubled.
+ */
+#ifndef LINE_BUFFER_INITIAL_SIZE
+#define LINE_BUFFER_INITIAL_SIZE 4096
+#else
+#error "The macro \"LINE_BUFFER_INITIAL_SIZE\" is already defined !"
+#endif /* LINE_BUFFER_INITIAL_SIZE */
+
+/**
+ * @brief Size of the stdio buffer for input files, that cannot be mapped in the memory. (E.g. pipes)
+ */
+#ifndef INPUT_FILE_STDIO_BUFFER_SIZE
+#define INPUT_FILE_STDIO_BUFFER_SIZE (1024 * 1024)
+#else
+#error "The macro \"INPUT_FILE_STDIO_BUFFER_SIZE\" is already defined !"
+#endif /* INPUT_FILE_STDIO_BUFFER_SIZE */
+
+/**
+ * @brief Max. nesting depth of arrays and objects in a JSON fragment. (The same limit as in cJSON)
+ */
+#ifndef JSON_NESTING_LIMIT
+#define JSON_NESTING_LIMIT 1000
+#else
+#error "The macro \"JSON_NESTING_LIMIT\" is already defined !"
+#endif /* JSON_NESTING_LIMIT */
+
+/**
+ * @brief Initial number of char offsets, that the JSON parser can hold for one dataset.
+ *
+ * If a reallocation is necessary, the size will be doubled.
+ */
+#ifndef JSON_CHAR_OFFSETS_INITIAL_SIZE
+#define JSON_CHAR_OFFSETS_INITIAL_SIZE 256
+#else
+#error "The macro \"JSON_CHAR_OFFSETS_INITIAL_SIZE\" is already defined !"
+#endif /* JSON_CHAR_OFFSETS_INITIAL_SIZE */
+
+/**
+ * @brief Number of chunks per thread in the parallel parsing of one input file. More chunks than threads result in a
+ * better load balancing.
+ */
+#ifndef INPUT_CHUNKS_PER_THREAD
+#define INPUT_CHUNKS_PER_THREAD 4
+#else
+#error "The macro \"INPUT_CHUNKS_PER_THREAD\" is already defined !"
+#endif /* INPUT_CHUNKS_PER_THREAD */
+
+/**
+ * @brief Min. size of a chunk in bytes in the parallel parsing of one input file. Smaller files will be parsed with
+ * less threads.
+ */
+#ifndef INPUT_CHUNK_MIN_SIZE
+#define INPUT_CHUNK_MIN_SIZE (64 * 1024)
+#else
+#error "The macro \"INPUT_CHUNK_MIN_SIZE\" is already defined !"
+#endif /* INPUT_CHUNK_MIN_SIZE */
+
 /**
  * @brief Check, whether the macro values are valid.
  */
 #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
-_Static_assert(TOKENS_ALLOCATION_STEP_SIZE > 0, "The marco \"TOKENS_ALLOCATION_STEP_SIZE\" is zero !");
-_Static_assert(TOKEN_CONTAINER_ALLOCATION_STEP_SIZE > 0, "The marco \"TOKEN_CONTAINER_ALLOCATION_STEP_SIZE\" is zero !");
+_Static_assert(LINE_BUFFER_INITIAL_SIZE >= 4, "The marco \"LINE_BUFFER_INITIAL_SIZE\" needs to be at least 4 !");
+_Static_assert(INPUT_FILE_STDIO_BUFFER_SIZE > 0, "The marco \"INPUT_FILE_STDIO_BUFFER_SIZE\" is zero !");
+
+IS_TYPE(LINE_BUFFER_INITIAL_SIZE, int)
+IS_TYPE(INPUT_FILE_STDIO_BUFFER_SIZE, int)
+
+_Static_assert(JSON_NESTING_LIMIT > 0, "The marco \"JSON_NESTING_LIMIT\" is zero !");
+_Static_assert(JSON_CHAR_OFFSETS_INITIAL_SIZE > 0, "The marco \"JSON_CHAR_OFFSETS_INITIAL_SIZE\" is zero !");
+
+IS_TYPE(JSON_NESTING_LIMIT, int)
+IS_TYPE(JSON_CHAR_OFFSETS_INITIAL_SIZE, int)
+
+_Static_assert(INPUT_CHUNKS_PER_THREAD > 0, "The marco \"INPUT_CHUNKS_PER_THREAD\" is zero !");
+_Static_assert(INPUT_CHUNK_MIN_SIZE > 0, "The marco \"INPUT_CHUNK_MIN_SIZE\" is zero !");
 
-IS_TYPE(TOKENS_ALLOCATION_STEP_SIZE, int)
-IS_TYPE(TOKEN_CONTAINER_ALLOCATION_STEP_SIZE, int)
+IS_TYPE(INPUT_CHUNKS_PER_THREAD, int)
+IS_TYPE(INPUT_CHUNK_MIN_SIZE, int)
+
+_Static_assert(TOKENS_INITIAL_SIZE > 0, "The marco \"TOKENS_INITIAL_SIZE\" is zero !");
+_Static_assert(TOKEN_CONTAINER_INITIAL_SIZE > 0, "The marco \"TOKEN_CONTAINER_INITIAL_SIZE\" is zero !");
+// The columns in the memory block of a Token_List are ordered by their alignment; so every column is aligned
+_Static_assert(sizeof (struct Token_Handle) % _Alignof(CHAR_OFFSET_TYPE) == 0,
+        "The char offsets needs to be moved to another position in the memory block of a Token_List !");
+_Static_assert(sizeof (CHAR_OFFSET_TYPE) % _Alignof(WORD_OFFSET_TYPE) == 0,
+        "The word offsets needs to be moved to another position in the memory block of a Token_List !");
+_Static_assert(sizeof (WORD_OFFSET_TYPE) % _Alignof(SENTENCE_OFFSET_TYPE) == 0,
+        "The sentence offsets needs to be moved to another position in the memory block of a Token_List !");
+_Static_assert(TOKEN_MEMORY_INITIAL_SIZE > 0, "The marco \"TOKEN_MEMORY_INITIAL_SIZE\" is zero !");
+
+IS_TYPE(TOKENS_INITIAL_SIZE, int)
+IS_TYPE(TOKEN_MEMORY_INITIAL_SIZE, int)
+IS_TYPE(TOKEN_CONTAINER_INITIAL_SIZE, int)
 
 _Static_assert(sizeof(JSON_TOKENS_ARRAY_NAME) > 0 + 1, "The macro \"JSON_TOKENS_ARRAY_NAME\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(JSON_CHAR_OFFSET_ARRAY_NAME) > 0 + 1, "The macro \"JSON_CHAR_OFFSET_ARRAY_NAME\" needs at least one char (plus '\0') !");
@@ -89,28 +207,127 @@ IS_CONST_STR(JSON_CHAR_OFFSET_ARRAY_NAME)
 #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ */
 
 /**
- * @brief Calculate the begin of the next free token in a Token_List.
+ * @brief An opened input file.
+ *
+ * Regular files will be mapped in the memory (read-only) and parsed directly from the mapped pages; there is no copy of
+ * the whole file. Other files (e.g. pipes) and systems without mmap() use the buffered reading with stdio. In both
+ * cases at most one line will be held in the line buffer at a time.
+ */
+struct Input_File
+{
+    const char* mapped_data;        ///< Mapped file content or NULL, if the buffered reading is used
+    size_t mapped_size;             ///< Size of the mapping in bytes
+    size_t position;                ///< Position of the next line in the mapping
+
+    FILE* file;                     ///< File for the buffered reading or NULL, if the file is mapped
+
+    /**
+     * @brief Line buffer with a null terminated line.
+     *
+     * There is always one spare byte after the terminator byte of the line. So the text tokenization can append a
+     * delimiter at the end of the line.
+     */
+    char* line_buffer;
+    size_t line_buffer_size;        ///< Allocated bytes of the line buffer
+
+    size_t file_size;               ///< Size of the file in bytes (0: Unknown, e.g. with a pipe)
+};
+
+/**
+ * @brief State of the streaming JSON parser.
+ *
+ * The parser is specialized for the schema of the input data:
+ * {"<dataset ID>": {"tokens": ["...", ...], "abs_char_offsets": [0, ...], ...}, ...}
+ *
+ * It scans the bytes of a JSON fragment once and appends the tokens directly to the container. So there is no tree of
+ * dynamic allocated nodes like in cJSON. Tokens without escape sequences will be copied directly from the input; the
+ * other tokens will be decoded directly in the token memory. The syntax rules are the same as in cJSON.
+ */
+struct JSON_Parser
+{
+    const char* position;                       ///< Current position (After a syntax error: Position of the error)
+    const char* end;                            ///< End of the parsable data (exclusive)
+    int depth;                                  ///< Current nesting depth of arrays and objects
+
+    struct Token_List_Container* container;     ///< Container, that receives the tokens
+    char dataset_id [DATASET_ID_LENGTH];        ///< Decoded (and truncated) ID of the current dataset
+
+    int* char_offsets;                          ///< Char offsets of the current dataset (From the data)
+    size_t number_of_char_offsets;              ///< Number of char offsets of the current dataset
+    size_t allocated_char_offsets;              ///< Allocated number of char offsets
+
+    uint_fast32_t tokens_found;                 ///< Tokens found in the current JSON fragment
+    uint_fast32_t sum_tokens_found;             ///< Tokens found in all valid JSON fragments
+
+    _Bool print_tokens_read;                    ///< Print the number of read tokens while parsing ? (One line files)
+    size_t tokens_read_before_last_output;      ///< Tokens read since the last print
+};
+
+/**
+ * @brief Part of a JSON fragment, that will be parsed.
+ *
+ * The top level object of a large single line JSON file can be split between its members; so the parts can be parsed
+ * in parallel.
+ */
+enum JSON_Fragment_Part
+{
+    JSON_WHOLE_FRAGMENT = 0,        ///< The whole JSON fragment
+    JSON_FIRST_PART,                ///< From the '{' of the top level object to the ',' before a later member
+    JSON_MIDDLE_PART,               ///< From the ',' before a member to the ',' before a later member
+    JSON_LAST_PART                  ///< From the ',' before a member to the '}' of the top level object (inclusive)
+};
+
+/**
+ * @brief Append a token to the token memory of the container and save the handle as next token of the Token_List.
+ *
+ * The Token_List needs enough memory for the new handle !
  *
  * Asserts:
+ *      token_list_container != NULL
  *      token_list != NULL
+ *      token != NULL
  *
+ * @param[in] token_list_container Token_List_Container object
  * @param[in] token_list Token_List object
+ * @param[in] token The new token (It doesn't need to be null terminated)
+ * @param[in] token_length Length of the new token
+ */
+static void
+Append_Token
+(
+        struct Token_List_Container* const restrict token_list_container,
+        struct Token_List* const restrict token_list,
+        const char* const restrict token,
+        const size_t token_length
+);
+
+/**
+ * @brief Make sure, that the token memory of the container has at least the given number of unused bytes.
+ *
+ * If a reallocation is necessary, the size will be doubled.
+ *
+ * Asserts:
+ *      token_list_container != NULL
  *
- * @return Pointer to the begin of the next free token
+ * @param[in] token_list_container Token_List_Container object
+ * @param[in] needed_bytes Number of needed unused bytes
  */
-static char*
-Get_Address_Of_Next_Free_Token
+static void
+Reserve_Token_Memory
 (
-        const struct Token_List* const token_list
+        struct Token_List_Container* const token_list_container,
+        const size_t needed_bytes
 );
 
 /**
  * @brief Calculate the begin of the token specified with an index in a Token_List.
  *
  * Asserts:
+ *      token_list_container != NULL
  *      token_list != NULL
  *      token_index < allocated_tokens
  *
+ * @param[in] token_list_container Token_List_Container object, that holds the token memory
  * @param[in] token_list Token_List object
  * @param[in] token_index Index of the token
  *
@@ -119,6 +336,7 @@ Get_Address_Of_Next_Free_Token
 static char*
 Get_Address_Of_Token
 (
+        const struct Token_List_Container* const token_list_container,
         const struct Token_List* const token_list,
         const uint_fast32_t token_index
 );
@@ -144,7 +362,8 @@ Get_Average_Token_Length
 /**
  * @brief Increase the number of Token_List objects in a Token_List_Container.
  *
- * The default allocation step size (TOKEN_CONTAINER_ALLOCATION_STEP_SIZE) will be used.
+ * The number will be doubled. The new Token_List objects are empty; their memory will be allocated with the first
+ * token.
  *
  * Asserts:
  *      token_list_container != NULL
@@ -160,39 +379,98 @@ Increase_Number_Of_Token_Lists
 /**
  * @brief Increase the number of tokens in a Token_List object.
  *
- * The default allocation step size (TOKENS_ALLOCATION_STEP_SIZE) will be used.
+ * The number will be doubled (The first allocation uses TOKENS_INITIAL_SIZE). All columns of the Token_List are in one
+ * memory block (structure of arrays): The handles, the char offsets, the word offsets and the sentence offsets. So
+ * only one reallocation is necessary; after that the columns will be moved to their new positions in the block.
  *
  * Asserts:
+ *      token_list_container != NULL
  *      token_list != NULL
  *
+ * @param[in] token_list_container Token_List_Container object (For the allocation counters)
  * @param[in] token_list Token_List object
  */
 static void
 Increase_Number_Of_Tokens
 (
-        struct Token_List* const token_list
+        struct Token_List_Container* const restrict token_list_container,
+        struct Token_List* const restrict token_list
 );
 
 /**
- * @brief Read the next line from the file and return the number of char, that were read.
+ * @brief Open an input file: Map it in the memory, if possible; otherwise prepare the buffered reading.
  *
  * Asserts:
  *      input_file != NULL
- *      input_file_data != NULL
- *      input_file_data_length > 0
+ *      file_name != NULL
+ *      The file can be opened
+ *      A regular file is not empty
+ *
+ * @param[out] input_file Input_File object, that will be initialized
+ * @param[in] file_name Name of the input file
+ */
+static void
+Open_Input_File
+(
+        struct Input_File* const restrict input_file,
+        const char* const restrict file_name
+);
+
+/**
+ * @brief Close an input file and delete the line buffer.
  *
- * @param[in] input_file Input file pointer
- * @param[in] input_file_data Buffer for the new input file data
- * @param[in] input_file_data_length Length of the input file buffer
+ * Asserts:
+ *      input_file != NULL
  *
- * @return Number of char, that were read
+ * @param[in] input_file Input_File object
  */
-static size_t
+static void
+Close_Input_File
+(
+        struct Input_File* const input_file
+);
+
+/**
+ * @brief Read the next line (without the '\n') from the file.
+ *
+ * A line of a mapped file will be used directly in the mapping, if no copy is requested. In this case the line is NOT
+ * null terminated ! Otherwise the line is a null terminated copy in the line buffer, that can be modified.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *      line != NULL
+ *      line_length != NULL
+ *
+ * @param[in] input_file Input_File object
+ * @param[in] copy_line Copy the line in the line buffer ?
+ * @param[out] line Begin of the line
+ * @param[out] line_length Number of char in the line
+ *
+ * @return true, if a line was read, otherwise false (End of the file)
+ */
+static _Bool
 Read_Next_Line
 (
-        FILE* restrict input_file,
-        char* const restrict input_file_data,
-        const long int input_file_data_length
+        struct Input_File* const restrict input_file,
+        const _Bool copy_line,
+        const char** const restrict line,
+        size_t* const restrict line_length
+);
+
+/**
+ * @brief Make sure, that the line buffer has at least the given size.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input_file Input_File object
+ * @param[in] needed_size Needed size of the line buffer in bytes
+ */
+static void
+Reserve_Line_Buffer
+(
+        struct Input_File* const input_file,
+        const size_t needed_size
 );
 
 /**
@@ -218,614 +496,2928 @@ Read_File_Process_Print_Function
 );
 
 /**
- * @brief Use the current cJSON object and identify the tokens and the offsets of them in this object.
+ * @brief Parse the next JSON fragment and append the tokens of the datasets directly to the container.
  *
- * The function expects, that all given pointer are valid !
+ * If the fragment contains a syntax error, all changes of this fragment in the container will be rolled back and the
+ * position of the parser points to the error.
+ *
+ * Asserts:
+ *      parser != NULL
+ *      begin != NULL
+ *      end != NULL
+ *      parse_end != NULL
+ *
+ * @param[in] parser JSON_Parser object
+ * @param[in] begin Begin of the JSON fragment (It doesn't need to be null terminated)
+ * @param[in] end End of the parsable data (exclusive)
+ * @param[in] part Part of the JSON fragment (A part of a split top level object needs to end exactly at the end)
+ * @param[out] parse_end Position of the first char after the JSON fragment
+ *
+ * @return true, if the fragment is valid, otherwise false
+ */
+static _Bool
+JSON_Parse_Fragment
+(
+        struct JSON_Parser* const restrict parser,
+        const char* const restrict begin,
+        const char* const restrict end,
+        const enum JSON_Fragment_Part part,
+        const char** const restrict parse_end
+);
+
+/**
+ * @brief Parse the members of the top level object of a JSON fragment. Every member is a dataset with the member name
+ * as ID.
+ *
+ * The function expects, that all given pointer are valid and that the parser points to the first member !
  *
  * Asserts:
  *      N/A
  *
- * @param[in] main_json Main cJSON object (It holds the object, that works direct with the source file)
- * @param[in] curr The current cJSON object
- * @param[in] new_container The new container, that will save the new information
+ * @param[in] parser JSON_Parser object
+ * @param[in] object_end_expected Ends the members with the '}' of the object ? (Otherwise: The members end with the
+ * end of the parsable data; this is a part of a split object)
  *
- * @return Number of tokens, that were found (This value can be 0)
+ * @return true, if the members are valid, otherwise false
  */
-static uint_fast32_t
-Use_Current_JSON_Fragment
+static _Bool
+JSON_Parse_Top_Level_Members
 (
-        const cJSON* const main_json,
-        const cJSON* const curr,
-        struct Token_List_Container* const new_container
+        struct JSON_Parser* const parser,
+        const _Bool object_end_expected
 );
 
 /**
- * @brief Use the current text line and determine the tokens, char, sentence and the word offset.
+ * @brief Parse the object of a dataset (the value after the dataset ID) and create a Token_List for it, if the object
+ * contains a non empty tokens array.
  *
- * The idea of the curr_line_num is, that the data sets get an created ID, because the data fragments from text files
- * have - unlike the JSON fragments - no ID. Technically an ID is not necessary for the calculations, but it is a good
- * information to get the position of the data in the source file.
+ * Only the first tokens array and the first char offsets array will be used. All other members will be skipped.
+ *
+ * The function expects, that all given pointer are valid and that the parser points to the '{' !
  *
  * Asserts:
  *      N/A
  *
- * @param[in] curr_text Content of the current text line
- * @param[in] curr_text_len Length of the current text line
- * @param[in] curr_line_num Current line number or UINT_FAST32_MAX, if this variable is unused
- * @param[in] tokenize_data Already calculated tokenize data
- * @param[in] new_container The new container, that will save the new information
+ * @param[in] parser JSON_Parser object
  *
- * @return Number of tokens, that were found (This value can be 0 !)
+ * @return true, if the object is valid, otherwise false
  */
-static uint_fast32_t
-Use_Current_Text_Fragment
+static _Bool
+JSON_Parse_Data_Set
 (
-        char* const curr_text,
-        const size_t curr_text_len,
-        const uint_fast32_t curr_line_num,
-        const struct Tokenized_String* const tokenize_data,
-        struct Token_List_Container* const new_container
+        struct JSON_Parser* const parser
 );
 
+/**
+ * @brief Parse the tokens array of a dataset and append the string elements as tokens.
+ *
+ * The Token_List will be created with the first string of the array. So an array without strings creates no
+ * Token_List. Other elements than strings will be skipped.
+ *
+ * The function expects, that all given pointer are valid and that the parser points to the '[' !
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] parser JSON_Parser object
+ * @param[out] token_list The created Token_List or NULL, if the array contains no strings
+ *
+ * @return true, if the array is valid, otherwise false
+ */
+static _Bool
+JSON_Parse_Tokens
+(
+        struct JSON_Parser* const restrict parser,
+        struct Token_List** const restrict token_list
+);
 
+/**
+ * @brief Parse an array or an object. Optionally the integer values of the elements will be saved as char offsets.
+ *
+ * The function expects, that all given pointer are valid and that the parser points to the '[' or '{' !
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] parser JSON_Parser object
+ * @param[in] save_char_offsets Save the integer values of the elements as char offsets in the parser ?
+ *
+ * @return true, if the array (or object) is valid, otherwise false
+ */
+static _Bool
+JSON_Parse_Array_Or_Object
+(
+        struct JSON_Parser* const parser,
+        const _Bool save_char_offsets
+);
 
-enum File_Type
-{
-    NOT_SPECIFIED_FILE_TYPE = 0,    ///< File type not specified (This can be used as initial value for new variables)
-    JSON_FILE_TYPE,                 ///< JSON file type
-    TXT_FILE_TYPE,                  ///< Text file type
+/**
+ * @brief Calculate the char, sentence and word offsets of all tokens in a new Token_List.
+ *
+ * The char offsets from the data will be used, if available. Otherwise they will be calculated.
+ *
+ * The function expects, that all given pointer are valid !
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] parser JSON_Parser object (It holds the char offsets from the data)
+ * @param[in] token_list The new Token_List
+ */
+static void
+JSON_Set_Offsets
+(
+        const struct JSON_Parser* const restrict parser,
+        struct Token_List* const restrict token_list
+);
 
-    UNKNOWN_FILE_TYPE               ///< Type is not determinable (This should not be used as initial value for new variables !)
-};
+/**
+ * @brief Parse (and validate) a JSON value without using it.
+ *
+ * The function expects, that all given pointer are valid !
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] parser JSON_Parser object
+ * @param[out] value_int Integer value of the JSON value like in cJSON (Numbers saturated to int; true: 1; otherwise 0)
+ *
+ * @return true, if the value is valid, otherwise false
+ */
+static _Bool
+JSON_Parse_Value
+(
+        struct JSON_Parser* const restrict parser,
+        int* const restrict value_int
+);
 
 /**
- * @brief Try to determine the file type.
+ * @brief Parse a number like cJSON: The chars, that can be part of a number, will be converted with strtod(). Integers
+ * will be converted directly.
  *
- * The function will check for a JSON or a text file.
+ * The function expects, that all given pointer are valid !
  *
- * @param input_file FILE pointer to the already opened file.
+ * Asserts:
+ *      N/A
  *
- * @return Type of the file; if a determination was not possible UNKNOWN_FILE_TYPE will be returned
+ * @param[in] parser JSON_Parser object
+ * @param[out] value_int Value of the number saturated to int
+ *
+ * @return true, if the number is valid, otherwise false
  */
-static enum File_Type
-Determine_File_Type
+static _Bool
+JSON_Parse_Number
 (
-        FILE* input_file
+        struct JSON_Parser* const restrict parser,
+        int* const restrict value_int
 );
 
-//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Parse the name of an object member and the following ':'.
+ *
+ * The decoded name will be truncated to name_size - 1 chars or to the first '\0' in the name.
+ *
+ * The function expects, that all given pointer are valid !
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] parser JSON_Parser object
+ * @param[out] name Memory for the decoded name or NULL, if only a validation is necessary
+ * @param[in] name_size Size of the memory for the name
+ *
+ * @return true, if the member name is valid, otherwise false
+ */
+static _Bool
+JSON_Parse_Member_Name
+(
+        struct JSON_Parser* const restrict parser,
+        char* const restrict name,
+        const size_t name_size
+);
 
 /**
- * @brief Create the token list from a JSON file.
+ * @brief Find the end of the string, that begins at the current position.
+ *
+ * The escape sequences will NOT be validated ! (See: JSON_Decode_String)
+ *
+ * The function expects, that all given pointer are valid !
  *
  * Asserts:
- *      file_name != NULL
- *      strlen(file_name) > 0
+ *      N/A
  *
- * @param[in] file_name Input file name
+ * @param[in] parser JSON_Parser object
+ * @param[out] content Begin of the raw string content (After the '"')
+ * @param[out] content_length Length of the raw string content
+ * @param[out] needs_decoding Contains the string escape sequences or '\0' chars ?
  *
- * @return Address to the new dynamic Token_List_Container
+ * @return true, if the string is complete, otherwise false (Then the current position is after the '"')
  */
-extern struct Token_List_Container*
-TokenListContainer_CreateObject
+static _Bool
+JSON_Scan_String
 (
-        const char* const file_name
-)
-{
-    ASSERT_MSG(file_name != NULL, "File name is NULL !");
-    ASSERT_MSG(strlen(file_name) > 0, "File name is empty !");
+        struct JSON_Parser* const restrict parser,
+        const char** const restrict content,
+        size_t* const restrict content_length,
+        _Bool* const restrict needs_decoding
+);
 
-    // Create the (outer) container
-    struct Token_List_Container* new_container =
-            (struct Token_List_Container*) CALLOC(1, sizeof (struct Token_List_Container));
-    ASSERT_ALLOC(new_container, "Cannot create new Token_Container !", 1 * sizeof (struct Token_List_Container));
+/**
+ * @brief Decode the escape sequences of a raw string content.
+ *
+ * The decoded string is never longer than the raw content. At most output_size chars will be written (no terminator
+ * symbol); the remaining content will only be validated.
+ *
+ * The function expects, that all given pointer are valid !
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] content Raw string content
+ * @param[in] content_length Length of the raw string content
+ * @param[out] output Memory for the decoded string or NULL, if only a validation is necessary
+ * @param[in] output_size Size of the output memory
+ * @param[out] decoded_length Length of the full decoded string
+ * @param[out] error_position Begin of the invalid escape sequence (Only set, if the function returns false)
+ *
+ * @return true, if all escape sequences are valid, otherwise false
+ */
+static _Bool
+JSON_Decode_String
+(
+        const char* const restrict content,
+        const size_t content_length,
+        char* const restrict output,
+        const size_t output_size,
+        size_t* const restrict decoded_length,
+        const char** const restrict error_position
+);
 
-    // Create the inner container
-    new_container->allocated_token_container = TOKEN_CONTAINER_ALLOCATION_STEP_SIZE;
-    new_container->token_lists = (struct Token_List*) CALLOC(new_container->allocated_token_container, sizeof (struct Token_List));
-    ASSERT_ALLOC(new_container->token_lists, "Cannot create new Token objects !", new_container->allocated_token_container *
-            sizeof (struct Token_List));
+/**
+ * @brief Convert four hex digits (of an \u escape sequence) to an integer.
+ *
+ * Like in cJSON an invalid hex digit results in the value 0.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] hex The four hex digits
+ *
+ * @return The value of the hex digits or 0, if there are invalid digits
+ */
+static unsigned long
+JSON_Parse_Hex4
+(
+        const char* const hex
+);
+
+/**
+ * @brief Skip the white spaces (all chars <= 32 like in cJSON) at the current position.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] parser JSON_Parser object
+ */
+static inline void
+JSON_Skip_Whitespace
+(
+        struct JSON_Parser* const parser
+);
+
+/**
+ * @brief Use the current text line and determine the tokens, char, sentence and the word offset.
+ *
+ * The idea of the curr_line_num is, that the data sets get an created ID, because the data fragments from text files
+ * have - unlike the JSON fragments - no ID. Technically an ID is not necessary for the calculations, but it is a good
+ * information to get the position of the data in the source file.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] curr_text Content of the current text line
+ * @param[in] curr_text_len Length of the current text line
+ * @param[in] curr_line_num Current line number or UINT_FAST32_MAX, if this variable is unused
+ * @param[in] tokenize_data Already calculated tokenize data
+ * @param[in] new_container The new container, that will save the new information
+ *
+ * @return Number of tokens, that were found (This value can be 0 ! Then no dataset will be created.)
+ */
+static uint_fast32_t
+Use_Current_Text_Fragment
+(
+        char* const curr_text,
+        const size_t curr_text_len,
+        const uint_fast32_t curr_line_num,
+        const struct Tokenized_String* const tokenize_data,
+        struct Token_List_Container* const new_container
+);
+
+
+
+enum File_Type
+{
+    NOT_SPECIFIED_FILE_TYPE = 0,    ///< File type not specified (This can be used as initial value for new variables)
+    JSON_FILE_TYPE,                 ///< JSON file type
+    TXT_FILE_TYPE,                  ///< Text file type
+
+    UNKNOWN_FILE_TYPE               ///< Type is not determinable (This should not be used as initial value for new variables !)
+};
+
+/**
+ * @brief Try to determine the file type.
+ *
+ * The function will check for a JSON or a text file.
+ *
+ * @param input_file The already opened file.
+ *
+ * @return Type of the file; if a determination was not possible UNKNOWN_FILE_TYPE will be returned
+ */
+static enum File_Type
+Determine_File_Type
+(
+        struct Input_File* const input_file
+);
+
+/**
+ * @brief A chunk of a mapped input file, that will be parsed by one thread in its own Token_List_Container.
+ */
+struct Input_Chunk
+{
+    const char* begin;                              ///< Begin of the chunk in the mapping
+    const char* end;                                ///< End of the chunk in the mapping (exclusive)
+    /**
+     * @brief Part of the split top level object of a single line JSON file or JSON_WHOLE_FRAGMENT, if the chunk
+     * contains whole lines.
+     */
+    enum JSON_Fragment_Part json_part;
+
+    uint_fast32_t lines_before;                     ///< Number of lines in the file before the chunk
+    uint_fast32_t number_of_lines;                  ///< Number of lines in the chunk
+
+    struct Token_List_Container* token_container;   ///< Token_List objects of the chunk
+    uint_fast32_t tokens_found;                     ///< Number of tokens in the chunk
+    _Bool valid;                                    ///< Is the chunk valid ? (Chunks with whole lines are always valid)
+
+    uint_fast32_t first_token_list;                 ///< Index of the first Token_List of the chunk after the merge
+    size_t token_memory_offset;                     ///< Offset of the token memory of the chunk after the merge
+
+    struct Token_Int_Mapping* local_mapping;        ///< Chunk local mapping of the direct-to-id ingestion or NULL
+    DATA_TYPE* remap_table;                         ///< Local -> global mapped integers after the merge of the mappings
+};
+
+/**
+ * @brief Work steps in the parallel parsing of one input file.
+ */
+enum Input_Chunk_Task
+{
+    COUNT_LINES_TASK = 0,                           ///< Count the lines of the chunks (For the line numbers)
+    PARSE_CHUNKS_TASK,                              ///< Parse the chunks
+    MERGE_CHUNKS_TASK                               ///< Move the Token_List objects to the merged container
+};
+
+/**
+ * @brief Queue with the chunks of one input file. Every thread takes the next unprocessed chunk.
+ */
+struct Input_Chunk_Queue
+{
+    atomic_size_t next_chunk;                       ///< Next unprocessed chunk
+    size_t number_of_chunks;                        ///< Number of chunks
+    struct Input_Chunk* chunks;                     ///< The chunks in the order of the file
+
+    enum File_Type file_type;                       ///< Type of the input file
+    enum Input_Chunk_Task task;                     ///< Current work step of the threads
+    struct Token_List_Container* merged_container;  ///< Container, that receives the Token_List objects of all chunks
+    struct Token_Int_Mapping* token_int_mapping;    ///< Mapping of the direct-to-id ingestion or NULL
+};
+
+/**
+ * @brief Create the token list from a file. With a given Token_Int_Mapping the tokens will be interned directly
+ * (direct-to-id ingestion).
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      number_of_threads > 0
+ *
+ * @param[in] file_name Input file name
+ * @param[in] number_of_threads Max. number of threads
+ * @param[in] token_int_mapping Token_Int_Mapping of the direct-to-id ingestion or NULL
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+static struct Token_List_Container*
+Create_Token_List_Container_From_File
+(
+        const char* const restrict file_name,
+        const size_t number_of_threads,
+        struct Token_Int_Mapping* const restrict token_int_mapping
+);
+
+/**
+ * @brief Delete the tokens and the offsets of all allocated Token_List objects.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] container Token_List_Container object
+ */
+static void
+Delete_Token_Data
+(
+        struct Token_List_Container* const container
+);
+
+/**
+ * @brief Intern the tokens of the new Token_List objects in the Token_Int_Mapping of the container (direct-to-id
+ * ingestion) and remove their chars from the token memory.
+ *
+ * After the call the handles of the tokens contain the mapped integers.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] container Token_List_Container object with a Token_Int_Mapping
+ * @param[in] first_token_list Index of the first new Token_List
+ * @param[in] end_token_list Index after the last new Token_List
+ * @param[in] token_memory_begin Used token memory before the new Token_List objects
+ */
+static void
+Intern_New_Tokens
+(
+        struct Token_List_Container* const container,
+        const uint_fast32_t first_token_list,
+        const uint_fast32_t end_token_list,
+        const size_t token_memory_begin
+);
+
+/**
+ * @brief Create an empty Token_List_Container with the initial memory.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+static struct Token_List_Container*
+Create_Token_List_Container
+(
+        void
+);
+
+/**
+ * @brief Parse the lines of an opened input file and append the datasets to the container.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input_file The opened input file
+ * @param[in] file_type Type of the input file
+ * @param[in] lines_before Number of lines before the first line (The text lines use the line number as dataset ID)
+ * @param[in] print_progress Print the progress ? (Only for the whole file)
+ * @param[in] new_container The container, that will save the datasets
+ * @param[out] sum_char_read Number of read chars (without the '\n')
+ *
+ * @return Number of tokens, that were found
+ */
+static uint_fast32_t
+Parse_Input_File
+(
+        struct Input_File* const restrict input_file,
+        const enum File_Type file_type,
+        const uint_fast32_t lines_before,
+        const _Bool print_progress,
+        struct Token_List_Container* const restrict new_container,
+        size_t* const restrict sum_char_read
+);
+
+/**
+ * @brief Parse a mapped input file in chunks with multiple threads.
+ *
+ * The file will be split at the record boundaries: At the begin of a line or - in a single line JSON file - between the
+ * members of the top level object. The split positions in a JSON object are speculative, because a string can contain
+ * the same chars. If one part is not parsable in isolation, the function returns NULL and the caller needs to parse the
+ * file with one thread; this creates the same result and error messages like without the split.
+ *
+ * The Token_List objects of the chunks will be merged in the order of the file. So the order of the datasets and the
+ * line numbers in the dataset IDs are the same like in the serial parsing. With the direct-to-id ingestion every chunk
+ * uses a local mapping; the local mappings will be merged in the order of the chunks, so the mapped integers are also
+ * the same.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input_file The opened and mapped input file
+ * @param[in] file_type Type of the input file (JSON_FILE_TYPE or TXT_FILE_TYPE)
+ * @param[in] number_of_threads Max. number of threads
+ * @param[in] token_int_mapping Mapping of the direct-to-id ingestion or NULL
+ * @param[out] sum_tokens_found Number of tokens, that were found
+ *
+ * @return Address to the new dynamic Token_List_Container or NULL, if the file cannot be parsed in chunks
+ */
+static struct Token_List_Container*
+Parse_Input_File_Parallel
+(
+        const struct Input_File* const restrict input_file,
+        const enum File_Type file_type,
+        const size_t number_of_threads,
+        struct Token_Int_Mapping* const restrict token_int_mapping,
+        uint_fast32_t* const restrict sum_tokens_found
+);
+
+/**
+ * @brief Search the next possible split position between two members of a top level JSON object.
+ *
+ * The pattern is: '}' ',' '"<name>"' ':' '{' (with optional white spaces) on the nesting depth of the top level object
+ * members and outside of a string. The position of the ',' will be returned.
+ *
+ * The nesting depth and the string state are only known from the begin of the top level object. So the scan continues
+ * at the position of the last call; every char of the object will be read only once, even with many split positions.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in, out] scan_position Position, where the scan continues (Not in a string; the begin of the top level object
+ *      before the first call). After the call: The returned position or end
+ * @param[in, out] depth Nesting depth at scan_position (0 before the first call)
+ * @param[in] split_position The returned ',' is not before this position
+ * @param[in] end End of the search (exclusive)
+ *
+ * @return Position of the ',' or NULL, if no split position was found
+ */
+static const char*
+Find_JSON_Member_Boundary
+(
+        const char** const restrict scan_position,
+        size_t* const restrict depth,
+        const char* const restrict split_position,
+        const char* const restrict end
+);
+
+/**
+ * @brief Process all chunks of the queue with the given task. The current thread is also a worker.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] queue Input_Chunk_Queue object
+ * @param[in] task Task for all chunks
+ * @param[in] number_of_threads Number of threads
+ */
+static void
+Run_Input_Chunk_Workers
+(
+        struct Input_Chunk_Queue* const queue,
+        const enum Input_Chunk_Task task,
+        const size_t number_of_threads
+);
+
+/**
+ * @brief Thread function: Process the next unprocessed chunks of the queue, until all chunks are processed.
+ *
+ * Asserts:
+ *      queue != NULL
+ *
+ * @param[in] queue Input_Chunk_Queue object
+ *
+ * @return Always NULL
+ */
+static void*
+Input_Chunk_Worker_Thread
+(
+        void* queue
+);
+
+/**
+ * @brief Parse one chunk in a new Token_List_Container.
+ *
+ * With the direct-to-id ingestion the chunk gets a local mapping with the case sensitivity of the given mapping.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] chunk Input_Chunk object
+ * @param[in] file_type Type of the input file
+ * @param[in] token_int_mapping Mapping of the direct-to-id ingestion or NULL
+ */
+static void
+Parse_Input_Chunk
+(
+        struct Input_Chunk* const restrict chunk,
+        const enum File_Type file_type,
+        const struct Token_Int_Mapping* const restrict token_int_mapping
+);
+
+/**
+ * @brief Move the Token_List objects and the tokens of a chunk to the merged container and delete the container of the
+ * chunk.
+ *
+ * The memory of the merged container was already allocated. Every chunk uses its own range of the memory; so the chunks
+ * can be moved in parallel. With the direct-to-id ingestion the local mapped integers will be replaced with the global
+ * ones.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] chunk Input_Chunk object
+ * @param[in] merged_container The merged container
+ */
+static void
+Move_Input_Chunk_To_Container
+(
+        struct Input_Chunk* const restrict chunk,
+        struct Token_List_Container* const restrict merged_container
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create the token list from a JSON file.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *
+ * @param[in] file_name Input file name
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+extern struct Token_List_Container*
+TokenListContainer_CreateObject
+(
+        const char* const file_name
+)
+{
+    return TokenListContainer_CreateObjectParallel (file_name, 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create the token list from a JSON file with multiple threads.
+ *
+ * A mapped file will be split in chunks at the record boundaries. The chunks will be parsed in parallel and merged in
+ * the order of the file. The result is the same like with one thread. Not mappable files (e.g. pipes) and small files
+ * will be parsed with one thread.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      number_of_threads > 0
+ *
+ * @param[in] file_name Input file name
+ * @param[in] number_of_threads Max. number of threads
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+extern struct Token_List_Container*
+TokenListContainer_CreateObjectParallel
+(
+        const char* const file_name,
+        const size_t number_of_threads
+)
+{
+    return Create_Token_List_Container_From_File (file_name, number_of_threads, NULL);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create the token list from a JSON file with multiple threads and intern the tokens directly in the given
+ * Token_Int_Mapping (direct-to-id ingestion).
+ *
+ * The container keeps only the mapped integers, the offsets and the dataset IDs; the chars of the tokens are only in
+ * the mapping. The mapped integers are exact the same as if the tokens of a container without mapping were interned
+ * one after the other: The threads use chunk local mappings, that will be merged in the order of the file.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      number_of_threads > 0
+ *      token_int_mapping != NULL
+ *
+ * @param[in] file_name Input file name
+ * @param[in] number_of_threads Max. number of threads
+ * @param[in] token_int_mapping Token_Int_Mapping, that receives the tokens
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+extern struct Token_List_Container*
+TokenListContainer_CreateObjectWithMapping
+(
+        const char* const file_name,
+        const size_t number_of_threads,
+        struct Token_Int_Mapping* const token_int_mapping
+)
+{
+    ASSERT_MSG(token_int_mapping != NULL, "Token_Int_Mapping is NULL !");
+
+    return Create_Token_List_Container_From_File (file_name, number_of_threads, token_int_mapping);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete a dynamic allocated Delete_Token_Container object.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] object Delete_Token_Container object
+ */
+extern void
+TokenListContainer_DeleteObject
+(
+        struct Token_List_Container* object
+)
+{
+    ASSERT_MSG(object != NULL, "Token_List_Container is NULL !");
+
+    TwoDimCStrArray_DeleteObject (object->list_of_long_tokens);
+    object->list_of_long_tokens = NULL;
+
+    // The tokens were already deleted, if the token memory is missing (See TokenListContainer_DeleteTokens())
+    if (object->token_memory != NULL)
+    {
+        Delete_Token_Data (object);
+        FREE_AND_SET_TO_NULL(object->token_memory);
+    }
+
+    FREE_AND_SET_TO_NULL(object->token_lists);
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete the tokens and the offsets of all Token_List objects in the container.
+ *
+ * Only the dataset IDs and the list of long tokens stay in the container. This is useful, when the tokens were
+ * already copied in a Document_Word_List and the container is only necessary for the dataset IDs. After the call all
+ * Token_List objects are empty and no new tokens can be added.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] container Token_List_Container object
+ */
+extern void
+TokenListContainer_DeleteTokens
+(
+        struct Token_List_Container* const container
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+
+    if (container->token_memory == NULL) { return; }
+
+    Delete_Token_Data (container);
+    for (size_t i = 0; i < container->allocated_token_container; ++ i)
+    {
+        container->token_lists [i].next_free_element = 0;
+        container->token_lists [i].allocated_tokens = 0;
+    }
+    FREE_AND_SET_TO_NULL(container->token_memory);
+    container->token_memory_used = 0;
+    container->token_memory_allocated = 0;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read a specific token from the container.
+ *
+ * For performance reasons, the memory for all tokens is allocated as one memory block. Therefore the address
+ * calculation is more complex. This is the reason for this function.
+ *
+ * Asserts:
+ *      container != NULL
+ *      container->next_free_element < index_token_list
+ *      index_token_in_token_list < container->token_lists [index_token_list].next_free_element
+ *
+ * @param[in] container Token_List_Container object
+ * @param[in] index_token_list Index of the Token_List object
+ * @param[in] index_token_in_token_list Index of the token in the Token_List object
+ *
+ * @return Pointer at the begin of the token. (token is terminated with a null byte !)
+ */
+extern char*
+TokenListContainer_GetToken
+(
+        const struct Token_List_Container* const container,
+        const uint_fast32_t index_token_list,
+        const uint_fast32_t index_token_in_token_list
+)
+{
+    ASSERT_MSG(container != NULL, "Token_Container is NULL !");
+    ASSERT_FMSG(index_token_list < container->next_free_element, "Tokens object id is invalid ! Max. valid: %"
+            PRIuFAST32 "; Got: %" PRIuFAST32 " !", container->next_free_element - 1, index_token_list);
+    ASSERT_FMSG(index_token_in_token_list < container->token_lists [index_token_list].next_free_element,
+            "Token in Tokens object %" PRIuFAST32 " is invalid ! Max. valid: %" PRIuFAST32 "; Got: %" PRIuFAST32 " !",
+            index_token_list, container->token_lists [index_token_list].next_free_element - 1, index_token_in_token_list);
+    ASSERT_MSG(container->token_int_mapping == NULL,
+            "The tokens of a container with direct-to-id ingestion are only available as mapped integers !");
+
+    return Get_Address_Of_Token(container, &(container->token_lists [index_token_list]), index_token_in_token_list);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Get the length of a specific token from the container. (A strlen() call is not necessary)
+ *
+ * Asserts:
+ *      container != NULL
+ *      container->next_free_element < index_token_list
+ *      index_token_in_token_list < container->token_lists [index_token_list].next_free_element
+ *
+ * @param[in] container Token_List_Container object
+ * @param[in] index_token_list Index of the Token_List object
+ * @param[in] index_token_in_token_list Index of the token in the Token_List object
+ *
+ * @return Length of the token
+ */
+extern size_t
+TokenListContainer_GetTokenLength
+(
+        const struct Token_List_Container* const container,
+        const uint_fast32_t index_token_list,
+        const uint_fast32_t index_token_in_token_list
+)
+{
+    ASSERT_MSG(container != NULL, "Token_Container is NULL !");
+    ASSERT_FMSG(index_token_list < container->next_free_element, "Tokens object id is invalid ! Max. valid: %"
+            PRIuFAST32 "; Got: %" PRIuFAST32 " !", container->next_free_element - 1, index_token_list);
+    ASSERT_FMSG(index_token_in_token_list < container->token_lists [index_token_list].next_free_element,
+            "Token in Tokens object %" PRIuFAST32 " is invalid ! Max. valid: %" PRIuFAST32 "; Got: %" PRIuFAST32 " !",
+            index_token_list, container->token_lists [index_token_list].next_free_element - 1, index_token_in_token_list);
+
+    return container->token_lists [index_token_list].tokens [index_token_in_token_list].length;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Get the mapped integer of a specific token from a container with direct-to-id ingestion.
+ *
+ * Asserts:
+ *      container != NULL
+ *      container->token_int_mapping != NULL
+ *      container->next_free_element < index_token_list
+ *      index_token_in_token_list < container->token_lists [index_token_list].next_free_element
+ *
+ * @param[in] container Token_List_Container object
+ * @param[in] index_token_list Index of the Token_List object
+ * @param[in] index_token_in_token_list Index of the token in the Token_List object
+ *
+ * @return Mapped integer of the token
+ */
+extern DATA_TYPE
+TokenListContainer_GetTokenIntValue
+(
+        const struct Token_List_Container* const container,
+        const uint_fast32_t index_token_list,
+        const uint_fast32_t index_token_in_token_list
+)
+{
+    ASSERT_MSG(container != NULL, "Token_Container is NULL !");
+    ASSERT_MSG(container->token_int_mapping != NULL, "The container was created without direct-to-id ingestion !");
+    ASSERT_FMSG(index_token_list < container->next_free_element, "Tokens object id is invalid ! Max. valid: %"
+            PRIuFAST32 "; Got: %" PRIuFAST32 " !", container->next_free_element - 1, index_token_list);
+    ASSERT_FMSG(index_token_in_token_list < container->token_lists [index_token_list].next_free_element,
+            "Token in Tokens object %" PRIuFAST32 " is invalid ! Max. valid: %" PRIuFAST32 "; Got: %" PRIuFAST32 " !",
+            index_token_list, container->token_lists [index_token_list].next_free_element - 1, index_token_in_token_list);
+
+    return (DATA_TYPE) container->token_lists [index_token_list].tokens [index_token_in_token_list].offset;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the full memory usage in byte.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] container Token_List_Container object
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+TokenListContainer_GetAllocatedMemSize
+(
+        const struct Token_List_Container* const container
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+
+    size_t result = 0;
+
+    result += sizeof (struct Token_List) * container->allocated_token_container;
+    result += sizeof (struct Token_List_Container);
+    result += container->token_memory_allocated * sizeof (char);
+
+    for (size_t i = 0; i < container->allocated_token_container; ++ i)
+    {
+        result += (container->token_lists [i].allocated_tokens * TOKEN_LIST_BYTES_PER_TOKEN);
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Print the content of a Token_List object.
+ *
+ * This is only for debugging purposes useful.
+ *
+ * Asserts:
+ *      container != NULL
+ *      container->next_free_element < index_token_list
+ *
+ * @param[in] container Token_List_Container object
+ * @param[in] index_token_list Index of the Token_List object
+ */
+extern void
+TokenListContainer_ShowSelectedTokenList
+(
+        const struct Token_List_Container* const container,
+        const size_t index_token_list
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+    ASSERT_FMSG(container->next_free_element > index_token_list, "Index for the Token_List object is invalid ! Max. "
+            "valid: %" PRIuFAST32 "; Got %zu !", container->next_free_element - 1, index_token_list);
+
+    printf ("Container: %zu (Dataset ID: %s)\n", index_token_list, container->token_lists [index_token_list].dataset_id);
+    for (size_t i = 0; i < container->token_lists [index_token_list].next_free_element; ++ i)
+    {
+        printf ("%4zu: %s\n", i, TokenListContainer_GetToken(container, (uint_fast32_t) index_token_list,
+                (uint_fast32_t) i));
+    }
+    PUTS_FFLUSH("");
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Print the content of a Token_List object as array.
+ *
+ * Example for the array representation:
+ *      ID: <Token_List ID>: [ <Token_List data> ]
+ *
+ * This is only for debugging purposes useful.
+ *
+ * Asserts:
+ *      container != NULL
+ *      container->next_free_element < index_token_list
+ *
+ * @param[in] container Token_List_Container object
+ * @param[in] index_token_list Index of the Token_List object
+ */
+extern void
+TokenListContainer_ShowSelectedTokenListAsArray
+(
+        const struct Token_List_Container* const container,
+        const size_t index_token_list
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+    ASSERT_FMSG(container->next_free_element > index_token_list, "Index for the Token_List object is invalid ! Max. "
+            "valid: %" PRIuFAST32 "; Got %zu !", container->next_free_element - 1, index_token_list);
+
+    printf ("Dataset ID: %s [ ", container->token_lists [index_token_list].dataset_id);
+    for (size_t i = 0; i < container->token_lists [index_token_list].next_free_element; ++ i)
+    {
+        printf ("\"%s\"", TokenListContainer_GetToken(container, (uint_fast32_t) index_token_list,
+                (uint_fast32_t) i));
+
+        if ((i + 1) < container->token_lists [index_token_list].next_free_element)
+        {
+            printf (", ");
+        }
+    }
+    PUTS_FFLUSH(" ]");
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Print the content of all Token_List containers in a Token_List_Container object.
+ *
+ * This is only for debugging purposes useful.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] container Token_List_Container object
+ */
+extern void
+TokenListContainer_ShowAllTokenLists
+(
+        const struct Token_List_Container* const container
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+
+    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    {
+        TokenListContainer_ShowSelectedTokenList (container, i);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Print the content of all Token_List containers in a Token_List_Container object with the array representation.
+ *
+ * This is only for debugging purposes useful.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] container Token_List_Container object
+ */
+extern void
+TokenListContainer_ShowAllTokenListsAsArrays
+(
+        const struct Token_List_Container* const container
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+
+    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    {
+        TokenListContainer_ShowSelectedTokenListAsArray (container, i);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Count all tokens in the whole Token_List_Container object.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] container Token_List_Container object
+ *
+ * @return Counted number of whole tokens in the Token_List_Container object
+ */
+extern uint_fast32_t
+TokenListContainer_CountAllTokens
+(
+        const struct Token_List_Container* const container
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+
+    uint_fast32_t result = 0;
+
+    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    {
+        result += container->token_lists [i].next_free_element;
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the longest token in the whole container and return the value.
+ *
+ * This function need some time, especially when the container holds many tokens.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] container Token_List_Container object
+ *
+ * @return Length of the longest token
+ */
+extern size_t
+TokenListContainer_GetLenghOfLongestToken
+(
+        const struct Token_List_Container* const container
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+
+    size_t result = 0;
+
+    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    {
+        for (uint_fast32_t i2 = 0; i2 < container->token_lists [i].next_free_element; ++ i2)
+        {
+            result = MAX_WITH_TYPE_CHECK(result, container->token_lists [i].tokens [i2].length);
+        }
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the longest Token_List object and return the value.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] container Token_List_Container object
+ *
+ * @return Length of the longest Token_List object
+ */
+extern size_t
+TokenListContainer_GetLenghOfLongestTokenList
+(
+        const struct Token_List_Container* const container
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+
+    size_t result = 0;
+
+    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    {
+        if (container->token_lists [i].next_free_element > result)
+        {
+            result = container->token_lists [i].next_free_element;
+        }
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the array index of the longest Token_List object and return the value.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] container Token_List_Container object
+ *
+ * @return Array index of the longest Token_List object
+ */
+extern size_t
+TokenListContainer_GetArrayIndexOfLongestTokenList
+(
+        const struct Token_List_Container* const container
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+
+    size_t max_length   = 0;
+    size_t result       = 0;
+
+    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    {
+        if (container->token_lists [i].next_free_element > max_length)
+        {
+            max_length = container->token_lists [i].next_free_element;
+            result = (size_t) i;
+        }
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the length of the longest data set ID.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] container Token_List_Container object
+ *
+ * @return Length of the longest data set ID
+ */
+extern size_t
+TokenListContainer_GetLengthOfLongestDatasetID
+(
+        const struct Token_List_Container* const container
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+
+    size_t longest_dataset_id = 0;
+
+    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    {
+        const size_t cur_id_length = strlen (container->token_lists [i].dataset_id);
+        if (cur_id_length > longest_dataset_id)
+        {
+            longest_dataset_id = cur_id_length;
+        }
+    }
+
+    return longest_dataset_id;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Print several container information.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] container Token_List_Container object
+ */
+extern void
+TokenListContainer_ShowAttributes
+(
+        const struct Token_List_Container* const container
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+
+    puts("");
+    printf ("Full token list container size: ");
+    Print_Memory_Size_As_B_KB_MB(TokenListContainer_GetAllocatedMemSize(container));
+    printf ("Sum all tokens:                 %" PRIuFAST32 "\n", TokenListContainer_CountAllTokens(container));
+    printf ("Number of token lists:          %" PRIuFAST32 "\n", container->next_free_element);
+    printf ("Token memory:                   %zu B (allocated: %zu B)\n", container->token_memory_used,
+            container->token_memory_allocated);
+    printf ("Average token length:           %zu\n", Get_Average_Token_Length(container));
+    printf ("Longest token list:             %zu\n", TokenListContainer_GetLenghOfLongestTokenList(container));
+    printf ("Array index longest token list: %zu\n", TokenListContainer_GetArrayIndexOfLongestTokenList(container));
+    printf ("Longest saved token:            %zu\n", TokenListContainer_GetLenghOfLongestToken(container));
+    printf ("Longest token in the container: %zu\n", container->longest_token_length);
+    printf ("Longest dataset id:             %zu\n", TokenListContainer_GetLengthOfLongestDatasetID(container));
+    printf ("Malloc / calloc calls:          %zu\n", container->malloc_calloc_calls);
+    printf ("Realloc calls:                  %zu\n", container->realloc_calls);
+    PUTS_FFLUSH("");
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Add a tuple with the three offsets to a Token_List.
+ *
+ * Asserts:
+ *      container != NULL
+ *      index < container->allocated_tokens
+ *
+ * @param[in] container Token_List object
+ * @param[in] index Data index
+ * @param[in] char_offset New char offset
+ * @param[in] sentence_offset New sentence offset
+ * @param[in] word_offset New word offset
+ */
+extern void
+TokenList_SetOffsets
+(
+        struct Token_List* const container,
+        const size_t index,
+        const CHAR_OFFSET_TYPE char_offset,
+        const SENTENCE_OFFSET_TYPE sentence_offset,
+        const WORD_OFFSET_TYPE word_offset
+)
+{
+    ASSERT_MSG(container != NULL, "Token_List object is NULL !");
+    ASSERT_FMSG(index < container->allocated_tokens, "Index (%zu) is out of bounds ! Max. valid %zu !", index,
+            container->allocated_tokens);
+
+    container->char_offsets [index]     = char_offset;
+    container->sentence_offsets [index] = sentence_offset;
+    container->word_offsets [index]     = word_offset;
+
+    return;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Append a token to the token memory of the container and save the handle as next token of the Token_List.
+ *
+ * The Token_List needs enough memory for the new handle !
+ *
+ * Asserts:
+ *      token_list_container != NULL
+ *      token_list != NULL
+ *      token != NULL
+ *
+ * @param[in] token_list_container Token_List_Container object
+ * @param[in] token_list Token_List object
+ * @param[in] token The new token (It doesn't need to be null terminated)
+ * @param[in] token_length Length of the new token
+ */
+static void
+Append_Token
+(
+        struct Token_List_Container* const restrict token_list_container,
+        struct Token_List* const restrict token_list,
+        const char* const restrict token,
+        const size_t token_length
+)
+{
+    ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
+    ASSERT_MSG(token_list != NULL, "Token_List is NULL !");
+    ASSERT_MSG(token != NULL, "Token is NULL !");
+
+    // Memory for the new token (inkl. the terminator symbol)
+    Reserve_Token_Memory (token_list_container, token_length + 1);
+
+    char* const new_token = &(token_list_container->token_memory [token_list_container->token_memory_used]);
+    memcpy(new_token, token, token_length);
+    new_token [token_length] = '\0';
+
+    token_list->tokens [token_list->next_free_element].offset = token_list_container->token_memory_used;
+    token_list->tokens [token_list->next_free_element].length = token_length;
+    token_list_container->token_memory_used += token_length + 1;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Make sure, that the token memory of the container has at least the given number of unused bytes.
+ *
+ * If a reallocation is necessary, the size will be doubled.
+ *
+ * Asserts:
+ *      token_list_container != NULL
+ *
+ * @param[in] token_list_container Token_List_Container object
+ * @param[in] needed_bytes Number of needed unused bytes
+ */
+static void
+Reserve_Token_Memory
+(
+        struct Token_List_Container* const token_list_container,
+        const size_t needed_bytes
+)
+{
+    ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
+
+    // Is more memory necessary ? Yes: Double the memory
+    if (token_list_container->token_memory_used + needed_bytes > token_list_container->token_memory_allocated)
+    {
+        size_t new_size = token_list_container->token_memory_allocated * 2;
+        while (token_list_container->token_memory_used + needed_bytes > new_size) { new_size *= 2; }
+
+        char* tmp_ptr = (char*) REALLOC(token_list_container->token_memory, new_size * sizeof (char));
+        ASSERT_ALLOC(tmp_ptr, "Cannot reallocate the token memory !", new_size * sizeof (char));
+        token_list_container->realloc_calls ++;
+
+        token_list_container->token_memory = tmp_ptr;
+        token_list_container->token_memory_allocated = new_size;
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Calculate the begin of the token specified with an index in a Token_List.
+ *
+ * Asserts:
+ *      token_list_container != NULL
+ *      token_list != NULL
+ *      token_index < allocated_tokens
+ *
+ * @param[in] token_list_container Token_List_Container object, that holds the token memory
+ * @param[in] token_list Token_List object
+ * @param[in] token_index Index of the token
+ *
+ * @return Pointer to the begin of the token with the given index
+ */
+static char*
+Get_Address_Of_Token
+(
+        const struct Token_List_Container* const token_list_container,
+        const struct Token_List* const token_list,
+        const uint_fast32_t token_index
+)
+{
+    ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
+    ASSERT_MSG(token_list != NULL, "Token_List is NULL !");
+    ASSERT_FMSG(token_index < token_list->allocated_tokens,
+            "Specified token index is too large ! Given: %" PRIuFAST32 "; Max. valid: %zu !",
+            token_index, token_list->allocated_tokens - 1);
+
+    return token_list_container->token_memory + token_list->tokens [token_index].offset;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Calculate the the average of all tokens in the object.
+ *
+ * This information is for debugging and statistical purposes helpful.
+ *
+ * Asserts:
+ *      token_list_container != NULL
+ *
+ * @param[in] token_list_container Token_List_Container object
+ *
+ * @return Average token length
+ */
+static size_t
+Get_Average_Token_Length
+(
+        const struct Token_List_Container* const token_list_container
+)
+{
+    ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
+
+    size_t sum_token_length = 0;
+
+    for (uint_fast32_t i = 0; i < token_list_container->next_free_element; ++ i)
+    {
+        for (uint_fast32_t i2 = 0; i2 < token_list_container->token_lists [i].next_free_element; ++ i2)
+        {
+            sum_token_length += token_list_container->token_lists [i].tokens [i2].length;
+        }
+    }
+
+    const float result = (float) sum_token_length / (float) TokenListContainer_CountAllTokens(token_list_container);
+    return (size_t) ceil (result);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Increase the number of Token_List objects in a Token_List_Container.
+ *
+ * The number will be doubled. The new Token_List objects are empty; their memory will be allocated with the first
+ * token.
+ *
+ * Asserts:
+ *      token_list_container != NULL
+ *
+ * @param[in] token_list_container Token_List_Container object
+ */
+static void
+Increase_Number_Of_Token_Lists
+(
+        struct Token_List_Container* const token_list_container
+)
+{
+    ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
+
+    const size_t old_allocated_token_container = token_list_container->allocated_token_container;
+    const size_t new_allocated_token_container = MAX(old_allocated_token_container * 2,
+            (size_t) TOKEN_CONTAINER_INITIAL_SIZE);
+
+    // Adjust the number of Token_List object
+    struct Token_List* temp_ptr = (struct Token_List*) REALLOC(token_list_container->token_lists,
+            new_allocated_token_container * sizeof (struct Token_List));
+    ASSERT_ALLOC(temp_ptr, "Cannot reallocate memory for Token_Container objects !",
+            new_allocated_token_container * sizeof (struct Token_List));
+    memset(temp_ptr + old_allocated_token_container, '\0',
+            sizeof (struct Token_List) * (new_allocated_token_container - old_allocated_token_container));
+    token_list_container->realloc_calls ++;
+
+    token_list_container->token_lists = temp_ptr;
+    token_list_container->allocated_token_container = new_allocated_token_container;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Increase the number of tokens in a Token_List object.
+ *
+ * The number will be doubled (The first allocation uses TOKENS_INITIAL_SIZE). All columns of the Token_List are in one
+ * memory block (structure of arrays): The handles, the char offsets, the word offsets and the sentence offsets. So
+ * only one reallocation is necessary; after that the columns will be moved to their new positions in the block.
+ *
+ * Asserts:
+ *      token_list_container != NULL
+ *      token_list != NULL
+ *
+ * @param[in] token_list_container Token_List_Container object (For the allocation counters)
+ * @param[in] token_list Token_List object
+ */
+static void
+Increase_Number_Of_Tokens
+(
+        struct Token_List_Container* const restrict token_list_container,
+        struct Token_List* const restrict token_list
+)
+{
+    ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
+    ASSERT_MSG(token_list != NULL, "Token_List is NULL !");
+
+    const size_t old_tokens_size = token_list->allocated_tokens;
+    const size_t new_tokens_size = (old_tokens_size == 0) ? TOKENS_INITIAL_SIZE : (old_tokens_size * 2);
+
+    char* const new_block = (char*) REALLOC(token_list->tokens, new_tokens_size * TOKEN_LIST_BYTES_PER_TOKEN);
+    ASSERT_ALLOC(new_block, "Cannot reallocate memory for Tokens data !", new_tokens_size * TOKEN_LIST_BYTES_PER_TOKEN);
+    if (old_tokens_size == 0)
+    {
+        token_list_container->malloc_calloc_calls ++;
+    }
+    else
+    {
+        token_list_container->realloc_calls ++;
+    }
+
+    // Positions of the columns in the block (The handles are always at the begin)
+    char* const old_char_offsets        = new_block + old_tokens_size * sizeof (struct Token_Handle);
+    char* const old_word_offsets        = old_char_offsets + old_tokens_size * sizeof (CHAR_OFFSET_TYPE);
+    char* const old_sentence_offsets    = old_word_offsets + old_tokens_size * sizeof (WORD_OFFSET_TYPE);
+    char* const new_char_offsets        = new_block + new_tokens_size * sizeof (struct Token_Handle);
+    char* const new_word_offsets        = new_char_offsets + new_tokens_size * sizeof (CHAR_OFFSET_TYPE);
+    char* const new_sentence_offsets    = new_word_offsets + new_tokens_size * sizeof (WORD_OFFSET_TYPE);
+
+    // The columns move only to the end of the block; so the last column needs to be moved first
+    memmove (new_sentence_offsets, old_sentence_offsets, old_tokens_size * sizeof (SENTENCE_OFFSET_TYPE));
+    memmove (new_word_offsets, old_word_offsets, old_tokens_size * sizeof (WORD_OFFSET_TYPE));
+    memmove (new_char_offsets, old_char_offsets, old_tokens_size * sizeof (CHAR_OFFSET_TYPE));
+
+    token_list->tokens              = (struct Token_Handle*) new_block;
+    token_list->char_offsets        = (CHAR_OFFSET_TYPE*) new_char_offsets;
+    token_list->word_offsets        = (WORD_OFFSET_TYPE*) new_word_offsets;
+    token_list->sentence_offsets    = (SENTENCE_OFFSET_TYPE*) new_sentence_offsets;
+    token_list->allocated_tokens    = new_tokens_size;
+
+    // Init new values
+    for (size_t i2 = old_tokens_size; i2 < new_tokens_size; ++ i2)
+    {
+        token_list->char_offsets [i2]       = CHAR_OFFSET_TYPE_MAX;
+        token_list->sentence_offsets [i2]   = SENTENCE_OFFSET_TYPE_MAX;
+        token_list->word_offsets [i2]       = WORD_OFFSET_TYPE_MAX;
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Open an input file: Map it in the memory, if possible; otherwise prepare the buffered reading.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *      file_name != NULL
+ *      The file can be opened
+ *      A regular file is not empty
+ *
+ * @param[out] input_file Input_File object, that will be initialized
+ * @param[in] file_name Name of the input file
+ */
+static void
+Open_Input_File
+(
+        struct Input_File* const restrict input_file,
+        const char* const restrict file_name
+)
+{
+    ASSERT_MSG(input_file != NULL, "Input_File object is NULL !");
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    memset (input_file, '\0', sizeof (struct Input_File));
+
+    input_file->line_buffer = (char*) MALLOC(LINE_BUFFER_INITIAL_SIZE * sizeof (char));
+    ASSERT_ALLOC(input_file->line_buffer, "Cannot allocate memory for the line buffer !",
+            LINE_BUFFER_INITIAL_SIZE * sizeof (char));
+    input_file->line_buffer_size = LINE_BUFFER_INITIAL_SIZE;
+
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    const int file_descriptor = open (file_name, O_RDONLY);
+    ASSERT_FMSG(file_descriptor != -1, "Cannot open the input file: \"%s\" !", file_name);
+
+    struct stat file_status;
+    const int fstat_return = fstat (file_descriptor, &file_status);
+    ASSERT_FMSG(fstat_return == 0, "Cannot determine the size of the input file \"%s\": %s", file_name,
+            strerror(errno));
+
+    if (S_ISREG(file_status.st_mode))
+    {
+        ASSERT_FMSG(file_status.st_size > 0, "Input file (%s) has the length 0 !", file_name);
+        input_file->file_size = (size_t) file_status.st_size;
+
+        // The file will be read only once from the begin to the end
+        void* const mapping = mmap (NULL, input_file->file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        if (mapping != MAP_FAILED)
+        {
+            // Only a hint for the read ahead; an error is not critical
+            (void) posix_madvise (mapping, input_file->file_size, POSIX_MADV_SEQUENTIAL);
+            input_file->mapped_data = (const char*) mapping;
+            input_file->mapped_size = input_file->file_size;
+
+            // The mapping stays valid after the close of the file
+            close (file_descriptor);
+            return;
+        }
+    }
+
+    // Fallback: Buffered reading (E.g. pipes or a failed mmap())
+    input_file->file = fdopen (file_descriptor, "rb");
+    ASSERT_FMSG(input_file->file != NULL, "Cannot open the input file: \"%s\" !", file_name);
+#else
+    input_file->file = fopen (file_name, "rb");
+    ASSERT_FMSG(input_file->file != NULL, "Cannot open the input file: \"%s\" !", file_name);
+
+    // Get file size
+    int fseek_return = fseek (input_file->file, 0, SEEK_END);
+    ASSERT_MSG(fseek_return == 0, "fseek() returned a nonzero value !");
+    const long int input_file_length = ftell (input_file->file);
+    ASSERT_MSG(input_file_length != -1, "ftell() returned -1 !");
+    fseek_return = fseek (input_file->file, 0, SEEK_SET);
+    ASSERT_MSG(fseek_return == 0, "fseek() returned a nonzero value !");
+
+    ASSERT_FMSG(input_file_length > 0, "Input file (%s) has the length 0 !", file_name);
+    input_file->file_size = (size_t) input_file_length;
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+
+    const int setvbuf_return = setvbuf (input_file->file, NULL, _IOFBF, INPUT_FILE_STDIO_BUFFER_SIZE);
+    ASSERT_MSG(setvbuf_return == 0, "setvbuf() returned a nonzero value !");
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Close an input file and delete the line buffer.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *
+ * @param[in] input_file Input_File object
+ */
+static void
+Close_Input_File
+(
+        struct Input_File* const input_file
+)
+{
+    ASSERT_MSG(input_file != NULL, "Input_File object is NULL !");
+
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    if (input_file->mapped_data != NULL)
+    {
+        const int munmap_return = munmap ((void*) input_file->mapped_data, input_file->mapped_size);
+        ASSERT_FMSG(munmap_return == 0, "munmap() failed: %s", strerror(errno));
+        input_file->mapped_data = NULL;
+    }
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+    if (input_file->file != NULL)
+    {
+        FCLOSE_AND_SET_TO_NULL(input_file->file);
+    }
+    FREE_AND_SET_TO_NULL(input_file->line_buffer);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Read the next line (without the '\n') from the file.
+ *
+ * A line of a mapped file will be used directly in the mapping, if no copy is requested. In this case the line is NOT
+ * null terminated ! Otherwise the line is a null terminated copy in the line buffer, that can be modified.
+ *
+ * Asserts:
+ *      input_file != NULL
+ *      line != NULL
+ *      line_length != NULL
+ *
+ * @param[in] input_file Input_File object
+ * @param[in] copy_line Copy the line in the line buffer ?
+ * @param[out] line Begin of the line
+ * @param[out] line_length Number of char in the line
+ *
+ * @return true, if a line was read, otherwise false (End of the file)
+ */
+static _Bool
+Read_Next_Line
+(
+        struct Input_File* const restrict input_file,
+        const _Bool copy_line,
+        const char** const restrict line,
+        size_t* const restrict line_length
+)
+{
+    ASSERT_MSG(input_file != NULL, "Input_File object is NULL !");
+    ASSERT_MSG(line != NULL, "Line pointer is NULL !");
+    ASSERT_MSG(line_length != NULL, "Line length pointer is NULL !");
+
+    *line = NULL;
+    *line_length = 0;
+
+    if (input_file->mapped_data != NULL)
+    {
+        if (input_file->position >= input_file->mapped_size) { return false; }
+
+        const char* const line_begin = input_file->mapped_data + input_file->position;
+        const size_t rest_of_file = input_file->mapped_size - input_file->position;
+        const char* const line_end = (const char*) memchr (line_begin, '\n', rest_of_file);
+        const size_t char_read = (line_end != NULL) ? (size_t) (line_end - line_begin) : rest_of_file;
+
+        // Skip the '\n'
+        input_file->position += (line_end != NULL) ? char_read + 1 : char_read;
+
+        if (copy_line)
+        {
+            // The terminator byte plus one spare byte
+            Reserve_Line_Buffer (input_file, char_read + 2);
+            memcpy (input_file->line_buffer, line_begin, char_read);
+            input_file->line_buffer [char_read] = '\0';
+            *line = input_file->line_buffer;
+        }
+        else
+        {
+            *line = line_begin;
+        }
+        *line_length = char_read;
+
+        return true;
+    }
+
+    // Buffered reading: Append the parts of the line in the line buffer, until the '\n' was found
+    size_t char_read = 0;
+    _Bool something_read = false;
+    while (true)
+    {
+        // The terminator byte plus one spare byte, and space for at least one new char
+        Reserve_Line_Buffer (input_file, char_read + 3);
+        const size_t free_space = input_file->line_buffer_size - char_read - 1;
+
+        if (fgets (input_file->line_buffer + char_read, (int) MIN(free_space, (size_t) INT_MAX), input_file->file)
+                == NULL)
+        {
+            break;
+        }
+        something_read = true;
+        char_read += strlen (input_file->line_buffer + char_read);
+
+        if (char_read > 0 && input_file->line_buffer [char_read - 1] == '\n')
+        {
+            -- char_read;
+            break;
+        }
+    }
+    ASSERT_FMSG(! ferror (input_file->file), "Error while reading the input file: %s", strerror(errno));
+
+    input_file->line_buffer [char_read] = '\0';
+    *line = input_file->line_buffer;
+    *line_length = char_read;
+
+    return something_read;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Make sure, that the line buffer has at least the given size.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input_file Input_File object
+ * @param[in] needed_size Needed size of the line buffer in bytes
+ */
+static void
+Reserve_Line_Buffer
+(
+        struct Input_File* const input_file,
+        const size_t needed_size
+)
+{
+    if (needed_size <= input_file->line_buffer_size) { return; }
+
+    size_t new_size = input_file->line_buffer_size * 2;
+    while (needed_size > new_size) { new_size *= 2; }
+
+    char* tmp_ptr = (char*) REALLOC(input_file->line_buffer, new_size * sizeof (char));
+    ASSERT_ALLOC(tmp_ptr, "Cannot increase the line buffer !", new_size * sizeof (char));
+    input_file->line_buffer = tmp_ptr;
+    input_file->line_buffer_size = new_size;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief The process print function for the file processing operation.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param print_step_size Number of inner loop calls, that needs to be done, for a new process print
+ * @param actual Counter since last process print
+ * @param hundred_percent The number of all inner loop calls (see the intersection code)
+ * @param interval_begin clock_t value at the begin of the last process print
+ * @param interval_end clock_t value since the last process print
+ */
+static void
+Read_File_Process_Print_Function
+(
+        const size_t print_step_size,
+        const size_t actual,
+        const size_t hundred_percent,
+        const clock_t interval_begin,
+        const clock_t interval_end
+)
+{
+    const size_t char_read_interval_begin   = (actual > hundred_percent) ? hundred_percent : actual;
+    const size_t input_file_length          = hundred_percent;
+    const size_t char_read_interval_end     = (char_read_interval_begin + print_step_size > input_file_length) ?
+            input_file_length : (char_read_interval_begin + print_step_size);
+
+    const int digits        = (int) Count_Number_Of_Digits(input_file_length);
+    const float percent     = Determine_Percent(char_read_interval_begin, input_file_length);
+    const float time_left   = Determine_Time_Left(char_read_interval_begin, char_read_interval_end, hundred_percent,
+            interval_end - interval_begin);
+
+    PRINTF_FFLUSH("Read file: %*zu KByte (%3.2f %% | %.2f sec.)   ",
+            (digits > 3) ? digits - 3 : 3, char_read_interval_begin / 1024,
+                    Replace_NaN_And_Inf_With_Zero((percent > 100.0f) ? 100.0f : percent),
+                    Replace_NaN_And_Inf_With_Zero(time_left));
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Parse the next JSON fragment and append the tokens of the datasets directly to the container.
+ *
+ * If the fragment contains a syntax error, all changes of this fragment in the container will be rolled back and the
+ * position of the parser points to the error.
+ *
+ * Asserts:
+ *      parser != NULL
+ *      begin != NULL
+ *      end != NULL
+ *      parse_end != NULL
+ *
+ * @param[in] parser JSON_Parser object
+ * @param[in] begin Begin of the JSON fragment (It doesn't need to be null terminated)
+ * @param[in] end End of the parsable data (exclusive)
+ * @param[in] part Part of the JSON fragment (A part of a split top level object needs to end exactly at the end)
+ * @param[out] parse_end Position of the first char after the JSON fragment
+ *
+ * @return true, if the fragment is valid, otherwise false
+ */
+static _Bool
+JSON_Parse_Fragment
+(
+        struct JSON_Parser* const restrict parser,
+        const char* const restrict begin,
+        const char* const restrict end,
+        const enum JSON_Fragment_Part part,
+        const char** const restrict parse_end
+)
+{
+    ASSERT_MSG(parser != NULL, "JSON_Parser is NULL !");
+    ASSERT_MSG(begin != NULL, "Begin of the JSON fragment is NULL !");
+    ASSERT_MSG(end != NULL, "End of the JSON fragment is NULL !");
+    ASSERT_MSG(parse_end != NULL, "Pointer for the parse end is NULL !");
+
+    struct Token_List_Container* const container = parser->container;
+
+    // State of the container before the fragment (For the roll back after a syntax error)
+    const uint_fast32_t first_new_token_list    = container->next_free_element;
+    const size_t token_memory_used              = container->token_memory_used;
+    const size_t longest_token_length           = container->longest_token_length;
+
+    parser->position        = begin;
+    parser->end             = end;
+    parser->depth           = 0;
+    parser->tokens_found    = 0;
+
+    _Bool valid = false;
+    if (part == JSON_MIDDLE_PART || part == JSON_LAST_PART)
+    {
+        // The part begins with the ',' before the next member of the split top level object
+        if (parser->position < parser->end && *parser->position == ',')
+        {
+            ++ parser->depth;
+            ++ parser->position;
+            valid = JSON_Parse_Top_Level_Members (parser, (part == JSON_LAST_PART) ? true : false);
+            -- parser->depth;
+        }
+    }
+    else
+    {
+        // Like cJSON: Skip the UTF-8 BOM
+        if ((end - begin) >= 3 && memcmp (begin, "\xEF\xBB\xBF", 3) == 0)
+        {
+            parser->position += 3;
+        }
+        JSON_Skip_Whitespace (parser);
+
+        if (parser->position < parser->end && *parser->position == '{')
+        {
+            // Every member of the top level object is a dataset with the member name as ID
+            ++ parser->depth;
+            ++ parser->position;
+            JSON_Skip_Whitespace (parser);
+
+            if (part == JSON_WHOLE_FRAGMENT && parser->position < parser->end && *parser->position == '}')
+            {
+                ++ parser->position;
+                valid = true;
+            }
+            else
+            {
+                valid = JSON_Parse_Top_Level_Members (parser, (part == JSON_WHOLE_FRAGMENT) ? true : false);
+            }
+            -- parser->depth;
+        }
+        else if (part == JSON_WHOLE_FRAGMENT)
+        {
+            // Other values contain no datasets
+            valid = JSON_Parse_Value (parser, NULL);
+        }
+    }
+
+    if (valid)
+    {
+        // Remember the long tokens (The tokens will NOT be truncated)
+        for (uint_fast32_t i = first_new_token_list; i < container->next_free_element; ++ i)
+        {
+            const struct Token_List* const token_list = &(container->token_lists [i]);
+            for (uint_fast32_t i2 = 0; i2 < token_list->next_free_element; ++ i2)
+            {
+                if (token_list->tokens [i2].length > (MAX_TOKEN_LENGTH - 1))
+                {
+                    TwoDimCStrArray_AppendNewString (container->list_of_long_tokens,
+                            Get_Address_Of_Token (container, token_list, i2), token_list->tokens [i2].length);
+                }
+            }
+        }
+        if (container->token_int_mapping != NULL)
+        {
+            Intern_New_Tokens (container, first_new_token_list, container->next_free_element, token_memory_used);
+        }
+
+        parser->sum_tokens_found += parser->tokens_found;
+        *parse_end = parser->position;
+    }
+    else
+    {
+        // Roll back all changes of this fragment (inclusive the Token_List, that was under construction)
+        for (uint_fast32_t i = first_new_token_list;
+                i <= container->next_free_element && i < container->allocated_token_container; ++ i)
+        {
+            struct Token_List* const token_list = &(container->token_lists [i]);
+            for (uint_fast32_t i2 = 0; i2 < token_list->next_free_element; ++ i2)
+            {
+                token_list->char_offsets [i2]       = CHAR_OFFSET_TYPE_MAX;
+                token_list->sentence_offsets [i2]   = SENTENCE_OFFSET_TYPE_MAX;
+                token_list->word_offsets [i2]       = WORD_OFFSET_TYPE_MAX;
+            }
+            token_list->next_free_element = 0;
+            memset (token_list->dataset_id, '\0', sizeof (token_list->dataset_id));
+        }
+
+        container->next_free_element    = first_new_token_list;
+        container->token_memory_used    = token_memory_used;
+        container->longest_token_length = longest_token_length;
+        parser->tokens_found            = 0;
+    }
+
+    return valid;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Parse the members of the top level object of a JSON fragment. Every member is a dataset with the member name
+ * as ID.
+ *
+ * The function expects, that all given pointer are valid and that the parser points to the first member !
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] parser JSON_Parser object
+ * @param[in] object_end_expected Ends the members with the '}' of the object ? (Otherwise: The members end with the
+ * end of the parsable data; this is a part of a split object)
+ *
+ * @return true, if the members are valid, otherwise false
+ */
+static _Bool
+JSON_Parse_Top_Level_Members
+(
+        struct JSON_Parser* const parser,
+        const _Bool object_end_expected
+)
+{
+    for (;;)
+    {
+        JSON_Skip_Whitespace (parser);
+        if (! JSON_Parse_Member_Name (parser, parser->dataset_id, sizeof (parser->dataset_id))) { return false; }
+
+        const _Bool value_valid = (parser->position < parser->end && *parser->position == '{') ?
+                JSON_Parse_Data_Set (parser) : JSON_Parse_Value (parser, NULL);
+        if (! value_valid) { return false; }
+
+        JSON_Skip_Whitespace (parser);
+        if (parser->position < parser->end && *parser->position == ',')
+        {
+            ++ parser->position;
+            continue;
+        }
+        if (! object_end_expected)
+        {
+            // A part of a split object ends directly before the ',' of the next member
+            return (parser->position >= parser->end) ? true : false;
+        }
+        if (parser->position < parser->end && *parser->position == '}')
+        {
+            ++ parser->position;
+            return true;
+        }
+        return false;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Parse the object of a dataset (the value after the dataset ID) and create a Token_List for it, if the object
+ * contains a non empty tokens array.
+ *
+ * Only the first tokens array and the first char offsets array will be used. All other members will be skipped.
+ *
+ * The function expects, that all given pointer are valid and that the parser points to the '{' !
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] parser JSON_Parser object
+ *
+ * @return true, if the object is valid, otherwise false
+ */
+static _Bool
+JSON_Parse_Data_Set
+(
+        struct JSON_Parser* const parser
+)
+{
+    if (parser->depth >= JSON_NESTING_LIMIT) { return false; }
+    ++ parser->depth;
+    ++ parser->position;
+    JSON_Skip_Whitespace (parser);
+
+    struct Token_List* token_list       = NULL;
+    _Bool tokens_array_found            = false;
+    _Bool char_offsets_array_found      = false;
+    _Bool valid                         = false;
+    parser->number_of_char_offsets      = 0;
+
+    if (parser->position < parser->end && *parser->position == '}')
+    {
+        ++ parser->position;
+        valid = true;
+    }
+    else
+    {
+        for (;;)
+        {
+            // Only the names of the both arrays are relevant; longer names will be truncated and don't match
+            char member_name [sizeof (JSON_CHAR_OFFSET_ARRAY_NAME) + 1];
+
+            JSON_Skip_Whitespace (parser);
+            if (! JSON_Parse_Member_Name (parser, member_name, sizeof (member_name))) { break; }
 
-    new_container->malloc_calloc_calls += 2;
+            const _Bool array_follows = (parser->position < parser->end && *parser->position == '[');
+            const _Bool object_follows = (parser->position < parser->end && *parser->position == '{');
+            _Bool value_valid = false;
 
-    // Allocate memory for the inner container
-    for (size_t i = 0; i < new_container->allocated_token_container; ++ i)
-    {
-        new_container->token_lists [i].data = (char*) CALLOC(MAX_TOKEN_LENGTH * TOKENS_ALLOCATION_STEP_SIZE, sizeof (char));
-        ASSERT_ALLOC(new_container->token_lists [i].data, "Cannot create data for a Token object !",
-                MAX_TOKEN_LENGTH * TOKENS_ALLOCATION_STEP_SIZE);
+            if (! tokens_array_found && strcmp (member_name, JSON_TOKENS_ARRAY_NAME) == 0)
+            {
+                tokens_array_found = true;
+                value_valid = (array_follows) ? JSON_Parse_Tokens (parser, &token_list) : JSON_Parse_Value (parser, NULL);
+            }
+            else if (! char_offsets_array_found && strcmp (member_name, JSON_CHAR_OFFSET_ARRAY_NAME) == 0)
+            {
+                // The char offsets can be given before or after the tokens
+                char_offsets_array_found = true;
+                value_valid = (array_follows || object_follows) ?
+                        JSON_Parse_Array_Or_Object (parser, true) : JSON_Parse_Value (parser, NULL);
+            }
+            else
+            {
+                value_valid = JSON_Parse_Value (parser, NULL);
+            }
+            if (! value_valid) { break; }
 
-        new_container->token_lists [i].char_offsets = (CHAR_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (CHAR_OFFSET_TYPE));
-        ASSERT_ALLOC(new_container->token_lists [i].char_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (CHAR_OFFSET_TYPE));
+            JSON_Skip_Whitespace (parser);
+            if (parser->position < parser->end && *parser->position == ',')
+            {
+                ++ parser->position;
+                continue;
+            }
+            if (parser->position < parser->end && *parser->position == '}')
+            {
+                ++ parser->position;
+                valid = true;
+            }
+            break;
+        }
+    }
+    -- parser->depth;
 
-        new_container->token_lists [i].sentence_offsets = (SENTENCE_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (SENTENCE_OFFSET_TYPE));
-        ASSERT_ALLOC(new_container->token_lists [i].sentence_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (SENTENCE_OFFSET_TYPE));
+    // The offsets can be calculated, when the whole dataset is known
+    if (valid && token_list != NULL)
+    {
+        JSON_Set_Offsets (parser, token_list);
 
-        new_container->token_lists [i].word_offsets = (WORD_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (WORD_OFFSET_TYPE));
-        ASSERT_ALLOC(new_container->token_lists [i].word_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (WORD_OFFSET_TYPE));
+        // Use next element in the container
+        parser->container->next_free_element ++;
 
-        // Init new values
-        for (size_t i2 = 0; i2 < TOKENS_ALLOCATION_STEP_SIZE; ++ i2)
+        if (parser->print_tokens_read)
         {
-            new_container->token_lists [i].char_offsets [i2] = CHAR_OFFSET_TYPE_MAX;
-            new_container->token_lists [i].sentence_offsets [i2] = SENTENCE_OFFSET_TYPE_MAX;
-            new_container->token_lists [i].word_offsets [i2] = WORD_OFFSET_TYPE_MAX;
-        }
+            const size_t tokens_read_print_steps = 25000;
 
-        new_container->token_lists [i].max_token_length = MAX_TOKEN_LENGTH;
-        new_container->token_lists [i].allocated_tokens = TOKENS_ALLOCATION_STEP_SIZE;
+            parser->tokens_read_before_last_output += token_list->next_free_element;
+            if (parser->tokens_read_before_last_output > tokens_read_print_steps)
+            {
+                PRINTF_FFLUSH("Tokens read: %" PRIuFAST32 "\r", parser->sum_tokens_found + parser->tokens_found);
+                parser->tokens_read_before_last_output = 0;
+            }
+        }
     }
-    new_container->malloc_calloc_calls += (new_container->allocated_token_container << 2);
 
-    // Create the container for too long token
-    new_container->list_of_too_long_token = TwoDimCStrArray_CreateObject (10);
-
-    clock_t start       = 0;
-    clock_t end         = 0;
-    float used_seconds  = 0.0f;
-
-    // Try to open the file
-    FILE* input_file = fopen (file_name, "rb");
-    ASSERT_FMSG(input_file != NULL, "Cannot open the input file: \"%s\" !", file_name);
+    return valid;
+}
 
-    // Get file size
-    int fseek_return = fseek (input_file, 0, SEEK_END);
-    ASSERT_MSG(fseek_return == 0, "fseek() returned a nonzero value !");
-    const long int input_file_length = ftell (input_file);
-    ASSERT_MSG(input_file_length != -1, "ftell() returned -1 !");
-    fseek_return = fseek (input_file, 0, SEEK_SET);
-    ASSERT_MSG(fseek_return == 0, "fseek() returned a nonzero value !");
+//---------------------------------------------------------------------------------------------------------------------
 
-    ASSERT_FMSG(input_file_length > 0, "Input file (%s) has the length 0 !", file_name);
+/**
+ * @brief Parse the tokens array of a dataset and append the string elements as tokens.
+ *
+ * The Token_List will be created with the first string of the array. So an array without strings creates no
+ * Token_List. Other elements than strings will be skipped.
+ *
+ * The function expects, that all given pointer are valid and that the parser points to the '[' !
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] parser JSON_Parser object
+ * @param[out] token_list The created Token_List or NULL, if the array contains no strings
+ *
+ * @return true, if the array is valid, otherwise false
+ */
+static _Bool
+JSON_Parse_Tokens
+(
+        struct JSON_Parser* const restrict parser,
+        struct Token_List** const restrict token_list
+)
+{
+    if (parser->depth >= JSON_NESTING_LIMIT) { return false; }
+    ++ parser->depth;
+    ++ parser->position;
+    JSON_Skip_Whitespace (parser);
 
-    char* input_file_data = (char*) CALLOC (((size_t) input_file_length + sizeof ("")), sizeof (char));
-    ASSERT_ALLOC(input_file_data, "Cannot allocate memory for reading the input file !",
-            ((size_t) input_file_length + sizeof ("")) * sizeof (char));
-    new_container->malloc_calloc_calls ++;
+    struct Token_List_Container* const container = parser->container;
+    _Bool valid = false;
+    *token_list = NULL;
 
-    // Determine the file type
-    const enum File_Type file_type = Determine_File_Type (input_file);
-    switch (file_type)
+    if (parser->position < parser->end && *parser->position == ']')
     {
-    case NOT_SPECIFIED_FILE_TYPE:
-        printf("Not specified file type for \"%s\"\n", file_name);
-        break;
-    case JSON_FILE_TYPE:
-        printf("Assume, that \"%s\" is a file with " ANSI_TEXT_BOLD "JSON formatted data" ANSI_RESET_ALL "\n", file_name);
-        break;
-    case TXT_FILE_TYPE:
-        printf("Assume, that \"%s\" is a file with raw " ANSI_TEXT_BOLD "text data" ANSI_RESET_ALL "\n", file_name);
-        break;
-    case UNKNOWN_FILE_TYPE:
-        printf("Cannot determine the file type for \"%s\" !\n", file_name);
-        break;
-    default:
-        ASSERT_MSG(false, "Switch case default path executed !");
+        ++ parser->position;
+        valid = true;
     }
-    puts("Start file loading ...");
-
-    uint_fast32_t line_counter              = 0;
-    uint_fast32_t sum_tokens_found          = 0;
-    const uint_fast8_t count_steps          = 100;
-    const size_t unsigned_input_file_length = (size_t) input_file_length;
-    const uint_fast32_t print_steps         = (uint_fast32_t) (((unsigned_input_file_length / count_steps) == 0) ?
-            1 : (unsigned_input_file_length / count_steps));
-
-    // Read the first line from the file
-    size_t char_read                    = Read_Next_Line (input_file, input_file_data, input_file_length);
-    size_t sum_char_read                = char_read;
-    size_t char_read_before_last_output = 0;
-
-    // Variables for the case, that the input file only contains one line
-    const _Bool one_line_file = (char_read == (size_t) input_file_length) ? true : false;
-    const size_t tokens_read_print_steps    = 25000;
-    size_t tokens_read_before_last_output   = 0;
-
-    CLOCK_WITH_RETURN_CHECK(start);
-    // ===== ===== ===== ===== ===== BEGIN Read file line by line ===== ===== ===== ===== =====
-    while(char_read > 0)
+    else
     {
-        ++ line_counter;
-        const char* current_parsing_position = input_file_data;
-        // ===== ===== ===== ===== BEGIN Parse current line ===== ===== ===== =====
-        if (file_type == JSON_FILE_TYPE)
-        {
-        while (*current_parsing_position != '\0')
-        {
-            // Parse the file JSON fragment per JSON fragment
-            cJSON* json = cJSON_ParseWithOpts(current_parsing_position, (const char**) &current_parsing_position, false);
+        struct Token_List* new_token_list = NULL;
 
-            // Print process information
-            char_read_before_last_output = Process_Printer(print_steps, char_read_before_last_output,
-                    sum_char_read, unsigned_input_file_length, true, Read_File_Process_Print_Function,
-                    NULL, NULL);
+        for (;;)
+        {
+            JSON_Skip_Whitespace (parser);
 
-            if (! json)
+            if (parser->position < parser->end && *parser->position == '"')
             {
-                // Sometimes the json pointer is NULL. But an error only occurs, when an error message is available
-                //if (strlen (cJSON_GetErrorPtr()) > 0)
-                if (! IS_STRING_LENGTH_ZERO(cJSON_GetErrorPtr()))
+                const char* content = NULL;
+                size_t content_length = 0;
+                _Bool needs_decoding = false;
+
+                if (! JSON_Scan_String (parser, &content, &content_length, &needs_decoding)) { break; }
+
+                // The first string creates the Token_List
+                if (new_token_list == NULL)
                 {
-                    printf("Error before: [%s] %" PRIuFAST32 ": %ld\n", cJSON_GetErrorPtr(), line_counter,
-                            (long int) (current_parsing_position - input_file_data));
+                    // Is it necessary to realloc/increase the number of Token_List objects in the container ?
+                    if (container->next_free_element >= container->allocated_token_container)
+                    {
+                        Increase_Number_Of_Token_Lists (container);
+                    }
+                    new_token_list = &(container->token_lists [container->next_free_element]);
+                    const size_t dataset_id_length = COUNT_ARRAY_ELEMENTS(new_token_list->dataset_id);
+                    strncpy (new_token_list->dataset_id, parser->dataset_id, dataset_id_length - 1);
+                    new_token_list->dataset_id [dataset_id_length - 1] = '\0';
+                    *token_list = new_token_list;
                 }
-                break;
-            }
-            cJSON* curr = json->child;
 
-            // ===== ===== ===== BEGIN Use current cJSON object ===== ===== =====
-            while (curr != NULL)
-            {
-                // Extract the information from the current cJSON object
-                const size_t new_tokens_found = Use_Current_JSON_Fragment(json, curr, new_container);
-                sum_tokens_found += (uint_fast32_t) new_tokens_found;
-                curr = curr->next;
+                // Is more memory for the new token in the Token_List necessary ?
+                if (new_token_list->next_free_element >= new_token_list->allocated_tokens)
+                {
+                    Increase_Number_Of_Tokens (container, new_token_list);
+                }
 
-                if (one_line_file)
+                size_t token_length = content_length;
+                if (! needs_decoding)
+                {
+                    // Copy the token directly from the input
+                    Append_Token (container, new_token_list, content, content_length);
+                }
+                else
                 {
-                    tokens_read_before_last_output += new_tokens_found;
-                    if (tokens_read_before_last_output > tokens_read_print_steps)
+                    // Decode the token directly in the token memory (The decoded token is never longer than the raw one)
+                    Reserve_Token_Memory (container, content_length + 1);
+                    char* const new_token = &(container->token_memory [container->token_memory_used]);
+                    size_t decoded_length = 0;
+
+                    if (! JSON_Decode_String (content, content_length, new_token, content_length, &decoded_length,
+                            &(parser->position)))
                     {
-                        PRINTF_FFLUSH("Tokens read: %" PRIuFAST32 "\r", sum_tokens_found);
-                        tokens_read_before_last_output = 0;
+                        break;
                     }
+
+                    // Like strlen() in the cJSON version: The token ends with the first '\0'
+                    const char* const terminator = (const char*) memchr (new_token, '\0', decoded_length);
+                    token_length = (terminator != NULL) ? (size_t) (terminator - new_token) : decoded_length;
+                    new_token [token_length] = '\0';
+
+                    new_token_list->tokens [new_token_list->next_free_element].offset = container->token_memory_used;
+                    new_token_list->tokens [new_token_list->next_free_element].length = token_length;
+                    container->token_memory_used += token_length + 1;
                 }
+
+                new_token_list->next_free_element ++;
+                parser->tokens_found ++;
+
+                // Is the current token longer than the previous tokens ?
+                container->longest_token_length = MAX(container->longest_token_length, token_length);
+            }
+            else if (! JSON_Parse_Value (parser, NULL))
+            {
+                break;
             }
-            // ===== ===== ===== BEGIN Use current cJSON object ===== ===== =====
 
-            cJSON_Delete(json);
-            json = NULL;
-        }
+            JSON_Skip_Whitespace (parser);
+            if (parser->position < parser->end && *parser->position == ',')
+            {
+                ++ parser->position;
+                continue;
+            }
+            if (parser->position < parser->end && *parser->position == ']')
+            {
+                ++ parser->position;
+                valid = true;
+            }
+            break;
         }
-        else if (file_type == TXT_FILE_TYPE)
+    }
+    -- parser->depth;
+
+    return valid;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Parse an array or an object. Optionally the integer values of the elements will be saved as char offsets.
+ *
+ * The function expects, that all given pointer are valid and that the parser points to the '[' or '{' !
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] parser JSON_Parser object
+ * @param[in] save_char_offsets Save the integer values of the elements as char offsets in the parser ?
+ *
+ * @return true, if the array (or object) is valid, otherwise false
+ */
+static _Bool
+JSON_Parse_Array_Or_Object
+(
+        struct JSON_Parser* const parser,
+        const _Bool save_char_offsets
+)
+{
+    if (parser->depth >= JSON_NESTING_LIMIT) { return false; }
+    ++ parser->depth;
+
+    const _Bool is_object = (*parser->position == '{');
+    const char closing_char = (is_object) ? '}' : ']';
+    _Bool valid = false;
+
+    ++ parser->position;
+    JSON_Skip_Whitespace (parser);
+
+    if (parser->position < parser->end && *parser->position == closing_char)
+    {
+        ++ parser->position;
+        valid = true;
+    }
+    else
+    {
+        for (;;)
         {
-            // Add explicit a delimiter at the end of the input data to avoid problems with the last token
-            // The tokenize function go one char behind the last token and - when there is no extra char - the function
-            // determines a '\0' and stop working. The result: the last token will be skipped
-            // But this modification is only possible, when the input array has at least one char left
-            ASSERT_FMSG((char_read + 1) < unsigned_input_file_length,
-                    "Cannot prepare data for the tokenization ! The array needs to be at least %zu large; current length: %zu",
-                    (char_read + 1) + 1, unsigned_input_file_length)
-            input_file_data [char_read] = ' ';
-            input_file_data [char_read + 1] = '\0';
-            const struct Tokenized_String tokenized_string = Tokenize_String(input_file_data, " \t\n\r");
+            int value_int = 0;
 
-            // Print process information
-            char_read_before_last_output = Process_Printer(print_steps, char_read_before_last_output,
-                    sum_char_read, unsigned_input_file_length, true,
-                    Read_File_Process_Print_Function,
-                    NULL,
-                    NULL);
+            JSON_Skip_Whitespace (parser);
+            if (is_object && ! JSON_Parse_Member_Name (parser, NULL, 0)) { break; }
+            if (! JSON_Parse_Value (parser, &value_int)) { break; }
 
-            if (input_file_length > 0 && tokenized_string.next_free_pos_len == 0)
+            if (save_char_offsets)
             {
-                printf ("Error in the line %" PRIuFAST32 "\n", line_counter);
-                continue; // while (*current_parsing_position != '\0')
+                // Is more memory for the char offsets necessary ? Yes: Double the memory
+                if (parser->number_of_char_offsets >= parser->allocated_char_offsets)
+                {
+                    const size_t new_size = (parser->allocated_char_offsets == 0) ?
+                            JSON_CHAR_OFFSETS_INITIAL_SIZE : (parser->allocated_char_offsets * 2);
+                    int* tmp_ptr = (int*) REALLOC(parser->char_offsets, new_size * sizeof (int));
+                    ASSERT_ALLOC(tmp_ptr, "Cannot reallocate the memory for the char offsets !",
+                            new_size * sizeof (int));
+
+                    parser->char_offsets = tmp_ptr;
+                    parser->allocated_char_offsets = new_size;
+                }
+                parser->char_offsets [parser->number_of_char_offsets] = value_int;
+                parser->number_of_char_offsets ++;
             }
 
-            if (tokenized_string.next_free_pos_len > 0)
+            JSON_Skip_Whitespace (parser);
+            if (parser->position < parser->end && *parser->position == ',')
             {
-                sum_tokens_found +=
-                        Use_Current_Text_Fragment(input_file_data, unsigned_input_file_length, line_counter,
-                                &tokenized_string, new_container);
+                ++ parser->position;
+                continue;
             }
+            if (parser->position < parser->end && *parser->position == closing_char)
+            {
+                ++ parser->position;
+                valid = true;
+            }
+            break;
         }
-        else
+    }
+    -- parser->depth;
+
+    return valid;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Calculate the char, sentence and word offsets of all tokens in a new Token_List.
+ *
+ * The char offsets from the data will be used, if available. Otherwise they will be calculated.
+ *
+ * The function expects, that all given pointer are valid !
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] parser JSON_Parser object (It holds the char offsets from the data)
+ * @param[in] token_list The new Token_List
+ */
+static void
+JSON_Set_Offsets
+(
+        const struct JSON_Parser* const restrict parser,
+        struct Token_List* const restrict token_list
+)
+{
+    for (uint_fast32_t i = 0; i < token_list->next_free_element; ++ i)
+    {
+        // Zero for the fist element
+        if (i == 0)
         {
-            ASSERT_MSG(false,
-                    "Else path in the line parsing executed ! (No code for parsing the current file format available)");
+            TokenList_SetOffsets(token_list, 0, 0, 0, 0);
+            continue;
         }
-        // ===== ===== ===== ===== BEGIN Parse current line ===== ===== ===== =====
 
-        // Read next line
-        char_read                       = Read_Next_Line (input_file, input_file_data, input_file_length);
-        sum_char_read                   += char_read;
-        char_read_before_last_output    += char_read;
-        //fgets_res = fgets(input_file_data, (int) input_file_length, input_file);
-        //input_file_data [input_file_length] = '\0';
-    }
-    // ===== ===== ===== ===== ===== END Read file line by line ===== ===== ===== ===== =====
+        const char* last_token = Get_Address_Of_Token (parser->container, token_list, i - 1);
+        const size_t last_token_length = (size_t) u8_strlen((char*) last_token);
 
-    // Print tokens, that was longer than the expected length
-    if (new_container->list_of_too_long_token->next_free_c_str > 0)
-    {
-        printf("\n\nTokens, that are longer than expected (max. expected length: %d):\n", MAX_TOKEN_LENGTH - 1);
-        if (new_container->list_of_too_long_token->next_free_c_str <= 50)
+        size_t new_char_offset = 0;
+        // Using the char offset from the data, if available
+        // If not: calculate them
+        if (i < parser->number_of_char_offsets)
         {
-            TwoDimCStrArray_PrintAllStrings(new_container->list_of_too_long_token);
+            new_char_offset = (size_t) parser->char_offsets [i];
         }
         else
         {
-            const uint_fast32_t next_free_c_str = new_container->list_of_too_long_token->next_free_c_str;
-            const int num_of_digits             = (int) Count_Number_Of_Digits(next_free_c_str);
-            const uint_fast32_t print_range     = 15;
+            new_char_offset = token_list->char_offsets [i - 1] + last_token_length;
 
-            // Print the first and the last 15 tokens
-            for (uint_fast32_t i = 0; i < print_range; ++ i)
-            {
-                printf("%*" PRIuFAST32 ": %s\n", num_of_digits, i + 1, new_container->list_of_too_long_token->data [i]);
-            }
-            PRINT_X_TIMES_SAME_CHAR(' ', num_of_digits + 2);
-            puts("...");
-            for (uint_fast32_t i = (next_free_c_str - print_range); i < next_free_c_str; ++ i)
-            {
-                printf("%*" PRIuFAST32 ": %s\n", num_of_digits, i + 1, new_container->list_of_too_long_token->data [i]);
-            }
+            // Don't forget, that the char offsets in original data includes the blanks between the tokens !
+            // Example from test_ebm_formatted.json:
+            /* "tokens":            [ "[", "The", "chemotherapy", "of", ... ] */
+            /* abs_char_offsets":   [ 0, 2, 6, 19, ... ] */
+            /* => */ new_char_offset ++;
         }
-    }
 
-    CLOCK_WITH_RETURN_CHECK(end);
-    used_seconds = DETERMINE_USED_TIME(start, end);
+        const size_t new_sentence_offset = token_list->sentence_offsets [i - 1] +
+                ((last_token [0] == '.' && last_token_length == 1) ? (size_t) 1 : (size_t) 0);
+        const size_t new_word_offset = (size_t) token_list->word_offsets [i - 1] + 1;
 
-    const float file_size_in_MB = ((float) input_file_length / 1024.0f / 1024.0f);
-    printf ("\n=> %.3f MB in %3.3fs (~ %.3f MB/s) for parsing the whole file (" ANSI_TEXT_BOLD ANSI_TEXT_ITALIC
-            "%" PRIuFAST32 " tokens found" ANSI_RESET_ALL ")\n",
-            file_size_in_MB, used_seconds, file_size_in_MB / used_seconds, sum_tokens_found);
+        CAST_CHECK(new_char_offset, size_t, CHAR_OFFSET_TYPE);
 
-    FCLOSE_AND_SET_TO_NULL(input_file);
-    FREE_AND_SET_TO_NULL(input_file_data);
+        TokenList_SetOffsets(token_list, i, (CHAR_OFFSET_TYPE) new_char_offset,
+                (SENTENCE_OFFSET_TYPE) new_sentence_offset, (WORD_OFFSET_TYPE) new_word_offset);
+    }
 
-    return new_container;
+    return;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Delete a dynamic allocated Delete_Token_Container object.
+ * @brief Parse (and validate) a JSON value without using it.
+ *
+ * The function expects, that all given pointer are valid !
  *
  * Asserts:
- *      container != NULL
+ *      N/A
  *
- * @param[in] object Delete_Token_Container object
+ * @param[in] parser JSON_Parser object
+ * @param[out] value_int Integer value of the JSON value like in cJSON (Numbers saturated to int; true: 1; otherwise 0)
+ *
+ * @return true, if the value is valid, otherwise false
  */
-extern void
-TokenListContainer_DeleteObject
+static _Bool
+JSON_Parse_Value
 (
-        struct Token_List_Container* object
+        struct JSON_Parser* const restrict parser,
+        int* const restrict value_int
 )
 {
-    ASSERT_MSG(object != NULL, "Token_List_Container is NULL !");
+    const char* const value_begin   = parser->position;
+    const size_t available_chars    = (size_t) (parser->end - value_begin);
+    int value                       = 0;
+    _Bool valid                     = false;
 
-    TwoDimCStrArray_DeleteObject (object->list_of_too_long_token);
-    object->list_of_too_long_token = NULL;
+    if (available_chars == 0) { return false; }
 
-    if (object->token_lists != NULL)
+    switch (*value_begin)
     {
-        // Delete from inner to the outer objects
-        for (size_t i = 0; i < object->allocated_token_container; ++ i)
+    case 'n':
+        if (available_chars >= 4 && memcmp (value_begin, "null", 4) == 0)
+        {
+            parser->position += 4;
+            valid = true;
+        }
+        break;
+    case 'f':
+        if (available_chars >= 5 && memcmp (value_begin, "false", 5) == 0)
+        {
+            parser->position += 5;
+            valid = true;
+        }
+        break;
+    case 't':
+        if (available_chars >= 4 && memcmp (value_begin, "true", 4) == 0)
+        {
+            parser->position += 4;
+            value = 1;
+            valid = true;
+        }
+        break;
+    case '"':
+    {
+        const char* content = NULL;
+        size_t content_length = 0;
+        _Bool needs_decoding = false;
+
+        valid = JSON_Scan_String (parser, &content, &content_length, &needs_decoding);
+        if (valid && needs_decoding)
         {
-            free(object->token_lists [i].data);
-            object->token_lists [i].data = NULL;
-            free(object->token_lists [i].char_offsets);
-            object->token_lists [i].char_offsets = NULL;
-            free(object->token_lists [i].sentence_offsets);
-            object->token_lists [i].sentence_offsets = NULL;
-            free(object->token_lists [i].word_offsets);
-            object->token_lists [i].word_offsets = NULL;
-//            FREE_AND_SET_TO_NULL(object->token_lists [i].data);
-//            FREE_AND_SET_TO_NULL(object->token_lists [i].char_offsets);
-//            FREE_AND_SET_TO_NULL(object->token_lists [i].sentence_offsets);
-//            FREE_AND_SET_TO_NULL(object->token_lists [i].word_offsets);
+            // Only the validation of the escape sequences is necessary
+            size_t decoded_length = 0;
+            valid = JSON_Decode_String (content, content_length, NULL, 0, &decoded_length, &(parser->position));
         }
-        GLOBAL_free_calls += (object->allocated_token_container << 2);
+        break;
+    }
+    case '-':
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+        valid = JSON_Parse_Number (parser, &value);
+        break;
+    case '[':
+    case '{':
+        valid = JSON_Parse_Array_Or_Object (parser, false);
+        break;
+    default:
+        break;
     }
 
-    FREE_AND_SET_TO_NULL(object->token_lists);
-    FREE_AND_SET_TO_NULL(object);
+    if (valid && value_int != NULL)
+    {
+        *value_int = value;
+    }
 
-    return;
+    return valid;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Read a specific token from the container.
+ * @brief Parse a number like cJSON: The chars, that can be part of a number, will be converted with strtod(). Integers
+ * will be converted directly.
  *
- * For performance reasons, the memory for each token list is allocated as one memory block. Therefore the address
- * calculation is more complex. This is the reason for this function.
+ * The function expects, that all given pointer are valid !
  *
  * Asserts:
- *      container != NULL
- *      container->next_free_element < index_token_list
- *      index_token_in_token_list < container->token_lists [index_token_list].next_free_element
+ *      N/A
  *
- * @param[in] container Token_List_Container object
- * @param[in] index_token_list Index of the Token_List object
- * @param[in] index_token_in_token_list Index of the token in the Token_List object
+ * @param[in] parser JSON_Parser object
+ * @param[out] value_int Value of the number saturated to int
  *
- * @return Pointer at the begin of the token. (token is terminated with a null byte !)
+ * @return true, if the number is valid, otherwise false
  */
-extern char*
-TokenListContainer_GetToken
+static _Bool
+JSON_Parse_Number
 (
-        const struct Token_List_Container* const container,
-        const uint_fast32_t index_token_list,
-        const uint_fast32_t index_token_in_token_list
+        struct JSON_Parser* const restrict parser,
+        int* const restrict value_int
 )
 {
-    ASSERT_MSG(container != NULL, "Token_Container is NULL !");
-    ASSERT_FMSG(index_token_list < container->next_free_element, "Tokens object id is invalid ! Max. valid: %"
-            PRIuFAST32 "; Got: %" PRIuFAST32 " !", container->next_free_element - 1, index_token_list);
-    ASSERT_FMSG(index_token_in_token_list < container->token_lists [index_token_list].next_free_element,
-            "Token in Tokens object %" PRIuFAST32 " is invalid ! Max. valid: %" PRIuFAST32 "; Got: %" PRIuFAST32 " !",
-            index_token_list, container->token_lists [index_token_list].next_free_element - 1, index_token_in_token_list);
+    char number_c_string [64];
+    size_t number_length = 0;
+    _Bool only_digits = true;
+
+    while (number_length < (sizeof (number_c_string) - 1) && parser->position + number_length < parser->end)
+    {
+        const char c = parser->position [number_length];
+        if (c >= '0' && c <= '9')
+        {
+            // Digits are always allowed
+        }
+        else if (c == '+' || c == '-' || c == '.' || c == 'e' || c == 'E')
+        {
+            if (! (c == '-' && number_length == 0)) { only_digits = false; }
+        }
+        else
+        {
+            break;
+        }
+        number_c_string [number_length] = c;
+        ++ number_length;
+    }
+    number_c_string [number_length] = '\0';
+
+    // Integers (e.g. the char offsets) don't need strtod()
+    const size_t first_digit = (number_c_string [0] == '-') ? 1 : 0;
+    if (only_digits && number_length > first_digit && (number_length - first_digit) <= 18)
+    {
+        uint_fast64_t number = 0;
+        for (size_t i = first_digit; i < number_length; ++ i)
+        {
+            number = (number * 10) + (uint_fast64_t) (number_c_string [i] - '0');
+        }
+
+        if (first_digit == 0)
+        {
+            *value_int = (number >= INT_MAX) ? INT_MAX : (int) number;
+        }
+        else
+        {
+            *value_int = (number > INT_MAX) ? INT_MIN : - (int) number;
+        }
+        parser->position += number_length;
+
+        return true;
+    }
+
+    char* after_end = NULL;
+    const double number = strtod (number_c_string, &after_end);
+    if (after_end == number_c_string) { return false; }
 
-    const size_t max_token_size = container->token_lists [index_token_list].max_token_length;
+    if (number >= INT_MAX)              { *value_int = INT_MAX; }
+    else if (number <= (double) INT_MIN){ *value_int = INT_MIN; }
+    else                                { *value_int = (int) number; }
+    parser->position += (size_t) (after_end - number_c_string);
 
-    return container->token_lists [index_token_list].data + (max_token_size * index_token_in_token_list);
+    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Determine the full memory usage in byte.
+ * @brief Parse the name of an object member and the following ':'.
+ *
+ * The decoded name will be truncated to name_size - 1 chars or to the first '\0' in the name.
+ *
+ * The function expects, that all given pointer are valid !
  *
  * Asserts:
- *      container != NULL
+ *      N/A
  *
- * @param[in] container Token_List_Container object
+ * @param[in] parser JSON_Parser object
+ * @param[out] name Memory for the decoded name or NULL, if only a validation is necessary
+ * @param[in] name_size Size of the memory for the name
  *
- * @return Size of the full object in bytes
+ * @return true, if the member name is valid, otherwise false
  */
-extern size_t
-TokenListContainer_GetAllocatedMemSize
+static _Bool
+JSON_Parse_Member_Name
 (
-        const struct Token_List_Container* const container
+        struct JSON_Parser* const restrict parser,
+        char* const restrict name,
+        const size_t name_size
 )
 {
-    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+    const char* content = NULL;
+    size_t content_length = 0;
+    _Bool needs_decoding = false;
 
-    size_t result = 0;
+    if (parser->position >= parser->end || *parser->position != '"')                    { return false; }
+    if (! JSON_Scan_String (parser, &content, &content_length, &needs_decoding))         { return false; }
 
-    const size_t max_token_size = container [0].token_lists->max_token_length;
-    result += sizeof (struct Token_List) * container->allocated_token_container;
-    result += sizeof (struct Token_List_Container);
+    const size_t max_name_length = (name != NULL) ? (name_size - 1) : 0;
+    size_t name_length = 0;
+    if (needs_decoding)
+    {
+        if (! JSON_Decode_String (content, content_length, name, max_name_length, &name_length,
+                &(parser->position)))
+        {
+            return false;
+        }
+    }
+    else if (name != NULL)
+    {
+        name_length = content_length;
+        memcpy (name, content, MIN(content_length, max_name_length));
+    }
 
-    for (size_t i = 0; i < container->allocated_token_container; ++ i)
+    // A '\0' in the name truncates it (Like the strcmp() and strncpy() calls in the cJSON version)
+    if (name != NULL)
     {
-        result += (container->token_lists [i].allocated_tokens * max_token_size);
-        result += (container->token_lists [i].allocated_tokens * sizeof (CHAR_OFFSET_TYPE));
+        name [MIN(name_length, max_name_length)] = '\0';
     }
 
-    return result;
+    JSON_Skip_Whitespace (parser);
+    if (parser->position >= parser->end || *parser->position != ':') { return false; }
+    ++ parser->position;
+    JSON_Skip_Whitespace (parser);
+
+    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Print the content of a Token_List object.
+ * @brief Find the end of the string, that begins at the current position.
  *
- * This is only for debugging purposes useful.
+ * The escape sequences will NOT be validated ! (See: JSON_Decode_String)
+ *
+ * The function expects, that all given pointer are valid !
  *
  * Asserts:
- *      container != NULL
- *      container->next_free_element < index_token_list
+ *      N/A
  *
- * @param[in] container Token_List_Container object
- * @param[in] index_token_list Index of the Token_List object
+ * @param[in] parser JSON_Parser object
+ * @param[out] content Begin of the raw string content (After the '"')
+ * @param[out] content_length Length of the raw string content
+ * @param[out] needs_decoding Contains the string escape sequences or '\0' chars ?
+ *
+ * @return true, if the string is complete, otherwise false (Then the current position is after the '"')
  */
-extern void
-TokenListContainer_ShowSelectedTokenList
+static _Bool
+JSON_Scan_String
 (
-        const struct Token_List_Container* const container,
-        const size_t index_token_list
+        struct JSON_Parser* const restrict parser,
+        const char** const restrict content,
+        size_t* const restrict content_length,
+        _Bool* const restrict needs_decoding
 )
 {
-    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
-    ASSERT_FMSG(container->next_free_element > index_token_list, "Index for the Token_List object is invalid ! Max. "
-            "valid: %" PRIuFAST32 "; Got %zu !", container->next_free_element - 1, index_token_list);
-
-    const size_t token_size = container->token_lists [index_token_list].max_token_length;
+    const char* current = parser->position + 1;
+    _Bool special_chars = false;
 
-    printf ("Container: %zu (Dataset ID: %s)\n", index_token_list, container->token_lists [index_token_list].dataset_id);
-    for (size_t i = 0; i < container->token_lists [index_token_list].next_free_element; ++ i)
+    while (current < parser->end && *current != '"')
+    {
+        if (*current == '\\')
+        {
+            // The escaped char can't be the end of the string
+            if (current + 1 >= parser->end) { break; }
+            ++ current;
+            special_chars = true;
+        }
+        else if (*current == '\0')
+        {
+            special_chars = true;
+        }
+        ++ current;
+    }
+    if (current >= parser->end || *current != '"')
     {
-        printf ("%4zu: %s\n", i, &(container->token_lists [index_token_list].data [i * token_size]));
+        // Like in cJSON: An incomplete string will be reported after the '"'
+        ++ parser->position;
+        return false;
     }
-    PUTS_FFLUSH("");
 
-    return;
+    *content            = parser->position + 1;
+    *content_length     = (size_t) (current - *content);
+    *needs_decoding     = special_chars;
+    parser->position    = current + 1;
+
+    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Print the content of a Token_List object as array.
+ * @brief Decode the escape sequences of a raw string content.
  *
- * Example for the array representation:
- *      ID: <Token_List ID>: [ <Token_List data> ]
+ * The decoded string is never longer than the raw content. At most output_size chars will be written (no terminator
+ * symbol); the remaining content will only be validated.
  *
- * This is only for debugging purposes useful.
+ * The function expects, that all given pointer are valid !
  *
  * Asserts:
- *      container != NULL
- *      container->next_free_element < index_token_list
+ *      N/A
  *
- * @param[in] container Token_List_Container object
- * @param[in] index_token_list Index of the Token_List object
+ * @param[in] content Raw string content
+ * @param[in] content_length Length of the raw string content
+ * @param[out] output Memory for the decoded string or NULL, if only a validation is necessary
+ * @param[in] output_size Size of the output memory
+ * @param[out] decoded_length Length of the full decoded string
+ * @param[out] error_position Begin of the invalid escape sequence (Only set, if the function returns false)
+ *
+ * @return true, if all escape sequences are valid, otherwise false
  */
-extern void
-TokenListContainer_ShowSelectedTokenListAsArray
+static _Bool
+JSON_Decode_String
 (
-        const struct Token_List_Container* const container,
-        const size_t index_token_list
+        const char* const restrict content,
+        const size_t content_length,
+        char* const restrict output,
+        const size_t output_size,
+        size_t* const restrict decoded_length,
+        const char** const restrict error_position
 )
 {
-    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
-    ASSERT_FMSG(container->next_free_element > index_token_list, "Index for the Token_List object is invalid ! Max. "
-            "valid: %" PRIuFAST32 "; Got %zu !", container->next_free_element - 1, index_token_list);
-
-    const size_t token_size = container->token_lists [index_token_list].max_token_length;
+    const char* current = content;
+    const char* const end = content + content_length;
+    size_t length = 0;
 
-    printf ("Dataset ID: %s [ ", container->token_lists [index_token_list].dataset_id);
-    for (size_t i = 0; i < container->token_lists [index_token_list].next_free_element; ++ i)
+    while (current < end)
     {
-        printf ("\"%s\"", &(container->token_lists [index_token_list].data [i * token_size]));
+        if (*current != '\\')
+        {
+            if (length < output_size) { output [length] = *current; }
+            ++ length;
+            ++ current;
+            continue;
+        }
 
-        if ((i + 1) < container->token_lists [index_token_list].next_free_element)
+        // The scanner guarantees, that the '\' is followed by at least one char
+        char escaped_char = '\0';
+        switch (current [1])
         {
-            printf (", ");
+        case 'b':   escaped_char = '\b';    break;
+        case 'f':   escaped_char = '\f';    break;
+        case 'n':   escaped_char = '\n';    break;
+        case 'r':   escaped_char = '\r';    break;
+        case 't':   escaped_char = '\t';    break;
+        case '\"':
+        case '\\':
+        case '/':   escaped_char = current [1]; break;
+        case 'u':
+        {
+            // UTF-16 literal (Surrogate pairs need to be complete)
+            if ((end - current) < 6) { *error_position = current; return false; }
+            const unsigned long first_code = JSON_Parse_Hex4 (current + 2);
+            unsigned long codepoint = first_code;
+            size_t sequence_length = 6;
+
+            if (first_code >= 0xDC00 && first_code <= 0xDFFF) { *error_position = current; return false; }
+            if (first_code >= 0xD800 && first_code <= 0xDBFF)
+            {
+                const char* const second_sequence = current + 6;
+                if ((end - second_sequence) < 6)                                { *error_position = current; return false; }
+                if (second_sequence [0] != '\\' || second_sequence [1] != 'u')  { *error_position = current; return false; }
+
+                const unsigned long second_code = JSON_Parse_Hex4 (second_sequence + 2);
+                if (second_code < 0xDC00 || second_code > 0xDFFF)               { *error_position = current; return false; }
+
+                codepoint = 0x10000 + (((first_code & 0x3FF) << 10) | (second_code & 0x3FF));
+                sequence_length = 12;
+            }
+
+            // Encode the codepoint as UTF-8
+            unsigned char utf8 [4];
+            size_t utf8_length = 0;
+            unsigned char first_byte_mark = 0;
+            if (codepoint < 0x80)           { utf8_length = 1; }
+            else if (codepoint < 0x800)     { utf8_length = 2; first_byte_mark = 0xC0; }
+            else if (codepoint < 0x10000)   { utf8_length = 3; first_byte_mark = 0xE0; }
+            else if (codepoint <= 0x10FFFF) { utf8_length = 4; first_byte_mark = 0xF0; }
+            else                            { *error_position = current; return false; }
+
+            for (size_t i = utf8_length - 1; i > 0; -- i)
+            {
+                utf8 [i] = (unsigned char) ((codepoint | 0x80) & 0xBF);
+                codepoint >>= 6;
+            }
+            utf8 [0] = (utf8_length > 1) ? (unsigned char) ((codepoint | first_byte_mark) & 0xFF) :
+                    (unsigned char) (codepoint & 0x7F);
+
+            for (size_t i = 0; i < utf8_length; ++ i)
+            {
+                if (length < output_size) { output [length] = (char) utf8 [i]; }
+                ++ length;
+            }
+            current += sequence_length;
+            continue;
+        }
+        default:
+            *error_position = current;
+            return false;
         }
+
+        if (length < output_size) { output [length] = escaped_char; }
+        ++ length;
+        current += 2;
     }
-    PUTS_FFLUSH(" ]");
 
-    return;
+    *decoded_length = length;
+
+    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Print the content of all Token_List containers in a Token_List_Container object.
+ * @brief Convert four hex digits (of an \u escape sequence) to an integer.
  *
- * This is only for debugging purposes useful.
+ * Like in cJSON an invalid hex digit results in the value 0.
  *
  * Asserts:
- *      container != NULL
+ *      N/A
  *
- * @param[in] container Token_List_Container object
+ * @param[in] hex The four hex digits
+ *
+ * @return The value of the hex digits or 0, if there are invalid digits
  */
-extern void
-TokenListContainer_ShowAllTokenLists
+static unsigned long
+JSON_Parse_Hex4
 (
-        const struct Token_List_Container* const container
+        const char* const hex
 )
 {
-    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+    unsigned long value = 0;
 
-    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    for (size_t i = 0; i < 4; ++ i)
     {
-        TokenListContainer_ShowSelectedTokenList (container, i);
+        value <<= 4;
+        if (hex [i] >= '0' && hex [i] <= '9')       { value += (unsigned long) (hex [i] - '0'); }
+        else if (hex [i] >= 'A' && hex [i] <= 'F')  { value += (unsigned long) (10 + hex [i] - 'A'); }
+        else if (hex [i] >= 'a' && hex [i] <= 'f')  { value += (unsigned long) (10 + hex [i] - 'a'); }
+        else                                        { return 0; }
     }
 
-    return;
+    return value;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Print the content of all Token_List containers in a Token_List_Container object with the array representation.
- *
- * This is only for debugging purposes useful.
+ * @brief Skip the white spaces (all chars <= 32 like in cJSON) at the current position.
  *
  * Asserts:
- *      container != NULL
+ *      N/A
  *
- * @param[in] container Token_List_Container object
+ * @param[in] parser JSON_Parser object
  */
-extern void
-TokenListContainer_ShowAllTokenListsAsArrays
+static inline void
+JSON_Skip_Whitespace
 (
-        const struct Token_List_Container* const container
+        struct JSON_Parser* const parser
 )
 {
-    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
-
-    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    while (parser->position < parser->end && (unsigned char) *parser->position <= 32)
     {
-        TokenListContainer_ShowSelectedTokenListAsArray (container, i);
+        ++ parser->position;
     }
 
     return;
@@ -834,403 +3426,479 @@ TokenListContainer_ShowAllTokenListsAsArrays
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Count all tokens in the whole Token_List_Container object.
+ * @brief Use the current text line and determine the tokens, char, sentence and the word offset.
+ *
+ * The idea of the curr_line_num is, that the data sets get an created ID, because the data fragments from text files
+ * have - unlike the JSON fragments - no ID. Technically an ID is not necessary for the calculations, but it is a good
+ * information to get the position of the data in the source file.
  *
  * Asserts:
- *      container != NULL
+ *      N/A
  *
- * @param[in] container Token_List_Container object
+ * @param[in] curr_text Content of the current text line
+ * @param[in] curr_text_len Length of the current text line
+ * @param[in] curr_line_num Current line number or UINT_FAST32_MAX, if this variable is unused
+ * @param[in] tokenize_data Already calculated tokenize data
+ * @param[in] new_container The new container, that will save the new information
  *
- * @return Counted number of whole tokens in the Token_List_Container object
+ * @return Number of tokens, that were found (This value can be 0 ! Then no dataset will be created.)
  */
-extern uint_fast32_t
-TokenListContainer_CountAllTokens
+static uint_fast32_t
+Use_Current_Text_Fragment
 (
-        const struct Token_List_Container* const container
+        char* const curr_text,
+        const size_t curr_text_len,
+        const uint_fast32_t curr_line_num,
+        const struct Tokenized_String* const tokenize_data,
+        struct Token_List_Container* const new_container
 )
 {
-    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
-
-    uint_fast32_t result = 0;
+    uint_fast32_t tokens_found = 0;
+    const size_t token_memory_begin = new_container->token_memory_used;
 
-    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    // Realloc necessary ?
+    // Is it necessary to realloc/increase the number of Token_List objects in the container ?
+    if (new_container->next_free_element >= new_container->allocated_token_container)
     {
-        result += container->token_lists [i].next_free_element;
+        Increase_Number_Of_Token_Lists (new_container);
     }
 
-    return result;
-}
+    if (curr_line_num != UINT_FAST32_MAX)
+    {
+        char int_to_str_mem [10] = { '\0', '\0', '\0', '\0', '\0',  '\0', '\0', '\0', '\0', '\0' };
 
-//---------------------------------------------------------------------------------------------------------------------
+        const enum int2str_errno convert_status = int2str(int_to_str_mem,
+                COUNT_ARRAY_ELEMENTS(int_to_str_mem), (long int) curr_line_num);
+        ASSERT_FMSG(convert_status == INT2STR_SUCCESS, "Cannot convert the int value %" PRIuFAST32 " to a c string ! "
+                "Error code: %d !", curr_line_num, (int) convert_status);
 
-/**
- * @brief Determine the longest token in the whole container and return the value.
- *
- * This function need some time, especially when the container holds many tokens.
- *
- * Asserts:
- *      container != NULL
- *
- * @param[in] container Token_List_Container object
- *
- * @return Length of the longest token
- */
-extern size_t
-TokenListContainer_GetLenghOfLongestToken
-(
-        const struct Token_List_Container* const container
-)
-{
-    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+        Multi_strncat(new_container->token_lists [new_container->next_free_element].dataset_id,
+                DATASET_ID_LENGTH - 1, 3, "Line ", int_to_str_mem, "\0");
+    }
 
-    const size_t token_size = container->token_lists [0].max_token_length;
-    size_t result = 0;
+    struct Token_List* const current_token_list_obj = &(new_container->token_lists [new_container->next_free_element]);
 
-    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    // ===== ===== ===== BEGIN Use all tokens in the current text line ===== ===== =====
+    for (uint_fast32_t i = 0; i < tokenize_data->next_free_pos_len; ++ i)
     {
-        for (uint_fast32_t i2 = 0; i2 < container->token_lists [i].next_free_element; ++ i2)
+        // Skip empty tokens
+        if (tokenize_data->token_data [i].len == 0) { continue; }
+
+        ASSERT_FMSG((size_t) (tokenize_data->token_data[i].pos + tokenize_data->token_data[i].len) <= curr_text_len,
+                "Invalid tokenize data found ! Length needs to be at least %zu; but a text with %zu is given !",
+                (size_t) (tokenize_data->token_data[i].pos + tokenize_data->token_data[i].len), curr_text_len);
+
+        // Is more memory for the new token in the Token_List necessary ?
+        if (current_token_list_obj->next_free_element >= current_token_list_obj->allocated_tokens)
+        {
+            Increase_Number_Of_Tokens (new_container, current_token_list_obj);
+        }
+
+        const size_t curr_token_len = (size_t) tokenize_data->token_data [i].len;
+        char* const token_begin = &(curr_text [tokenize_data->token_data [i].pos]);
+
+        // Temporary override end char of the current token to make the char range null terminated
+        const char saved_char = *(token_begin + curr_token_len);
+        *(token_begin + curr_token_len) = '\0';
+
+        // Copy token to the token memory of the container
+        Append_Token (new_container, current_token_list_obj, token_begin, curr_token_len);
+
+        // Remember the token, if it is a long token (The token will NOT be truncated)
+        if (curr_token_len > (MAX_TOKEN_LENGTH - 1))
+        {
+            TwoDimCStrArray_AppendNewString
+            (
+                    new_container->list_of_long_tokens,
+                    token_begin,
+                    curr_token_len
+            );
+        }
+
+        if (current_token_list_obj->next_free_element == 0)
+        {
+            TokenList_SetOffsets(current_token_list_obj, 0, 0, 0, 0);
+        }
+        else
         {
-            result = MAX_WITH_TYPE_CHECK(result, strlen (&(container->token_lists [i].data [i2 * token_size])));
+            const char* last_token = Get_Address_Of_Token (new_container, current_token_list_obj,
+                    current_token_list_obj->next_free_element - 1);
+            // VVV This is the old way without notifying UTF8 char VVV
+            // const size_t last_token_length = strlen(last_token);
+            const size_t last_token_length = (size_t) u8_strlen((char*) last_token);
+
+            size_t new_char_offset = current_token_list_obj->char_offsets [current_token_list_obj->next_free_element - 1] +
+                    last_token_length;
+
+            // Don't forget, that the char offsets in original data includes the blanks between the tokens !
+            // Example from test_ebm_formatted.json:
+            /* "tokens":            [ "[", "The", "chemotherapy", "of", ... ] */
+            /* abs_char_offsets":   [ 0, 2, 6, 19, ... ] */
+            /* => */ new_char_offset ++;
+
+            const size_t new_sentence_offset =
+                    current_token_list_obj->sentence_offsets [current_token_list_obj->next_free_element - 1] +
+                    (last_token [0] == '.' && (IS_STRING_LENGTH_ONE(last_token))) ? 1 : 0;
+            const size_t new_word_offset = (size_t)
+                    current_token_list_obj->word_offsets [current_token_list_obj->next_free_element - 1] + 1;
+
+            CAST_CHECK(new_char_offset, size_t, CHAR_OFFSET_TYPE);
+
+            TokenList_SetOffsets(current_token_list_obj, current_token_list_obj->next_free_element,
+                    (CHAR_OFFSET_TYPE) new_char_offset, (SENTENCE_OFFSET_TYPE) new_sentence_offset, (WORD_OFFSET_TYPE) new_word_offset);
         }
-    }
 
-    return result;
-}
+        current_token_list_obj->next_free_element ++;
+        tokens_found ++;
 
-//---------------------------------------------------------------------------------------------------------------------
+        // Is the current token longer than the previous tokens ?
+        new_container->longest_token_length = MAX(new_container->longest_token_length, curr_token_len);
 
-/**
- * @brief Determine the longest Token_List object and return the value.
- *
- * Asserts:
- *      container != NULL
- *
- * @param[in] container Token_List_Container object
- *
- * @return Length of the longest Token_List object
- */
-extern size_t
-TokenListContainer_GetLenghOfLongestTokenList
-(
-        const struct Token_List_Container* const container
-)
-{
-    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+        // Recover the origin text content
+        *(token_begin + tokenize_data->token_data [i].len) = saved_char;
+    }
+    // ===== ===== ===== END Use all tokens in the current text line ===== ===== =====
 
-    size_t result = 0;
+    // A line with only white spaces creates no dataset (like an empty line)
+    if (tokens_found == 0)
+    {
+        memset (current_token_list_obj->dataset_id, '\0', sizeof (current_token_list_obj->dataset_id));
+        return tokens_found;
+    }
 
-    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    // Use next element in the container
+    new_container->next_free_element ++;
+
+    if (new_container->token_int_mapping != NULL)
     {
-        if (container->token_lists [i].next_free_element > result)
-        {
-            result = container->token_lists [i].next_free_element;
-        }
+        Intern_New_Tokens (new_container, new_container->next_free_element - 1, new_container->next_free_element,
+                token_memory_begin);
     }
 
-    return result;
+    return tokens_found;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Determine the array index of the longest Token_List object and return the value.
+ * @brief Try to determine the file type.
+ *
+ * The function will check for a JSON or a text file.
  *
  * Asserts:
- *      container != NULL
+ *      input_file != NULL
  *
- * @param[in] container Token_List_Container object
+ * @param input_file The already opened file.
  *
- * @return Array index of the longest Token_List object
+ * @return Type of the file; if a determination was not possible UNKNOWN_FILE_TYPE will be returned
  */
-extern size_t
-TokenListContainer_GetArrayIndexOfLongestTokenList
+static enum File_Type
+Determine_File_Type
 (
-        const struct Token_List_Container* const container
+        struct Input_File* const input_file
 )
 {
-    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+    ASSERT_MSG(input_file != NULL, "Input_File object is NULL !");
 
-    size_t max_length   = 0;
-    size_t result       = 0;
+    _Bool JSON_start_char_found = false;
+    _Bool JSON_end_char_found   = false;
 
-    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    // For a simple check mechanism we expect, that an JSON file starts with a '{' and end with a '}'
+    // There will be no check, if the input file is a full valid JSON file. This will done in the reading process, when
+    // this function determines a JSON file
+
+    if (input_file->mapped_data != NULL)
     {
-        if (container->token_lists [i].next_free_element > max_length)
+        const char* const data = input_file->mapped_data;
+
+        // Reading until an '{' or a not space char was found
+        for (size_t i = 0; i < input_file->mapped_size; ++ i)
         {
-            max_length = container->token_lists [i].next_free_element;
-            result = (size_t) i;
+            if (data [i] == '{')
+            {
+                JSON_start_char_found = true;
+                break;
+            }
+            else if (! isspace((unsigned char) data [i]))
+            {
+                JSON_start_char_found = false;
+                break;
+            }
         }
-    }
-
-    return result;
-}
 
-//---------------------------------------------------------------------------------------------------------------------
+        // Reading until an '}' or a not space char was found
+        for (size_t i = input_file->mapped_size; i > 0; -- i)
+        {
+            if (data [i - 1] == '}')
+            {
+                JSON_end_char_found = true;
+                break;
+            }
+            else if (! isspace((unsigned char) data [i - 1]))
+            {
+                JSON_end_char_found = true;
+                break;
+            }
+        }
 
-/**
- * @brief Determine the length of the longest data set ID.
- *
- * Asserts:
- *      container != NULL
- *
- * @param[in] container Token_List_Container object
- *
- * @return Length of the longest data set ID
- */
-extern size_t
-TokenListContainer_GetLengthOfLongestDatasetID
-(
-        const struct Token_List_Container* const container
-)
-{
-    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+        return (JSON_start_char_found && JSON_end_char_found) ? JSON_FILE_TYPE : TXT_FILE_TYPE;
+    }
 
-    size_t longest_dataset_id = 0;
+    FILE* const file = input_file->file;
 
-    for (uint_fast32_t i = 0; i < container->next_free_element; ++ i)
+    // Set the cursor to the start of the file and save the current cursor position
+    const long int curr_cursor_pos = ftell (file);
+    if (curr_cursor_pos == -1L)
     {
-        const size_t cur_id_length = strlen (container->token_lists [i].dataset_id);
-        if (cur_id_length > longest_dataset_id)
+        // Not seekable file (e.g. a pipe): Only the first not space char can be checked
+        // The leading white spaces will be consumed; this changes nothing in the parsing
+        int curr_c = 0;
+        while ((curr_c = fgetc(file)) != EOF && isspace(curr_c)) {}
+        if (curr_c != EOF)
         {
-            longest_dataset_id = cur_id_length;
+            const int ungetc_return = ungetc(curr_c, file);
+            ASSERT_MSG(ungetc_return != EOF, "ungetc() failed !");
         }
+
+        return (curr_c == '{') ? JSON_FILE_TYPE : TXT_FILE_TYPE;
     }
+    int fseek_return = fseek (file, 0, SEEK_SET);
+    ASSERT_FMSG(fseek_return == 0, "fseek() returned a nonzero value: %s", strerror(errno));
 
-    return longest_dataset_id;
-}
+    // Reading until an '{' or a not space char was found
+    int curr_c = 0;
+    while ((curr_c = fgetc(file)) != EOF)
+    {
+        if (curr_c == '{')
+        {
+            JSON_start_char_found = true;
+            break;
+        }
+        else if (! isspace(curr_c))
+        {
+            JSON_start_char_found = false;
+            break;
+        }
+    }
 
-//---------------------------------------------------------------------------------------------------------------------
+    // Reading until an '}' or a not space char was found
+    curr_c = 0;
+    for (long int i = 0; curr_c != EOF; i ++)
+    {
+        fseek_return = fseek (file, -(i + 1), SEEK_END);
+        ASSERT_FMSG(fseek_return == 0, "fseek() returned a nonzero value: %s", strerror(errno));
 
-/**
- * @brief Print several container information.
- *
- * Asserts:
- *      container != NULL
- *
- * @param[in] container Token_List_Container object
- */
-extern void
-TokenListContainer_ShowAttributes
-(
-        const struct Token_List_Container* const container
-)
-{
-    ASSERT_MSG(container != NULL, "Token_List_Container is NULL !");
+        curr_c = fgetc (file);
+        if (curr_c == '}')
+        {
+            JSON_end_char_found = true;
+            break;
+        }
+        else if (! isspace(curr_c))
+        {
+            JSON_end_char_found = true;
+            break;
+        }
+    }
 
-    puts("");
-    printf ("Full token list container size: ");
-    Print_Memory_Size_As_B_KB_MB(TokenListContainer_GetAllocatedMemSize(container));
-    printf ("Sum all tokens:                 %" PRIuFAST32 "\n", TokenListContainer_CountAllTokens(container));
-    printf ("Number of token lists:          %" PRIuFAST32 "\n", container->next_free_element);
-    // Actual every token list has the same max token length !
-    printf ("Max. possible token length:     %zu\n", container->token_lists [0].max_token_length);
-    printf ("Average token length:           %zu\n", Get_Average_Token_Length(container));
-    printf ("Longest token list:             %zu\n", TokenListContainer_GetLenghOfLongestTokenList(container));
-    printf ("Array index longest token list: %zu\n", TokenListContainer_GetArrayIndexOfLongestTokenList(container));
-    printf ("Longest saved token:            %zu\n", TokenListContainer_GetLenghOfLongestToken(container));
-    printf ("Longest token in the container: %zu\n", container->longest_token_length);
-    printf ("Longest dataset id:             %zu\n", TokenListContainer_GetLengthOfLongestDatasetID(container));
-    printf ("Malloc / calloc calls:          %zu\n", container->malloc_calloc_calls);
-    printf ("Realloc calls:                  %zu\n", container->realloc_calls);
-    PUTS_FFLUSH("");
+    // Set the file cursor the origin position
+    fseek_return = fseek (file, curr_cursor_pos, SEEK_SET);
+    ASSERT_FMSG(fseek_return == 0, "fseek() returned a nonzero value: %s", strerror(errno));
 
-    return;
+    return (JSON_start_char_found && JSON_end_char_found) ? JSON_FILE_TYPE : TXT_FILE_TYPE;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
+
+
 /**
- * @brief Add a tuple with the three offsets to a Token_List.
+ * @brief Create the token list from a file. With a given Token_Int_Mapping the tokens will be interned directly
+ * (direct-to-id ingestion).
  *
  * Asserts:
- *      container != NULL
- *      index < container->allocated_tokens
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      number_of_threads > 0
  *
- * @param[in] container Token_List object
- * @param[in] index Data index
- * @param[in] char_offset New char offset
- * @param[in] sentence_offset New sentence offset
- * @param[in] word_offset New word offset
+ * @param[in] file_name Input file name
+ * @param[in] number_of_threads Max. number of threads
+ * @param[in] token_int_mapping Token_Int_Mapping of the direct-to-id ingestion or NULL
+ *
+ * @return Address to the new dynamic Token_List_Container
  */
-extern void
-TokenList_SetOffsets
+static struct Token_List_Container*
+Create_Token_List_Container_From_File
 (
-        struct Token_List* const container,
-        const size_t index,
-        const CHAR_OFFSET_TYPE char_offset,
-        const SENTENCE_OFFSET_TYPE sentence_offset,
-        const WORD_OFFSET_TYPE word_offset
+        const char* const restrict file_name,
+        const size_t number_of_threads,
+        struct Token_Int_Mapping* const restrict token_int_mapping
 )
 {
-    ASSERT_MSG(container != NULL, "Token_List object is NULL !");
-    ASSERT_FMSG(index < container->allocated_tokens, "Index (%zu) is out of bounds ! Max. valid %zu !", index,
-            container->allocated_tokens);
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+    ASSERT_MSG(strlen(file_name) > 0, "File name is empty !");
+    ASSERT_MSG(number_of_threads > 0, "Number of threads is 0 !");
 
-    container->char_offsets [index]     = char_offset;
-    container->sentence_offsets [index] = sentence_offset;
-    container->word_offsets [index]     = word_offset;
+    // Open the file: Regular files will be mapped in the memory; other files (e.g. pipes) will be read buffered
+    struct Input_File input_file;
+    Open_Input_File (&input_file, file_name);
 
-    return;
-}
+    // Determine the file type
+    const enum File_Type file_type = Determine_File_Type (&input_file);
+    switch (file_type)
+    {
+    case NOT_SPECIFIED_FILE_TYPE:
+        printf("Not specified file type for \"%s\"\n", file_name);
+        break;
+    case JSON_FILE_TYPE:
+        printf("Assume, that \"%s\" is a file with " ANSI_TEXT_BOLD "JSON formatted data" ANSI_RESET_ALL "\n", file_name);
+        break;
+    case TXT_FILE_TYPE:
+        printf("Assume, that \"%s\" is a file with raw " ANSI_TEXT_BOLD "text data" ANSI_RESET_ALL "\n", file_name);
+        break;
+    case UNKNOWN_FILE_TYPE:
+        printf("Cannot determine the file type for \"%s\" !\n", file_name);
+        break;
+    default:
+        ASSERT_MSG(false, "Switch case default path executed !");
+    }
+    puts("Start file loading ...");
 
-//=====================================================================================================================
+    // The wall clock time shows the speedup of the threads (clock() measures the processor time of all threads)
+    const uint64_t start_time = Current_Time_In_Ns ();
 
-/**
- * @brief Calculate the begin of the next free token in a Token_List.
- *
- * Asserts:
- *      token_list != NULL
- *
- * @param[in] token_list Token_List object
- *
- * @return Pointer to the begin of the next free token
- */
-static char*
-Get_Address_Of_Next_Free_Token
-(
-        const struct Token_List* const token_list
-)
-{
-    ASSERT_MSG(token_list != NULL, "Token_List is NULL !");
+    struct Token_List_Container* new_container  = NULL;
+    uint_fast32_t sum_tokens_found              = 0;
+    size_t sum_char_read                        = 0;
+
+    if (number_of_threads > 1 && input_file.mapped_data != NULL &&
+            (file_type == JSON_FILE_TYPE || file_type == TXT_FILE_TYPE))
+    {
+        new_container = Parse_Input_File_Parallel (&input_file, file_type, number_of_threads, token_int_mapping,
+                &sum_tokens_found);
+        sum_char_read = input_file.file_size;
+    }
+    if (new_container == NULL)
+    {
+        new_container = Create_Token_List_Container ();
+        new_container->token_int_mapping = token_int_mapping;
+        sum_tokens_found = Parse_Input_File (&input_file, file_type, 0, true, new_container, &sum_char_read);
+    }
+    new_container->malloc_calloc_calls ++;
+
+    // Print the long tokens
+    if (new_container->list_of_long_tokens->next_free_c_str > 0)
+    {
+        printf("\n\nLong tokens (longer than %d chars; they are not truncated):\n", MAX_TOKEN_LENGTH - 1);
+        if (new_container->list_of_long_tokens->next_free_c_str <= 50)
+        {
+            TwoDimCStrArray_PrintAllStrings(new_container->list_of_long_tokens);
+        }
+        else
+        {
+            const uint_fast32_t next_free_c_str = new_container->list_of_long_tokens->next_free_c_str;
+            const int num_of_digits             = (int) Count_Number_Of_Digits(next_free_c_str);
+            const uint_fast32_t print_range     = 15;
 
-    return token_list->data + (token_list->max_token_length * token_list->next_free_element);
-}
+            // Print the first and the last 15 tokens
+            for (uint_fast32_t i = 0; i < print_range; ++ i)
+            {
+                printf("%*" PRIuFAST32 ": %s\n", num_of_digits, i + 1, new_container->list_of_long_tokens->data [i]);
+            }
+            PRINT_X_TIMES_SAME_CHAR(' ', num_of_digits + 2);
+            puts("...");
+            for (uint_fast32_t i = (next_free_c_str - print_range); i < next_free_c_str; ++ i)
+            {
+                printf("%*" PRIuFAST32 ": %s\n", num_of_digits, i + 1, new_container->list_of_long_tokens->data [i]);
+            }
+        }
+    }
 
-//---------------------------------------------------------------------------------------------------------------------
+    const float used_seconds = (float) (Current_Time_In_Ns () - start_time) / 1e9f;
 
-/**
- * @brief Calculate the begin of the token specified with an index in a Token_List.
- *
- * Asserts:
- *      token_list != NULL
- *      token_index < allocated_tokens
- *
- * @param[in] token_list Token_List object
- * @param[in] token_index Index of the token
- *
- * @return Pointer to the begin of the token with the given index
- */
-static char*
-Get_Address_Of_Token
-(
-        const struct Token_List* const token_list,
-        const uint_fast32_t token_index
-)
-{
-    ASSERT_MSG(token_list != NULL, "Token_List is NULL !");
-    ASSERT_FMSG(token_index < token_list->allocated_tokens,
-            "Specified token index is too large ! Given: %" PRIuFAST32 "; Max. valid: %zu !",
-            token_index, token_list->allocated_tokens - 1);
+    // The size of a pipe is unknown before the reading
+    const size_t read_bytes = (input_file.file_size > 0) ? input_file.file_size : sum_char_read;
+    const float file_size_in_MB = ((float) read_bytes / 1024.0f / 1024.0f);
+    printf ("\n=> %.3f MB in %3.3fs (~ %.3f MB/s) for parsing the whole file (" ANSI_TEXT_BOLD ANSI_TEXT_ITALIC
+            "%" PRIuFAST32 " tokens found" ANSI_RESET_ALL ")\n",
+            file_size_in_MB, used_seconds, file_size_in_MB / used_seconds, sum_tokens_found);
 
-    return token_list->data + (token_list->max_token_length * token_index);
+    Close_Input_File (&input_file);
+
+    return new_container;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Calculate the the average of all tokens in the object.
- *
- * This information is for debugging and statistical purposes helpful.
+ * @brief Delete the tokens and the offsets of all allocated Token_List objects.
  *
  * Asserts:
- *      token_list_container != NULL
- *
- * @param[in] token_list_container Token_List_Container object
+ *      N/A
  *
- * @return Average token length
+ * @param[in] container Token_List_Container object
  */
-static size_t
-Get_Average_Token_Length
+static void
+Delete_Token_Data
 (
-        const struct Token_List_Container* const token_list_container
+        struct Token_List_Container* const container
 )
 {
-    ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
-
-    size_t sum_token_length = 0;
-
-    for (uint_fast32_t i = 0; i < token_list_container->next_free_element; ++ i)
+    if (container->token_lists != NULL)
     {
-        for (uint_fast32_t i2 = 0; i2 < token_list_container->token_lists [i].next_free_element; ++ i2)
+        // Delete from inner to the outer objects
+        // The handles are the begin of the memory block with all columns of a Token_List
+        for (size_t i = 0; i < container->allocated_token_container; ++ i)
         {
-            sum_token_length += strlen (TokenListContainer_GetToken(token_list_container, i, i2));
+            if (container->token_lists [i].tokens != NULL)
+            {
+                FREE_AND_SET_TO_NULL(container->token_lists [i].tokens);
+            }
+            container->token_lists [i].char_offsets = NULL;
+            container->token_lists [i].sentence_offsets = NULL;
+            container->token_lists [i].word_offsets = NULL;
         }
     }
 
-    const float result = (float) sum_token_length / (float) TokenListContainer_CountAllTokens(token_list_container);
-    return (size_t) ceil (result);
+    return;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Increase the number of Token_List objects in a Token_List_Container.
+ * @brief Intern the tokens of the new Token_List objects in the Token_Int_Mapping of the container (direct-to-id
+ * ingestion) and remove their chars from the token memory.
  *
- * The default allocation step size (TOKEN_CONTAINER_ALLOCATION_STEP_SIZE) will be used.
+ * After the call the handles of the tokens contain the mapped integers.
  *
  * Asserts:
- *      token_list_container != NULL
+ *      N/A
  *
- * @param[in] token_list_container Token_List_Container object
+ * @param[in] container Token_List_Container object with a Token_Int_Mapping
+ * @param[in] first_token_list Index of the first new Token_List
+ * @param[in] end_token_list Index after the last new Token_List
+ * @param[in] token_memory_begin Used token memory before the new Token_List objects
  */
 static void
-Increase_Number_Of_Token_Lists
+Intern_New_Tokens
 (
-        struct Token_List_Container* const token_list_container
+        struct Token_List_Container* const container,
+        const uint_fast32_t first_token_list,
+        const uint_fast32_t end_token_list,
+        const size_t token_memory_begin
 )
 {
-    ASSERT_MSG(token_list_container != NULL, "Token_List_Container is NULL !");
-
-    static size_t token_container_realloc_counter = 0;
-    ++ token_container_realloc_counter;
-    const size_t old_allocated_token_container = token_list_container->allocated_token_container;
-
-    // Adjust the number of Token_List object
-    struct Token_List* temp_ptr = (struct Token_List*) REALLOC(token_list_container->token_lists,
-            (old_allocated_token_container + TOKEN_CONTAINER_ALLOCATION_STEP_SIZE) * sizeof (struct Token_List));
-    ASSERT_ALLOC(temp_ptr, "Cannot reallocate memory for Token_Container objects !",
-            (old_allocated_token_container + TOKEN_CONTAINER_ALLOCATION_STEP_SIZE) * sizeof (struct Token_List));
-    memset(temp_ptr + old_allocated_token_container, '\0', sizeof (struct Token_List) * TOKEN_CONTAINER_ALLOCATION_STEP_SIZE);
-    token_list_container->realloc_calls ++;
-
-    token_list_container->token_lists = temp_ptr;
-    token_list_container->allocated_token_container = old_allocated_token_container + TOKEN_CONTAINER_ALLOCATION_STEP_SIZE;
-
-    // Create memory for the new Token_List objects
-    for (size_t i = old_allocated_token_container; i < token_list_container->allocated_token_container; ++ i)
+    for (uint_fast32_t i = first_token_list; i < end_token_list; ++ i)
     {
-        token_list_container->token_lists [i].data = (char*) CALLOC(MAX_TOKEN_LENGTH * TOKENS_ALLOCATION_STEP_SIZE, sizeof (char));
-        ASSERT_ALLOC(token_list_container->token_lists [i].data, "Cannot create data for a Token object !",
-                MAX_TOKEN_LENGTH * TOKENS_ALLOCATION_STEP_SIZE * sizeof (char));
-
-        token_list_container->token_lists [i].char_offsets =
-                (CHAR_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (CHAR_OFFSET_TYPE));
-        ASSERT_ALLOC(token_list_container->token_lists [i].char_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (CHAR_OFFSET_TYPE));
-
-        token_list_container->token_lists [i].sentence_offsets =
-                (SENTENCE_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (SENTENCE_OFFSET_TYPE));
-        ASSERT_ALLOC(token_list_container->token_lists [i].sentence_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (SENTENCE_OFFSET_TYPE));
-
-        token_list_container->token_lists [i].word_offsets =
-                        (WORD_OFFSET_TYPE*) MALLOC (TOKENS_ALLOCATION_STEP_SIZE * sizeof (WORD_OFFSET_TYPE));
-        ASSERT_ALLOC(token_list_container->token_lists [i].word_offsets, "Cannot create data for a Token object !",
-                TOKENS_ALLOCATION_STEP_SIZE * sizeof (WORD_OFFSET_TYPE));
-
-        token_list_container->malloc_calloc_calls += 3;
-
-        // Init new values
-        for (size_t i2 = 0; i2 < TOKENS_ALLOCATION_STEP_SIZE; ++ i2)
+        struct Token_List* const token_list = &(container->token_lists [i]);
+        for (uint_fast32_t i2 = 0; i2 < token_list->next_free_element; ++ i2)
         {
-            token_list_container->token_lists [i].char_offsets [i2] = CHAR_OFFSET_TYPE_MAX;
-            token_list_container->token_lists [i].sentence_offsets [i2] = SENTENCE_OFFSET_TYPE_MAX;
-            token_list_container->token_lists [i].word_offsets [i2] = WORD_OFFSET_TYPE_MAX;
+            struct Token_Handle* const token = &(token_list->tokens [i2]);
+            token->offset = (size_t) TokenIntMapping_Intern (container->token_int_mapping,
+                    container->token_memory + token->offset, token->length);
         }
-
-        token_list_container->token_lists [i].max_token_length = MAX_TOKEN_LENGTH;
-        token_list_container->token_lists [i].allocated_tokens = TOKENS_ALLOCATION_STEP_SIZE;
     }
+    container->token_memory_used = token_memory_begin;
 
     return;
 }
@@ -1238,546 +3906,789 @@ Increase_Number_Of_Token_Lists
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Increase the number of tokens in a Token_List object.
- *
- * The default allocation step size (TOKENS_ALLOCATION_STEP_SIZE) will be used.
+ * @brief Create an empty Token_List_Container with the initial memory.
  *
  * Asserts:
- *      token_list != NULL
+ *      N/A
  *
- * @param[in] token_list Token_List object
+ * @return Address to the new dynamic Token_List_Container
  */
-static void
-Increase_Number_Of_Tokens
+static struct Token_List_Container*
+Create_Token_List_Container
 (
-        struct Token_List* const token_list
+        void
 )
 {
-    ASSERT_MSG(token_list != NULL, "Token_List is NULL !");
+    // Create the (outer) container
+    struct Token_List_Container* new_container =
+            (struct Token_List_Container*) CALLOC(1, sizeof (struct Token_List_Container));
+    ASSERT_ALLOC(new_container, "Cannot create new Token_Container !", 1 * sizeof (struct Token_List_Container));
 
-    static size_t tokens_realloc_counter = 0;
-    ++ tokens_realloc_counter;
-    const size_t old_tokens_size    = token_list->allocated_tokens;
-    const size_t token_size         = token_list->max_token_length;
-
-    char* tmp_ptr = (char*) REALLOC(token_list->data,
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * token_size);
-    ASSERT_ALLOC(tmp_ptr, "Cannot reallocate memory for Tokens data !",
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * token_size);
-    memset(tmp_ptr + (old_tokens_size * token_size), '\0',
-            (TOKENS_ALLOCATION_STEP_SIZE) * token_size);
-
-    CHAR_OFFSET_TYPE* tmp_ptr2 = (CHAR_OFFSET_TYPE*) REALLOC (token_list->char_offsets,
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (CHAR_OFFSET_TYPE));
-    ASSERT_ALLOC(tmp_ptr2, "Cannot create data for a Token object !",
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (CHAR_OFFSET_TYPE));
-
-    SENTENCE_OFFSET_TYPE* tmp_ptr3 = (SENTENCE_OFFSET_TYPE*) REALLOC (token_list->sentence_offsets,
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (SENTENCE_OFFSET_TYPE));
-    ASSERT_ALLOC(tmp_ptr2, "Cannot create data for a Token object !",
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (SENTENCE_OFFSET_TYPE));
-
-    WORD_OFFSET_TYPE* tmp_ptr4 = (WORD_OFFSET_TYPE*) REALLOC (token_list->word_offsets,
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (WORD_OFFSET_TYPE));
-    ASSERT_ALLOC(tmp_ptr4, "Cannot create data for a Token object !",
-            (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE) * sizeof (WORD_OFFSET_TYPE))
+    // Create the inner container (The memory of the tokens will be allocated with the first token of a Token_List)
+    new_container->allocated_token_container = TOKEN_CONTAINER_INITIAL_SIZE;
+    new_container->token_lists = (struct Token_List*) CALLOC(new_container->allocated_token_container, sizeof (struct Token_List));
+    ASSERT_ALLOC(new_container->token_lists, "Cannot create new Token objects !", new_container->allocated_token_container *
+            sizeof (struct Token_List));
 
-    // Init new values
-    for (size_t i2 = old_tokens_size; i2 < (old_tokens_size + TOKENS_ALLOCATION_STEP_SIZE); ++ i2)
-    {
-        tmp_ptr2 [i2] = CHAR_OFFSET_TYPE_MAX;
-        tmp_ptr3 [i2] = SENTENCE_OFFSET_TYPE_MAX;
-        tmp_ptr4 [i2] = WORD_OFFSET_TYPE_MAX;
-    }
+    // Memory for the chars of all tokens
+    new_container->token_memory = (char*) MALLOC(TOKEN_MEMORY_INITIAL_SIZE * sizeof (char));
+    ASSERT_ALLOC(new_container->token_memory, "Cannot create the token memory !", TOKEN_MEMORY_INITIAL_SIZE * sizeof (char));
+    new_container->token_memory_allocated = TOKEN_MEMORY_INITIAL_SIZE;
 
-    token_list->data                = tmp_ptr;
-    token_list->char_offsets        = tmp_ptr2;
-    token_list->sentence_offsets    = tmp_ptr3;
-    token_list->word_offsets        = tmp_ptr4;
-    token_list->allocated_tokens    += TOKENS_ALLOCATION_STEP_SIZE;
+    new_container->malloc_calloc_calls += 3;
 
-    return;
+    // Create the container for long tokens
+    new_container->list_of_long_tokens = TwoDimCStrArray_CreateObject (10);
+
+    return new_container;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Read the next line from the file and return the number of char, that were read.
+ * @brief Parse the lines of an opened input file and append the datasets to the container.
  *
  * Asserts:
- *      input_file != NULL
- *      input_file_data != NULL
- *      input_file_data_length > 0
+ *      N/A
  *
- * @param[in] input_file Input file pointer
- * @param[in] input_file_data Buffer for the new input file data
- * @param[in] input_file_data_length Length of the input file buffer
+ * @param[in] input_file The opened input file
+ * @param[in] file_type Type of the input file
+ * @param[in] lines_before Number of lines before the first line (The text lines use the line number as dataset ID)
+ * @param[in] print_progress Print the progress ? (Only for the whole file)
+ * @param[in] new_container The container, that will save the datasets
+ * @param[out] sum_char_read Number of read chars (without the '\n')
  *
- * @return Number of char, that were read
+ * @return Number of tokens, that were found
  */
-static size_t
-Read_Next_Line
+static uint_fast32_t
+Parse_Input_File
 (
-        FILE* restrict input_file,
-        char* const restrict input_file_data,
-        const long int input_file_data_length
+        struct Input_File* const restrict input_file,
+        const enum File_Type file_type,
+        const uint_fast32_t lines_before,
+        const _Bool print_progress,
+        struct Token_List_Container* const restrict new_container,
+        size_t* const restrict sum_char_read
 )
 {
-    ASSERT_MSG(input_file != NULL, "FILE is NULL !");
-    ASSERT_MSG(input_file_data != NULL, "Input file data is NULL !");
-    ASSERT_MSG(input_file_data_length > 0, "Input file data length is zero !");
+    uint_fast32_t line_counter              = lines_before;
+    uint_fast32_t sum_tokens_found          = 0;
+    const uint_fast8_t count_steps          = 100;
+    const size_t unsigned_input_file_length = (print_progress) ? input_file->file_size : 0;
+    const uint_fast32_t print_steps         = (uint_fast32_t) (((unsigned_input_file_length / count_steps) == 0) ?
+            1 : (unsigned_input_file_length / count_steps));
 
-    size_t char_read = 0;
+    // The text tokenization modifies the line; so text lines need a copy. JSON lines will be parsed in place
+    const _Bool copy_lines = (file_type == JSON_FILE_TYPE) ? false : true;
+
+    // Read the first line from the file
+    const char* line                    = NULL;
+    size_t char_read                    = 0;
+    _Bool line_available                = Read_Next_Line (input_file, copy_lines, &line, &char_read);
+    *sum_char_read                      = char_read;
+    size_t char_read_before_last_output = 0;
+
+    // For files with only one line the number of read tokens will be printed while parsing
+    const _Bool one_line_file = (print_progress && char_read == unsigned_input_file_length) ? true : false;
+    struct JSON_Parser json_parser = { .container = new_container, .print_tokens_read = one_line_file };
 
-    for (int c = getc(input_file); c != EOF; c = getc(input_file), ++ char_read)
+    // The memory for the token positions will be reused for all text lines
+    struct Tokenized_String tokenized_string;
+    memset (&tokenized_string, '\0', sizeof (struct Tokenized_String));
+
+    // ===== ===== ===== ===== ===== BEGIN Read file line by line ===== ===== ===== ===== =====
+    while (line_available)
     {
-        if (c == '\n')
+        ++ line_counter;
+        // ===== ===== ===== ===== BEGIN Parse current line ===== ===== ===== =====
+        if (char_read == 0)
         {
-            input_file_data [char_read] = '\0';
-            input_file_data [input_file_data_length] = '\0';
-            break;
+            // Empty line: Nothing to parse
         }
-        input_file_data [char_read] = (char) c;
-    }
+        else if (file_type == JSON_FILE_TYPE)
+        {
+        const char* current_parsing_position = line;
+        const char* const line_end = line + char_read;
+        while (current_parsing_position < line_end)
+        {
+            // Only white spaces after the last JSON fragment ?
+            while (current_parsing_position < line_end && isspace((unsigned char) *current_parsing_position))
+            {
+                ++ current_parsing_position;
+            }
+            if (current_parsing_position >= line_end) { break; }
 
-    return char_read;
-}
+            // Parse the file JSON fragment per JSON fragment (The line is not null terminated in a mapped file)
+            const _Bool fragment_valid = JSON_Parse_Fragment (&json_parser, current_parsing_position, line_end,
+                    JSON_WHOLE_FRAGMENT, &current_parsing_position);
 
-//---------------------------------------------------------------------------------------------------------------------
+            // Print process information
+            if (unsigned_input_file_length > 0)
+            {
+                char_read_before_last_output = Process_Printer(print_steps, char_read_before_last_output,
+                        *sum_char_read, unsigned_input_file_length, true, Read_File_Process_Print_Function,
+                        NULL, NULL);
+            }
 
-/**
- * @brief The process print function for the file processing operation.
- *
- * Asserts:
- *      N/A
- *
- * @param print_step_size Number of inner loop calls, that needs to be done, for a new process print
- * @param actual Counter since last process print
- * @param hundred_percent The number of all inner loop calls (see the intersection code)
- * @param interval_begin clock_t value at the begin of the last process print
- * @param interval_end clock_t value since the last process print
- */
-static void
-Read_File_Process_Print_Function
-(
-        const size_t print_step_size,
-        const size_t actual,
-        const size_t hundred_percent,
-        const clock_t interval_begin,
-        const clock_t interval_end
-)
-{
-    const size_t char_read_interval_begin   = (actual > hundred_percent) ? hundred_percent : actual;
-    const size_t input_file_length          = hundred_percent;
-    const size_t char_read_interval_end     = (char_read_interval_begin + print_step_size > input_file_length) ?
-            input_file_length : (char_read_interval_begin + print_step_size);
+            if (! fragment_valid)
+            {
+                const char* const error_position = json_parser.position;
+                printf("Error before: [%.*s] %" PRIuFAST32 ": %ld\n", (int) (line_end - error_position),
+                        error_position, line_counter, (long int) (error_position - line));
+                break;
+            }
+            sum_tokens_found += json_parser.tokens_found;
+        }
+        }
+        else if (file_type == TXT_FILE_TYPE)
+        {
+            // Add explicit a delimiter at the end of the input data: Use_Current_Text_Fragment() overrides temporary
+            // the char after every token with a '\0' (So the last token needs also a char after it)
+            // The copied line has the space for the extra char (See struct Input_File)
+            char* const text_line = input_file->line_buffer;
+            text_line [char_read] = ' ';
+            text_line [char_read + 1] = '\0';
+            Tokenize_String(text_line, " \t\n\r", &tokenized_string);
 
-    const int digits        = (int) Count_Number_Of_Digits(input_file_length);
-    const float percent     = Determine_Percent(char_read_interval_begin, input_file_length);
-    const float time_left   = Determine_Time_Left(char_read_interval_begin, char_read_interval_end, hundred_percent,
-            interval_end - interval_begin);
+            // Print process information
+            if (unsigned_input_file_length > 0)
+            {
+                char_read_before_last_output = Process_Printer(print_steps, char_read_before_last_output,
+                        *sum_char_read, unsigned_input_file_length, true,
+                        Read_File_Process_Print_Function,
+                        NULL,
+                        NULL);
+            }
 
-    PRINTF_FFLUSH("Read file: %*zu KByte (%3.2f %% | %.2f sec.)   ",
-            (digits > 3) ? digits - 3 : 3, char_read_interval_begin / 1024,
-                    Replace_NaN_And_Inf_With_Zero((percent > 100.0f) ? 100.0f : percent),
-                    Replace_NaN_And_Inf_With_Zero(time_left));
-    return;
+            // A line with only white spaces creates no dataset
+            sum_tokens_found +=
+                    Use_Current_Text_Fragment(text_line, char_read + 1, line_counter, &tokenized_string, new_container);
+        }
+        else
+        {
+            ASSERT_MSG(false,
+                    "Else path in the line parsing executed ! (No code for parsing the current file format available)");
+        }
+        // ===== ===== ===== ===== BEGIN Parse current line ===== ===== ===== =====
+
+        // Read next line
+        line_available                  = Read_Next_Line (input_file, copy_lines, &line, &char_read);
+        *sum_char_read                  += char_read;
+        char_read_before_last_output    += char_read;
+    }
+    // ===== ===== ===== ===== ===== END Read file line by line ===== ===== ===== ===== =====
+
+    if (json_parser.char_offsets != NULL)
+    {
+        FREE_AND_SET_TO_NULL(json_parser.char_offsets);
+    }
+    Delete_Tokenized_String (&tokenized_string);
+
+    return sum_tokens_found;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Use the current cJSON object and identify the tokens and the offsets of them in this object.
+ * @brief Parse a mapped input file in chunks with multiple threads.
  *
- * The function expects, that all given pointer are valid !
+ * The file will be split at the record boundaries: At the begin of a line or - in a single line JSON file - between the
+ * members of the top level object. The split positions in a JSON object are speculative, because a string can contain
+ * the same chars. If one part is not parsable in isolation, the function returns NULL and the caller needs to parse the
+ * file with one thread; this creates the same result and error messages like without the split.
+ *
+ * The Token_List objects of the chunks will be merged in the order of the file. So the order of the datasets and the
+ * line numbers in the dataset IDs are the same like in the serial parsing. With the direct-to-id ingestion every chunk
+ * uses a local mapping; the local mappings will be merged in the order of the chunks, so the mapped integers are also
+ * the same.
  *
  * Asserts:
  *      N/A
  *
- * @param[in] main_json Main cJSON object (It holds the object, that works direct with the source file)
- * @param[in] curr The current cJSON object
- * @param[in] new_container The new container, that will save the new information
+ * @param[in] input_file The opened and mapped input file
+ * @param[in] file_type Type of the input file (JSON_FILE_TYPE or TXT_FILE_TYPE)
+ * @param[in] number_of_threads Max. number of threads
+ * @param[in] token_int_mapping Mapping of the direct-to-id ingestion or NULL
+ * @param[out] sum_tokens_found Number of tokens, that were found
  *
- * @return Number of tokens, that were found (This value can be 0)
+ * @return Address to the new dynamic Token_List_Container or NULL, if the file cannot be parsed in chunks
  */
-static uint_fast32_t
-Use_Current_JSON_Fragment
+static struct Token_List_Container*
+Parse_Input_File_Parallel
 (
-        const cJSON* const main_json,
-        const cJSON* const curr,
-        struct Token_List_Container* const new_container
+        const struct Input_File* const restrict input_file,
+        const enum File_Type file_type,
+        const size_t number_of_threads,
+        struct Token_Int_Mapping* const restrict token_int_mapping,
+        uint_fast32_t* const restrict sum_tokens_found
 )
 {
-    uint_fast32_t tokens_found = 0;
+    const char* const file_begin    = input_file->mapped_data;
+    const char* const file_end      = file_begin + input_file->mapped_size;
+
+    const size_t max_number_of_chunks = MIN(number_of_threads * INPUT_CHUNKS_PER_THREAD,
+            input_file->mapped_size / INPUT_CHUNK_MIN_SIZE);
+    if (max_number_of_chunks < 2) { return NULL; }
+
+    // A JSON file with only one line contains usually one large top level object; it will be split between its
+    // members (Like in the serial parsing the lines after the first line can contain white spaces)
+    const char* const newline = (const char*) memchr (file_begin, '\n', input_file->mapped_size);
+    const char* const first_line_end = (newline != NULL) ? newline : file_end;
+    _Bool split_json_object = (file_type == JSON_FILE_TYPE) ? true : false;
+    for (const char* c = first_line_end; split_json_object && c < file_end; ++ c)
+    {
+        if (! isspace((unsigned char) *c)) { split_json_object = false; }
+    }
+
+    const char* split_begin = file_begin;
+    const char* const split_end = (split_json_object) ? first_line_end : file_end;
+    while (split_json_object && split_begin < split_end && isspace((unsigned char) *split_begin))
+    {
+        ++ split_begin;
+    }
 
-    const cJSON* const name = cJSON_GetObjectItemCaseSensitive(main_json, curr->string);
-    if (! name)                         { return 0; }
-    if (! name->string)                 { return 0; }
+    struct Input_Chunk_Queue queue;
+    memset (&queue, '\0', sizeof (struct Input_Chunk_Queue));
+    queue.file_type = file_type;
+    queue.token_int_mapping = token_int_mapping;
+    queue.chunks = (struct Input_Chunk*) CALLOC(max_number_of_chunks, sizeof (struct Input_Chunk));
+    ASSERT_ALLOC(queue.chunks, "Cannot allocate memory for the input chunks !",
+            max_number_of_chunks * sizeof (struct Input_Chunk));
+
+    // Split the file at the next record boundary after the uniform split positions
+    const char* chunk_begin = split_begin;
+    const char* json_scan_position = split_begin;
+    size_t json_scan_depth = 0;
+    for (size_t c = 1; c <= max_number_of_chunks && chunk_begin < split_end; ++ c)
+    {
+        const char* chunk_end = split_end;
+        if (c < max_number_of_chunks)
+        {
+            const char* const split_position = file_begin + (c * input_file->mapped_size) / max_number_of_chunks;
+            if (split_position <= chunk_begin || split_position >= split_end) { continue; }
 
-    // Exists a tokens array ?
-    const cJSON* const tokens_array = cJSON_GetObjectItemCaseSensitive(name, JSON_TOKENS_ARRAY_NAME);
-    if (! tokens_array)                 { return 0; }
-    if (! cJSON_IsArray(tokens_array))  { return 0; }
+            if (split_json_object)
+            {
+                chunk_end = Find_JSON_Member_Boundary (&json_scan_position, &json_scan_depth, split_position,
+                        split_end);
+            }
+            else
+            {
+                // The chunk ends after the '\n'
+                chunk_end = (const char*) memchr (split_position - 1, '\n', (size_t) (file_end - split_position + 1));
+                chunk_end = (chunk_end != NULL) ? chunk_end + 1 : NULL;
+            }
+            if (chunk_end == NULL) { continue; }
+        }
 
-    // If a array with offsets is available ? Use them
-    const cJSON* char_offsets_array = cJSON_GetObjectItemCaseSensitive(name, JSON_CHAR_OFFSET_ARRAY_NAME);
-    if (! char_offsets_array) { if (! cJSON_IsArray(char_offsets_array)) { char_offsets_array = NULL; } }
+        queue.chunks [queue.number_of_chunks].begin = chunk_begin;
+        queue.chunks [queue.number_of_chunks].end = chunk_end;
+        queue.chunks [queue.number_of_chunks].json_part = (split_json_object) ? JSON_MIDDLE_PART : JSON_WHOLE_FRAGMENT;
+        ++ queue.number_of_chunks;
+        chunk_begin = chunk_end;
+    }
+    if (queue.number_of_chunks < 2)
+    {
+        FREE_AND_SET_TO_NULL(queue.chunks);
+        return NULL;
+    }
+    if (split_json_object)
+    {
+        queue.chunks [0].json_part = JSON_FIRST_PART;
+        queue.chunks [queue.number_of_chunks - 1].json_part = JSON_LAST_PART;
+    }
 
-    // Get all tokens from tokens array
-    //const int tokens_array_size = cJSON_GetArraySize(tokens_array);
-    register const cJSON* curr_token = tokens_array->child;
-    if (! curr_token)                   { return 0; }
-    register const cJSON* curr_char_offset = NULL;
-    if (char_offsets_array != NULL) { curr_char_offset = char_offsets_array->child; }
+    const size_t used_threads = MIN(number_of_threads, queue.number_of_chunks);
+    printf("Parse the file in %zu chunks with %zu threads\n", queue.number_of_chunks, used_threads);
 
+    // The line numbers are necessary for the dataset IDs of the text lines and for the error messages
+    if (! split_json_object)
+    {
+        Run_Input_Chunk_Workers (&queue, COUNT_LINES_TASK, used_threads);
 
-    // Realloc necessary ?
-    // Is it necessary to realloc/increase the number of Token_List objects in the container ?
-    if (new_container->next_free_element >= new_container->allocated_token_container)
+        uint_fast32_t lines_before = 0;
+        for (size_t c = 0; c < queue.number_of_chunks; ++ c)
+        {
+            queue.chunks [c].lines_before = lines_before;
+            lines_before += queue.chunks [c].number_of_lines;
+        }
+    }
+    if (token_int_mapping != NULL)
     {
-        Increase_Number_Of_Token_Lists (new_container);
+        // The stop word list will be initialized with the first call. This initialization is not thread safe; so it
+        // needs to be done before the threads intern the tokens in their local mappings
+        (void) Is_Word_In_Stop_Word_List("the", strlen ("the"), ENG);
     }
-    const size_t dataset_id_length =
-            COUNT_ARRAY_ELEMENTS(new_container->token_lists [new_container->next_free_element].dataset_id);
-    strncpy (new_container->token_lists [new_container->next_free_element].dataset_id, name->string,
-            dataset_id_length - 1);
-    new_container->token_lists [new_container->next_free_element].dataset_id [dataset_id_length - 1] = '\0';
+    Run_Input_Chunk_Workers (&queue, PARSE_CHUNKS_TASK, used_threads);
 
+    // Positions of the chunks in the merged container
+    _Bool all_chunks_valid                  = true;
+    uint_fast32_t number_of_token_lists     = 0;
+    size_t token_memory_used                = 0;
+    for (size_t c = 0; c < queue.number_of_chunks; ++ c)
+    {
+        const struct Token_List_Container* const chunk_container = queue.chunks [c].token_container;
 
-    struct Token_List* const current_token_list_obj = &(new_container->token_lists [new_container->next_free_element]);
+        all_chunks_valid = all_chunks_valid && queue.chunks [c].valid;
+        queue.chunks [c].first_token_list = number_of_token_lists;
+        queue.chunks [c].token_memory_offset = token_memory_used;
+        number_of_token_lists += chunk_container->next_free_element;
+        token_memory_used += chunk_container->token_memory_used;
+    }
 
-    // ===== ===== ===== BEGIN Go though the full chained list (the tokens array in the JSON file) ===== ===== =====
-    while (curr_token != NULL)
+    if (! all_chunks_valid)
     {
-        if (! curr_token->valuestring) { curr_token = curr_token->next; continue; }
+        puts("The split JSON object is not parsable in chunks: Parse the file with one thread");
+        for (size_t c = 0; c < queue.number_of_chunks; ++ c)
+        {
+            TokenListContainer_DeleteObject (queue.chunks [c].token_container);
+            queue.chunks [c].token_container = NULL;
+            if (queue.chunks [c].local_mapping != NULL)
+            {
+                TokenIntMapping_DeleteObject (queue.chunks [c].local_mapping);
+                queue.chunks [c].local_mapping = NULL;
+            }
+        }
+        FREE_AND_SET_TO_NULL(queue.chunks);
+        return NULL;
+    }
 
-        // Is more memory for the new token in the Token_List necessary ?
-        if (current_token_list_obj->next_free_element >= current_token_list_obj->allocated_tokens)
+    // The merged container gets exact the memory, that the chunks need
+    struct Token_List_Container* merged_container =
+            (struct Token_List_Container*) CALLOC(1, sizeof (struct Token_List_Container));
+    ASSERT_ALLOC(merged_container, "Cannot create new Token_Container !", 1 * sizeof (struct Token_List_Container));
+
+    merged_container->token_lists =
+            (struct Token_List*) CALLOC(MAX(number_of_token_lists, 1), sizeof (struct Token_List));
+    ASSERT_ALLOC(merged_container->token_lists, "Cannot create new Token objects !",
+            MAX(number_of_token_lists, 1) * sizeof (struct Token_List));
+    merged_container->allocated_token_container = number_of_token_lists;
+    merged_container->next_free_element = number_of_token_lists;
+
+    merged_container->token_memory = (char*) MALLOC(MAX(token_memory_used, 1) * sizeof (char));
+    ASSERT_ALLOC(merged_container->token_memory, "Cannot create the token memory !",
+            MAX(token_memory_used, 1) * sizeof (char));
+    merged_container->token_memory_allocated = MAX(token_memory_used, 1);
+    merged_container->token_memory_used = token_memory_used;
+
+    merged_container->list_of_long_tokens = TwoDimCStrArray_CreateObject (10);
+    merged_container->malloc_calloc_calls += 3;
+    merged_container->parsed_chunks = queue.number_of_chunks;
+
+    *sum_tokens_found = 0;
+    for (size_t c = 0; c < queue.number_of_chunks; ++ c)
+    {
+        const struct Token_List_Container* const chunk_container = queue.chunks [c].token_container;
+
+        merged_container->longest_token_length = MAX(merged_container->longest_token_length,
+                chunk_container->longest_token_length);
+        merged_container->malloc_calloc_calls += chunk_container->malloc_calloc_calls;
+        merged_container->realloc_calls += chunk_container->realloc_calls;
+        *sum_tokens_found += queue.chunks [c].tokens_found;
+
+        for (uint_fast32_t i = 0; i < chunk_container->list_of_long_tokens->next_free_c_str; ++ i)
+        {
+            TwoDimCStrArray_AppendNewString (merged_container->list_of_long_tokens,
+                    chunk_container->list_of_long_tokens->data [i],
+                    strlen (chunk_container->list_of_long_tokens->data [i]));
+        }
+    }
+
+    // The local mappings will be merged in the order of the chunks; so the global mapped integers are the same as in
+    // the serial parsing
+    if (token_int_mapping != NULL)
+    {
+        for (size_t c = 0; c < queue.number_of_chunks; ++ c)
         {
-            Increase_Number_Of_Tokens (current_token_list_obj);
+            struct Input_Chunk* const chunk = &(queue.chunks [c]);
+
+            chunk->remap_table = (DATA_TYPE*) MALLOC(MAX(chunk->local_mapping->number_of_tokens, 1) *
+                    sizeof (DATA_TYPE));
+            ASSERT_ALLOC(chunk->remap_table, "Cannot allocate memory for a remap table !",
+                    MAX(chunk->local_mapping->number_of_tokens, 1) * sizeof (DATA_TYPE));
+            (void) TokenIntMapping_Merge (token_int_mapping, chunk->local_mapping, chunk->remap_table);
 
-            // Adjust the number of reallocs in the upper container
-            new_container->realloc_calls += 3;
+            TokenIntMapping_DeleteObject (chunk->local_mapping);
+            chunk->local_mapping = NULL;
         }
+        merged_container->token_int_mapping = token_int_mapping;
+    }
 
-        char* res_mem_for_curr_token = Get_Address_Of_Next_Free_Token (current_token_list_obj);
+    queue.merged_container = merged_container;
+    Run_Input_Chunk_Workers (&queue, MERGE_CHUNKS_TASK, used_threads);
+    FREE_AND_SET_TO_NULL(queue.chunks);
 
-        const size_t current_token_len = strlen (curr_token->valuestring);
+    return merged_container;
+}
 
-        // Copy token to the current Token_List
-        strncpy(res_mem_for_curr_token, curr_token->valuestring, current_token_list_obj->max_token_length - 1);
+//---------------------------------------------------------------------------------------------------------------------
 
-        // Save the full token, if it is too long
-        if (current_token_len > (current_token_list_obj->max_token_length - 1))
-        {
-            TwoDimCStrArray_AppendNewString
-            (
-                    new_container->list_of_too_long_token,
-                    curr_token->valuestring,
-                    current_token_len
-            );
-        }
+/**
+ * @brief Search the next possible split position between two members of a top level JSON object.
+ *
+ * The pattern is: '}' ',' '"<name>"' ':' '{' (with optional white spaces) on the nesting depth of the top level object
+ * members and outside of a string. The position of the ',' will be returned.
+ *
+ * The nesting depth and the string state are only known from the begin of the top level object. So the scan continues
+ * at the position of the last call; every char of the object will be read only once, even with many split positions.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in, out] scan_position Position, where the scan continues (Not in a string; the begin of the top level object
+ *      before the first call). After the call: The returned position or end
+ * @param[in, out] depth Nesting depth at scan_position (0 before the first call)
+ * @param[in] split_position The returned ',' is not before this position
+ * @param[in] end End of the search (exclusive)
+ *
+ * @return Position of the ',' or NULL, if no split position was found
+ */
+static const char*
+Find_JSON_Member_Boundary
+(
+        const char** const restrict scan_position,
+        size_t* const restrict depth,
+        const char* const restrict split_position,
+        const char* const restrict end
+)
+{
+    _Bool in_string = false;
+    // Last char outside of a string, that is no white space
+    char last_char = '\0';
 
-        // Adjust the next offset value
-        // Zero for the fist element
-        if (current_token_list_obj->next_free_element == 0)
-        {
-            TokenList_SetOffsets(current_token_list_obj, 0, 0, 0, 0);
-        }
-        else
-        {
-            const char* last_token =
-                    Get_Address_Of_Token (current_token_list_obj, current_token_list_obj->next_free_element - 1);
-            // VVV This is the old way without notifying UTF8 char VVV
-            // const size_t last_token_length = strlen(last_token);
-            const size_t last_token_length = (size_t) u8_strlen((char*) last_token);
+    for (const char* position = *scan_position; position < end; ++ position)
+    {
+        const char c = *position;
 
-            size_t new_char_offset = 0;
-            // Using the char offset from the data, if available
-            // If not: calculate them
-            if (curr_char_offset != NULL)
+        if (in_string)
+        {
+            if (c == '\\' && (position + 1) < end)
             {
-                new_char_offset = (size_t) curr_char_offset->valueint;
+                ++ position;
             }
-            else
+            else if (c == '"')
             {
-                new_char_offset = current_token_list_obj->char_offsets [current_token_list_obj->next_free_element - 1] +
-                        last_token_length;
-
-                // Don't forget, that the char offsets in original data includes the blanks between the tokens !
-                // Example from test_ebm_formatted.json:
-                /* "tokens":            [ "[", "The", "chemotherapy", "of", ... ] */
-                /* abs_char_offsets":   [ 0, 2, 6, 19, ... ] */
-                /* => */ new_char_offset ++;
+                in_string = false;
+                last_char = c;
             }
+            continue;
+        }
 
-            const size_t new_sentence_offset =
-                    current_token_list_obj->sentence_offsets [current_token_list_obj->next_free_element - 1] +
-                    ((last_token [0] == '.' && last_token_length == 1) ? (size_t) 1 : (size_t) 0);
-            const size_t new_word_offset = (size_t)
-                    current_token_list_obj->word_offsets [current_token_list_obj->next_free_element - 1] + 1;
-
-            CAST_CHECK(new_char_offset, size_t, CHAR_OFFSET_TYPE);
+        // White spaces like in the JSON parser
+        if ((unsigned char) c <= 32) { continue; }
 
-            TokenList_SetOffsets(current_token_list_obj, current_token_list_obj->next_free_element,
-                    (CHAR_OFFSET_TYPE) new_char_offset, (SENTENCE_OFFSET_TYPE) new_sentence_offset, (WORD_OFFSET_TYPE) new_word_offset);
+        switch (c)
+        {
+        case '"':
+            in_string = true;
+            break;
+        case '{':
+        case '[':
+            ++ (*depth);
+            break;
+        case '}':
+        case ']':
+            if (*depth > 0) { -- (*depth); }
+            break;
+        default:
+            break;
         }
 
-        current_token_list_obj->next_free_element ++;
-        tokens_found ++;
+        // Only a member separator of the top level object after a data set object is a split position
+        const _Bool top_level_separator = c == ',' && *depth == 1 && last_char == '}' && position >= split_position;
+        last_char = c;
+        if (! top_level_separator) { continue; }
 
-        // Is the current token longer than the previous tokens ?
-        new_container->longest_token_length = MAX(new_container->longest_token_length, current_token_len);
+        const char* const member_separator = position;
+        const char* next = position;
 
-        curr_token = curr_token->next;
-        if (curr_char_offset != NULL)
+        for (++ next; next < end && (unsigned char) *next <= 32; ++ next) {}
+        if (next >= end || *next != '"') { continue; }
+
+        // Skip the member name
+        for (++ next; next < end && *next != '"'; ++ next)
         {
-            curr_char_offset = curr_char_offset->next;
+            if (*next == '\\' && (next + 1) < end) { ++ next; }
         }
-    }
-    // ===== ===== ===== END Go though the full chained list (the tokens array in the JSON file) ===== ===== =====
+        if (next >= end) { continue; }
 
-    // Use next element in the container
-    new_container->next_free_element ++;
+        for (++ next; next < end && (unsigned char) *next <= 32; ++ next) {}
+        if (next >= end || *next != ':') { continue; }
 
-    return tokens_found;
+        for (++ next; next < end && (unsigned char) *next <= 32; ++ next) {}
+        if (next >= end || *next != '{') { continue; }
+
+        *scan_position = member_separator;
+        return member_separator;
+    }
+
+    *scan_position = end;
+    return NULL;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Use the current text line and determine the tokens, char, sentence and the word offset.
- *
- * The idea of the curr_line_num is, that the data sets get an created ID, because the data fragments from text files
- * have - unlike the JSON fragments - no ID. Technically an ID is not necessary for the calculations, but it is a good
- * information to get the position of the data in the source file.
+ * @brief Process all chunks of the queue with the given task. The current thread is also a worker.
  *
  * Asserts:
  *      N/A
  *
- * @param[in] curr_text Content of the current text line
- * @param[in] curr_text_len Length of the current text line
- * @param[in] curr_line_num Current line number or UINT_FAST32_MAX, if this variable is unused
- * @param[in] tokenize_data Already calculated tokenize data
- * @param[in] new_container The new container, that will save the new information
- *
- * @return Number of tokens, that were found (This value can be 0 !)
+ * @param[in] queue Input_Chunk_Queue object
+ * @param[in] task Task for all chunks
+ * @param[in] number_of_threads Number of threads
  */
-static uint_fast32_t
-Use_Current_Text_Fragment
+static void
+Run_Input_Chunk_Workers
 (
-        char* const curr_text,
-        const size_t curr_text_len,
-        const uint_fast32_t curr_line_num,
-        const struct Tokenized_String* const tokenize_data,
-        struct Token_List_Container* const new_container
+        struct Input_Chunk_Queue* const queue,
+        const enum Input_Chunk_Task task,
+        const size_t number_of_threads
 )
 {
-    uint_fast32_t tokens_found = 0;
+    queue->task = task;
+    atomic_store(&queue->next_chunk, 0);
 
-    // Realloc necessary ?
-    // Is it necessary to realloc/increase the number of Token_List objects in the container ?
-    if (new_container->next_free_element >= new_container->allocated_token_container)
+    pthread_t* threads = (pthread_t*) CALLOC(number_of_threads, sizeof (pthread_t));
+    ASSERT_ALLOC(threads, "Cannot allocate memory for the parsing threads !", number_of_threads * sizeof (pthread_t));
+    for (size_t i = 1; i < number_of_threads; ++ i)
     {
-        Increase_Number_Of_Token_Lists (new_container);
+        const int pthread_ret_value = pthread_create(&threads [i], NULL, Input_Chunk_Worker_Thread, queue);
+        ASSERT_FMSG(pthread_ret_value == 0, "Cannot create a thread for the file parsing: %s !",
+                strerror(pthread_ret_value));
     }
-
-    if (curr_line_num != UINT_FAST32_MAX)
+    Input_Chunk_Worker_Thread(queue);
+    for (size_t i = 1; i < number_of_threads; ++ i)
     {
-        char int_to_str_mem [10] = { '\0', '\0', '\0', '\0', '\0',  '\0', '\0', '\0', '\0', '\0' };
+        const int pthread_ret_value = pthread_join(threads [i], NULL);
+        ASSERT_FMSG(pthread_ret_value == 0, "Cannot join a thread of the file parsing: %s !",
+                strerror(pthread_ret_value));
+    }
+    FREE_AND_SET_TO_NULL(threads);
 
-        const enum int2str_errno convert_status = int2str(int_to_str_mem,
-                COUNT_ARRAY_ELEMENTS(int_to_str_mem), (long int) curr_line_num);
-        ASSERT_FMSG(convert_status == INT2STR_SUCCESS, "Cannot convert the int value %" PRIuFAST32 " to a c string ! "
-                "Error code: %d !", curr_line_num, (int) convert_status);
+    return;
+}
 
-        Multi_strncat(new_container->token_lists [new_container->next_free_element].dataset_id,
-                DATASET_ID_LENGTH - 1, 3, "Line ", int_to_str_mem, "\0");
-    }
+//---------------------------------------------------------------------------------------------------------------------
 
-    struct Token_List* const current_token_list_obj = &(new_container->token_lists [new_container->next_free_element]);
+/**
+ * @brief Thread function: Process the next unprocessed chunks of the queue, until all chunks are processed.
+ *
+ * Asserts:
+ *      queue != NULL
+ *
+ * @param[in] queue Input_Chunk_Queue object
+ *
+ * @return Always NULL
+ */
+static void*
+Input_Chunk_Worker_Thread
+(
+        void* queue
+)
+{
+    ASSERT_MSG(queue != NULL, "Input chunk queue is NULL !");
+    struct Input_Chunk_Queue* const chunk_queue = (struct Input_Chunk_Queue*) queue;
 
-    // ===== ===== ===== BEGIN Use all tokens in the current text line ===== ===== =====
-    for (uint_fast32_t i = 0; i < tokenize_data->next_free_pos_len; ++ i)
+    while (true)
     {
-        // Skip empty tokens
-        if (tokenize_data->token_data [i].len == 0) { continue; }
+        const size_t selected_chunk = atomic_fetch_add(&chunk_queue->next_chunk, 1);
+        if (selected_chunk >= chunk_queue->number_of_chunks) { break; }
 
-        ASSERT_FMSG((size_t) (tokenize_data->token_data[i].pos + tokenize_data->token_data[i].len) <= curr_text_len,
-                "Invalid tokenize data found ! Length needs to be at least %zu; but a text with %zu is given !",
-                (size_t) (tokenize_data->token_data[i].pos + tokenize_data->token_data[i].len), curr_text_len);
+        struct Input_Chunk* const chunk = &(chunk_queue->chunks [selected_chunk]);
 
-        // Is more memory for the new token in the Token_List necessary ?
-        if (current_token_list_obj->next_free_element >= current_token_list_obj->allocated_tokens)
+        switch (chunk_queue->task)
         {
-            Increase_Number_Of_Tokens (current_token_list_obj);
-
-            // Adjust the number of reallocs in the upper container
-            new_container->realloc_calls += 3;
-        }
-
-        char* const res_mem_for_curr_token = Get_Address_Of_Next_Free_Token (current_token_list_obj);
-
-        const size_t curr_token_len = (size_t) tokenize_data->token_data [i].len;
-        char* const token_begin = &(curr_text [tokenize_data->token_data [i].pos]);
-
-        // Temporary override end char of the current token to make the char range null terminated
-        const char saved_char = *(token_begin + curr_token_len);
-        *(token_begin + curr_token_len) = '\0';
-
-        // Copy token to the current Token_List
-        strncpy(res_mem_for_curr_token, token_begin, current_token_list_obj->max_token_length - 1);
-
-        // Save the full token, if it is too long
-        if (curr_token_len > (current_token_list_obj->max_token_length - 1))
+        case COUNT_LINES_TASK:
         {
-            TwoDimCStrArray_AppendNewString
-            (
-                    new_container->list_of_too_long_token,
-                    token_begin,
-                    curr_token_len
-            );
+            // The last line of the file needs no '\n'
+            uint_fast32_t number_of_lines = (chunk->end [-1] != '\n') ? 1 : 0;
+            for (const char* c = chunk->begin;
+                    (c = (const char*) memchr (c, '\n', (size_t) (chunk->end - c))) != NULL; ++ c)
+            {
+                ++ number_of_lines;
+            }
+            chunk->number_of_lines = number_of_lines;
+            break;
         }
-
-        if (current_token_list_obj->next_free_element == 0)
-        {
-            TokenList_SetOffsets(current_token_list_obj, 0, 0, 0, 0);
+        case PARSE_CHUNKS_TASK:
+            Parse_Input_Chunk (chunk, chunk_queue->file_type, chunk_queue->token_int_mapping);
+            break;
+        case MERGE_CHUNKS_TASK:
+            Move_Input_Chunk_To_Container (chunk, chunk_queue->merged_container);
+            break;
+        default:
+            ASSERT_MSG(false, "Switch case default path executed !");
         }
-        else
-        {
-            const char* last_token =
-                    Get_Address_Of_Token (current_token_list_obj, current_token_list_obj->next_free_element - 1);
-            // VVV This is the old way without notifying UTF8 char VVV
-            // const size_t last_token_length = strlen(last_token);
-            const size_t last_token_length = (size_t) u8_strlen((char*) last_token);
-
-            size_t new_char_offset = current_token_list_obj->char_offsets [current_token_list_obj->next_free_element - 1] +
-                    last_token_length;
+    }
 
-            // Don't forget, that the char offsets in original data includes the blanks between the tokens !
-            // Example from test_ebm_formatted.json:
-            /* "tokens":            [ "[", "The", "chemotherapy", "of", ... ] */
-            /* abs_char_offsets":   [ 0, 2, 6, 19, ... ] */
-            /* => */ new_char_offset ++;
+    return NULL;
+}
 
-            const size_t new_sentence_offset =
-                    current_token_list_obj->sentence_offsets [current_token_list_obj->next_free_element - 1] +
-                    (last_token [0] == '.' && (IS_STRING_LENGTH_ONE(last_token))) ? 1 : 0;
-            const size_t new_word_offset = (size_t)
-                    current_token_list_obj->word_offsets [current_token_list_obj->next_free_element - 1] + 1;
+//---------------------------------------------------------------------------------------------------------------------
 
-            CAST_CHECK(new_char_offset, size_t, CHAR_OFFSET_TYPE);
+/**
+ * @brief Parse one chunk in a new Token_List_Container.
+ *
+ * With the direct-to-id ingestion the chunk gets a local mapping with the case sensitivity of the given mapping.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] chunk Input_Chunk object
+ * @param[in] file_type Type of the input file
+ * @param[in] token_int_mapping Mapping of the direct-to-id ingestion or NULL
+ */
+static void
+Parse_Input_Chunk
+(
+        struct Input_Chunk* const restrict chunk,
+        const enum File_Type file_type,
+        const struct Token_Int_Mapping* const restrict token_int_mapping
+)
+{
+    chunk->token_container = Create_Token_List_Container ();
+    if (token_int_mapping != NULL)
+    {
+        chunk->local_mapping = TokenIntMapping_CreateObjectWithCaseSensitivity (token_int_mapping->case_sensitive);
+        chunk->token_container->token_int_mapping = chunk->local_mapping;
+    }
 
-            TokenList_SetOffsets(current_token_list_obj, current_token_list_obj->next_free_element,
-                    (CHAR_OFFSET_TYPE) new_char_offset, (SENTENCE_OFFSET_TYPE) new_sentence_offset, (WORD_OFFSET_TYPE) new_word_offset);
-        }
+    if (chunk->json_part == JSON_WHOLE_FRAGMENT)
+    {
+        // A view on the lines of the chunk (The mapping belongs to the input file)
+        struct Input_File chunk_file;
+        memset (&chunk_file, '\0', sizeof (struct Input_File));
+        chunk_file.mapped_data = chunk->begin;
+        chunk_file.mapped_size = (size_t) (chunk->end - chunk->begin);
+
+        chunk_file.line_buffer = (char*) MALLOC(LINE_BUFFER_INITIAL_SIZE * sizeof (char));
+        ASSERT_ALLOC(chunk_file.line_buffer, "Cannot allocate memory for the line buffer !",
+                LINE_BUFFER_INITIAL_SIZE * sizeof (char));
+        chunk_file.line_buffer_size = LINE_BUFFER_INITIAL_SIZE;
+
+        size_t char_read = 0;
+        chunk->tokens_found = Parse_Input_File (&chunk_file, file_type, chunk->lines_before, false,
+                chunk->token_container, &char_read);
+        chunk->valid = true;
+
+        FREE_AND_SET_TO_NULL(chunk_file.line_buffer);
+        return;
+    }
 
-        current_token_list_obj->next_free_element ++;
-        tokens_found ++;
+    struct JSON_Parser json_parser = { .container = chunk->token_container, .print_tokens_read = false };
+    const char* parse_end = NULL;
+    chunk->valid = JSON_Parse_Fragment (&json_parser, chunk->begin, chunk->end, chunk->json_part, &parse_end);
 
-        // Is the current token longer than the previous tokens ?
-        new_container->longest_token_length = MAX(new_container->longest_token_length, curr_token_len);
+    // After the top level object: The other JSON fragments in the line
+    while (chunk->valid && chunk->json_part == JSON_LAST_PART)
+    {
+        while (parse_end < chunk->end && isspace((unsigned char) *parse_end)) { ++ parse_end; }
+        if (parse_end >= chunk->end) { break; }
 
-        // Recover the origin text content
-        *(token_begin + tokenize_data->token_data [i].len) = saved_char;
+        chunk->valid = JSON_Parse_Fragment (&json_parser, parse_end, chunk->end, JSON_WHOLE_FRAGMENT, &parse_end);
     }
-    // ===== ===== ===== END Use all tokens in the current text line ===== ===== =====
+    chunk->tokens_found = json_parser.sum_tokens_found;
 
-    // Use next element in the container
-    new_container->next_free_element ++;
+    if (json_parser.char_offsets != NULL)
+    {
+        FREE_AND_SET_TO_NULL(json_parser.char_offsets);
+    }
 
-    return tokens_found;
+    return;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Try to determine the file type.
+ * @brief Move the Token_List objects and the tokens of a chunk to the merged container and delete the container of the
+ * chunk.
  *
- * The function will check for a JSON or a text file.
+ * The memory of the merged container was already allocated. Every chunk uses its own range of the memory; so the chunks
+ * can be moved in parallel. With the direct-to-id ingestion the local mapped integers will be replaced with the global
+ * ones.
  *
  * Asserts:
- *      input_file != NULL
- *
- * @param input_file FILE pointer to the already opened file.
+ *      N/A
  *
- * @return Type of the file; if a determination was not possible UNKNOWN_FILE_TYPE will be returned
+ * @param[in] chunk Input_Chunk object
+ * @param[in] merged_container The merged container
  */
-static enum File_Type
-Determine_File_Type
+static void
+Move_Input_Chunk_To_Container
 (
-        FILE* input_file
+        struct Input_Chunk* const restrict chunk,
+        struct Token_List_Container* const restrict merged_container
 )
 {
-    ASSERT_MSG(input_file != NULL, "FILE is NULL !");
-
-    _Bool JSON_start_char_found = false;
-    _Bool JSON_end_char_found   = false;
-
-    // For a simple check mechanism we expect, that an JSON file starts with a '{' and end with a '}'
-    // There will be no check, if the input file is a full valid JSON file. This will done in the reading process, when
-    // this function determines a JSON file
+    struct Token_List_Container* const chunk_container = chunk->token_container;
+    const uint_fast32_t number_of_token_lists = chunk_container->next_free_element;
 
-    // Set the cursor to the start of the file and save the current cursor position
-    const long int curr_cursor_pos = ftell (input_file);
-    ASSERT_FMSG(curr_cursor_pos != -1L, "ftell() returned -1: %s", strerror(errno));
-    int fseek_return = fseek (input_file, 0, SEEK_SET);
-    ASSERT_FMSG(fseek_return == 0, "fseek() returned a nonzero value: %s", strerror(errno));
+    memcpy (merged_container->token_memory + chunk->token_memory_offset, chunk_container->token_memory,
+            chunk_container->token_memory_used);
 
-    // Reading until an '{' or a not space char was found
-    int curr_c = 0;
-    while ((curr_c = fgetc(input_file)) != EOF)
+    for (uint_fast32_t i = 0; i < number_of_token_lists; ++ i)
     {
-        if (curr_c == '{')
+        struct Token_List* const token_list = &(merged_container->token_lists [chunk->first_token_list + i]);
+
+        *token_list = chunk_container->token_lists [i];
+        if (chunk->remap_table != NULL)
         {
-            JSON_start_char_found = true;
-            break;
+            for (uint_fast32_t i2 = 0; i2 < token_list->next_free_element; ++ i2)
+            {
+                token_list->tokens [i2].offset = (size_t) chunk->remap_table [token_list->tokens [i2].offset];
+            }
         }
-        else if (! isspace(curr_c))
+        else
         {
-            JSON_start_char_found = false;
-            break;
+            for (uint_fast32_t i2 = 0; i2 < token_list->next_free_element; ++ i2)
+            {
+                token_list->tokens [i2].offset += chunk->token_memory_offset;
+            }
         }
     }
 
-    // Reading until an '}' or a not space char was found
-    curr_c = 0;
-    for (long int i = 0; curr_c != EOF; i ++)
-    {
-        fseek_return = fseek (input_file, -(i + 1), SEEK_END);
-        ASSERT_FMSG(fseek_return == 0, "fseek() returned a nonzero value: %s", strerror(errno));
+    // The moved Token_List objects belong now to the merged container; the unused ones will be deleted with the chunk
+    memmove (chunk_container->token_lists, chunk_container->token_lists + number_of_token_lists,
+            (chunk_container->allocated_token_container - number_of_token_lists) * sizeof (struct Token_List));
+    chunk_container->allocated_token_container -= number_of_token_lists;
+    chunk_container->next_free_element = 0;
 
-        curr_c = fgetc (input_file);
-        if (curr_c == '}')
-        {
-            JSON_end_char_found = true;
-            break;
-        }
-        else if (! isspace(curr_c))
-        {
-            JSON_end_char_found = true;
-            break;
-        }
+    TokenListContainer_DeleteObject (chunk_container);
+    chunk->token_container = NULL;
+    if (chunk->remap_table != NULL)
+    {
+        FREE_AND_SET_TO_NULL(chunk->remap_table);
     }
 
-    // Set the file cursor the origin position
-    fseek_return = fseek (input_file, curr_cursor_pos, SEEK_SET);
-    ASSERT_FMSG(fseek_return == 0, "fseek() returned a nonzero value: %s", strerror(errno));
-
-    return (JSON_start_char_found && JSON_end_char_found) ? JSON_FILE_TYPE : TXT_FILE_TYPE;
+    return;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
+#ifdef TOKENS_INITIAL_SIZE
+#undef TOKENS_INITIAL_SIZE
+#endif /* TOKENS_INITIAL_SIZE */
+
+#ifdef TOKEN_LIST_BYTES_PER_TOKEN
+#undef TOKEN_LIST_BYTES_PER_TOKEN
+#endif /* TOKEN_LIST_BYTES_PER_TOKEN */
+
+#ifdef TOKEN_MEMORY_INITIAL_SIZE
+#undef TOKEN_MEMORY_INITIAL_SIZE
+#endif /* TOKEN_MEMORY_INITIAL_SIZE */
 
+#ifdef TOKEN_CONTAINER_INITIAL_SIZE
+#undef TOKEN_CONTAINER_INITIAL_SIZE
+#endif /* TOKEN_CONTAINER_INITIAL_SIZE */
 
-#ifdef TOKENS_ALLOCATION_STEP_SIZE
-#undef TOKENS_ALLOCATION_STEP_SIZE
-#endif /* TOKENS_ALLOCATION_STEP_SIZE */
+#ifdef LINE_BUFFER_INITIAL_SIZE
+#undef LINE_BUFFER_INITIAL_SIZE
+#endif /* LINE_BUFFER_INITIAL_SIZE */
 
-#ifdef TOKEN_CONTAINER_ALLOCATION_STEP_SIZE
-#undef TOKEN_CONTAINER_ALLOCATION_STEP_SIZE
-#endif /* TOKEN_CONTAINER_ALLOCATION_STEP_SIZE */
+#ifdef INPUT_FILE_STDIO_BUFFER_SIZE
+#undef INPUT_FILE_STDIO_BUFFER_SIZE
+#endif /* INPUT_FILE_STDIO_BUFFER_SIZE */
 
 #ifdef JSON_TOKENS_ARRAY_NAME
 #undef JSON_TOKENS_ARRAY_NAME
@@ -1786,3 +4697,19 @@ Determine_File_Type
 #ifdef JSON_CHAR_OFFSET_ARRAY_NAME
 #undef JSON_CHAR_OFFSET_ARRAY_NAME
 #endif /* JSON_CHAR_OFFSET_ARRAY_NAME */
+
+#ifdef JSON_NESTING_LIMIT
+#undef JSON_NESTING_LIMIT
+#endif /* JSON_NESTING_LIMIT */
+
+#ifdef JSON_CHAR_OFFSETS_INITIAL_SIZE
+#undef JSON_CHAR_OFFSETS_INITIAL_SIZE
+#endif /* JSON_CHAR_OFFSETS_INITIAL_SIZE */
+
+#ifdef INPUT_CHUNKS_PER_THREAD
+#undef INPUT_CHUNKS_PER_THREAD
+#endif /* INPUT_CHUNKS_PER_THREAD */
+
+#ifdef INPUT_CHUNK_MIN_SIZE
+#undef INPUT_CHUNK_MIN_SIZE
+#endif /* INPUT_CHUNK_MIN_SIZE */
@@ -6,6 +6,9 @@
  *
  * It holds the original tokens from the dataset and make them usable for the mapping process. (See: "Token_Int_Mapping")
  *
+ * With the direct-to-id ingestion the tokens will be interned in a Token_Int_Mapping while parsing. Then the container
+ * holds only the mapped integers, the offsets and the dataset IDs.
+ *
  * @date 21.06.2022
  * @author Gyps
  */
@@ -23,10 +26,28 @@ extern "C"
 #include <inttypes.h>               // uint_fast32_t
 #include <stddef.h>                 // size_t
 #include "Defines.h"                // CHAR_OFFSET_TYPE
+#include "Token_Int_Mapping.h"      // struct Token_Int_Mapping
 #include "Two_Dim_C_String_Array.h" // struct Two_Dim_C_String_Array
 
 
 
+//=====================================================================================================================
+
+/**
+ * @brief Position of a token in the token memory of a Token_List_Container.
+ */
+struct Token_Handle
+{
+    /**
+     * @brief Offset of the first char in the token memory.
+     *
+     * With the direct-to-id ingestion the chars will not be kept: Then it is the mapped integer of the token. (See:
+     * Token_List_Container.token_int_mapping)
+     */
+    size_t offset;
+    size_t length;                  ///< Length of the token (without the terminator symbol)
+};
+
 //=====================================================================================================================
 
 struct Token_List_Container
@@ -38,15 +59,17 @@ struct Token_List_Container
     struct Token_List
     {
         /**
-         * @brief C-Strings containing the tokens.
+         * @brief Handles of the tokens.
          *
-         * It is a flat memory model. This means, that one C-String contains multiple tokens. Every token is saved as an
-         * interval in the C-String.
+         * The chars of the tokens are in the token memory of the container. (See: Token_List_Container.token_memory)
+         *
+         * This pointer is also the begin of the one memory block, that holds all columns of the list: handles, char
+         * offsets, word offsets and sentence offsets (structure of arrays). NULL, if no token was added so far.
          */
-        char* data;
+        struct Token_Handle* tokens;
 
         /**
-         * @brief Char offsets of each token.
+         * @brief Char offsets of each token. (Points into the memory block of Token_List.tokens)
          */
         CHAR_OFFSET_TYPE* char_offsets;
 
@@ -58,15 +81,10 @@ struct Token_List_Container
         SENTENCE_OFFSET_TYPE* sentence_offsets;
 
         /**
-         * @brief Word offsets of each token.
+         * @brief Word offsets of each token. (Points into the memory block of Token_List.tokens)
          */
         WORD_OFFSET_TYPE* word_offsets;
 
-        /**
-         * @brief Max. possible length for one token (inkl. terminator symbol)
-         */
-        size_t max_token_length;
-
         /**
          * @brief Next free element in the memory. The specific address will be calculated at runtime.
          */
@@ -81,6 +99,16 @@ struct Token_List_Container
         char dataset_id [DATASET_ID_LENGTH];                ///< ID of the dataset
     }* token_lists;
 
+    /**
+     * @brief Memory containing the tokens of all Token_List objects.
+     *
+     * It is a flat memory model. This means, that one C-String contains all tokens (with the terminator symbol) one
+     * after the other. Every token needs only its own length plus one byte; there is no max. token length.
+     */
+    char* token_memory;
+    size_t token_memory_used;                               ///< Used bytes in the token memory
+    size_t token_memory_allocated;                          ///< Allocated bytes for the token memory
+
     size_t longest_token_length;                            ///< Length of the longest token in the whole container
 
     uint_fast32_t next_free_element;                        ///< Next free element in the Token_List array
@@ -89,7 +117,17 @@ struct Token_List_Container
     size_t malloc_calloc_calls;                             ///< How many malloc / calloc calls were done with this object ?
     size_t realloc_calls;                                   ///< How many realloc calls were done with this object ?
 
-    struct Two_Dim_C_String_Array* list_of_too_long_token;  ///< List of tokens, that are longer than expected
+    struct Two_Dim_C_String_Array* list_of_long_tokens;     ///< Tokens, that are longer than MAX_TOKEN_LENGTH - 1 chars (not truncated; only for information)
+    size_t parsed_chunks;                                   ///< Number of chunks of the parallel parsing (0: Parsed with one thread)
+    /**
+     * @brief Token_Int_Mapping of the direct-to-id ingestion or NULL.
+     *
+     * With a mapping the tokens of every parsed JSON fragment or text line will be interned directly in the mapping.
+     * After that the chars of the fragment will be removed from the token memory and the handles contain the mapped
+     * integers. So the token memory holds never more than the tokens of one fragment. The mapping is NOT owned by the
+     * container.
+     */
+    struct Token_Int_Mapping* token_int_mapping;
 };
 
 //=====================================================================================================================
@@ -111,6 +149,58 @@ TokenListContainer_CreateObject
         const char* const file_name
 );
 
+/**
+ * @brief Create the token list from a JSON file with multiple threads.
+ *
+ * A mapped file will be split in chunks at the record boundaries. The chunks will be parsed in parallel and merged in
+ * the order of the file. The result is the same like with one thread. Not mappable files (e.g. pipes) and small files
+ * will be parsed with one thread.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      number_of_threads > 0
+ *
+ * @param[in] file_name Input file name
+ * @param[in] number_of_threads Max. number of threads
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+extern struct Token_List_Container*
+TokenListContainer_CreateObjectParallel
+(
+        const char* const file_name,
+        const size_t number_of_threads
+);
+
+/**
+ * @brief Create the token list from a JSON file with multiple threads and intern the tokens directly in the given
+ * Token_Int_Mapping (direct-to-id ingestion).
+ *
+ * The container keeps only the mapped integers, the offsets and the dataset IDs; the chars of the tokens are only in
+ * the mapping. The mapped integers are exact the same as if the tokens of a container without mapping were interned
+ * one after the other: The threads use chunk local mappings, that will be merged in the order of the file.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      strlen(file_name) > 0
+ *      number_of_threads > 0
+ *      token_int_mapping != NULL
+ *
+ * @param[in] file_name Input file name
+ * @param[in] number_of_threads Max. number of threads
+ * @param[in] token_int_mapping Token_Int_Mapping, that receives the tokens
+ *
+ * @return Address to the new dynamic Token_List_Container
+ */
+extern struct Token_List_Container*
+TokenListContainer_CreateObjectWithMapping
+(
+        const char* const file_name,
+        const size_t number_of_threads,
+        struct Token_Int_Mapping* const token_int_mapping
+);
+
 /**
  * @brief Delete a dynamic allocated Delete_Token_Container object.
  *
@@ -125,10 +215,28 @@ TokenListContainer_DeleteObject
         struct Token_List_Container* object
 );
 
+/**
+ * @brief Delete the tokens and the offsets of all Token_List objects in the container.
+ *
+ * Only the dataset IDs and the list of long tokens stay in the container. This is useful, when the tokens were
+ * already copied in a Document_Word_List and the container is only necessary for the dataset IDs. After the call all
+ * Token_List objects are empty and no new tokens can be added.
+ *
+ * Asserts:
+ *      container != NULL
+ *
+ * @param[in] container Token_List_Container object
+ */
+extern void
+TokenListContainer_DeleteTokens
+(
+        struct Token_List_Container* const container
+);
+
 /**
  * @brief Read a specific token from the container.
  *
- * For performance reasons, the memory for each token list is allocated as one memory block. Therefore the address
+ * For performance reasons, the memory for all tokens is allocated as one memory block. Therefore the address
  * calculation is more complex. This is the reason for this function.
  *
  * Asserts:
@@ -150,6 +258,51 @@ TokenListContainer_GetToken
         const uint_fast32_t index_token_in_token_list
 );
 
+/**
+ * @brief Get the length of a specific token from the container. (A strlen() call is not necessary)
+ *
+ * Asserts:
+ *      container != NULL
+ *      container->next_free_element < index_token_list
+ *      index_token_in_token_list < container->token_lists [index_token_list].next_free_element
+ *
+ * @param[in] container Token_List_Container object
+ * @param[in] index_token_list Index of the Token_List object
+ * @param[in] index_token_in_token_list Index of the token in the Token_List object
+ *
+ * @return Length of the token
+ */
+extern size_t
+TokenListContainer_GetTokenLength
+(
+        const struct Token_List_Container* const container,
+        const uint_fast32_t index_token_list,
+        const uint_fast32_t index_token_in_token_list
+);
+
+/**
+ * @brief Get the mapped integer of a specific token from a container with direct-to-id ingestion.
+ *
+ * Asserts:
+ *      container != NULL
+ *      container->token_int_mapping != NULL
+ *      container->next_free_element < index_token_list
+ *      index_token_in_token_list < container->token_lists [index_token_list].next_free_element
+ *
+ * @param[in] container Token_List_Container object
+ * @param[in] index_token_list Index of the Token_List object
+ * @param[in] index_token_in_token_list Index of the token in the Token_List object
+ *
+ * @return Mapped integer of the token
+ */
+extern DATA_TYPE
+TokenListContainer_GetTokenIntValue
+(
+        const struct Token_List_Container* const container,
+        const uint_fast32_t index_token_list,
+        const uint_fast32_t index_token_in_token_list
+);
+
 /**
  * @brief Determine the full memory usage in byte.
  *
@@ -35,6 +35,7 @@
 #include "Print_Tools.h"
 #include "Defines.h"
 #include "CLI_Parameter.h"
+#include "CPUID.h"
 
 
 
@@ -159,11 +160,30 @@ struct Intersection_Data
     const size_t data_1_length;
     const DATA_TYPE* const restrict data_2;
     const size_t data_2_length;
-    _Bool* const restrict multiple_guard_data_1;
-    _Bool* const restrict multiple_guard_data_2;
+    uint32_t* const restrict multiple_guard_data_1;
+    uint32_t* const restrict multiple_guard_data_2;
+    const uint32_t guard_generation;
 };
 
-#if defined(__AVX__) && defined(__AVX2__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS)
+/**
+ * @brief Start a new generation of the duplicate guards and increase the memory of the stamps, if necessary.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] guards Duplicate guards
+ * @param[in] data_1_length Length of the first data array of the next intersection
+ * @param[in] data_2_length Length of the second data array of the next intersection
+ */
+static void
+Prepare_Guards
+(
+        struct Intersection_Guards* const guards,
+        const size_t data_1_length,
+        const size_t data_2_length
+);
+
+#if defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS)
 /**
  * @brief Using AVX2 intrinsic function to use SIMD commands for the comparisons.
  *
@@ -177,12 +197,15 @@ struct Intersection_Data
  *
  * @param[in] data struct with all necessary data for the intersection calculation
  */
+__attribute__((target("avx2")))
 static void
 Inersection_With_AVX2
 (
         const struct Intersection_Data data
 );
-#elif defined(__AVX__) && ! defined(NO_AVX) && ! defined(NO_CPU_EXTENSIONS)
+#endif /* defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS) */
+
+#if defined(__GNUC__) && ! defined(NO_AVX) && ! defined(NO_CPU_EXTENSIONS)
 /**
  * @brief Using AVX intrinsic function to use SIMD commands for the comparisons.
  *
@@ -204,12 +227,15 @@ Inersection_With_AVX2
  *
  * @param[in] data struct with all necessary data for the intersection calculation
  */
+__attribute__((target("avx")))
 static void
 Inersection_With_AVX
 (
         const struct Intersection_Data data
 );
-#elif defined(__SSE__) && defined(__SSE2__) && defined(__SSE3__) && defined(__SSE4_1__) && ! defined(NO_SSE4_1) && ! defined(NO_CPU_EXTENSIONS)
+#endif /* defined(__GNUC__) && ! defined(NO_AVX) && ! defined(NO_CPU_EXTENSIONS) */
+
+#if defined(__GNUC__) && ! defined(NO_SSE4_1) && ! defined(NO_CPU_EXTENSIONS)
 /**
  * @brief Using SSE4.1 intrinsic function to use SIMD commands for the comparisons.
  *
@@ -223,12 +249,15 @@ Inersection_With_AVX
  *
  * @param[in] data struct with all necessary data for the intersection calculation
  */
+__attribute__((target("sse4.1")))
 static void
 Inersection_With_SSE4_1
 (
         const struct Intersection_Data data
 );
-#elif defined(__SSE__) && defined(__SSE2__) && ! defined(NO_SSE2) && ! defined (NO_CPU_EXTENSIONS)
+#endif /* defined(__GNUC__) && ! defined(NO_SSE4_1) && ! defined(NO_CPU_EXTENSIONS) */
+
+#if defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS)
 /**
  * @brief Using SSE2 intrinsic function to use SIMD commands for the comparisons.
  *
@@ -242,12 +271,15 @@ Inersection_With_SSE4_1
  *
  * @param[in] data struct with all necessary data for the intersection calculation
  */
+__attribute__((target("sse2")))
 static void
 Inersection_With_SSE2
 (
         const struct Intersection_Data data
 );
-#elif defined(__MMX__) && ! defined(NO_MMX) && ! defined (NO_CPU_EXTENSIONS)
+#endif /* defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS) */
+
+#if defined(__GNUC__) && ! defined(NO_MMX) && ! defined(NO_CPU_EXTENSIONS)
 /**
  * @brief Using MMX intrinsic function to use SIMD commands for the comparisons.
  *
@@ -261,12 +293,13 @@ Inersection_With_SSE2
  *
  * @param[in] data struct with all necessary data for the intersection calculation
  */
+__attribute__((target("mmx")))
 static void
 Inersection_With_MMX
 (
         const struct Intersection_Data data
 );
-#endif
+#endif /* defined(__GNUC__) && ! defined(NO_MMX) && ! defined(NO_CPU_EXTENSIONS) */
 /**
  * @brief No special instructions for the calculation.
  *
@@ -290,6 +323,49 @@ Inersection_Without_Special_Instructions
         const struct Intersection_Data data
 );
 
+/**
+ * @brief An entry of the kernel dispatch table.
+ */
+struct Intersection_Kernel
+{
+    const char* name;                                   ///< Name of the kernel (CLI parameter "--kernel")
+    const char* extension_name;                         ///< Name of the used CPU extension (Only for the output)
+    void (*function) (const struct Intersection_Data);  ///< Function, that calculates the intersection
+    _Bool (*is_available) (void);                       ///< Does the host CPU support the kernel ? (NULL: always)
+};
+
+/**
+ * @brief All kernels, that are compiled into the program.
+ *
+ * The kernels are sorted from the fastest to the slowest kernel. The automatic selection uses the first kernel, that
+ * the host CPU supports. The kernel without CPU extensions needs to be the last one.
+ */
+static const struct Intersection_Kernel INTERSECTION_KERNELS [] =
+{
+#if defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS)
+        { "avx2",   "AVX2",     Inersection_With_AVX2,                      CPUID_IsAVX2Available },
+#endif /* defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS) */
+#if defined(__GNUC__) && ! defined(NO_AVX) && ! defined(NO_CPU_EXTENSIONS)
+        { "avx",    "AVX",      Inersection_With_AVX,                       CPUID_IsAVXAvailable },
+#endif /* defined(__GNUC__) && ! defined(NO_AVX) && ! defined(NO_CPU_EXTENSIONS) */
+#if defined(__GNUC__) && ! defined(NO_SSE4_1) && ! defined(NO_CPU_EXTENSIONS)
+        { "sse4_1", "SSE4.1",   Inersection_With_SSE4_1,                    CPUID_IsSSE4_1Available },
+#endif /* defined(__GNUC__) && ! defined(NO_SSE4_1) && ! defined(NO_CPU_EXTENSIONS) */
+#if defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS)
+        { "sse2",   "SSE2",     Inersection_With_SSE2,                      CPUID_IsSSE2Available },
+#endif /* defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS) */
+#if defined(__GNUC__) && ! defined(NO_MMX) && ! defined(NO_CPU_EXTENSIONS)
+        { "mmx",    "MMX",      Inersection_With_MMX,                       CPUID_IsMMXAvailable },
+#endif /* defined(__GNUC__) && ! defined(NO_MMX) && ! defined(NO_CPU_EXTENSIONS) */
+        { "none",   "no",       Inersection_Without_Special_Instructions,   NULL }
+};
+
+/**
+ * @brief The kernel, that will be used in the intersection calculation. Will be set once at the program start with
+ * IntersectionApproach_SelectKernel().
+ */
+static const struct Intersection_Kernel* selected_kernel = NULL;
+
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -463,12 +539,6 @@ IntersectionApproach_HeapSortAndBinarySearch
 
 //---------------------------------------------------------------------------------------------------------------------
 
-// Disable the -Wstack-protector warning for the next function, because stack protector are not possible with functions
-// that works with VLA
-#ifdef __GNUC__
-    #pragma GCC diagnostic push
-    #pragma GCC diagnostic ignored "-Wstack-protector"
-#endif /* __GNUC__ */
 /**
  * @brief Determine intersections with a naive approach (Compare everyone with everyone -> to nested loops).
  *
@@ -476,6 +546,7 @@ IntersectionApproach_HeapSortAndBinarySearch
  *
  * Asserts:
  *      res_obj != NULL
+ *      guards != NULL
  *      data_1 != NULL
  *      data_1_length = 0
  *      data_2 != NULL
@@ -484,7 +555,10 @@ IntersectionApproach_HeapSortAndBinarySearch
  *      sentence_offsets != NULL
  *      word_offsets != NULL
  *
+ * The memory of the guards will be increased, if the data arrays are longer than the allocated stamps.
+ *
  * @param[in] res_obj Preallocated Document_Word_List object, that will be used for the result data
+ * @param[in] guards Duplicate guards (Result of IntersectionApproach_CreateGuards())
  * @param[in] data_1 Data, that will be used for the intersection with the second data array
  * @param[in] char_offsets Char offsets of the data focused on the source file, that was also the source for data_1
  * @param[in] sentence_offsets Sentence offsets of the data focused on the source file, that was also the source for data_1
@@ -499,6 +573,7 @@ extern void
 IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
 (
         struct Document_Word_List* const res_obj,
+        struct Intersection_Guards* const guards,
 
         const DATA_TYPE* const restrict data_1,
         const CHAR_OFFSET_TYPE* const restrict char_offsets,
@@ -510,6 +585,7 @@ IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
 )
 {
     ASSERT_MSG(res_obj != NULL, "Given result pointer is NULL !");
+    ASSERT_MSG(guards != NULL, "Intersection guards are NULL !");
     ASSERT_MSG(data_1 != NULL, "Data 1 is NULL !");
     ASSERT_MSG(data_1_length > 0, "Length of the data 1 is 0 !");
     ASSERT_MSG(data_2 != NULL, "Data 2 is NULL !");
@@ -518,55 +594,8 @@ IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
     ASSERT_MSG(sentence_offsets != NULL, "Sentence offset is NULL !");
     ASSERT_MSG(word_offsets != NULL, "Word offset is NULL !");
 
-#ifndef __STDC_NO_VLA__
-    #ifndef UNSAFE_VLA_USAGE
-        ASSERT_FMSG(data_1_length <= MAX_VLA_LENGTH, "Length of the data 1 is too large for VLA ! Max. valid: %zu; Got %zu !",
-                MAX_VLA_LENGTH, data_1_length);
-        ASSERT_FMSG(data_2_length <= MAX_VLA_LENGTH, "Length of the data 2 is too large for VLA ! Max. valid: %zu; Got %zu !",
-                MAX_VLA_LENGTH, data_2_length);
-    #endif /* UNSAFE_VLA_USAGE */
-#else
-    // Nothing to do
-#endif /* #ifndef __STDC_NO_VLA__ */
-
-    // Arrays, which display, if a value is already in the intersection
-    _Bool* multiple_guard_data_1 = NULL;
-    _Bool* multiple_guard_data_2 = NULL;
-#ifndef __STDC_NO_VLA__
-    #ifndef UNSAFE_VLA_USAGE
-        if (data_1_length > MAX_VLA_LENGTH)
-        {
-            multiple_guard_data_1 = (_Bool*) CALLOC(data_1_length, sizeof (_Bool));
-            ASSERT_ALLOC(multiple_guard_data_1, "Cannot create the multiple guard for data 1 !", data_1_length * sizeof (_Bool));
-        }
-        else
-        {
-    #endif /* UNSAFE_VLA_USAGE */
-        _Bool tmp_multiple_guard_data_1 [data_1_length];
-        multiple_guard_data_1 = tmp_multiple_guard_data_1;
-        memset(multiple_guard_data_1, '\0', data_1_length);
-    #ifndef UNSAFE_VLA_USAGE
-        }
-        if (data_2_length > MAX_VLA_LENGTH)
-        {
-            multiple_guard_data_2 = (_Bool*) CALLOC(data_2_length, sizeof (_Bool));
-            ASSERT_ALLOC(multiple_guard_data_2, "Cannot create the multiple guard for data 2 !", data_2_length * sizeof (_Bool));
-        }
-        else
-        {
-    #endif /* UNSAFE_VLA_USAGE */
-        _Bool tmp_multiple_guard_data_2 [data_2_length];
-        multiple_guard_data_2 = tmp_multiple_guard_data_2;
-        memset(multiple_guard_data_2, '\0', data_2_length);
-    #ifndef UNSAFE_VLA_USAGE
-        }
-    #endif /* UNSAFE_VLA_USAGE */
-#else
-    multiple_guard_data_1 = (_Bool*) CALLOC(data_1_length, sizeof (_Bool));
-    ASSERT_ALLOC(multiple_guard_data_1, "Cannot create the multiple guard for data 1 !", data_1_length * sizeof (_Bool));
-    multiple_guard_data_2 = (_Bool*) CALLOC(data_2_length, sizeof (_Bool));
-    ASSERT_ALLOC(multiple_guard_data_2, "Cannot create the multiple guard for data 2 !", data_2_length * sizeof (_Bool));
-#endif /* __STDC_NO_VLA__ */
+    // The stamps of the last intersection become invalid with the next generation
+    Prepare_Guards(guards, data_1_length, data_2_length);
 
     // Reset the length and the next free element values to "recycle" the given object
     res_obj->next_free_array = 0;
@@ -582,27 +611,16 @@ IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
             data_1_length,
             data_2,
             data_2_length,
-            multiple_guard_data_1,
-            multiple_guard_data_2
+            guards->stamps_data_1,
+            guards->stamps_data_2,
+            guards->generation
     };
 
-    // For the first implementation and to have a compiler independent code: Only use the CPU extensions, if the GCC
-    // compiler will be used
+    // The kernel was selected at the program start with the CPUID results (-> IntersectionApproach_SelectKernel())
     if (! GLOBAL_CLI_NO_CPU_EXTENSIONS)
     {
-#if defined(__AVX__) && defined(__AVX2__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS)
-        Inersection_With_AVX2(data);
-#elif defined(__AVX__) && ! defined(NO_AVX) && ! defined(NO_CPU_EXTENSIONS)
-        Inersection_With_AVX(data);
-#elif defined(__SSE__) && defined(__SSE2__) && defined(__SSE3__) && defined(__SSE4_1__) && ! defined(NO_SSE4_1) && ! defined(NO_CPU_EXTENSIONS)
-        Inersection_With_SSE4_1(data);
-#elif defined(__SSE__) && defined(__SSE2__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS)
-        Inersection_With_SSE2(data);
-#elif defined(__MMX__) && ! defined(NO_MMX) && ! defined (NO_CPU_EXTENSIONS)
-        Inersection_With_MMX(data);
-#else
-        Inersection_Without_Special_Instructions(data);
-#endif
+        ASSERT_MSG(selected_kernel != NULL, "No intersection kernel was selected !");
+        selected_kernel->function(data);
     }
     else
     {
@@ -611,32 +629,165 @@ IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
 
     res_obj->intersection_data = true;
 
-#ifndef __STDC_NO_VLA__
-    #ifndef UNSAFE_VLA_USAGE
-        if (data_1_length > MAX_VLA_LENGTH)
-        {
-            FREE_AND_SET_TO_NULL(multiple_guard_data_1);
-        }
-        if (data_2_length > MAX_VLA_LENGTH)
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create the duplicate guards for IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays().
+ *
+ * The stamps should be large enough for the longest data arrays. Otherwise they will be increased in the intersection
+ * calculation.
+ *
+ * Asserts:
+ *      max_data_1_length > 0
+ *      max_data_2_length > 0
+ *
+ * @param[in] max_data_1_length Expected max. length of the first data array
+ * @param[in] max_data_2_length Expected max. length of the second data array
+ *
+ * @return Pointer to the new dynamic allocated guards
+ */
+extern struct Intersection_Guards*
+IntersectionApproach_CreateGuards
+(
+        const size_t max_data_1_length,
+        const size_t max_data_2_length
+)
+{
+    ASSERT_MSG(max_data_1_length > 0, "Max. length of the data 1 is 0 !");
+    ASSERT_MSG(max_data_2_length > 0, "Max. length of the data 2 is 0 !");
+
+    struct Intersection_Guards* new_object = (struct Intersection_Guards*) CALLOC(1, sizeof (struct Intersection_Guards));
+    ASSERT_ALLOC(new_object, "Cannot allocate memory for the intersection guards !", sizeof (struct Intersection_Guards));
+
+    // A stamp with the value 0 is never valid, because the generation starts with 1
+    new_object->stamps_data_1 = (uint32_t*) CALLOC(max_data_1_length, sizeof (uint32_t));
+    ASSERT_ALLOC(new_object->stamps_data_1, "Cannot allocate memory for the stamps of data 1 !",
+            max_data_1_length * sizeof (uint32_t));
+    new_object->stamps_data_2 = (uint32_t*) CALLOC(max_data_2_length, sizeof (uint32_t));
+    ASSERT_ALLOC(new_object->stamps_data_2, "Cannot allocate memory for the stamps of data 2 !",
+            max_data_2_length * sizeof (uint32_t));
+    new_object->length_data_1 = max_data_1_length;
+    new_object->length_data_2 = max_data_2_length;
+    new_object->generation = 0;
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete the duplicate guards.
+ *
+ * Asserts:
+ *      guards != NULL
+ *
+ * @param[in] guards Duplicate guards, which will be deleted
+ */
+extern void
+IntersectionApproach_DeleteGuards
+(
+        struct Intersection_Guards* guards
+)
+{
+    ASSERT_MSG(guards != NULL, "Intersection guards are NULL !");
+
+    FREE_AND_SET_TO_NULL(guards->stamps_data_1);
+    FREE_AND_SET_TO_NULL(guards->stamps_data_2);
+    FREE_AND_SET_TO_NULL(guards);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Select the kernel, that will be used in IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays().
+ *
+ * With NULL or "auto" the fastest kernel, that the host CPU supports (Determined with the CPUID instruction), will be
+ * selected. Otherwise the kernel with the given name will be selected, if the host CPU supports it.
+ *
+ * This function needs to be called before the intersection calculation starts (The selection is not thread safe).
+ *
+ * @param[in] kernel_name Name of the kernel ("avx2", "avx", "sse4_1", "sse2", "mmx", "none" or "auto") or NULL
+ *
+ * @return true, if the kernel was selected, otherwise false (Unknown name or not supported by the host CPU)
+ */
+extern _Bool
+IntersectionApproach_SelectKernel
+(
+        const char* const kernel_name
+)
+{
+    const _Bool auto_selection = kernel_name == NULL || strcmp(kernel_name, "auto") == 0;
+
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(INTERSECTION_KERNELS); ++ i)
+    {
+        const struct Intersection_Kernel* const kernel = &INTERSECTION_KERNELS [i];
+
+        if (! auto_selection && strcmp(kernel_name, kernel->name) != 0) { continue; }
+        if (kernel->is_available != NULL && ! kernel->is_available())
         {
-            FREE_AND_SET_TO_NULL(multiple_guard_data_2);
+            // A explicit given kernel, that the CPU does not support, is an error
+            if (auto_selection) { continue; }
+            return false;
         }
-    #endif /* UNSAFE_VLA_USAGE */
-#else
-    FREE_AND_SET_TO_NULL(multiple_guard_data_1);
-    FREE_AND_SET_TO_NULL(multiple_guard_data_2);
-#endif /* __STDC_NO_VLA__ */
 
-    return;
+        selected_kernel = kernel;
+        return true;
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Get the name of the CPU extension, that the selected kernel uses.
+ *
+ * @return Name of the CPU extension ("no", if no kernel was selected or the CPU extensions are disabled)
+ */
+extern const char*
+IntersectionApproach_GetKernelExtensionName
+(
+        void
+)
+{
+    if (selected_kernel == NULL || GLOBAL_CLI_NO_CPU_EXTENSIONS)
+    {
+        return INTERSECTION_KERNELS [COUNT_ARRAY_ELEMENTS(INTERSECTION_KERNELS) - 1].extension_name;
+    }
+
+    return selected_kernel->extension_name;
+}
+
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Is the kernel without CPU extensions used for the intersections ?
+ *
+ * The kernel without CPU extensions creates the results in the order of the first data set. All other kernels create
+ * the results in the order of the second data set. The engines --inverted_index and --sorted_merge use this function to
+ * create the results in the order of the selected kernel.
+ *
+ * @return true, if the kernel without CPU extensions is used, otherwise false
+ */
+extern _Bool
+IntersectionApproach_IsScalarKernelUsed
+(
+        void
+)
+{
+    return selected_kernel == NULL || GLOBAL_CLI_NO_CPU_EXTENSIONS ||
+            selected_kernel->function == Inersection_Without_Special_Instructions;
 }
-// Enable the -Wstack-protector warning again
-#ifdef __GNUC__
-    #pragma GCC diagnostic pop
-#endif /* __GNUC__ */
 
 //=====================================================================================================================
 
-#if defined(__AVX__) && defined(__AVX2__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS)
+#if defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS)
 /**
  * @brief Using AVX2 intrinsic function to use SIMD commands for the comparisons.
  *
@@ -650,6 +801,7 @@ IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
  *
  * @param[in] data struct with all necessary data for the intersection calculation
  */
+__attribute__((target("avx2")))
 static void
 Inersection_With_AVX2
 (
@@ -701,12 +853,12 @@ Inersection_With_AVX2
                 if (data.data_1 [real_d1] == curr_data_2_var)
                 {
                     // Was the current value already inserted in the intersection result ?
-                    if (! data.multiple_guard_data_1 [real_d1] && ! data.multiple_guard_data_2 [d2])
+                    if (data.multiple_guard_data_1 [real_d1] != data.guard_generation && data.multiple_guard_data_2 [d2] != data.guard_generation)
                     {
                         Put_One_Value_And_Offset_Types_To_Document_Word_List(data.intersection_result, data.data_1 [real_d1],
                                 data.char_offsets [real_d1], data.sentence_offsets [real_d1], data.word_offsets [real_d1]);
-                        data.multiple_guard_data_1 [real_d1] = true;
-                        data.multiple_guard_data_2 [d2] = true;
+                        data.multiple_guard_data_1 [real_d1] = data.guard_generation;
+                        data.multiple_guard_data_2 [d2] = data.guard_generation;
                     }
                 }
             }
@@ -717,12 +869,12 @@ Inersection_With_AVX2
             if (data.data_1 [d1] == curr_data_2_var)
             {
                 // Was the current value already inserted in the intersection result ?
-                if (! data.multiple_guard_data_1 [d1] && ! data.multiple_guard_data_2 [d2])
+                if (data.multiple_guard_data_1 [d1] != data.guard_generation && data.multiple_guard_data_2 [d2] != data.guard_generation)
                 {
                     Put_One_Value_And_Offset_Types_To_Document_Word_List(data.intersection_result, data.data_1 [d1],
                             data.char_offsets [d1], data.sentence_offsets [d1], data.word_offsets [d1]);
-                    data.multiple_guard_data_1 [d1] = true;
-                    data.multiple_guard_data_2 [d2] = true;
+                    data.multiple_guard_data_1 [d1] = data.guard_generation;
+                    data.multiple_guard_data_2 [d2] = data.guard_generation;
                 }
             }
         }
@@ -733,7 +885,9 @@ Inersection_With_AVX2
 
 //---------------------------------------------------------------------------------------------------------------------
 
-#elif defined(__AVX__) && ! defined(NO_AVX) && ! defined(NO_CPU_EXTENSIONS)
+#endif /* defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS) */
+
+#if defined(__GNUC__) && ! defined(NO_AVX) && ! defined(NO_CPU_EXTENSIONS)
 /**
  * @brief Using AVX intrinsic function to use SIMD commands for the comparisons.
  *
@@ -755,6 +909,7 @@ Inersection_With_AVX2
  *
  * @param[in] data struct with all necessary data for the intersection calculation
  */
+__attribute__((target("avx")))
 static void
 Inersection_With_AVX
 (
@@ -792,12 +947,12 @@ Inersection_With_AVX
                 if (data.data_1 [real_d1] == curr_data_2_var)
                 {
                     // Was the current value already inserted in the intersection result ?
-                    if (! data.multiple_guard_data_1 [real_d1] && ! data.multiple_guard_data_2 [d2])
+                    if (data.multiple_guard_data_1 [real_d1] != data.guard_generation && data.multiple_guard_data_2 [d2] != data.guard_generation)
                     {
                         Put_One_Value_And_Offset_Types_To_Document_Word_List(data.intersection_result, data.data_1 [real_d1],
                                 data.char_offsets [real_d1], data.sentence_offsets [real_d1], data.word_offsets [real_d1]);
-                        data.multiple_guard_data_1 [real_d1] = true;
-                        data.multiple_guard_data_2 [d2] = true;
+                        data.multiple_guard_data_1 [real_d1] = data.guard_generation;
+                        data.multiple_guard_data_2 [d2] = data.guard_generation;
                     }
                 }
             }
@@ -808,12 +963,12 @@ Inersection_With_AVX
             if (data.data_1 [d1] == curr_data_2_var)
             {
                 // Was the current value already inserted in the intersection result ?
-                if (! data.multiple_guard_data_1 [d1] && ! data.multiple_guard_data_2 [d2])
+                if (data.multiple_guard_data_1 [d1] != data.guard_generation && data.multiple_guard_data_2 [d2] != data.guard_generation)
                 {
                     Put_One_Value_And_Offset_Types_To_Document_Word_List(data.intersection_result, data.data_1 [d1],
                             data.char_offsets [d1], data.sentence_offsets [d1], data.word_offsets [d1]);
-                    data.multiple_guard_data_1 [d1] = true;
-                    data.multiple_guard_data_2 [d2] = true;
+                    data.multiple_guard_data_1 [d1] = data.guard_generation;
+                    data.multiple_guard_data_2 [d2] = data.guard_generation;
                 }
             }
         }
@@ -824,7 +979,9 @@ Inersection_With_AVX
 
 //---------------------------------------------------------------------------------------------------------------------
 
-#elif defined(__SSE__) && defined(__SSE2__) && defined(__SSE3__) && defined(__SSE4_1__) && ! defined(NO_SSE4_1) && ! defined(NO_CPU_EXTENSIONS)
+#endif /* defined(__GNUC__) && ! defined(NO_AVX) && ! defined(NO_CPU_EXTENSIONS) */
+
+#if defined(__GNUC__) && ! defined(NO_SSE4_1) && ! defined(NO_CPU_EXTENSIONS)
 /**
  * @brief Using SSE4.1 intrinsic function to use SIMD commands for the comparisons.
  *
@@ -838,6 +995,7 @@ Inersection_With_AVX
  *
  * @param[in] data struct with all necessary data for the intersection calculation
  */
+__attribute__((target("sse4.1")))
 static void
 Inersection_With_SSE4_1
 (
@@ -880,12 +1038,12 @@ Inersection_With_SSE4_1
                 if (data.data_1 [real_d1] == curr_data_2_var)
                 {
                     // Was the current value already inserted in the intersection result ?
-                    if (! data.multiple_guard_data_1 [real_d1] && ! data.multiple_guard_data_2 [d2])
+                    if (data.multiple_guard_data_1 [real_d1] != data.guard_generation && data.multiple_guard_data_2 [d2] != data.guard_generation)
                     {
                         Put_One_Value_And_Offset_Types_To_Document_Word_List(data.intersection_result, data.data_1 [real_d1],
                                 data.char_offsets [real_d1], data.sentence_offsets [real_d1], data.word_offsets [real_d1]);
-                        data.multiple_guard_data_1 [real_d1] = true;
-                        data.multiple_guard_data_2 [d2] = true;
+                        data.multiple_guard_data_1 [real_d1] = data.guard_generation;
+                        data.multiple_guard_data_2 [d2] = data.guard_generation;
                     }
                 }
             }
@@ -896,12 +1054,12 @@ Inersection_With_SSE4_1
             if (data.data_1 [d1] == curr_data_2_var)
             {
                 // Was the current value already inserted in the intersection result ?
-                if (! data.multiple_guard_data_1 [d1] && ! data.multiple_guard_data_2 [d2])
+                if (data.multiple_guard_data_1 [d1] != data.guard_generation && data.multiple_guard_data_2 [d2] != data.guard_generation)
                 {
                     Put_One_Value_And_Offset_Types_To_Document_Word_List(data.intersection_result, data.data_1 [d1],
                             data.char_offsets [d1], data.sentence_offsets [d1], data.word_offsets [d1]);
-                    data.multiple_guard_data_1 [d1] = true;
-                    data.multiple_guard_data_2 [d2] = true;
+                    data.multiple_guard_data_1 [d1] = data.guard_generation;
+                    data.multiple_guard_data_2 [d2] = data.guard_generation;
                 }
             }
         }
@@ -912,7 +1070,9 @@ Inersection_With_SSE4_1
 
 //---------------------------------------------------------------------------------------------------------------------
 
-#elif defined(__SSE__) && defined(__SSE2__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS)
+#endif /* defined(__GNUC__) && ! defined(NO_SSE4_1) && ! defined(NO_CPU_EXTENSIONS) */
+
+#if defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS)
 /**
  * @brief Using SSE2 intrinsic function to use SIMD commands for the comparisons.
  *
@@ -926,6 +1086,7 @@ Inersection_With_SSE4_1
  *
  * @param[in] data struct with all necessary data for the intersection calculation
  */
+__attribute__((target("sse2")))
 static void
 Inersection_With_SSE2
 (
@@ -973,12 +1134,12 @@ Inersection_With_SSE2
                 if (data.data_1 [real_d1] == curr_data_2_var)
                 {
                     // Was the current value already inserted in the intersection result ?
-                    if (! data.multiple_guard_data_1 [real_d1] && ! data.multiple_guard_data_2 [d2])
+                    if (data.multiple_guard_data_1 [real_d1] != data.guard_generation && data.multiple_guard_data_2 [d2] != data.guard_generation)
                     {
                         Put_One_Value_And_Offset_Types_To_Document_Word_List(data.intersection_result, data.data_1 [real_d1],
                                 data.char_offsets [real_d1], data.sentence_offsets [real_d1], data.word_offsets [real_d1]);
-                        data.multiple_guard_data_1 [real_d1] = true;
-                        data.multiple_guard_data_2 [d2] = true;
+                        data.multiple_guard_data_1 [real_d1] = data.guard_generation;
+                        data.multiple_guard_data_2 [d2] = data.guard_generation;
                     }
                 }
             }
@@ -989,12 +1150,12 @@ Inersection_With_SSE2
             if (data.data_1 [d1] == curr_data_2_var)
             {
                 // Was the current value already inserted in the intersection result ?
-                if (! data.multiple_guard_data_1 [d1] && ! data.multiple_guard_data_2 [d2])
+                if (data.multiple_guard_data_1 [d1] != data.guard_generation && data.multiple_guard_data_2 [d2] != data.guard_generation)
                 {
                     Put_One_Value_And_Offset_Types_To_Document_Word_List(data.intersection_result, data.data_1 [d1],
                             data.char_offsets [d1], data.sentence_offsets [d1], data.word_offsets [d1]);
-                    data.multiple_guard_data_1 [d1] = true;
-                    data.multiple_guard_data_2 [d2] = true;
+                    data.multiple_guard_data_1 [d1] = data.guard_generation;
+                    data.multiple_guard_data_2 [d2] = data.guard_generation;
                 }
             }
         }
@@ -1005,7 +1166,9 @@ Inersection_With_SSE2
 
 //---------------------------------------------------------------------------------------------------------------------
 
-#elif defined(__MMX__) && ! defined(NO_MMX) && ! defined (NO_CPU_EXTENSIONS)
+#endif /* defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS) */
+
+#if defined(__GNUC__) && ! defined(NO_MMX) && ! defined(NO_CPU_EXTENSIONS)
 /**
  * @brief Using MMX intrinsic function to use SIMD commands for the comparisons.
  *
@@ -1019,6 +1182,7 @@ Inersection_With_SSE2
  *
  * @param[in] data struct with all necessary data for the intersection calculation
  */
+__attribute__((target("mmx")))
 static void
 Inersection_With_MMX
 (
@@ -1054,12 +1218,12 @@ Inersection_With_MMX
                 if (data.data_1 [real_d1] == curr_data_2_var)
                 {
                     // Was the current value already inserted in the intersection result ?
-                    if (! data.multiple_guard_data_1 [real_d1] && ! data.multiple_guard_data_2 [d2])
+                    if (data.multiple_guard_data_1 [real_d1] != data.guard_generation && data.multiple_guard_data_2 [d2] != data.guard_generation)
                     {
                         Put_One_Value_And_Offset_Types_To_Document_Word_List(data.intersection_result, data.data_1 [real_d1],
                                 data.char_offsets [real_d1], data.sentence_offsets [real_d1], data.word_offsets [real_d1]);
-                        data.multiple_guard_data_1 [real_d1] = true;
-                        data.multiple_guard_data_2 [d2] = true;
+                        data.multiple_guard_data_1 [real_d1] = data.guard_generation;
+                        data.multiple_guard_data_2 [d2] = data.guard_generation;
                     }
                 }
             }
@@ -1070,12 +1234,12 @@ Inersection_With_MMX
             if (data.data_1 [d1] == curr_data_2_var)
             {
                 // Was the current value already inserted in the intersection result ?
-                if (! data.multiple_guard_data_1 [d1] && ! data.multiple_guard_data_2 [d2])
+                if (data.multiple_guard_data_1 [d1] != data.guard_generation && data.multiple_guard_data_2 [d2] != data.guard_generation)
                 {
                     Put_One_Value_And_Offset_Types_To_Document_Word_List(data.intersection_result, data.data_1 [d1],
                             data.char_offsets [d1], data.sentence_offsets [d1], data.word_offsets [d1]);
-                    data.multiple_guard_data_1 [d1] = true;
-                    data.multiple_guard_data_2 [d2] = true;
+                    data.multiple_guard_data_1 [d1] = data.guard_generation;
+                    data.multiple_guard_data_2 [d2] = data.guard_generation;
                 }
             }
         }
@@ -1086,7 +1250,7 @@ Inersection_With_MMX
 
 //---------------------------------------------------------------------------------------------------------------------
 
-#endif
+#endif /* defined(__GNUC__) && ! defined(NO_MMX) && ! defined(NO_CPU_EXTENSIONS) */
 /**
  * @brief No special instructions for the calculation.
  *
@@ -1118,12 +1282,12 @@ Inersection_Without_Special_Instructions
             if (data.data_1 [d1] == data.data_2 [d2])
             {
                 // Was the current value already inserted in the intersection result ?
-                if (! data.multiple_guard_data_1 [d1] && ! data.multiple_guard_data_2 [d2])
+                if (data.multiple_guard_data_1 [d1] != data.guard_generation && data.multiple_guard_data_2 [d2] != data.guard_generation)
                 {
                     Put_One_Value_And_Offset_Types_To_Document_Word_List(data.intersection_result, data.data_1 [d1],
                             data.char_offsets [d1], data.sentence_offsets [d1], data.word_offsets [d1]);
-                    data.multiple_guard_data_1 [d1] = true;
-                    data.multiple_guard_data_2 [d2] = true;
+                    data.multiple_guard_data_1 [d1] = data.guard_generation;
+                    data.multiple_guard_data_2 [d2] = data.guard_generation;
                 }
             }
         }
@@ -1415,6 +1579,57 @@ Heapsort
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Start a new generation of the duplicate guards and increase the memory of the stamps, if necessary.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] guards Duplicate guards
+ * @param[in] data_1_length Length of the first data array of the next intersection
+ * @param[in] data_2_length Length of the second data array of the next intersection
+ */
+static void
+Prepare_Guards
+(
+        struct Intersection_Guards* const guards,
+        const size_t data_1_length,
+        const size_t data_2_length
+)
+{
+    if (data_1_length > guards->length_data_1)
+    {
+        uint32_t* tmp_ptr = (uint32_t*) REALLOC(guards->stamps_data_1, data_1_length * sizeof (uint32_t));
+        ASSERT_ALLOC(tmp_ptr, "Cannot increase the memory for the stamps of data 1 !", data_1_length * sizeof (uint32_t));
+        guards->stamps_data_1 = tmp_ptr;
+        memset(guards->stamps_data_1 + guards->length_data_1, '\0',
+                (data_1_length - guards->length_data_1) * sizeof (uint32_t));
+        guards->length_data_1 = data_1_length;
+    }
+    if (data_2_length > guards->length_data_2)
+    {
+        uint32_t* tmp_ptr = (uint32_t*) REALLOC(guards->stamps_data_2, data_2_length * sizeof (uint32_t));
+        ASSERT_ALLOC(tmp_ptr, "Cannot increase the memory for the stamps of data 2 !", data_2_length * sizeof (uint32_t));
+        guards->stamps_data_2 = tmp_ptr;
+        memset(guards->stamps_data_2 + guards->length_data_2, '\0',
+                (data_2_length - guards->length_data_2) * sizeof (uint32_t));
+        guards->length_data_2 = data_2_length;
+    }
+
+    ++ guards->generation;
+    // After an overflow old stamps could be equal with the new generation
+    if (guards->generation == 0)
+    {
+        memset(guards->stamps_data_1, '\0', guards->length_data_1 * sizeof (uint32_t));
+        memset(guards->stamps_data_2, '\0', guards->length_data_2 * sizeof (uint32_t));
+        guards->generation = 1;
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 #ifdef MULTIPLE_GUARD_ALLOC_STEP
 #undef MULTIPLE_GUARD_ALLOC_STEP
 #endif /* MULTIPLE_GUARD_ALLOC_STEP */
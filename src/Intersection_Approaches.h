@@ -27,10 +27,32 @@ extern "C"
 
 
 
+#include <inttypes.h>   // uint32_t
+#include <stddef.h>     // size_t
 #include "Document_Word_List.h"
 
 
 
+/**
+ * @brief Duplicate guards for IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays().
+ *
+ * A position is already in the intersection, if its stamp is equal with the current generation. So the guards will be
+ * reset in O(1) with an increment of the generation instead of clearing the arrays for every intersection. Only after
+ * an overflow of the generation the stamps need to be cleared.
+ *
+ * The object will be reused for all intersections. Every thread needs its own object.
+ */
+struct Intersection_Guards
+{
+    uint32_t* stamps_data_1;            ///< Stamp of every position in the first data array
+    uint32_t* stamps_data_2;            ///< Stamp of every position in the second data array
+    size_t length_data_1;               ///< Allocated elements for the stamps of the first data array
+    size_t length_data_2;               ///< Allocated elements for the stamps of the second data array
+    uint32_t generation;                ///< Generation of the current intersection (Never 0)
+};
+
+
+
 /**
  * @brief Determine intersections with a naive approach (Compare everyone with everyone -> to nested loops).
  *
@@ -110,6 +132,7 @@ IntersectionApproach_HeapSortAndBinarySearch
  *
  * Asserts:
  *      res_obj != NULL
+ *      guards != NULL
  *      data_1 != NULL
  *      data_1_length = 0
  *      data_2 != NULL
@@ -118,7 +141,10 @@ IntersectionApproach_HeapSortAndBinarySearch
  *      sentence_offsets != NULL
  *      word_offsets != NULL
  *
+ * The memory of the guards will be increased, if the data arrays are longer than the allocated stamps.
+ *
  * @param[in] res_obj Preallocated Document_Word_List object, that will be used for the result data
+ * @param[in] guards Duplicate guards (Result of IntersectionApproach_CreateGuards())
  * @param[in] data_1 Data, that will be used for the intersection with the second data array
  * @param[in] char_offsets Char offsets of the data focused on the source file, that was also the source for data_1
  * @param[in] sentence_offsets Sentence offsets of the data focused on the source file, that was also the source for data_1
@@ -133,6 +159,7 @@ extern void
 IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
 (
         struct Document_Word_List* const res_obj,
+        struct Intersection_Guards* const guards,
 
         const DATA_TYPE* const restrict data_1,
         const CHAR_OFFSET_TYPE* const restrict char_offsets,
@@ -143,6 +170,86 @@ IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays
         const size_t data_2_length
 );
 
+/**
+ * @brief Create the duplicate guards for IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays().
+ *
+ * The stamps should be large enough for the longest data arrays. Otherwise they will be increased in the intersection
+ * calculation.
+ *
+ * Asserts:
+ *      max_data_1_length > 0
+ *      max_data_2_length > 0
+ *
+ * @param[in] max_data_1_length Expected max. length of the first data array
+ * @param[in] max_data_2_length Expected max. length of the second data array
+ *
+ * @return Pointer to the new dynamic allocated guards
+ */
+extern struct Intersection_Guards*
+IntersectionApproach_CreateGuards
+(
+        const size_t max_data_1_length,
+        const size_t max_data_2_length
+);
+
+/**
+ * @brief Delete the duplicate guards.
+ *
+ * Asserts:
+ *      guards != NULL
+ *
+ * @param[in] guards Duplicate guards, which will be deleted
+ */
+extern void
+IntersectionApproach_DeleteGuards
+(
+        struct Intersection_Guards* guards
+);
+
+/**
+ * @brief Select the kernel, that will be used in IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays().
+ *
+ * With NULL or "auto" the fastest kernel, that the host CPU supports (Determined with the CPUID instruction), will be
+ * selected. Otherwise the kernel with the given name will be selected, if the host CPU supports it.
+ *
+ * This function needs to be called before the intersection calculation starts (The selection is not thread safe).
+ *
+ * @param[in] kernel_name Name of the kernel ("avx2", "avx", "sse4_1", "sse2", "mmx", "none" or "auto") or NULL
+ *
+ * @return true, if the kernel was selected, otherwise false (Unknown name or not supported by the host CPU)
+ */
+extern _Bool
+IntersectionApproach_SelectKernel
+(
+        const char* const kernel_name
+);
+
+/**
+ * @brief Get the name of the CPU extension, that the selected kernel uses.
+ *
+ * @return Name of the CPU extension ("no", if no kernel was selected or the CPU extensions are disabled)
+ */
+extern const char*
+IntersectionApproach_GetKernelExtensionName
+(
+        void
+);
+
+/**
+ * @brief Is the kernel without CPU extensions used for the intersections ?
+ *
+ * The kernel without CPU extensions creates the results in the order of the first data set. All other kernels create
+ * the results in the order of the second data set. The engines --inverted_index and --sorted_merge use this function to
+ * create the results in the order of the selected kernel.
+ *
+ * @return true, if the kernel without CPU extensions is used, otherwise false
+ */
+extern _Bool
+IntersectionApproach_IsScalarKernelUsed
+(
+        void
+);
+
 
 
 #ifdef __cplusplus
@@ -0,0 +1,1138 @@
+/**
+ * @file Inverted_Index.c
+ *
+ * @brief The Inverted_Index object maps every mapped token (integer value) of a Document_Word_List to the list of
+ * positions, where this token appears (so-called posting lists).
+ *
+ * The intersection process with the two nested loops compares every data set of the second file with every data set
+ * of the first file. Most of these comparisons are without any result. With the posting lists it is possible to find
+ * all data sets of the first file, that have at least one token in common with a given data set, without touching the
+ * other data sets.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "Inverted_Index.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
+#include "Error_Handling/_Generics.h"
+#include "Misc.h"
+#include "Print_Tools.h"
+
+
+
+/**
+ * @brief Compare function for the qsort call, that sorts the candidates.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] a First value
+ * @param[in] b Second value
+ *
+ * @return -1, if a < b; 0, if a == b; 1, if a > b
+ */
+static int
+Compare_Data_Set_Indices
+(
+        const void* a,
+        const void* b
+);
+
+/**
+ * @brief Find the first posting of a data set in the posting list of a token. (Binary search)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] begin Begin of the posting list
+ * @param[in] end End of the posting list (exclusive)
+ * @param[in] data_set_index Searched data set
+ *
+ * @return Index of the first posting with a data set index >= data_set_index (end, if there is no such posting)
+ */
+static inline size_t
+Lower_Bound_Of_Data_Set
+(
+        const struct Inverted_Index* const object,
+        size_t begin,
+        size_t end,
+        const uint32_t data_set_index
+);
+
+/**
+ * @brief Allocate the temporary memory for the determination of the candidates.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Inverted_Index with valid max_token_value and source
+ */
+static void
+Allocate_Temporary_Memory
+(
+        struct Inverted_Index* const object
+);
+
+/**
+ * @brief Determine the rank of every position in a data set: The number of the same token on the previous positions.
+ *
+ * After this call the token counter contains the number of occurrences of every token in the data set. The caller
+ * needs to reset the token counter with Reset_Token_Counter().
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] data Data set (mapped tokens)
+ * @param[in] data_length Length of the data set
+ */
+static void
+Determine_Set_Ranks
+(
+        struct Inverted_Index* const restrict object,
+        const DATA_TYPE* const restrict data,
+        const size_t data_length
+);
+
+/**
+ * @brief Reset the token counter after a Determine_Set_Ranks() call.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] data Data set (the same as in the Determine_Set_Ranks() call)
+ * @param[in] data_length Length of the data set
+ */
+static inline void
+Reset_Token_Counter
+(
+        struct Inverted_Index* const restrict object,
+        const DATA_TYPE* const restrict data,
+        const size_t data_length
+);
+
+/**
+ * @brief Compare function for the qsort call, that sorts the query tokens. (Posting list length in the upper 32 bit)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] a First value
+ * @param[in] b Second value
+ *
+ * @return -1, if a < b; 0, if a == b; 1, if a > b
+ */
+static int
+Compare_Query_Tokens
+(
+        const void* a,
+        const void* b
+);
+
+/**
+ * @brief Compare function for the qsort call, that sorts the matched positions of a indexed data set.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] a First value
+ * @param[in] b Second value
+ *
+ * @return -1, if a < b; 0, if a == b; 1, if a > b
+ */
+static int
+Compare_Positions
+(
+        const void* a,
+        const void* b
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a new Inverted_Index with the data of a Document_Word_List.
+ *
+ * The Document_Word_List needs to be alive as long as the Inverted_Index will be used, because the offsets of the
+ * tokens will be read directly from the Document_Word_List.
+ *
+ * Asserts:
+ *      source != NULL
+ *      source->intersection_data == true (The offsets are necessary)
+ *      source->next_free_array > 0
+ *
+ * @param[in] source Document_Word_List, that will be indexed
+ *
+ * @return Pointer to the new dynamic allocated Inverted_Index
+ */
+extern struct Inverted_Index*
+InvertedIndex_CreateObject
+(
+        const struct Document_Word_List* const source
+)
+{
+    ASSERT_MSG(source != NULL, "Document_Word_List is NULL !");
+    ASSERT_MSG(source->intersection_data, "Document_Word_List contains no offsets !");
+    ASSERT_MSG(source->next_free_array > 0, "Document_Word_List contains no data !");
+    ASSERT_FMSG(source->next_free_array <= UINT32_MAX, "Too many data sets for the Inverted_Index ! Max. valid: %"
+            PRIu32 "; Got %" PRIuFAST32 " !", UINT32_MAX, source->next_free_array);
+
+    struct Inverted_Index* new_object = (struct Inverted_Index*) CALLOC(1, sizeof (struct Inverted_Index));
+    ASSERT_ALLOC(new_object, "Cannot create new Inverted_Index !", sizeof (struct Inverted_Index));
+    new_object->source = source;
+
+    // Find the largest token and the number of postings
+    for (uint_fast32_t i = 0; i < source->next_free_array; ++ i)
+    {
+        const DATA_TYPE* const data = source->data_struct.data [i];
+        for (size_t i2 = 0; i2 < source->arrays_lengths [i]; ++ i2)
+        {
+            if (data [i2] > new_object->max_token_value) { new_object->max_token_value = data [i2]; }
+        }
+        new_object->number_of_postings += source->arrays_lengths [i];
+    }
+    ASSERT_MSG(new_object->max_token_value != DATA_TYPE_MAX, "Invalid token in the Document_Word_List !");
+
+    const size_t number_of_tokens = (size_t) new_object->max_token_value + 1;
+
+    new_object->posting_list_starts = (size_t*) CALLOC(number_of_tokens + 1, sizeof (size_t));
+    ASSERT_ALLOC(new_object->posting_list_starts, "Cannot create the posting list starts !",
+            (number_of_tokens + 1) * sizeof (size_t));
+    new_object->posting_data_set_indices = (uint32_t*) MALLOC(new_object->number_of_postings * sizeof (uint32_t));
+    ASSERT_ALLOC(new_object->posting_data_set_indices, "Cannot create the posting data set indices !",
+            new_object->number_of_postings * sizeof (uint32_t));
+    new_object->posting_positions = (uint32_t*) MALLOC(new_object->number_of_postings * sizeof (uint32_t));
+    ASSERT_ALLOC(new_object->posting_positions, "Cannot create the posting positions !",
+            new_object->number_of_postings * sizeof (uint32_t));
+
+    new_object->malloc_calloc_calls += 4;
+    Allocate_Temporary_Memory(new_object);
+
+    // First pass: Length of every posting list
+    for (uint_fast32_t i = 0; i < source->next_free_array; ++ i)
+    {
+        const DATA_TYPE* const data = source->data_struct.data [i];
+        for (size_t i2 = 0; i2 < source->arrays_lengths [i]; ++ i2)
+        {
+            ++ new_object->posting_list_starts [data [i2] + 1];
+        }
+    }
+    // Prefix sum -> Begin of every posting list
+    for (size_t i = 1; i <= number_of_tokens; ++ i)
+    {
+        new_object->posting_list_starts [i] += new_object->posting_list_starts [i - 1];
+    }
+
+    // Second pass: Fill the posting lists
+    // The token counter is used as insertion cursor for every posting list. Because the data sets will be visited in
+    // ascending order, every posting list is automatically sorted by the data set index and the position
+    for (uint_fast32_t i = 0; i < source->next_free_array; ++ i)
+    {
+        const DATA_TYPE* const data = source->data_struct.data [i];
+        for (size_t i2 = 0; i2 < source->arrays_lengths [i]; ++ i2)
+        {
+            const size_t insert_position = new_object->posting_list_starts [data [i2]] +
+                    new_object->token_counter [data [i2]];
+            new_object->posting_data_set_indices [insert_position] = (uint32_t) i;
+            new_object->posting_positions [insert_position] = (uint32_t) i2;
+            ++ new_object->token_counter [data [i2]];
+        }
+    }
+    memset(new_object->token_counter, '\0', number_of_tokens * sizeof (uint32_t));
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a new Inverted_Index, that uses the posting lists of an existing Inverted_Index.
+ *
+ * Only the temporary memory for the determination of the candidates will be allocated. With this it is possible to
+ * use the same posting lists in more than one thread: Every thread needs its own shared object.
+ *
+ * The given Inverted_Index needs to be alive as long as the shared object will be used.
+ *
+ * Asserts:
+ *      original != NULL
+ *
+ * @param[in] original Inverted_Index, that is the owner of the posting lists
+ *
+ * @return Pointer to the new dynamic allocated Inverted_Index
+ */
+extern struct Inverted_Index*
+InvertedIndex_CreateSharedObject
+(
+        const struct Inverted_Index* const original
+)
+{
+    ASSERT_MSG(original != NULL, "Original Inverted_Index is NULL !");
+
+    struct Inverted_Index* new_object = (struct Inverted_Index*) CALLOC(1, sizeof (struct Inverted_Index));
+    ASSERT_ALLOC(new_object, "Cannot create new Inverted_Index !", sizeof (struct Inverted_Index));
+    new_object->malloc_calloc_calls ++;
+
+    new_object->posting_list_starts         = original->posting_list_starts;
+    new_object->posting_data_set_indices    = original->posting_data_set_indices;
+    new_object->posting_positions           = original->posting_positions;
+    new_object->number_of_postings          = original->number_of_postings;
+    new_object->max_token_value             = original->max_token_value;
+    new_object->source                      = original->source;
+    new_object->shared_postings             = true;
+
+    Allocate_Temporary_Memory(new_object);
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete a Inverted_Index object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Inverted_Index, which will be deleted
+ */
+extern void
+InvertedIndex_DeleteObject
+(
+        struct Inverted_Index* object
+)
+{
+    ASSERT_MSG(object != NULL, "Inverted_Index is NULL !");
+
+    // The posting lists of a shared object will be deleted with the original object
+    if (! object->shared_postings)
+    {
+        FREE_AND_SET_TO_NULL(object->posting_list_starts);
+        FREE_AND_SET_TO_NULL(object->posting_data_set_indices);
+        FREE_AND_SET_TO_NULL(object->posting_positions);
+    }
+    FREE_AND_SET_TO_NULL(object->hits);
+    FREE_AND_SET_TO_NULL(object->candidates);
+    FREE_AND_SET_TO_NULL(object->token_counter);
+    if (object->set_ranks != NULL)
+    {
+        FREE_AND_SET_TO_NULL(object->set_ranks);
+        FREE_AND_SET_TO_NULL(object->query_tokens);
+        FREE_AND_SET_TO_NULL(object->matched_positions);
+    }
+    object->source = NULL;
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine all data sets of the indexed Document_Word_List, which have at least "min_hits" intersection tokens
+ * with the given data set.
+ *
+ * Tokens, that are marked in "ignore_tokens" (e.g. stop words), will not be counted as hit. Every position in the
+ * given data set can only be used once. The same is valid for the positions in the indexed data sets. So the number of
+ * hits is exact the number of tokens (without the ignored ones), that a intersection calculation would produce.
+ *
+ * The result - the candidates - are in the member "candidates" of the object, sorted ascending. This function also
+ * prepares the object for the following InvertedIndex_IntersectWithDataSet() calls with the same data set.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *      data_length > 0
+ *      ignore_tokens != NULL
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] data Data set (mapped tokens)
+ * @param[in] data_length Length of the data set
+ * @param[in] ignore_tokens Flag for every position in the data set, whether the token should be ignored
+ * @param[in] min_hits Minimum number of hits for a valid candidate
+ *
+ * @return Number of candidates
+ */
+extern size_t
+InvertedIndex_DetermineCandidates
+(
+        struct Inverted_Index* const restrict object,
+        const DATA_TYPE* const restrict data,
+        const size_t data_length,
+        const _Bool* const restrict ignore_tokens,
+        const size_t min_hits
+)
+{
+    ASSERT_MSG(object != NULL, "Inverted_Index is NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+    ASSERT_MSG(data_length > 0, "Length of the data is 0 !");
+    ASSERT_MSG(ignore_tokens != NULL, "Ignore token flags are NULL !");
+
+    // After this call the token counter contains the number of occurrences of every token in the given data set
+    Determine_Set_Ranks(object, data, data_length);
+
+    object->number_of_candidates = 0;
+    for (size_t i = 0; i < data_length; ++ i)
+    {
+        // Only the first occurrence of every token will be processed
+        if (ignore_tokens [i] || data [i] > object->max_token_value || object->set_ranks [i] != 0) { continue; }
+
+        const uint32_t occurrences_in_data = object->token_counter [data [i]];
+        const size_t posting_list_end = object->posting_list_starts [data [i] + 1];
+        size_t posting = object->posting_list_starts [data [i]];
+
+        while (posting < posting_list_end)
+        {
+            // All postings of one data set are side by side
+            const uint32_t data_set_index = object->posting_data_set_indices [posting];
+            uint32_t occurrences_in_data_set = 0;
+            while (posting < posting_list_end && object->posting_data_set_indices [posting] == data_set_index)
+            {
+                ++ occurrences_in_data_set;
+                ++ posting;
+            }
+
+            if (object->hits [data_set_index] == 0)
+            {
+                object->candidates [object->number_of_candidates] = data_set_index;
+                ++ object->number_of_candidates;
+            }
+            // Every position can only be used once
+            object->hits [data_set_index] += MIN(occurrences_in_data, occurrences_in_data_set);
+        }
+    }
+
+    // Reset the token counter for the next call
+    Reset_Token_Counter(object, data, data_length);
+
+    // Remove the candidates with too less hits and reset the hit counter
+    size_t valid_candidates = 0;
+    for (size_t i = 0; i < object->number_of_candidates; ++ i)
+    {
+        const uint32_t data_set_index = object->candidates [i];
+        if (object->hits [data_set_index] >= min_hits)
+        {
+            object->candidates [valid_candidates] = data_set_index;
+            ++ valid_candidates;
+        }
+        object->hits [data_set_index] = 0;
+    }
+    object->number_of_candidates = valid_candidates;
+
+    // The results need to be in the same order as the data sets in the Document_Word_List
+    qsort(object->candidates, object->number_of_candidates, sizeof (uint32_t), Compare_Data_Set_Indices);
+
+    return object->number_of_candidates;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine all data sets of the indexed Document_Word_List, which contain every token of the given data set
+ * (full matches).
+ *
+ * Tokens, that are marked in "ignore_tokens" (e.g. stop words), will not be considered. A token, that appears n times
+ * in the given data set, needs to appear at least n times in a candidate. So the candidates are exact the data sets,
+ * whose intersection calculation would produce every not ignored token of the given data set.
+ *
+ * Instead of counting the hits of every posting (InvertedIndex_DetermineCandidates()), the distinct tokens will be
+ * sorted by the length of their posting lists. The posting list of the rarest token creates the first candidates;
+ * every following posting list can only remove candidates. The data sets of the candidates are searched with a binary
+ * search in the following posting lists. The determination stops, if no candidate is left.
+ *
+ * The result - the candidates - are in the member "candidates" of the object, sorted ascending. This function also
+ * prepares the object for the following InvertedIndex_IntersectWithDataSet() calls with the same data set.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *      data_length > 0
+ *      ignore_tokens != NULL
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] data Data set (mapped tokens)
+ * @param[in] data_length Length of the data set
+ * @param[in] ignore_tokens Flag for every position in the data set, whether the token should be ignored
+ * @param[in] min_hits Minimum number of not ignored tokens in the given data set for a valid full match
+ *
+ * @return Number of candidates
+ */
+extern size_t
+InvertedIndex_DetermineFullMatchCandidates
+(
+        struct Inverted_Index* const restrict object,
+        const DATA_TYPE* const restrict data,
+        const size_t data_length,
+        const _Bool* const restrict ignore_tokens,
+        const size_t min_hits
+)
+{
+    ASSERT_MSG(object != NULL, "Inverted_Index is NULL !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+    ASSERT_MSG(data_length > 0, "Length of the data is 0 !");
+    ASSERT_MSG(ignore_tokens != NULL, "Ignore token flags are NULL !");
+
+    // After this call the token counter contains the number of occurrences of every token in the given data set
+    Determine_Set_Ranks(object, data, data_length);
+
+    object->number_of_candidates = 0;
+    size_t number_of_query_tokens = 0;
+    size_t not_ignored_tokens = 0;
+    _Bool full_match_possible = true;
+    for (size_t i = 0; i < data_length; ++ i)
+    {
+        if (ignore_tokens [i]) { continue; }
+        ++ not_ignored_tokens;
+        // A token, that is not in the indexed Document_Word_List, makes a full match impossible
+        if (data [i] > object->max_token_value) { full_match_possible = false; break; }
+        // Only the first occurrence of every token will be processed
+        if (object->set_ranks [i] != 0) { continue; }
+
+        const size_t posting_list_length = object->posting_list_starts [data [i] + 1] -
+                object->posting_list_starts [data [i]];
+        if (posting_list_length == 0) { full_match_possible = false; break; }
+
+        // The posting list length in the upper bits sorts the rarest token to the begin
+        const uint64_t length_key = (posting_list_length > UINT32_MAX) ? UINT32_MAX : posting_list_length;
+        object->query_tokens [number_of_query_tokens] = (length_key << 32) | (uint64_t) data [i];
+        ++ number_of_query_tokens;
+    }
+
+    if (full_match_possible && number_of_query_tokens > 0 && not_ignored_tokens >= min_hits)
+    {
+        qsort(object->query_tokens, number_of_query_tokens, sizeof (uint64_t), Compare_Query_Tokens);
+
+        // The posting list of the rarest token creates the candidates
+        const DATA_TYPE rarest_token = (DATA_TYPE) (object->query_tokens [0] & UINT32_MAX);
+        const uint32_t rarest_token_occurrences = object->token_counter [rarest_token];
+        const size_t rarest_posting_list_end = object->posting_list_starts [rarest_token + 1];
+        size_t posting = object->posting_list_starts [rarest_token];
+
+        while (posting < rarest_posting_list_end)
+        {
+            // All postings of one data set are side by side
+            const uint32_t data_set_index = object->posting_data_set_indices [posting];
+            uint32_t occurrences_in_data_set = 0;
+            while (posting < rarest_posting_list_end && object->posting_data_set_indices [posting] == data_set_index)
+            {
+                ++ occurrences_in_data_set;
+                ++ posting;
+            }
+
+            if (occurrences_in_data_set >= rarest_token_occurrences)
+            {
+                object->candidates [object->number_of_candidates] = data_set_index;
+                ++ object->number_of_candidates;
+            }
+        }
+
+        // Every following token can only remove candidates
+        for (size_t q = 1; q < number_of_query_tokens && object->number_of_candidates > 0; ++ q)
+        {
+            const DATA_TYPE token = (DATA_TYPE) (object->query_tokens [q] & UINT32_MAX);
+            const uint32_t token_occurrences = object->token_counter [token];
+            const size_t posting_list_end = object->posting_list_starts [token + 1];
+            size_t search_begin = object->posting_list_starts [token];
+            size_t valid_candidates = 0;
+
+            // The candidates and the postings are sorted ascending. So the search can start at the last position
+            for (size_t i = 0; i < object->number_of_candidates; ++ i)
+            {
+                const uint32_t data_set_index = object->candidates [i];
+                search_begin = Lower_Bound_Of_Data_Set(object, search_begin, posting_list_end, data_set_index);
+
+                uint32_t occurrences_in_data_set = 0;
+                while (search_begin < posting_list_end &&
+                        object->posting_data_set_indices [search_begin] == data_set_index)
+                {
+                    ++ occurrences_in_data_set;
+                    ++ search_begin;
+                }
+
+                if (occurrences_in_data_set >= token_occurrences)
+                {
+                    object->candidates [valid_candidates] = data_set_index;
+                    ++ valid_candidates;
+                }
+            }
+            object->number_of_candidates = valid_candidates;
+        }
+    }
+
+    // Reset the token counter for the next call
+    Reset_Token_Counter(object, data, data_length);
+
+    return object->number_of_candidates;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the intersection between a indexed data set and the data set, that was used in the last
+ * InvertedIndex_DetermineCandidates() or InvertedIndex_DetermineFullMatchCandidates() call.
+ *
+ * The result is exact the same (including the order of the tokens) as the result of
+ * IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays(): For every position in the given data set the first not
+ * used position in the indexed data set with the same token will be used. The kernels with CPU extensions create the
+ * results in the order of the given data set; the kernel without CPU extensions in the order of the indexed data set.
+ *
+ * Asserts:
+ *      object != NULL
+ *      res_obj != NULL
+ *      data_set_index < object->source->next_free_array
+ *      data != NULL
+ *      data_length > 0
+ *      data_length <= object->allocated_set_ranks
+ *
+ * @param[in] object Inverted_Index
+ * @param[out] res_obj Result object (only the first array will be used)
+ * @param[in] data_set_index Index of the data set in the indexed Document_Word_List
+ * @param[in] data Data set (the same as in the last candidate determination)
+ * @param[in] data_length Length of the data set
+ * @param[in] indexed_data_set_order Create the result in the order of the indexed data set (like the kernel without
+ *      CPU extensions) instead of the order of the given data set ?
+ */
+extern void
+InvertedIndex_IntersectWithDataSet
+(
+        const struct Inverted_Index* const restrict object,
+        struct Document_Word_List* const restrict res_obj,
+        const uint32_t data_set_index,
+        const DATA_TYPE* const restrict data,
+        const size_t data_length,
+        const _Bool indexed_data_set_order
+)
+{
+    ASSERT_MSG(object != NULL, "Inverted_Index is NULL !");
+    ASSERT_MSG(res_obj != NULL, "Given result pointer is NULL !");
+    ASSERT_MSG(data_set_index < object->source->next_free_array, "Data set index is too large !");
+    ASSERT_MSG(data != NULL, "Data is NULL !");
+    ASSERT_MSG(data_length > 0, "Length of the data is 0 !");
+    ASSERT_MSG(data_length <= object->allocated_set_ranks, "Data was not used for the candidate determination !");
+
+    // Reset the length and the next free element values to "recycle" the given object
+    res_obj->next_free_array = 0;
+    for (size_t i = 0; i < res_obj->number_of_arrays; ++ i) { res_obj->arrays_lengths [i] = 0; }
+
+    const struct Data_And_Offsets* const source_data = &(object->source->data_struct);
+    size_t number_of_matches = 0;
+
+    for (size_t d2 = 0; d2 < data_length; ++ d2)
+    {
+        if (data [d2] > object->max_token_value) { continue; }
+
+        // The n-th occurrence of a token in the given data set will be matched with the n-th occurrence in the indexed
+        // data set
+        const size_t posting_list_end = object->posting_list_starts [data [d2] + 1];
+        const size_t posting = Lower_Bound_Of_Data_Set(object, object->posting_list_starts [data [d2]],
+                posting_list_end, data_set_index) + object->set_ranks [d2];
+
+        if (posting < posting_list_end && object->posting_data_set_indices [posting] == data_set_index)
+        {
+            const uint32_t d1 = object->posting_positions [posting];
+            if (indexed_data_set_order)
+            {
+                object->matched_positions [number_of_matches] = d1;
+                ++ number_of_matches;
+                continue;
+            }
+            Put_One_Value_And_Offset_Types_To_Document_Word_List(res_obj, data [d2],
+                    source_data->char_offsets [data_set_index][d1],
+                    source_data->sentence_offsets [data_set_index][d1],
+                    source_data->word_offsets [data_set_index][d1]);
+        }
+    }
+
+    // Every matched position is unique; so the order of the positions is the order of the indexed data set
+    if (number_of_matches > 0)
+    {
+        qsort(object->matched_positions, number_of_matches, sizeof (uint32_t), Compare_Positions);
+        for (size_t i = 0; i < number_of_matches; ++ i)
+        {
+            const uint32_t d1 = object->matched_positions [i];
+            Put_One_Value_And_Offset_Types_To_Document_Word_List(res_obj, source_data->data [data_set_index][d1],
+                    source_data->char_offsets [data_set_index][d1],
+                    source_data->sentence_offsets [data_set_index][d1],
+                    source_data->word_offsets [data_set_index][d1]);
+        }
+    }
+
+    res_obj->intersection_data = true;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the candidates of every indexed data set with only one pass over the data sets of another
+ * Document_Word_List.
+ *
+ * The index is normally built over the first file and every data set of the second file is a query. This function
+ * works the other way round: The index is built over the second file and every data set of the first file (the larger
+ * one) will be read only once in sequential memory order. The hits will be accumulated for every indexed data set and
+ * every pair with at least "min_hits" hits is a candidate.
+ *
+ * Because the hits are symmetric, the candidates of a indexed data set are exact the same as the result of
+ * InvertedIndex_DetermineCandidates() with a index over the other Document_Word_List.
+ *
+ * Asserts:
+ *      object != NULL
+ *      documents != NULL
+ *      documents->next_free_array <= UINT32_MAX
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] documents Document_Word_List, whose data sets will be used as queries
+ * @param[in] ignore_token Optional function, that decides whether a token will be ignored (NULL: no token is ignored)
+ * @param[in] ignore_token_data Optional parameter for the ignore function
+ * @param[in] min_hits Minimum number of hits for a valid candidate
+ *
+ * @return Pointer to the new dynamic allocated candidate lists
+ */
+extern struct Inverted_Index_Candidate_Lists*
+InvertedIndex_CreateCandidateLists
+(
+        struct Inverted_Index* const restrict object,
+        const struct Document_Word_List* const restrict documents,
+        _Bool (*ignore_token)
+        (
+                const DATA_TYPE token,
+                const void* data
+        ),
+        const void* ignore_token_data,
+        const size_t min_hits
+)
+{
+    ASSERT_MSG(object != NULL, "Inverted_Index is NULL !");
+    ASSERT_MSG(documents != NULL, "Document_Word_List is NULL !");
+    ASSERT_FMSG(documents->next_free_array <= UINT32_MAX, "Too many data sets for the candidate lists ! Max. valid: %"
+            PRIu32 "; Got %" PRIuFAST32 " !", UINT32_MAX, documents->next_free_array);
+
+    struct Inverted_Index_Candidate_Lists* new_object = (struct Inverted_Index_Candidate_Lists*) CALLOC(1,
+            sizeof (struct Inverted_Index_Candidate_Lists));
+    ASSERT_ALLOC(new_object, "Cannot create new candidate lists !", sizeof (struct Inverted_Index_Candidate_Lists));
+    new_object->number_of_lists = object->source->next_free_array;
+
+    new_object->list_starts = (size_t*) CALLOC(new_object->number_of_lists + 1, sizeof (size_t));
+    ASSERT_ALLOC(new_object->list_starts, "Cannot create the candidate list starts !",
+            (new_object->number_of_lists + 1) * sizeof (size_t));
+
+    // Temporary memory: The found pairs (indexed data set, document) in the order of the documents
+    size_t allocated_pairs = MAX_WITH_TYPE_CHECK(new_object->number_of_lists, (size_t) 1);
+    uint32_t* pair_lists = (uint32_t*) MALLOC(allocated_pairs * sizeof (uint32_t));
+    ASSERT_ALLOC(pair_lists, "Cannot create the list indices of the pairs !", allocated_pairs * sizeof (uint32_t));
+    uint32_t* pair_documents = (uint32_t*) MALLOC(allocated_pairs * sizeof (uint32_t));
+    ASSERT_ALLOC(pair_documents, "Cannot create the documents of the pairs !", allocated_pairs * sizeof (uint32_t));
+    size_t allocated_ignore_flags = MAX_WITH_TYPE_CHECK(documents->max_array_length, (size_t) 1);
+    _Bool* ignore_flags = (_Bool*) MALLOC(allocated_ignore_flags * sizeof (_Bool));
+    ASSERT_ALLOC(ignore_flags, "Cannot create the ignore flags !", allocated_ignore_flags * sizeof (_Bool));
+    new_object->malloc_calloc_calls += 5;
+
+    // One pass over all documents
+    for (uint_fast32_t i = 0; i < documents->next_free_array; ++ i)
+    {
+        const DATA_TYPE* const data = documents->data_struct.data [i];
+        const size_t data_length = documents->arrays_lengths [i];
+        if (data_length == 0) { continue; }
+
+        if (data_length > allocated_ignore_flags)
+        {
+            _Bool* tmp_ptr = (_Bool*) REALLOC(ignore_flags, data_length * sizeof (_Bool));
+            ASSERT_ALLOC(tmp_ptr, "Cannot reallocate the ignore flags !", data_length * sizeof (_Bool));
+            ignore_flags = tmp_ptr;
+            allocated_ignore_flags = data_length;
+            ++ new_object->realloc_calls;
+        }
+        for (size_t i2 = 0; i2 < data_length; ++ i2)
+        {
+            ignore_flags [i2] = (ignore_token != NULL) ? ignore_token(data [i2], ignore_token_data) : false;
+        }
+
+        const size_t number_of_candidates = InvertedIndex_DetermineCandidates(object, data, data_length, ignore_flags,
+                min_hits);
+
+        if (new_object->number_of_candidates + number_of_candidates > allocated_pairs)
+        {
+            allocated_pairs = MAX_WITH_TYPE_CHECK(allocated_pairs * 2, new_object->number_of_candidates +
+                    number_of_candidates);
+            uint32_t* tmp_ptr = (uint32_t*) REALLOC(pair_lists, allocated_pairs * sizeof (uint32_t));
+            ASSERT_ALLOC(tmp_ptr, "Cannot reallocate the list indices of the pairs !",
+                    allocated_pairs * sizeof (uint32_t));
+            pair_lists = tmp_ptr;
+            tmp_ptr = (uint32_t*) REALLOC(pair_documents, allocated_pairs * sizeof (uint32_t));
+            ASSERT_ALLOC(tmp_ptr, "Cannot reallocate the documents of the pairs !",
+                    allocated_pairs * sizeof (uint32_t));
+            pair_documents = tmp_ptr;
+            new_object->realloc_calls += 2;
+        }
+        for (size_t i2 = 0; i2 < number_of_candidates; ++ i2)
+        {
+            pair_lists [new_object->number_of_candidates] = object->candidates [i2];
+            pair_documents [new_object->number_of_candidates] = (uint32_t) i;
+            ++ new_object->number_of_candidates;
+            ++ new_object->list_starts [object->candidates [i2] + 1];
+        }
+    }
+
+    // Prefix sum -> Begin of every candidate list
+    for (size_t i = 1; i <= new_object->number_of_lists; ++ i)
+    {
+        new_object->list_starts [i] += new_object->list_starts [i - 1];
+    }
+
+    // Counting sort of the pairs by the indexed data set
+    // The pairs are in the order of the documents. So every candidate list is automatically sorted ascending
+    const size_t allocation_size = MAX_WITH_TYPE_CHECK(new_object->number_of_candidates, (size_t) 1);
+    new_object->candidates = (uint32_t*) MALLOC(allocation_size * sizeof (uint32_t));
+    ASSERT_ALLOC(new_object->candidates, "Cannot create the candidates !", allocation_size * sizeof (uint32_t));
+    ++ new_object->malloc_calloc_calls;
+    for (size_t i = 0; i < new_object->number_of_candidates; ++ i)
+    {
+        // The list start is used as insertion cursor and will be restored after the loop
+        new_object->candidates [new_object->list_starts [pair_lists [i]] ++] = pair_documents [i];
+    }
+    for (size_t i = new_object->number_of_lists; i > 0; -- i)
+    {
+        new_object->list_starts [i] = new_object->list_starts [i - 1];
+    }
+    new_object->list_starts [0] = 0;
+
+    FREE_AND_SET_TO_NULL(pair_lists);
+    FREE_AND_SET_TO_NULL(pair_documents);
+    FREE_AND_SET_TO_NULL(ignore_flags);
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete candidate lists.
+ *
+ * Asserts:
+ *      lists != NULL
+ *
+ * @param[in] lists Candidate lists, which will be deleted
+ */
+extern void
+InvertedIndex_DeleteCandidateLists
+(
+        struct Inverted_Index_Candidate_Lists* lists
+)
+{
+    ASSERT_MSG(lists != NULL, "Candidate lists are NULL !");
+
+    FREE_AND_SET_TO_NULL(lists->list_starts);
+    FREE_AND_SET_TO_NULL(lists->candidates);
+    FREE_AND_SET_TO_NULL(lists);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the full memory usage in byte.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Inverted_Index
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+InvertedIndex_GetAllocatedMemSize
+(
+        const struct Inverted_Index* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Inverted_Index is NULL !");
+
+    const size_t number_of_tokens = (size_t) object->max_token_value + 1;
+
+    size_t result = sizeof (struct Inverted_Index);
+    if (! object->shared_postings)
+    {
+        result += (number_of_tokens + 1) * sizeof (size_t);
+        result += object->number_of_postings * sizeof (uint32_t) * 2;
+    }
+    result += object->source->next_free_array * sizeof (uint32_t) * 2;
+    result += number_of_tokens * sizeof (uint32_t);
+    result += object->allocated_set_ranks * (sizeof (uint32_t) * 2 + sizeof (uint64_t));
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Print attributes of a Inverted_Index to stdout.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Inverted_Index
+ */
+extern void
+InvertedIndex_ShowAttributes
+(
+        const struct Inverted_Index* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Inverted_Index is NULL !");
+
+    // Int formatter for the output
+    int formatter_int = (int) MAX_WITH_TYPE_CHECK(Count_Number_Of_Digits(object->number_of_postings),
+            Count_Number_Of_Digits((size_t) object->max_token_value));
+    formatter_int = MAX_WITH_TYPE_CHECK((int) Count_Number_Of_Digits(object->source->next_free_array), formatter_int);
+
+    puts("");
+    printf("Full inverted index size: ");
+    Print_Memory_Size_As_B_KB_MB(InvertedIndex_GetAllocatedMemSize(object));
+
+    puts ("> Attributes <");
+    printf ("Number of postings:    %*zu\n", formatter_int, object->number_of_postings);
+    printf ("Number of data sets:   %*zu\n", formatter_int, (size_t) object->source->next_free_array);
+    printf ("Max. token value:      %*zu\n", formatter_int, (size_t) object->max_token_value);
+    printf ("Malloc / calloc calls: %*zu\n", formatter_int, object->malloc_calloc_calls);
+    printf ("Realloc calls:         %*zu\n", formatter_int, object->realloc_calls);
+
+    return;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Compare function for the qsort call, that sorts the candidates.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] a First value
+ * @param[in] b Second value
+ *
+ * @return -1, if a < b; 0, if a == b; 1, if a > b
+ */
+static int
+Compare_Data_Set_Indices
+(
+        const void* a,
+        const void* b
+)
+{
+    const uint32_t value_a = *((const uint32_t*) a);
+    const uint32_t value_b = *((const uint32_t*) b);
+
+    return (value_a > value_b) - (value_a < value_b);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Find the first posting of a data set in the posting list of a token. (Binary search)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] begin Begin of the posting list
+ * @param[in] end End of the posting list (exclusive)
+ * @param[in] data_set_index Searched data set
+ *
+ * @return Index of the first posting with a data set index >= data_set_index (end, if there is no such posting)
+ */
+static inline size_t
+Lower_Bound_Of_Data_Set
+(
+        const struct Inverted_Index* const object,
+        size_t begin,
+        size_t end,
+        const uint32_t data_set_index
+)
+{
+    while (begin < end)
+    {
+        const size_t middle = begin + ((end - begin) >> 1);
+        if (object->posting_data_set_indices [middle] < data_set_index)
+        {
+            begin = middle + 1;
+        }
+        else
+        {
+            end = middle;
+        }
+    }
+
+    return begin;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Allocate the temporary memory for the determination of the candidates.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Inverted_Index with valid max_token_value and source
+ */
+static void
+Allocate_Temporary_Memory
+(
+        struct Inverted_Index* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Inverted_Index is NULL !");
+
+    const size_t number_of_data_sets = object->source->next_free_array;
+    const size_t number_of_tokens = (size_t) object->max_token_value + 1;
+
+    object->hits = (uint32_t*) CALLOC(number_of_data_sets, sizeof (uint32_t));
+    ASSERT_ALLOC(object->hits, "Cannot create the hit counter !", number_of_data_sets * sizeof (uint32_t));
+    object->candidates = (uint32_t*) CALLOC(number_of_data_sets, sizeof (uint32_t));
+    ASSERT_ALLOC(object->candidates, "Cannot create the candidates !", number_of_data_sets * sizeof (uint32_t));
+    object->token_counter = (uint32_t*) CALLOC(number_of_tokens, sizeof (uint32_t));
+    ASSERT_ALLOC(object->token_counter, "Cannot create the token counter !", number_of_tokens * sizeof (uint32_t));
+    object->malloc_calloc_calls += 3;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the rank of every position in a data set: The number of the same token on the previous positions.
+ *
+ * After this call the token counter contains the number of occurrences of every token in the data set. The caller
+ * needs to reset the token counter with Reset_Token_Counter().
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] data Data set (mapped tokens)
+ * @param[in] data_length Length of the data set
+ */
+static void
+Determine_Set_Ranks
+(
+        struct Inverted_Index* const restrict object,
+        const DATA_TYPE* const restrict data,
+        const size_t data_length
+)
+{
+    ASSERT_MSG(object != NULL, "Inverted_Index is NULL !");
+
+    // Enough memory for the ranks ?
+    if (data_length > object->allocated_set_ranks)
+    {
+        uint32_t* tmp_ptr = (uint32_t*) REALLOC(object->set_ranks, data_length * sizeof (uint32_t));
+        ASSERT_ALLOC(tmp_ptr, "Cannot reallocate memory for the set ranks !", data_length * sizeof (uint32_t));
+        object->set_ranks = tmp_ptr;
+        uint64_t* tmp_ptr_2 = (uint64_t*) REALLOC(object->query_tokens, data_length * sizeof (uint64_t));
+        ASSERT_ALLOC(tmp_ptr_2, "Cannot reallocate memory for the query tokens !", data_length * sizeof (uint64_t));
+        object->query_tokens = tmp_ptr_2;
+        uint32_t* tmp_ptr_3 = (uint32_t*) REALLOC(object->matched_positions, data_length * sizeof (uint32_t));
+        ASSERT_ALLOC(tmp_ptr_3, "Cannot reallocate memory for the matched positions !",
+                data_length * sizeof (uint32_t));
+        object->matched_positions = tmp_ptr_3;
+        object->allocated_set_ranks = data_length;
+        object->realloc_calls += 3;
+    }
+
+    for (size_t i = 0; i < data_length; ++ i)
+    {
+        if (data [i] > object->max_token_value) { object->set_ranks [i] = 0; continue; }
+        object->set_ranks [i] = object->token_counter [data [i]] ++;
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Reset the token counter after a Determine_Set_Ranks() call.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] data Data set (the same as in the Determine_Set_Ranks() call)
+ * @param[in] data_length Length of the data set
+ */
+static inline void
+Reset_Token_Counter
+(
+        struct Inverted_Index* const restrict object,
+        const DATA_TYPE* const restrict data,
+        const size_t data_length
+)
+{
+    for (size_t i = 0; i < data_length; ++ i)
+    {
+        if (data [i] <= object->max_token_value) { object->token_counter [data [i]] = 0; }
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Compare function for the qsort call, that sorts the query tokens. (Posting list length in the upper 32 bit)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] a First value
+ * @param[in] b Second value
+ *
+ * @return -1, if a < b; 0, if a == b; 1, if a > b
+ */
+static int
+Compare_Query_Tokens
+(
+        const void* a,
+        const void* b
+)
+{
+    const uint64_t value_a = *((const uint64_t*) a);
+    const uint64_t value_b = *((const uint64_t*) b);
+
+    return (value_a > value_b) - (value_a < value_b);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Compare function for the qsort call, that sorts the matched positions of a indexed data set.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] a First value
+ * @param[in] b Second value
+ *
+ * @return -1, if a < b; 0, if a == b; 1, if a > b
+ */
+static int
+Compare_Positions
+(
+        const void* a,
+        const void* b
+)
+{
+    const uint32_t value_a = *((const uint32_t*) a);
+    const uint32_t value_b = *((const uint32_t*) b);
+
+    return (value_a > value_b) - (value_a < value_b);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,361 @@
+/**
+ * @file Inverted_Index.h
+ *
+ * @brief The Inverted_Index object maps every mapped token (integer value) of a Document_Word_List to the list of
+ * positions, where this token appears (so-called posting lists).
+ *
+ * The intersection process with the two nested loops compares every data set of the second file with every data set
+ * of the first file. Most of these comparisons are without any result. With the posting lists it is possible to find
+ * all data sets of the first file, that have at least one token in common with a given data set, without touching the
+ * other data sets.
+ *
+ * The postings are saved in a flat memory model (Compressed Sparse Row layout): All postings of all tokens are in one
+ * array and the postings of a specific token are the interval [posting_list_starts [token], posting_list_starts [token
+ * + 1]). In this interval the postings are sorted ascending by the data set index and the position in the data set.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef INVERTED_INDEX_H
+#define INVERTED_INDEX_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <inttypes.h>   // uint32_t
+#include <stddef.h>     // size_t
+#include "Defines.h"
+#include "Document_Word_List.h"
+
+
+
+//=====================================================================================================================
+
+struct Inverted_Index
+{
+    /**
+     * @brief Begin of the posting list of every token. (Length: max_token_value + 2)
+     *
+     * The last element is the number of all postings. So the length of a posting list is always
+     * posting_list_starts [token + 1] - posting_list_starts [token].
+     */
+    size_t* posting_list_starts;
+
+    uint32_t* posting_data_set_indices; ///< Index of the data set (array in the Document_Word_List) of the postings
+    uint32_t* posting_positions;        ///< Position of the token in the data set of the postings
+    size_t number_of_postings;          ///< Number of all postings
+
+    DATA_TYPE max_token_value;          ///< Largest mapped token in the indexed Document_Word_List
+
+    /**
+     * @brief The indexed Document_Word_List.
+     *
+     * The object is NOT the owner of this Document_Word_List ! It is only a reference for the offset information.
+     */
+    const struct Document_Word_List* source;
+
+    /**
+     * @brief Are the posting lists borrowed from another Inverted_Index ?
+     *
+     * This is the case for objects, that were created with InvertedIndex_CreateSharedObject(). Such an object is NOT
+     * the owner of the posting lists, but of the temporary memory.
+     */
+    _Bool shared_postings;
+
+    // >>> Temporary memory for the determination of the candidates <<<
+    uint32_t* hits;                     ///< Number of possible intersection tokens per data set (Length: number of data sets)
+    uint32_t* candidates;               ///< Data sets with at least one hit (Length: number of data sets)
+    size_t number_of_candidates;        ///< Number of valid candidates after the last determination
+
+    uint32_t* token_counter;            ///< Counter for the tokens in the current data set (Length: max_token_value + 1)
+    uint32_t* set_ranks;                ///< How often appeared the token at this position before in the data set ?
+    uint64_t* query_tokens;             ///< Distinct tokens of the full match determination (Length: allocated_set_ranks)
+    uint32_t* matched_positions;        ///< Matched positions in the indexed data set (Length: allocated_set_ranks)
+    size_t allocated_set_ranks;         ///< Allocated elements for the set ranks
+
+    size_t malloc_calloc_calls;         ///< How many malloc / calloc calls were done with this object ?
+    size_t realloc_calls;               ///< How many realloc calls were done with this object ?
+};
+
+/**
+ * @brief Candidates of every indexed data set, determined with one pass over all data sets of another
+ * Document_Word_List. (Result of InvertedIndex_CreateCandidateLists())
+ *
+ * The candidates of the indexed data set i are the interval [list_starts [i], list_starts [i + 1]) in the array
+ * candidates. In every list the candidates are sorted ascending.
+ */
+struct Inverted_Index_Candidate_Lists
+{
+    size_t* list_starts;                ///< Begin of the candidate list of every indexed data set (Length: number_of_lists + 1)
+    uint32_t* candidates;               ///< Candidates of all lists (Data set indices of the other Document_Word_List)
+    size_t number_of_lists;             ///< Number of candidate lists (= Number of indexed data sets)
+    size_t number_of_candidates;        ///< Number of all candidates
+
+    size_t malloc_calloc_calls;         ///< How many malloc / calloc calls were done with this object ?
+    size_t realloc_calls;               ///< How many realloc calls were done with this object ?
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Create a new Inverted_Index with the data of a Document_Word_List.
+ *
+ * The Document_Word_List needs to be alive as long as the Inverted_Index will be used, because the offsets of the
+ * tokens will be read directly from the Document_Word_List.
+ *
+ * Asserts:
+ *      source != NULL
+ *      source->intersection_data == true (The offsets are necessary)
+ *      source->next_free_array > 0
+ *
+ * @param[in] source Document_Word_List, that will be indexed
+ *
+ * @return Pointer to the new dynamic allocated Inverted_Index
+ */
+extern struct Inverted_Index*
+InvertedIndex_CreateObject
+(
+        const struct Document_Word_List* const source
+);
+
+/**
+ * @brief Create a new Inverted_Index, that uses the posting lists of an existing Inverted_Index.
+ *
+ * Only the temporary memory for the determination of the candidates will be allocated. With this it is possible to
+ * use the same posting lists in more than one thread: Every thread needs its own shared object.
+ *
+ * The given Inverted_Index needs to be alive as long as the shared object will be used.
+ *
+ * Asserts:
+ *      original != NULL
+ *
+ * @param[in] original Inverted_Index, that is the owner of the posting lists
+ *
+ * @return Pointer to the new dynamic allocated Inverted_Index
+ */
+extern struct Inverted_Index*
+InvertedIndex_CreateSharedObject
+(
+        const struct Inverted_Index* const original
+);
+
+/**
+ * @brief Delete a Inverted_Index object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Inverted_Index, which will be deleted
+ */
+extern void
+InvertedIndex_DeleteObject
+(
+        struct Inverted_Index* object
+);
+
+/**
+ * @brief Determine all data sets of the indexed Document_Word_List, which have at least "min_hits" intersection tokens
+ * with the given data set.
+ *
+ * Tokens, that are marked in "ignore_tokens" (e.g. stop words), will not be counted as hit. Every position in the
+ * given data set can only be used once. The same is valid for the positions in the indexed data sets. So the number of
+ * hits is exact the number of tokens (without the ignored ones), that a intersection calculation would produce.
+ *
+ * The result - the candidates - are in the member "candidates" of the object, sorted ascending. This function also
+ * prepares the object for the following InvertedIndex_IntersectWithDataSet() calls with the same data set.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *      data_length > 0
+ *      ignore_tokens != NULL
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] data Data set (mapped tokens)
+ * @param[in] data_length Length of the data set
+ * @param[in] ignore_tokens Flag for every position in the data set, whether the token should be ignored
+ * @param[in] min_hits Minimum number of hits for a valid candidate
+ *
+ * @return Number of candidates
+ */
+extern size_t
+InvertedIndex_DetermineCandidates
+(
+        struct Inverted_Index* const restrict object,
+        const DATA_TYPE* const restrict data,
+        const size_t data_length,
+        const _Bool* const restrict ignore_tokens,
+        const size_t min_hits
+);
+
+/**
+ * @brief Determine all data sets of the indexed Document_Word_List, which contain every token of the given data set
+ * (full matches).
+ *
+ * Tokens, that are marked in "ignore_tokens" (e.g. stop words), will not be considered. A token, that appears n times
+ * in the given data set, needs to appear at least n times in a candidate. So the candidates are exact the data sets,
+ * whose intersection calculation would produce every not ignored token of the given data set.
+ *
+ * Instead of counting the hits of every posting (InvertedIndex_DetermineCandidates()), the distinct tokens will be
+ * sorted by the length of their posting lists. The posting list of the rarest token creates the first candidates;
+ * every following posting list can only remove candidates. The data sets of the candidates are searched with a binary
+ * search in the following posting lists. The determination stops, if no candidate is left.
+ *
+ * The result - the candidates - are in the member "candidates" of the object, sorted ascending. This function also
+ * prepares the object for the following InvertedIndex_IntersectWithDataSet() calls with the same data set.
+ *
+ * Asserts:
+ *      object != NULL
+ *      data != NULL
+ *      data_length > 0
+ *      ignore_tokens != NULL
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] data Data set (mapped tokens)
+ * @param[in] data_length Length of the data set
+ * @param[in] ignore_tokens Flag for every position in the data set, whether the token should be ignored
+ * @param[in] min_hits Minimum number of not ignored tokens in the given data set for a valid full match
+ *
+ * @return Number of candidates
+ */
+extern size_t
+InvertedIndex_DetermineFullMatchCandidates
+(
+        struct Inverted_Index* const restrict object,
+        const DATA_TYPE* const restrict data,
+        const size_t data_length,
+        const _Bool* const restrict ignore_tokens,
+        const size_t min_hits
+);
+
+/**
+ * @brief Determine the intersection between a indexed data set and the data set, that was used in the last
+ * InvertedIndex_DetermineCandidates() or InvertedIndex_DetermineFullMatchCandidates() call.
+ *
+ * The result is exact the same (including the order of the tokens) as the result of
+ * IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays(): For every position in the given data set the first not
+ * used position in the indexed data set with the same token will be used. The kernels with CPU extensions create the
+ * results in the order of the given data set; the kernel without CPU extensions in the order of the indexed data set.
+ *
+ * Asserts:
+ *      object != NULL
+ *      res_obj != NULL
+ *      data_set_index < object->source->next_free_array
+ *      data != NULL
+ *      data_length > 0
+ *      data_length <= object->allocated_set_ranks
+ *
+ * @param[in] object Inverted_Index
+ * @param[out] res_obj Result object (only the first array will be used)
+ * @param[in] data_set_index Index of the data set in the indexed Document_Word_List
+ * @param[in] data Data set (the same as in the last candidate determination)
+ * @param[in] data_length Length of the data set
+ * @param[in] indexed_data_set_order Create the result in the order of the indexed data set (like the kernel without
+ *      CPU extensions) instead of the order of the given data set ?
+ */
+extern void
+InvertedIndex_IntersectWithDataSet
+(
+        const struct Inverted_Index* const restrict object,
+        struct Document_Word_List* const restrict res_obj,
+        const uint32_t data_set_index,
+        const DATA_TYPE* const restrict data,
+        const size_t data_length,
+        const _Bool indexed_data_set_order
+);
+
+/**
+ * @brief Determine the candidates of every indexed data set with only one pass over the data sets of another
+ * Document_Word_List.
+ *
+ * The index is normally built over the first file and every data set of the second file is a query. This function
+ * works the other way round: The index is built over the second file and every data set of the first file (the larger
+ * one) will be read only once in sequential memory order. The hits will be accumulated for every indexed data set and
+ * every pair with at least "min_hits" hits is a candidate.
+ *
+ * Because the hits are symmetric, the candidates of a indexed data set are exact the same as the result of
+ * InvertedIndex_DetermineCandidates() with a index over the other Document_Word_List.
+ *
+ * Asserts:
+ *      object != NULL
+ *      documents != NULL
+ *      documents->next_free_array <= UINT32_MAX
+ *
+ * @param[in] object Inverted_Index
+ * @param[in] documents Document_Word_List, whose data sets will be used as queries
+ * @param[in] ignore_token Optional function, that decides whether a token will be ignored (NULL: no token is ignored)
+ * @param[in] ignore_token_data Optional parameter for the ignore function
+ * @param[in] min_hits Minimum number of hits for a valid candidate
+ *
+ * @return Pointer to the new dynamic allocated candidate lists
+ */
+extern struct Inverted_Index_Candidate_Lists*
+InvertedIndex_CreateCandidateLists
+(
+        struct Inverted_Index* const restrict object,
+        const struct Document_Word_List* const restrict documents,
+        _Bool (*ignore_token)
+        (
+                const DATA_TYPE token,
+                const void* data
+        ),
+        const void* ignore_token_data,
+        const size_t min_hits
+);
+
+/**
+ * @brief Delete candidate lists.
+ *
+ * Asserts:
+ *      lists != NULL
+ *
+ * @param[in] lists Candidate lists, which will be deleted
+ */
+extern void
+InvertedIndex_DeleteCandidateLists
+(
+        struct Inverted_Index_Candidate_Lists* lists
+);
+
+/**
+ * @brief Determine the full memory usage in byte.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Inverted_Index
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+InvertedIndex_GetAllocatedMemSize
+(
+        const struct Inverted_Index* const object
+);
+
+/**
+ * @brief Print attributes of a Inverted_Index to stdout.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Inverted_Index
+ */
+extern void
+InvertedIndex_ShowAttributes
+(
+        const struct Inverted_Index* const object
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* INVERTED_INDEX_H */
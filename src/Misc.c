@@ -224,6 +224,37 @@ extern inline float Replace_NaN_And_Inf_With_Zero
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Read a monotonic clock (e.g. for wall clock time measurements of multi threaded code).
+ *
+ * Without POSIX the processor time of clock() will be used.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Current time in ns
+ */
+extern uint64_t Current_Time_In_Ns
+(
+        void
+)
+{
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    struct timespec now;
+    const int clock_gettime_result = clock_gettime(CLOCK_MONOTONIC, &now);
+    ASSERT_MSG(clock_gettime_result == 0, "clock_gettime() failed !");
+
+    return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+#else
+    const clock_t now = clock ();
+    ASSERT_MSG(now != (clock_t) -1, "clock() failed !");
+
+    return (uint64_t) ((double) now / (double) CLOCKS_PER_SEC * 1e9);
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 #if defined(__unix__) && defined(_POSIX_C_SOURCE)
 #include <sys/types.h>
 #endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
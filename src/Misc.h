@@ -367,6 +367,21 @@ extern float Replace_NaN_And_Inf_With_Zero
         const float input
 );
 
+/**
+ * @brief Read a monotonic clock (e.g. for wall clock time measurements of multi threaded code).
+ *
+ * Without POSIX the processor time of clock() will be used.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Current time in ns
+ */
+extern uint64_t Current_Time_In_Ns
+(
+        void
+);
+
 /**
  * @brief Determine the size of a FILE* object. In normal cases this is the file size.
  *
@@ -0,0 +1,526 @@
+/**
+ * @file Sorted_Data_Sets.c
+ *
+ * @brief The Sorted_Data_Sets object contains every data set of a Document_Word_List sorted by the mapped token and the
+ * original position in the data set.
+ *
+ * The sorting will be done only once at the creation. After that the intersection between two sorted data sets is a
+ * linear merge (with galloping for data sets with a very different length) instead of a comparison of every token with
+ * every other token. Because the original position of every token will be saved, the offsets of the tokens remain
+ * valid.
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#include "Sorted_Data_Sets.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
+#include "Error_Handling/_Generics.h"
+#include "Misc.h"
+#include "Print_Tools.h"
+
+
+
+/**
+ * @brief Marker for a position in the match memory without a matching token.
+ */
+#ifndef NO_MATCH
+#define NO_MATCH UINT32_MAX
+#else
+#error "The macro \"NO_MATCH\" is already defined !"
+#endif /* NO_MATCH */
+
+
+
+/**
+ * @brief A token with its original position in the data set. (Only used while sorting the data sets)
+ */
+struct Token_And_Position
+{
+    DATA_TYPE token;    ///< Mapped token
+    uint32_t position;  ///< Position in the data set
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Compare function for the qsort call, that sorts the tokens of a data set. (First by token, then by position)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] a First token (struct Token_And_Position*)
+ * @param[in] b Second token (struct Token_And_Position*)
+ *
+ * @return -1, if a < b; 0, if a == b; 1, if a > b
+ */
+static int
+Compare_Token_And_Position
+(
+        const void* a,
+        const void* b
+);
+
+/**
+ * @brief Find the first token >= the searched token. (Exponential search followed by a binary search)
+ *
+ * The exponential search makes the merge fast, when one data set is much longer than the other: The cost is only
+ * logarithmic in the number of skipped tokens.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] tokens Sorted tokens
+ * @param[in] begin Begin of the search (tokens [begin] needs to be < token)
+ * @param[in] end End of the search (exclusive)
+ * @param[in] token Searched token
+ *
+ * @return Index of the first token >= token (end, if there is no such token)
+ */
+static inline size_t
+Gallop_To_Token
+(
+        const DATA_TYPE* const tokens,
+        size_t begin,
+        const size_t end,
+        const DATA_TYPE token
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a new Sorted_Data_Sets object with the data of a Document_Word_List.
+ *
+ * The Document_Word_List needs to be alive as long as the Sorted_Data_Sets object will be used, because the offsets of
+ * the tokens will be read directly from the Document_Word_List.
+ *
+ * Asserts:
+ *      source != NULL
+ *      source->next_free_array > 0
+ *
+ * @param[in] source Document_Word_List, that will be sorted
+ *
+ * @return Pointer to the new dynamic allocated Sorted_Data_Sets object
+ */
+extern struct Sorted_Data_Sets*
+SortedDataSets_CreateObject
+(
+        const struct Document_Word_List* const source
+)
+{
+    ASSERT_MSG(source != NULL, "Document_Word_List is NULL !");
+    ASSERT_MSG(source->next_free_array > 0, "Document_Word_List contains no data !");
+
+    struct Sorted_Data_Sets* new_object = (struct Sorted_Data_Sets*) CALLOC(1, sizeof (struct Sorted_Data_Sets));
+    ASSERT_ALLOC(new_object, "Cannot create new Sorted_Data_Sets object !", sizeof (struct Sorted_Data_Sets));
+    new_object->source = source;
+
+    const size_t number_of_data_sets = source->next_free_array;
+
+    new_object->data_set_starts = (size_t*) MALLOC((number_of_data_sets + 1) * sizeof (size_t));
+    ASSERT_ALLOC(new_object->data_set_starts, "Cannot create the data set starts !",
+            (number_of_data_sets + 1) * sizeof (size_t));
+
+    // Begin of every data set and the length of the longest data set
+    new_object->data_set_starts [0] = 0;
+    for (size_t i = 0; i < number_of_data_sets; ++ i)
+    {
+        ASSERT_FMSG(source->arrays_lengths [i] <= UINT32_MAX, "Data set %zu is too long for the Sorted_Data_Sets "
+                "object ! Max. valid: %" PRIu32 "; Got %zu !", i, UINT32_MAX, source->arrays_lengths [i]);
+        new_object->data_set_starts [i + 1] = new_object->data_set_starts [i] + source->arrays_lengths [i];
+        new_object->max_data_set_length = MAX_WITH_TYPE_CHECK(new_object->max_data_set_length,
+                source->arrays_lengths [i]);
+    }
+    new_object->number_of_tokens = new_object->data_set_starts [number_of_data_sets];
+
+    // At least one element, so that the memory is always valid
+    const size_t allocation_size = MAX_WITH_TYPE_CHECK(new_object->number_of_tokens, (size_t) 1);
+    new_object->sorted_tokens = (DATA_TYPE*) MALLOC(allocation_size * sizeof (DATA_TYPE));
+    ASSERT_ALLOC(new_object->sorted_tokens, "Cannot create the sorted tokens !", allocation_size * sizeof (DATA_TYPE));
+    new_object->original_positions = (uint32_t*) MALLOC(allocation_size * sizeof (uint32_t));
+    ASSERT_ALLOC(new_object->original_positions, "Cannot create the original positions !",
+            allocation_size * sizeof (uint32_t));
+
+    const size_t sort_memory_size = MAX_WITH_TYPE_CHECK(new_object->max_data_set_length, (size_t) 1);
+    struct Token_And_Position* sort_memory = (struct Token_And_Position*) MALLOC(sort_memory_size *
+            sizeof (struct Token_And_Position));
+    ASSERT_ALLOC(sort_memory, "Cannot create the memory for sorting the data sets !",
+            sort_memory_size * sizeof (struct Token_And_Position));
+
+    new_object->malloc_calloc_calls += 5;
+
+    // Sort every data set: First by token, then by the original position
+    // The order by position is necessary, because the n-th occurrence of a token will be matched with the n-th
+    // occurrence in the other data set (the same as in the intersection approaches with the CPU extensions)
+    for (size_t i = 0; i < number_of_data_sets; ++ i)
+    {
+        const DATA_TYPE* const data = source->data_struct.data [i];
+        const size_t data_set_length = source->arrays_lengths [i];
+
+        for (size_t i2 = 0; i2 < data_set_length; ++ i2)
+        {
+            sort_memory [i2].token = data [i2];
+            sort_memory [i2].position = (uint32_t) i2;
+        }
+        qsort(sort_memory, data_set_length, sizeof (struct Token_And_Position), Compare_Token_And_Position);
+
+        DATA_TYPE* const sorted_tokens = new_object->sorted_tokens + new_object->data_set_starts [i];
+        uint32_t* const original_positions = new_object->original_positions + new_object->data_set_starts [i];
+        for (size_t i2 = 0; i2 < data_set_length; ++ i2)
+        {
+            sorted_tokens [i2] = sort_memory [i2].token;
+            original_positions [i2] = sort_memory [i2].position;
+        }
+    }
+
+    FREE_AND_SET_TO_NULL(sort_memory);
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete a Sorted_Data_Sets object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Sorted_Data_Sets object, which will be deleted
+ */
+extern void
+SortedDataSets_DeleteObject
+(
+        struct Sorted_Data_Sets* object
+)
+{
+    ASSERT_MSG(object != NULL, "Sorted_Data_Sets object is NULL !");
+
+    FREE_AND_SET_TO_NULL(object->data_set_starts);
+    FREE_AND_SET_TO_NULL(object->sorted_tokens);
+    FREE_AND_SET_TO_NULL(object->original_positions);
+    object->source = NULL;
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a array, that can be used as temporary memory for SortedDataSets_IntersectDataSets().
+ *
+ * Every thread needs its own array.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Sorted_Data_Sets object, whose order will be used in SortedDataSets_IntersectDataSets() (Normally
+ *      the second object)
+ *
+ * @return Pointer to the new dynamic allocated array
+ */
+extern uint32_t*
+SortedDataSets_CreateMatchMemory
+(
+        const struct Sorted_Data_Sets* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Sorted_Data_Sets object is NULL !");
+
+    const size_t match_memory_size = MAX_WITH_TYPE_CHECK(object->max_data_set_length, (size_t) 1);
+    uint32_t* match_memory = (uint32_t*) MALLOC(match_memory_size * sizeof (uint32_t));
+    ASSERT_ALLOC(match_memory, "Cannot create the match memory !", match_memory_size * sizeof (uint32_t));
+
+    // All bytes 0xFF -> NO_MATCH
+    memset(match_memory, 0xFF, match_memory_size * sizeof (uint32_t));
+
+    return match_memory;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the intersection between a data set of the first object and a data set of the second object.
+ *
+ * The result is exact the same (including the order of the tokens) as the result of
+ * IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays(): The n-th occurrence of a token in the second data set will
+ * be matched with the n-th occurrence in the first data set. The results contain the offsets of the first data set.
+ * They are in the order of the second data set (like the kernels with CPU extensions) or in the order of the first
+ * data set (like the kernel without CPU extensions).
+ *
+ * Asserts:
+ *      object_1 != NULL
+ *      object_1->source->intersection_data == true (The offsets are necessary)
+ *      data_set_index_1 < object_1->source->next_free_array
+ *      object_2 != NULL
+ *      data_set_index_2 < object_2->source->next_free_array
+ *      matches != NULL
+ *      res_obj != NULL
+ *
+ * @param[in] object_1 Sorted data sets of the first file
+ * @param[in] data_set_index_1 Index of the data set in the first object
+ * @param[in] object_2 Sorted data sets of the second file
+ * @param[in] data_set_index_2 Index of the data set in the second object
+ * @param[in] matches Temporary memory (Result of SortedDataSets_CreateMatchMemory() with the object, whose order will
+ *      be used)
+ * @param[out] res_obj Result object (only the first array will be used)
+ * @param[in] first_data_set_order Create the result in the order of the first data set instead of the order of the
+ *      second data set ?
+ */
+extern void
+SortedDataSets_IntersectDataSets
+(
+        const struct Sorted_Data_Sets* const restrict object_1,
+        const uint32_t data_set_index_1,
+        const struct Sorted_Data_Sets* const restrict object_2,
+        const uint32_t data_set_index_2,
+        uint32_t* const restrict matches,
+        struct Document_Word_List* const restrict res_obj,
+        const _Bool first_data_set_order
+)
+{
+    ASSERT_MSG(object_1 != NULL, "Sorted_Data_Sets object 1 is NULL !");
+    ASSERT_MSG(object_1->source->intersection_data, "Document_Word_List of object 1 contains no offsets !");
+    ASSERT_MSG(data_set_index_1 < object_1->source->next_free_array, "Data set index 1 is too large !");
+    ASSERT_MSG(object_2 != NULL, "Sorted_Data_Sets object 2 is NULL !");
+    ASSERT_MSG(data_set_index_2 < object_2->source->next_free_array, "Data set index 2 is too large !");
+    ASSERT_MSG(matches != NULL, "Match memory is NULL !");
+    ASSERT_MSG(res_obj != NULL, "Given result pointer is NULL !");
+
+    // Reset the length and the next free element values to "recycle" the given object
+    res_obj->next_free_array = 0;
+    for (size_t i = 0; i < res_obj->number_of_arrays; ++ i) { res_obj->arrays_lengths [i] = 0; }
+    res_obj->intersection_data = true;
+
+    const DATA_TYPE* const tokens_1     = object_1->sorted_tokens + object_1->data_set_starts [data_set_index_1];
+    const uint32_t* const positions_1   = object_1->original_positions + object_1->data_set_starts [data_set_index_1];
+    const size_t length_1               = object_1->data_set_starts [data_set_index_1 + 1] -
+            object_1->data_set_starts [data_set_index_1];
+    const DATA_TYPE* const tokens_2     = object_2->sorted_tokens + object_2->data_set_starts [data_set_index_2];
+    const uint32_t* const positions_2   = object_2->original_positions + object_2->data_set_starts [data_set_index_2];
+    const size_t length_2               = object_2->data_set_starts [data_set_index_2 + 1] -
+            object_2->data_set_starts [data_set_index_2];
+
+    // Disjunct value ranges -> No intersection possible
+    if (length_1 == 0 || length_2 == 0 || tokens_1 [length_1 - 1] < tokens_2 [0] ||
+            tokens_2 [length_2 - 1] < tokens_1 [0])
+    {
+        return;
+    }
+
+    // Merge the two sorted data sets
+    // The matches will be saved at the original position in the data set, whose order the result needs to have
+    size_t i1 = 0;
+    size_t i2 = 0;
+    size_t number_of_matches = 0;
+    while (i1 < length_1 && i2 < length_2)
+    {
+        if (tokens_1 [i1] < tokens_2 [i2])
+        {
+            i1 = Gallop_To_Token(tokens_1, i1, length_1, tokens_2 [i2]);
+        }
+        else if (tokens_1 [i1] > tokens_2 [i2])
+        {
+            i2 = Gallop_To_Token(tokens_2, i2, length_2, tokens_1 [i1]);
+        }
+        else
+        {
+            // Both runs of the same token are sorted by position -> n-th occurrence with n-th occurrence
+            const DATA_TYPE token = tokens_1 [i1];
+            while (i1 < length_1 && i2 < length_2 && tokens_1 [i1] == token && tokens_2 [i2] == token)
+            {
+                if (first_data_set_order)   { matches [positions_1 [i1]] = positions_1 [i1]; }
+                else                        { matches [positions_2 [i2]] = positions_1 [i1]; }
+                ++ number_of_matches;
+                ++ i1;
+                ++ i2;
+            }
+            // Skip the remaining tokens of the longer run
+            while (i1 < length_1 && tokens_1 [i1] == token) { ++ i1; }
+            while (i2 < length_2 && tokens_2 [i2] == token) { ++ i2; }
+        }
+    }
+
+    if (number_of_matches == 0) { return; }
+
+    // Export the matches in the order of the chosen data set and reset the match memory for the next call
+    // The matched tokens are equal; so the tokens of the first data set can always be used
+    const struct Data_And_Offsets* const source_data_1 = &(object_1->source->data_struct);
+    const size_t match_memory_length = (first_data_set_order) ? length_1 : length_2;
+    for (size_t i = 0; i < match_memory_length; ++ i)
+    {
+        const uint32_t d1 = matches [i];
+        if (d1 == NO_MATCH) { continue; }
+
+        Put_One_Value_And_Offset_Types_To_Document_Word_List(res_obj, source_data_1->data [data_set_index_1][d1],
+                source_data_1->char_offsets [data_set_index_1][d1],
+                source_data_1->sentence_offsets [data_set_index_1][d1],
+                source_data_1->word_offsets [data_set_index_1][d1]);
+        matches [i] = NO_MATCH;
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the full memory usage in byte.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Sorted_Data_Sets object
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+SortedDataSets_GetAllocatedMemSize
+(
+        const struct Sorted_Data_Sets* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Sorted_Data_Sets object is NULL !");
+
+    size_t result = sizeof (struct Sorted_Data_Sets);
+    result += (object->source->next_free_array + 1) * sizeof (size_t);
+    const size_t allocation_size = MAX_WITH_TYPE_CHECK(object->number_of_tokens, (size_t) 1);
+    result += allocation_size * (sizeof (DATA_TYPE) + sizeof (uint32_t));
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Print attributes of a Sorted_Data_Sets object to stdout.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Sorted_Data_Sets object
+ */
+extern void
+SortedDataSets_ShowAttributes
+(
+        const struct Sorted_Data_Sets* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Sorted_Data_Sets object is NULL !");
+
+    // Int formatter for the output
+    int formatter_int = (int) MAX_WITH_TYPE_CHECK(Count_Number_Of_Digits(object->number_of_tokens),
+            Count_Number_Of_Digits(object->max_data_set_length));
+    formatter_int = MAX_WITH_TYPE_CHECK((int) Count_Number_Of_Digits(object->source->next_free_array), formatter_int);
+
+    puts("");
+    printf("Full sorted data sets size: ");
+    Print_Memory_Size_As_B_KB_MB(SortedDataSets_GetAllocatedMemSize(object));
+
+    puts ("> Attributes <");
+    printf ("Number of tokens:      %*zu\n", formatter_int, object->number_of_tokens);
+    printf ("Number of data sets:   %*zu\n", formatter_int, (size_t) object->source->next_free_array);
+    printf ("Max. data set length:  %*zu\n", formatter_int, object->max_data_set_length);
+    printf ("Malloc / calloc calls: %*zu\n", formatter_int, object->malloc_calloc_calls);
+    printf ("Realloc calls:         %*zu\n", formatter_int, object->realloc_calls);
+
+    return;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Compare function for the qsort call, that sorts the tokens of a data set. (First by token, then by position)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] a First token (struct Token_And_Position*)
+ * @param[in] b Second token (struct Token_And_Position*)
+ *
+ * @return -1, if a < b; 0, if a == b; 1, if a > b
+ */
+static int
+Compare_Token_And_Position
+(
+        const void* a,
+        const void* b
+)
+{
+    const struct Token_And_Position* const value_a = (const struct Token_And_Position*) a;
+    const struct Token_And_Position* const value_b = (const struct Token_And_Position*) b;
+
+    if (value_a->token != value_b->token)
+    {
+        return (value_a->token > value_b->token) - (value_a->token < value_b->token);
+    }
+
+    return (value_a->position > value_b->position) - (value_a->position < value_b->position);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Find the first token >= the searched token. (Exponential search followed by a binary search)
+ *
+ * The exponential search makes the merge fast, when one data set is much longer than the other: The cost is only
+ * logarithmic in the number of skipped tokens.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] tokens Sorted tokens
+ * @param[in] begin Begin of the search (tokens [begin] needs to be < token)
+ * @param[in] end End of the search (exclusive)
+ * @param[in] token Searched token
+ *
+ * @return Index of the first token >= token (end, if there is no such token)
+ */
+static inline size_t
+Gallop_To_Token
+(
+        const DATA_TYPE* const tokens,
+        size_t begin,
+        const size_t end,
+        const DATA_TYPE token
+)
+{
+    // Exponential search: After the loop the searched token is in the interval (begin, begin + step]
+    size_t step = 1;
+    while (begin + step < end && tokens [begin + step] < token)
+    {
+        begin += step;
+        step <<= 1;
+    }
+
+    // Binary search in the found interval
+    size_t upper = MIN(begin + step, end);
+    ++ begin;
+    while (begin < upper)
+    {
+        const size_t middle = begin + ((upper - begin) >> 1);
+        if (tokens [middle] < token)
+        {
+            begin = middle + 1;
+        }
+        else
+        {
+            upper = middle;
+        }
+    }
+
+    return begin;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+
+
+#ifdef NO_MATCH
+#undef NO_MATCH
+#endif /* NO_MATCH */
@@ -0,0 +1,196 @@
+/**
+ * @file Sorted_Data_Sets.h
+ *
+ * @brief The Sorted_Data_Sets object contains every data set of a Document_Word_List sorted by the mapped token and the
+ * original position in the data set.
+ *
+ * The sorting will be done only once at the creation. After that the intersection between two sorted data sets is a
+ * linear merge (with galloping for data sets with a very different length) instead of a comparison of every token with
+ * every other token. Because the original position of every token will be saved, the offsets of the tokens remain
+ * valid.
+ *
+ * The sorted data are saved in a flat memory model (Compressed Sparse Row layout): The sorted tokens of all data sets
+ * are in one array and the tokens of a specific data set are the interval [data_set_starts [data_set],
+ * data_set_starts [data_set + 1]).
+ *
+ * @date 16.10.2026
+ * @author am4
+ */
+
+#ifndef SORTED_DATA_SETS_H
+#define SORTED_DATA_SETS_H ///< Include-Guard
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+
+#include <inttypes.h>   // uint32_t
+#include <stddef.h>     // size_t
+#include "Defines.h"
+#include "Document_Word_List.h"
+
+
+
+//=====================================================================================================================
+
+struct Sorted_Data_Sets
+{
+    /**
+     * @brief Begin of every data set. (Length: number_of_data_sets + 1)
+     *
+     * The last element is the number of all tokens. So the length of a data set is always
+     * data_set_starts [data_set + 1] - data_set_starts [data_set].
+     */
+    size_t* data_set_starts;
+
+    DATA_TYPE* sorted_tokens;           ///< Tokens of all data sets (In every data set sorted by token and position)
+    uint32_t* original_positions;       ///< Original position of the sorted tokens in the data set
+    size_t number_of_tokens;            ///< Number of all tokens
+    size_t max_data_set_length;         ///< Length of the longest data set
+
+    /**
+     * @brief The sorted Document_Word_List.
+     *
+     * The object is NOT the owner of this Document_Word_List ! It is only a reference for the offset information.
+     */
+    const struct Document_Word_List* source;
+
+    size_t malloc_calloc_calls;         ///< How many malloc / calloc calls were done with this object ?
+    size_t realloc_calls;               ///< How many realloc calls were done with this object ?
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Create a new Sorted_Data_Sets object with the data of a Document_Word_List.
+ *
+ * The Document_Word_List needs to be alive as long as the Sorted_Data_Sets object will be used, because the offsets of
+ * the tokens will be read directly from the Document_Word_List.
+ *
+ * Asserts:
+ *      source != NULL
+ *      source->next_free_array > 0
+ *
+ * @param[in] source Document_Word_List, that will be sorted
+ *
+ * @return Pointer to the new dynamic allocated Sorted_Data_Sets object
+ */
+extern struct Sorted_Data_Sets*
+SortedDataSets_CreateObject
+(
+        const struct Document_Word_List* const source
+);
+
+/**
+ * @brief Delete a Sorted_Data_Sets object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Sorted_Data_Sets object, which will be deleted
+ */
+extern void
+SortedDataSets_DeleteObject
+(
+        struct Sorted_Data_Sets* object
+);
+
+/**
+ * @brief Create a array, that can be used as temporary memory for SortedDataSets_IntersectDataSets().
+ *
+ * Every thread needs its own array.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Sorted_Data_Sets object, whose order will be used in SortedDataSets_IntersectDataSets() (Normally
+ *      the second object)
+ *
+ * @return Pointer to the new dynamic allocated array
+ */
+extern uint32_t*
+SortedDataSets_CreateMatchMemory
+(
+        const struct Sorted_Data_Sets* const object
+);
+
+/**
+ * @brief Determine the intersection between a data set of the first object and a data set of the second object.
+ *
+ * The result is exact the same (including the order of the tokens) as the result of
+ * IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays(): The n-th occurrence of a token in the second data set will
+ * be matched with the n-th occurrence in the first data set. The results contain the offsets of the first data set.
+ * They are in the order of the second data set (like the kernels with CPU extensions) or in the order of the first
+ * data set (like the kernel without CPU extensions).
+ *
+ * Asserts:
+ *      object_1 != NULL
+ *      object_1->source->intersection_data == true (The offsets are necessary)
+ *      data_set_index_1 < object_1->source->next_free_array
+ *      object_2 != NULL
+ *      data_set_index_2 < object_2->source->next_free_array
+ *      matches != NULL
+ *      res_obj != NULL
+ *
+ * @param[in] object_1 Sorted data sets of the first file
+ * @param[in] data_set_index_1 Index of the data set in the first object
+ * @param[in] object_2 Sorted data sets of the second file
+ * @param[in] data_set_index_2 Index of the data set in the second object
+ * @param[in] matches Temporary memory (Result of SortedDataSets_CreateMatchMemory() with the object, whose order will
+ *      be used)
+ * @param[out] res_obj Result object (only the first array will be used)
+ * @param[in] first_data_set_order Create the result in the order of the first data set instead of the order of the
+ *      second data set ?
+ */
+extern void
+SortedDataSets_IntersectDataSets
+(
+        const struct Sorted_Data_Sets* const restrict object_1,
+        const uint32_t data_set_index_1,
+        const struct Sorted_Data_Sets* const restrict object_2,
+        const uint32_t data_set_index_2,
+        uint32_t* const restrict matches,
+        struct Document_Word_List* const restrict res_obj,
+        const _Bool first_data_set_order
+);
+
+/**
+ * @brief Determine the full memory usage in byte.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Sorted_Data_Sets object
+ *
+ * @return Size of the full object in bytes
+ */
+extern size_t
+SortedDataSets_GetAllocatedMemSize
+(
+        const struct Sorted_Data_Sets* const object
+);
+
+/**
+ * @brief Print attributes of a Sorted_Data_Sets object to stdout.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Sorted_Data_Sets object
+ */
+extern void
+SortedDataSets_ShowAttributes
+(
+        const struct Sorted_Data_Sets* const object
+);
+
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SORTED_DATA_SETS_H */
@@ -11,6 +11,180 @@
 #include <string.h>
 #include <ctype.h>
 #include <limits.h>
+#include "Error_Handling/Assert_Msg.h"
+#include "Error_Handling/Dynamic_Memory.h"
+#include "Error_Handling/_Generics.h"
+#include "CPUID.h"
+#include "Misc.h"
+
+#if defined(__GNUC__) && ! defined(NO_CPU_EXTENSIONS)
+#include <immintrin.h>
+#endif /* defined(__GNUC__) && ! defined(NO_CPU_EXTENSIONS) */
+
+
+
+/**
+ * @brief Initial number of tokens in a Tokenized_String object. If a reallocation is necessary, the size will be
+ * doubled.
+ */
+#ifndef TOKENIZED_STRING_INITIAL_SIZE
+#define TOKENIZED_STRING_INITIAL_SIZE 256
+#else
+#error "The macro \"TOKENIZED_STRING_INITIAL_SIZE\" is already defined !"
+#endif /* TOKENIZED_STRING_INITIAL_SIZE */
+
+/**
+ * @brief Max. number of delimiters, that will be searched with SIMD instructions. (Every delimiter needs one compare
+ * per block) With more delimiters the string will be tokenized char by char.
+ */
+#ifndef TOKENIZE_MAX_SIMD_DELIMITERS
+#define TOKENIZE_MAX_SIMD_DELIMITERS 8
+#else
+#error "The macro \"TOKENIZE_MAX_SIMD_DELIMITERS\" is already defined !"
+#endif /* TOKENIZE_MAX_SIMD_DELIMITERS */
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(TOKENIZED_STRING_INITIAL_SIZE > 0, "The macro \"TOKENIZED_STRING_INITIAL_SIZE\" needs to be at least 1 !");
+_Static_assert(TOKENIZE_MAX_SIMD_DELIMITERS > 0, "The macro \"TOKENIZE_MAX_SIMD_DELIMITERS\" needs to be at least 1 !");
+
+IS_TYPE(TOKENIZED_STRING_INITIAL_SIZE, int)
+IS_TYPE(TOKENIZE_MAX_SIMD_DELIMITERS, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+/**
+ * @brief Append the position and the length of a token to a Tokenized_String object. The memory will be increased, if
+ * necessary.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] result Tokenized_String object
+ * @param[in] pos Position of the token
+ * @param[in] len Length of the token
+ */
+static void
+Append_Token_Position
+(
+        struct Tokenized_String* const result,
+        const ptrdiff_t pos,
+        const ptrdiff_t len
+);
+
+#if defined(__GNUC__) && ! defined(NO_CPU_EXTENSIONS) && (! defined(NO_AVX2) || ! defined(NO_SSE2))
+/**
+ * @brief Use the delimiter bit mask of a block: Every change between delimiters and other chars is the begin or the end
+ * of a token.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] result Tokenized_String object
+ * @param[in] delimiter_mask Bit mask of the delimiters in the block (Bit i: Is the char i a delimiter ?)
+ * @param[in] block_mask Bit mask with all bits of the block
+ * @param[in] block_position Position of the block in the string
+ * @param[in, out] token_begin Begin of the current token or -1, if the last char was a delimiter
+ */
+static inline void
+Use_Delimiter_Mask
+(
+        struct Tokenized_String* const restrict result,
+        const uint32_t delimiter_mask,
+        const uint32_t block_mask,
+        const size_t block_position,
+        ptrdiff_t* const restrict token_begin
+);
+#endif /* defined(__GNUC__) && ! defined(NO_CPU_EXTENSIONS) && (! defined(NO_AVX2) || ! defined(NO_SSE2)) */
+
+#if defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS)
+/**
+ * @brief Tokenize the 32 byte blocks of a string with AVX2 instructions.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input Input string
+ * @param[in] input_length Length of the input string
+ * @param[in] breakset List of delimiters (Max. TOKENIZE_MAX_SIMD_DELIMITERS)
+ * @param[in] breakset_length Number of delimiters
+ * @param[in] result Tokenized_String object
+ * @param[in, out] token_begin Begin of the current token or -1, if the last char was a delimiter
+ *
+ * @return Number of tokenized chars (The rest is smaller than one block)
+ */
+__attribute__((target("avx2")))
+static size_t
+Tokenize_Blocks_With_AVX2
+(
+        const char* const restrict input,
+        const size_t input_length,
+        const char* const restrict breakset,
+        const size_t breakset_length,
+        struct Tokenized_String* const restrict result,
+        ptrdiff_t* const restrict token_begin
+);
+#endif /* defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS) */
+
+#if defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS)
+/**
+ * @brief Tokenize the 16 byte blocks of a string with SSE2 instructions.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input Input string
+ * @param[in] input_length Length of the input string
+ * @param[in] breakset List of delimiters (Max. TOKENIZE_MAX_SIMD_DELIMITERS)
+ * @param[in] breakset_length Number of delimiters
+ * @param[in] result Tokenized_String object
+ * @param[in, out] token_begin Begin of the current token or -1, if the last char was a delimiter
+ *
+ * @return Number of tokenized chars (The rest is smaller than one block)
+ */
+__attribute__((target("sse2")))
+static size_t
+Tokenize_Blocks_With_SSE2
+(
+        const char* const restrict input,
+        const size_t input_length,
+        const char* const restrict breakset,
+        const size_t breakset_length,
+        struct Tokenized_String* const restrict result,
+        ptrdiff_t* const restrict token_begin
+);
+#endif /* defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS) */
+
+/**
+ * @brief An entry of the dispatch table for the block tokenizers.
+ */
+struct Block_Tokenizer
+{
+    const char* extension_name;                         ///< Name of the used CPU extension
+    size_t (*function) (const char* const restrict, const size_t, const char* const restrict, const size_t,
+            struct Tokenized_String* const restrict, ptrdiff_t* const restrict); ///< Function, that tokenizes blocks
+    _Bool (*is_available) (void);                       ///< Does the host CPU support the block tokenizer ?
+};
+
+/**
+ * @brief All block tokenizers, that are compiled into the program. Sorted from the fastest to the slowest one.
+ *
+ * The selection uses the first block tokenizer, that the host CPU supports. (Like the intersection kernels)
+ */
+static const struct Block_Tokenizer BLOCK_TOKENIZERS [] =
+{
+#if defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS)
+        { "AVX2",   Tokenize_Blocks_With_AVX2,  CPUID_IsAVX2Available },
+#endif /* defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS) */
+#if defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS)
+        { "SSE2",   Tokenize_Blocks_With_SSE2,  CPUID_IsSSE2Available },
+#endif /* defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS) */
+        { "no",     NULL,                       NULL }
+};
+
+/**
+ * @brief The block tokenizer, that Tokenize_String() uses. Will be set once at the program start with
+ * Select_Tokenize_String_Extension(). Until then all chars will be tokenized char by char.
+ */
+static const struct Block_Tokenizer* selected_block_tokenizer = NULL;
 
 
 
@@ -510,66 +684,356 @@ Is_String_Null_Terminated
  * @brief Tokenize a string and save the tokens in a struct with the position information as offset and the length of
  * the token focused on the offsets.
  *
- * Every delimiter is represented as one char in the c string.
+ * Every delimiter is represented as one char in the c string. A token is a non empty sequence of chars, that are no
+ * delimiters; so leading, trailing and multiple delimiters create no empty tokens.
  *
- * An error will be indicated, that the counter in the result struct for the next free data block is 0.
+ * The delimiters will be searched with the block tokenizer, that Select_Tokenize_String_Extension() selected with the
+ * CPUID results (AVX2 or SSE2). (Compare a block of chars with every delimiter and create a bit mask of the delimiter
+ * positions) The remaining chars and all chars of a breakset with more than TOKENIZE_MAX_SIMD_DELIMITERS delimiters
+ * will be tokenized char by char.
+ *
+ * The tokens of a previous call will be overwritten. If the input or the breakset is NULL or empty, the result contains
+ * no tokens (result->next_free_pos_len is 0).
+ *
+ * Asserts:
+ *      result != NULL
  *
  * @param[in] input input c string
  * @param[in] breakset List of delimiters
- *
- * @return The Tokenized_String data
+ * @param[out] result Tokenized_String object, that will be (re)used for the tokens of the string
  */
-extern struct Tokenized_String
+extern void
 Tokenize_String
 (
         const char* restrict input,
-        const char* restrict breakset
+        const char* restrict breakset,
+        struct Tokenized_String* const restrict result
+)
+{
+    ASSERT_MSG(result != NULL, "Tokenized_String object is NULL !");
+
+    result->next_free_pos_len = 0;
+
+    if (input == NULL)                      { return; }
+    if (IS_STRING_LENGTH_ZERO(input))       { return; }
+    if (breakset == NULL)                   { return; }
+    if (IS_STRING_LENGTH_ZERO(breakset))    { return; }
+
+    const size_t input_length       = strlen (input);
+    const size_t breakset_length    = strlen (breakset);
+    ptrdiff_t token_begin           = -1;
+    size_t position                 = 0;
+
+    // The most chars will be tokenized block by block
+    if (breakset_length <= TOKENIZE_MAX_SIMD_DELIMITERS)
+    {
+        if (selected_block_tokenizer != NULL && selected_block_tokenizer->function != NULL)
+        {
+            position = selected_block_tokenizer->function (input, input_length, breakset, breakset_length, result,
+                    &token_begin);
+        }
+    }
+
+    // The rest char by char
+    _Bool is_delimiter [UCHAR_MAX + 1];
+    memset (is_delimiter, '\0', sizeof (is_delimiter));
+    for (size_t i = 0; i < breakset_length; ++ i)
+    {
+        is_delimiter [(unsigned char) breakset [i]] = true;
+    }
+
+    for (; position < input_length; ++ position)
+    {
+        if (is_delimiter [(unsigned char) input [position]])
+        {
+            if (token_begin >= 0)
+            {
+                Append_Token_Position (result, token_begin, (ptrdiff_t) position - token_begin);
+                token_begin = -1;
+            }
+        }
+        else if (token_begin < 0)
+        {
+            token_begin = (ptrdiff_t) position;
+        }
+    }
+    if (token_begin >= 0)
+    {
+        Append_Token_Position (result, token_begin, (ptrdiff_t) input_length - token_begin);
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Free the memory of a Tokenized_String object. (The object itself will not be freed)
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Tokenized_String object
+ */
+extern void
+Delete_Tokenized_String
+(
+        struct Tokenized_String* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Tokenized_String object is NULL !");
+
+    if (object->token_data != NULL)
+    {
+        FREE_AND_SET_TO_NULL(object->token_data);
+    }
+    object->next_free_pos_len = 0;
+    object->allocated_pos_len = 0;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Select the block tokenizer of Tokenize_String() with the CPUID results: The fastest block tokenizer, that the
+ * host CPU supports, will be used.
+ *
+ * This function needs to be called before the first tokenization starts (The selection is not thread safe). Without a
+ * selection Tokenize_String() tokenizes all chars char by char.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Name of the CPU extension of the selected block tokenizer ("no", if no CPU extension can be used)
+ */
+extern const char*
+Select_Tokenize_String_Extension
+(
+        void
+)
+{
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(BLOCK_TOKENIZERS); ++ i)
+    {
+        if (BLOCK_TOKENIZERS [i].is_available == NULL || BLOCK_TOKENIZERS [i].is_available())
+        {
+            selected_block_tokenizer = &BLOCK_TOKENIZERS [i];
+            break;
+        }
+    }
+
+    return selected_block_tokenizer->extension_name;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Append the position and the length of a token to a Tokenized_String object. The memory will be increased, if
+ * necessary.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] result Tokenized_String object
+ * @param[in] pos Position of the token
+ * @param[in] len Length of the token
+ */
+static void
+Append_Token_Position
+(
+        struct Tokenized_String* const result,
+        const ptrdiff_t pos,
+        const ptrdiff_t len
 )
 {
-    struct Tokenized_String results;
-    memset(&results, '\0', sizeof(results));
+    if (result->next_free_pos_len >= result->allocated_pos_len)
+    {
+        const size_t new_size = (result->allocated_pos_len == 0) ?
+                TOKENIZED_STRING_INITIAL_SIZE : (result->allocated_pos_len * 2);
+
+        void* tmp_ptr = REALLOC(result->token_data, new_size * sizeof (*result->token_data));
+        ASSERT_ALLOC(tmp_ptr, "Cannot increase the memory for the tokens !", new_size * sizeof (*result->token_data));
+        result->token_data = tmp_ptr;
+        result->allocated_pos_len = new_size;
+    }
+
+    result->token_data [result->next_free_pos_len].pos = pos;
+    result->token_data [result->next_free_pos_len].len = len;
+    ++ result->next_free_pos_len;
+
+    return;
+}
 
-    if (input == NULL)                      { return results; }
-    if (IS_STRING_LENGTH_ZERO(input))       { return results; }
-    if (breakset == NULL)                   { return results; }
-    if (IS_STRING_LENGTH_ZERO(breakset))    { return results; }
+//---------------------------------------------------------------------------------------------------------------------
 
-    const char* const orig_input_ptr = input;
-    uint_fast32_t counter = 1;
+#if defined(__GNUC__) && ! defined(NO_CPU_EXTENSIONS) && (! defined(NO_AVX2) || ! defined(NO_SSE2))
+/**
+ * @brief Use the delimiter bit mask of a block: Every change between delimiters and other chars is the begin or the end
+ * of a token.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] result Tokenized_String object
+ * @param[in] delimiter_mask Bit mask of the delimiters in the block (Bit i: Is the char i a delimiter ?)
+ * @param[in] block_mask Bit mask with all bits of the block
+ * @param[in] block_position Position of the block in the string
+ * @param[in, out] token_begin Begin of the current token or -1, if the last char was a delimiter
+ */
+static inline void
+Use_Delimiter_Mask
+(
+        struct Tokenized_String* const restrict result,
+        const uint32_t delimiter_mask,
+        const uint32_t block_mask,
+        const size_t block_position,
+        ptrdiff_t* const restrict token_begin
+)
+{
+    uint32_t delimiters = delimiter_mask;
+    uint32_t other_chars = (~delimiter_mask) & block_mask;
 
-    results.token_data[0].pos = 0;
-    do
+    while (true)
     {
-        // Find one of the separators
-        input = strpbrk(input, breakset);
-        if(input != NULL)
+        if (*token_begin >= 0)
         {
-            results.token_data[counter].pos = input - orig_input_ptr;
-            results.token_data[counter - 1].len = (ptrdiff_t) (results.token_data[counter].pos - results.token_data[counter - 1].pos);
-            // Skip the separator
-            const char* before_strspn = input;
-            input += strspn(input, breakset);
-            const ptrdiff_t strspn_diff = input - before_strspn;
-            results.token_data[counter].pos += strspn_diff;
+            // The current token ends with the next delimiter
+            if (delimiters == 0) { break; }
+            const unsigned int token_end = (unsigned int) __builtin_ctz (delimiters);
+
+            Append_Token_Position (result, *token_begin, (ptrdiff_t) (block_position + token_end) - *token_begin);
+            *token_begin = -1;
+            other_chars &= ~((1u << token_end) - 1u);
         }
-        // Here a temporary empty token will be created. This is necessary. because a do-while loop must be used with
-        // strpbrk and strspn
-        counter ++;
+        else
+        {
+            // The next token begins with the next char, that is no delimiter
+            if (other_chars == 0) { break; }
+            const unsigned int next_token_begin = (unsigned int) __builtin_ctz (other_chars);
+
+            *token_begin = (ptrdiff_t) (block_position + next_token_begin);
+            delimiters &= ~((1u << next_token_begin) - 1u);
+        }
+    }
+
+    return;
+}
+#endif /* defined(__GNUC__) && ! defined(NO_CPU_EXTENSIONS) && (! defined(NO_AVX2) || ! defined(NO_SSE2)) */
+
+//---------------------------------------------------------------------------------------------------------------------
+
+#if defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS)
+/**
+ * @brief Tokenize the 32 byte blocks of a string with AVX2 instructions.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input Input string
+ * @param[in] input_length Length of the input string
+ * @param[in] breakset List of delimiters (Max. TOKENIZE_MAX_SIMD_DELIMITERS)
+ * @param[in] breakset_length Number of delimiters
+ * @param[in] result Tokenized_String object
+ * @param[in, out] token_begin Begin of the current token or -1, if the last char was a delimiter
+ *
+ * @return Number of tokenized chars (The rest is smaller than one block)
+ */
+__attribute__((target("avx2")))
+static size_t
+Tokenize_Blocks_With_AVX2
+(
+        const char* const restrict input,
+        const size_t input_length,
+        const char* const restrict breakset,
+        const size_t breakset_length,
+        struct Tokenized_String* const restrict result,
+        ptrdiff_t* const restrict token_begin
+)
+{
+    __m256i delimiters [TOKENIZE_MAX_SIMD_DELIMITERS];
+    for (size_t i = 0; i < breakset_length; ++ i)
+    {
+        delimiters [i] = _mm256_set1_epi8 (breakset [i]);                                   // <<|AVX|>>
     }
-    while(input != NULL && *input != '\0' && counter < TOKENIZED_STRING_NUM_DATASETS);
 
-    // Override the newest entry, because sometimes - especially when delimiter are at the end of the string - there
-    // will be position data in this object
-    // Technically this is not a problem, because the counter will be decreased before return; but it could
-    // misunderstandings
-    results.token_data [counter].pos = 0;
-    results.token_data [counter].len = 0;
+    size_t position = 0;
+    for (; (position + sizeof (__m256i)) <= input_length; position += sizeof (__m256i))
+    {
+        const __m256i block = _mm256_loadu_si256 ((const __m256i*) (input + position));     // <<|AVX|>>
+        __m256i cmp_result = _mm256_cmpeq_epi8 (block, delimiters [0]);                     // <<|AVX2|>>
+        for (size_t i = 1; i < breakset_length; ++ i)
+        {
+            cmp_result = _mm256_or_si256 (cmp_result, _mm256_cmpeq_epi8 (block, delimiters [i])); // <<|AVX2|>>
+        }
 
-    // The last call creates an empty token, because a do-while loop must be used with strpbrk and strspn
-    counter --;
-    results.next_free_pos_len = counter;
+        Use_Delimiter_Mask (result, (uint32_t) _mm256_movemask_epi8 (cmp_result), UINT32_MAX, position, // <<|AVX2|>>
+                token_begin);
+    }
 
-    return results;
+    return position;
 }
+#endif /* defined(__GNUC__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS) */
 
 //---------------------------------------------------------------------------------------------------------------------
+
+#if defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS)
+/**
+ * @brief Tokenize the 16 byte blocks of a string with SSE2 instructions.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input Input string
+ * @param[in] input_length Length of the input string
+ * @param[in] breakset List of delimiters (Max. TOKENIZE_MAX_SIMD_DELIMITERS)
+ * @param[in] breakset_length Number of delimiters
+ * @param[in] result Tokenized_String object
+ * @param[in, out] token_begin Begin of the current token or -1, if the last char was a delimiter
+ *
+ * @return Number of tokenized chars (The rest is smaller than one block)
+ */
+__attribute__((target("sse2")))
+static size_t
+Tokenize_Blocks_With_SSE2
+(
+        const char* const restrict input,
+        const size_t input_length,
+        const char* const restrict breakset,
+        const size_t breakset_length,
+        struct Tokenized_String* const restrict result,
+        ptrdiff_t* const restrict token_begin
+)
+{
+    __m128i delimiters [TOKENIZE_MAX_SIMD_DELIMITERS];
+    for (size_t i = 0; i < breakset_length; ++ i)
+    {
+        delimiters [i] = _mm_set1_epi8 (breakset [i]);                                      // <<|SSE2|>>
+    }
+
+    size_t position = 0;
+    for (; (position + sizeof (__m128i)) <= input_length; position += sizeof (__m128i))
+    {
+        const __m128i block = _mm_loadu_si128 ((const __m128i*) (input + position));        // <<|SSE2|>>
+        __m128i cmp_result = _mm_cmpeq_epi8 (block, delimiters [0]);                        // <<|SSE2|>>
+        for (size_t i = 1; i < breakset_length; ++ i)
+        {
+            cmp_result = _mm_or_si128 (cmp_result, _mm_cmpeq_epi8 (block, delimiters [i])); // <<|SSE2|>>
+        }
+
+        Use_Delimiter_Mask (result, (uint32_t) _mm_movemask_epi8 (cmp_result), 0xFFFFu, position,  // <<|SSE2|>>
+                token_begin);
+    }
+
+    return position;
+}
+#endif /* defined(__GNUC__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS) */
+
+//---------------------------------------------------------------------------------------------------------------------
+
+#ifdef TOKENIZED_STRING_INITIAL_SIZE
+#undef TOKENIZED_STRING_INITIAL_SIZE
+#endif /* TOKENIZED_STRING_INITIAL_SIZE */
+
+#ifdef TOKENIZE_MAX_SIMD_DELIMITERS
+#undef TOKENIZE_MAX_SIMD_DELIMITERS
+#endif /* TOKENIZE_MAX_SIMD_DELIMITERS */
@@ -362,15 +362,14 @@ Is_String_Null_Terminated
 
 //---------------------------------------------------------------------------------------------------------------------
 
-#ifndef TOKENIZED_STRING_NUM_DATASETS
-#define TOKENIZED_STRING_NUM_DATASETS 250
-#else
-#error "The macro \"TOKENIZED_STRING_NUM_DATASETS\" is already defined !"
-#endif /* TOKENIZED_STRING_NUM_DATASETS */
-
 /**
  * @brief This structure saves the main information about a tokenized c string. It saves the position as offset and the
  * length of the token.
+ *
+ * The memory for the tokens grows with the number of tokens; so there is no limit for the number of tokens in a string.
+ * An object can be reused for the next string without a new allocation. Before the first use the object needs to be
+ * zero initialized (E.g. with memset) and after the last use the memory needs to be freed with
+ * Delete_Tokenized_String().
  */
 struct Tokenized_String
 {
@@ -378,28 +377,71 @@ struct Tokenized_String
     {
         ptrdiff_t pos;                              ///< Position as offset
         ptrdiff_t len;                              ///< Length focused from the offset
-    } token_data [TOKENIZED_STRING_NUM_DATASETS];   ///< The value should be enough for our purposes
-    uint_fast32_t next_free_pos_len;                ///< Index of the next unused object
+    }* token_data;                                  ///< Position and length of the tokens
+    uint_fast32_t next_free_pos_len;                ///< Index of the next unused object (Number of tokens)
+    size_t allocated_pos_len;                       ///< Allocated number of objects
 };
 
 /**
  * @brief Tokenize a string and save the tokens in a struct with the position information as offset and the length of
  * the token focused on the offsets.
  *
- * Every delimiter is represented as one char in the c string.
+ * Every delimiter is represented as one char in the c string. A token is a non empty sequence of chars, that are no
+ * delimiters; so leading, trailing and multiple delimiters create no empty tokens.
  *
- * An error will be indicated, that the counter in the result struct for the next free data block is 0.
+ * The delimiters will be searched with the block tokenizer, that Select_Tokenize_String_Extension() selected with the
+ * CPUID results (AVX2 or SSE2). (Compare a block of chars with every delimiter and create a bit mask of the delimiter
+ * positions) The remaining chars and all chars of a breakset with more than TOKENIZE_MAX_SIMD_DELIMITERS (8) delimiters
+ * will be tokenized char by char.
+ *
+ * The tokens of a previous call will be overwritten. If the input or the breakset is NULL or empty, the result contains
+ * no tokens (result->next_free_pos_len is 0).
+ *
+ * Asserts:
+ *      result != NULL
  *
  * @param[in] input input c string
  * @param[in] breakset List of delimiters
- *
- * @return The Tokenized_String data
+ * @param[out] result Tokenized_String object, that will be (re)used for the tokens of the string
  */
-extern struct Tokenized_String
+extern void
 Tokenize_String
 (
         const char* restrict input,
-        const char* restrict breakset
+        const char* restrict breakset,
+        struct Tokenized_String* const restrict result
+);
+
+/**
+ * @brief Free the memory of a Tokenized_String object. (The object itself will not be freed)
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Tokenized_String object
+ */
+extern void
+Delete_Tokenized_String
+(
+        struct Tokenized_String* const object
+);
+
+/**
+ * @brief Select the block tokenizer of Tokenize_String() with the CPUID results: The fastest block tokenizer, that the
+ * host CPU supports, will be used.
+ *
+ * This function needs to be called before the first tokenization starts (The selection is not thread safe). Without a
+ * selection Tokenize_String() tokenizes all chars char by char.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Name of the CPU extension of the selected block tokenizer ("no", if no CPU extension can be used)
+ */
+extern const char*
+Select_Tokenize_String_Extension
+(
+        void
 );
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -11,7 +11,10 @@
 
 #include <time.h>
 #include <string.h>
+#include <stdlib.h>
 #include "../Document_Word_List.h"
+#include "../Intersection_Approaches.h"
+#include "../CLI_Parameter.h"
 #include "../Misc.h"
 #include "../Error_Handling/Assert_Msg.h"
 #include "../Error_Handling/Dynamic_Memory.h"
@@ -46,17 +49,25 @@
 #error "The macro \"NUMBER_OF_RUNS\" is already defined !"
 #endif /* NUMBER_OF_RUNS */
 
+#ifndef KERNEL_TEST_DATA_LENGTH
+#define KERNEL_TEST_DATA_LENGTH 1003 ///< Length of the data in the kernel test (Not a multiple of the register widths)
+#else
+#error "The macro \"KERNEL_TEST_DATA_LENGTH\" is already defined !"
+#endif /* KERNEL_TEST_DATA_LENGTH */
+
 // #define checks only works with C11 and higher
 #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
 _Static_assert(NUMBER_OF_ARRAYS > 0, "The macro \"NUMBER_OF_ARRAYS\" needs to be at least one !");
 _Static_assert(MAX_ARRAY_LENGTH > 0, "The macro \"MAX_ARRAY_LENGTH\" needs to be at least one !");
 _Static_assert(RAND_UPPER_BOUND > 0, "The macro \"RAND_UPPER_BOUND\" needs to be at least one !");
 _Static_assert(NUMBER_OF_RUNS > 0, "The macro \"NUMBER_OF_RUNS needs\" needs to be at least one !");
+_Static_assert(KERNEL_TEST_DATA_LENGTH > 0, "The macro \"KERNEL_TEST_DATA_LENGTH\" needs to be at least one !");
 
 IS_TYPE(NUMBER_OF_ARRAYS, int)
 IS_TYPE(MAX_ARRAY_LENGTH, int)
 IS_TYPE(RAND_UPPER_BOUND, int)
 IS_TYPE(NUMBER_OF_RUNS, int)
+IS_TYPE(KERNEL_TEST_DATA_LENGTH, int)
 #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
 
 /**
@@ -71,6 +82,20 @@ static void Use_All_Intersection_Modes
         const struct Document_Word_List* const restrict data_2
 );
 
+/**
+ * @brief Ignore function for the token signatures: Only the token 3 will be ignored.
+ *
+ * @param[in] token Mapped token
+ * @param[in] data Not used
+ *
+ * @return true, if the token is 3, otherwise false
+ */
+static _Bool Ignore_Token_Three
+(
+        const DATA_TYPE token,
+        const void* data
+);
+
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -290,6 +315,149 @@ extern _Bool TEST_Intersection_With_Random_Data_And_Specified_Result (void)
     return result;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether all intersection kernels, that the host CPU supports, find the same intersections as the kernel
+ * without CPU extensions.
+ *
+ * The order of the results is different between the kernels. Therefore the char offsets (= index in the first data
+ * array) of the results will be compared.
+ */
+extern void TEST_Intersection_Kernels (void)
+{
+    const char* kernel_names [] = { "avx2", "avx", "sse4_1", "sse2", "mmx" };
+
+    DATA_TYPE data_1 [KERNEL_TEST_DATA_LENGTH];
+    DATA_TYPE data_2 [KERNEL_TEST_DATA_LENGTH / 2];
+    CHAR_OFFSET_TYPE char_offsets [KERNEL_TEST_DATA_LENGTH];
+    SENTENCE_OFFSET_TYPE sentence_offsets [KERNEL_TEST_DATA_LENGTH];
+    WORD_OFFSET_TYPE word_offsets [KERNEL_TEST_DATA_LENGTH];
+
+    // Many duplicates in both arrays to check the multiple guards
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(data_1); ++ i)
+    {
+        data_1 [i] = (DATA_TYPE) (rand() % (RAND_UPPER_BOUND * 10));
+        char_offsets [i] = (CHAR_OFFSET_TYPE) i;
+        sentence_offsets [i] = 0;
+        word_offsets [i] = (WORD_OFFSET_TYPE) i;
+    }
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(data_2); ++ i)
+    {
+        data_2 [i] = (DATA_TYPE) (rand() % (RAND_UPPER_BOUND * 10));
+    }
+
+    struct Document_Word_List* reference_result = DocumentWordList_CreateObjectAsIntersectionResult(1, 10);
+    struct Document_Word_List* kernel_result = DocumentWordList_CreateObjectAsIntersectionResult(1, 10);
+    // Too small guards: The stamps need to be increased in the first call and reused in all following calls
+    struct Intersection_Guards* guards = IntersectionApproach_CreateGuards(1, 1);
+
+    ASSERT_EQUALS(true, IntersectionApproach_SelectKernel("none"));
+    IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays(reference_result, guards, data_1, char_offsets, sentence_offsets,
+            word_offsets, COUNT_ARRAY_ELEMENTS(data_1), data_2, COUNT_ARRAY_ELEMENTS(data_2));
+
+    _Bool in_reference_result [KERNEL_TEST_DATA_LENGTH];
+    memset(in_reference_result, '\0', sizeof (in_reference_result));
+    for (size_t i = 0; i < reference_result->arrays_lengths [0]; ++ i)
+    {
+        in_reference_result [reference_result->data_struct.char_offsets [0][i]] = true;
+    }
+
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(kernel_names); ++ i)
+    {
+        // Skip kernels, that the host CPU does not support
+        if (! IntersectionApproach_SelectKernel(kernel_names [i])) { continue; }
+        printf("Kernel: %s\n", kernel_names [i]);
+
+        IntersectionApproach_TwoNestedLoopsWithTwoRawDataArrays(kernel_result, guards, data_1, char_offsets, sentence_offsets,
+                word_offsets, COUNT_ARRAY_ELEMENTS(data_1), data_2, COUNT_ARRAY_ELEMENTS(data_2));
+
+        ASSERT_EQUALS(reference_result->arrays_lengths [0], kernel_result->arrays_lengths [0]);
+        for (size_t i2 = 0; i2 < kernel_result->arrays_lengths [0]; ++ i2)
+        {
+            ASSERT_EQUALS(true, in_reference_result [kernel_result->data_struct.char_offsets [0][i2]]);
+        }
+    }
+
+    DocumentWordList_DeleteObject(reference_result);
+    reference_result = NULL;
+    DocumentWordList_DeleteObject(kernel_result);
+    kernel_result = NULL;
+    IntersectionApproach_DeleteGuards(guards);
+    guards = NULL;
+
+    // Restore the kernel selection of the CLI parameter
+    ASSERT_EQUALS(true, IntersectionApproach_SelectKernel(GLOBAL_CLI_KERNEL));
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether the token signatures never reject two data sets with a common token.
+ *
+ * Additionally the ignore function will be checked: Data sets, that have only ignored tokens in common, need to be
+ * rejected.
+ */
+extern void TEST_Token_Signatures (void)
+{
+    struct Document_Word_List* data_sets = DocumentWordList_CreateObject(NUMBER_OF_ARRAYS, 10);
+    DATA_TYPE data [RAND_UPPER_BOUND];
+
+    for (size_t i = 0; i < NUMBER_OF_ARRAYS; ++ i)
+    {
+        for (size_t i2 = 0; i2 < COUNT_ARRAY_ELEMENTS(data); ++ i2)
+        {
+            data [i2] = (DATA_TYPE) (rand() % (RAND_UPPER_BOUND * 100));
+        }
+        DocumentWordList_AppendData(data_sets, data, COUNT_ARRAY_ELEMENTS(data));
+    }
+    DocumentWordList_CreateSignatures(data_sets, NULL, NULL);
+
+    for (uint_fast32_t i = 0; i < data_sets->next_free_array; ++ i)
+    {
+        for (uint_fast32_t i2 = 0; i2 < data_sets->next_free_array; ++ i2)
+        {
+            _Bool common_token = false;
+            for (size_t d1 = 0; d1 < data_sets->arrays_lengths [i] && ! common_token; ++ d1)
+            {
+                for (size_t d2 = 0; d2 < data_sets->arrays_lengths [i2]; ++ d2)
+                {
+                    if (data_sets->data_struct.data [i][d1] == data_sets->data_struct.data [i2][d2])
+                    {
+                        common_token = true;
+                        break;
+                    }
+                }
+            }
+            if (common_token)
+            {
+                ASSERT_EQUALS(true, DocumentWordList_SignaturesIntersect(data_sets, i, data_sets, i2));
+            }
+        }
+    }
+    DocumentWordList_DeleteObject(data_sets);
+    data_sets = NULL;
+
+    // Only the ignored token is a common token
+    const DATA_TYPE data_1 [] = { 1, 2, 3 };
+    const DATA_TYPE data_2 [] = { 3, 3 };
+    data_sets = DocumentWordList_CreateObject(2, 10);
+    DocumentWordList_AppendData(data_sets, data_1, COUNT_ARRAY_ELEMENTS(data_1));
+    DocumentWordList_AppendData(data_sets, data_2, COUNT_ARRAY_ELEMENTS(data_2));
+
+    DocumentWordList_CreateSignatures(data_sets, NULL, NULL);
+    ASSERT_EQUALS(true, DocumentWordList_SignaturesIntersect(data_sets, 0, data_sets, 1));
+    DocumentWordList_CreateSignatures(data_sets, Ignore_Token_Three, NULL);
+    ASSERT_EQUALS(false, DocumentWordList_SignaturesIntersect(data_sets, 0, data_sets, 1));
+
+    DocumentWordList_DeleteObject(data_sets);
+    data_sets = NULL;
+
+    return;
+}
+
 //=====================================================================================================================
 
 /**
@@ -351,6 +519,27 @@ static void Use_All_Intersection_Modes
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Ignore function for the token signatures: Only the token 3 will be ignored.
+ *
+ * @param[in] token Mapped token
+ * @param[in] data Not used
+ *
+ * @return true, if the token is 3, otherwise false
+ */
+static _Bool Ignore_Token_Three
+(
+        const DATA_TYPE token,
+        const void* data
+)
+{
+    UNUSED(data);
+
+    return token == 3;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 #ifdef NUMBER_OF_ARRAYS
 #undef NUMBER_OF_ARRAYS
 #endif /* NUMBER_OF_ARRAYS */
@@ -366,3 +555,7 @@ static void Use_All_Intersection_Modes
 #ifdef NUMBER_OF_RUNS
 #undef NUMBER_OF_RUNS
 #endif /* NUMBER_OF_RUNS */
+
+#ifdef KERNEL_TEST_DATA_LENGTH
+#undef KERNEL_TEST_DATA_LENGTH
+#endif /* KERNEL_TEST_DATA_LENGTH */
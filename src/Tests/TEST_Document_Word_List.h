@@ -41,6 +41,17 @@ extern _Bool TEST_Intersection_With_Random_Data (void);
  */
 extern _Bool TEST_Intersection_With_Random_Data_And_Specified_Result (void);
 
+/**
+ * @brief Check, whether all intersection kernels, that the host CPU supports, find the same intersections as the kernel
+ * without CPU extensions.
+ */
+extern void TEST_Intersection_Kernels (void);
+
+/**
+ * @brief Check, whether the token signatures never reject two data sets with a common token.
+ */
+extern void TEST_Token_Signatures (void);
+
 
 
 #ifdef __cplusplus
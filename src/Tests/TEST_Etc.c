@@ -18,6 +18,17 @@
 #include "../Error_Handling/Dynamic_Memory.h"
 #include "../ANSI_Esc_Seq.h"
 #include "../String_Tools.h"
+#include "../Token_Int_Mapping.h"
+#include "../Stop_Words/Stop_Words.h"
+#include "../Misc.h"
+
+
+
+#ifndef TEST_SNAPSHOT_FILE
+#define TEST_SNAPSHOT_FILE "./test_vocab.snapshot" ///< Temporary vocabulary snapshot file
+#else
+#error "The macro \"TEST_SNAPSHOT_FILE\" is already defined !"
+#endif /* TEST_SNAPSHOT_FILE */
 
 
 
@@ -89,7 +100,9 @@ extern void TEST_Tokenize_String (void)
 
     _Bool test_results = true;
 
-    struct Tokenized_String tokenized_string = Tokenize_String (test_str, delimiter);
+    struct Tokenized_String tokenized_string;
+    memset (&tokenized_string, '\0', sizeof (struct Tokenized_String));
+    Tokenize_String (test_str, delimiter, &tokenized_string);
     ASSERT_EQUALS(sizeof (expected_results) / sizeof (expected_results [0]), tokenized_string.next_free_pos_len);
 
     for (size_t i = 0; i < (sizeof (expected_results) / sizeof (expected_results [0])); ++ i)
@@ -111,6 +124,71 @@ extern void TEST_Tokenize_String (void)
         }
     }
     ASSERT_EQUALS(true, test_results);
+    Delete_Tokenized_String (&tokenized_string);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test the tokenization of a string with more tokens than the initial size of the Tokenized_String object.
+ * Tokens and runs of delimiters with different lengths cross the block borders of the SIMD search. The object will be
+ * reused for a second string.
+ */
+extern void TEST_Tokenize_Long_String (void)
+{
+    const char* const delimiter = " \t,";
+    const size_t number_of_tokens = 1000;
+    char test_str [1000 * (40 + 3) + 3 + 1];
+    ptrdiff_t expected_pos [1000];
+    ptrdiff_t expected_len [1000];
+
+    // Leading delimiters, then tokens with 1 - 40 chars and 1 - 3 delimiters after every token
+    size_t next_char = 0;
+    test_str [next_char ++] = '\t';
+    test_str [next_char ++] = ' ';
+    for (size_t i = 0; i < number_of_tokens; ++ i)
+    {
+        expected_pos [i] = (ptrdiff_t) next_char;
+        expected_len [i] = (ptrdiff_t) ((i * 7) % 40 + 1);
+        for (ptrdiff_t i2 = 0; i2 < expected_len [i]; ++ i2)
+        {
+            test_str [next_char ++] = (char) ('a' + (i + (size_t) i2) % 26);
+        }
+        for (size_t i2 = 0; i2 < (i % 3) + 1; ++ i2)
+        {
+            test_str [next_char ++] = delimiter [(i + i2) % 3];
+        }
+    }
+    test_str [next_char] = '\0';
+
+    struct Tokenized_String tokenized_string;
+    memset (&tokenized_string, '\0', sizeof (struct Tokenized_String));
+    Tokenize_String (test_str, delimiter, &tokenized_string);
+
+    ASSERT_EQUALS(number_of_tokens, tokenized_string.next_free_pos_len);
+    _Bool test_results = true;
+    for (size_t i = 0; i < number_of_tokens; ++ i)
+    {
+        if (tokenized_string.token_data [i].pos != expected_pos [i] ||
+                tokenized_string.token_data [i].len != expected_len [i])
+        {
+            printf ("Token %zu: Expected (%td, %td); Got: (%td, %td)\n", i, expected_pos [i], expected_len [i],
+                    tokenized_string.token_data [i].pos, tokenized_string.token_data [i].len);
+            test_results = false;
+            break;
+        }
+    }
+    ASSERT_EQUALS(true, test_results);
+
+    // Reuse the object: A string without delimiter at the end
+    Tokenize_String ("reused object", delimiter, &tokenized_string);
+    ASSERT_EQUALS(2, tokenized_string.next_free_pos_len);
+    ASSERT_EQUALS(7, tokenized_string.token_data [1].pos);
+    ASSERT_EQUALS(6, tokenized_string.token_data [1].len);
+
+    Delete_Tokenized_String (&tokenized_string);
 
     return;
 }
@@ -366,3 +444,435 @@ extern void TEST_Any_Print (void)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test, whether the stop word flags of the Token_Int_Mapping are equal with the results of the stop word list.
+ *
+ * So many tokens will be added, that the memory of the mapping needs to be increased.
+ */
+extern void TEST_Token_Int_Mapping_Stop_Word_Flags (void)
+{
+    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObject();
+    char token [MAX_TOKEN_LENGTH];
+
+    // Every stop word and a few thousand tokens, that are no stop words
+    for (size_t i = 0; GLOBAL_eng_stop_words [i] != NULL; ++ i)
+    {
+        TokenIntMapping_AddToken(token_int_mapping, GLOBAL_eng_stop_words [i], strlen (GLOBAL_eng_stop_words [i]));
+    }
+    for (size_t i = 0; i < 25000; ++ i)
+    {
+        snprintf(token, sizeof (token), "token_%zu", i);
+        TokenIntMapping_AddToken(token_int_mapping, token, strlen (token));
+    }
+
+    for (DATA_TYPE token_int_value = 0; token_int_value < token_int_mapping->number_of_tokens; ++ token_int_value)
+    {
+        const char* int_to_token_mem = TokenIntMapping_IntToTokenPtr(token_int_mapping, token_int_value);
+
+        ASSERT_EQUALS(Is_Word_In_Stop_Word_List(int_to_token_mem, strlen (int_to_token_mem), ENG),
+                TokenIntMapping_IsStopWord(token_int_mapping, token_int_value));
+    }
+    ASSERT_EQUALS(true, TokenIntMapping_IsStopWord(token_int_mapping,
+            TokenIntMapping_TokenToInt(token_int_mapping, GLOBAL_eng_stop_words [0], strlen (GLOBAL_eng_stop_words [0]))));
+    ASSERT_EQUALS(false, TokenIntMapping_IsStopWord(token_int_mapping,
+            TokenIntMapping_TokenToInt(token_int_mapping, "token_42", strlen ("token_42"))));
+
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test the hash table of the Token_Int_Mapping: Round trip token -> int -> token after multiple growing steps.
+ */
+extern void TEST_Token_Int_Mapping_Hash_Table (void)
+{
+    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObjectWithCaseSensitivity(false);
+    char token [MAX_TOKEN_LENGTH];
+
+    // Enough tokens for multiple growing steps of the hash table
+    for (size_t i = 0; i < 25000; ++ i)
+    {
+        snprintf(token, sizeof (token), "Token_%zu", i);
+        ASSERT_EQUALS(true, TokenIntMapping_AddToken(token_int_mapping, token, strlen (token)));
+    }
+    ASSERT_EQUALS(25000, token_int_mapping->number_of_tokens);
+
+    // No duplicates; also not with a different char case
+    for (size_t i = 0; i < 25000; ++ i)
+    {
+        snprintf(token, sizeof (token), "TOKEN_%zu", i);
+        ASSERT_EQUALS(false, TokenIntMapping_AddToken(token_int_mapping, token, strlen (token)));
+
+        const DATA_TYPE token_int_value = TokenIntMapping_TokenToInt(token_int_mapping, token, strlen (token));
+        ASSERT("Token not found", token_int_value != DATA_TYPE_MAX);
+        // Dense mapped integers in the order of the insertion
+        ASSERT_EQUALS(i, token_int_value);
+
+        snprintf(token, sizeof (token), "Token_%zu", i);
+        ASSERT_STRING_EQUALS(token, TokenIntMapping_IntToTokenPtr(token_int_mapping, token_int_value));
+    }
+    ASSERT_EQUALS(25000, token_int_mapping->number_of_tokens);
+
+    // Prefixes of existing tokens are not in the mapping
+    ASSERT_EQUALS(DATA_TYPE_MAX, TokenIntMapping_TokenToInt(token_int_mapping, "Token_", strlen ("Token_")));
+    ASSERT_EQUALS(DATA_TYPE_MAX, TokenIntMapping_TokenToInt(token_int_mapping, "Token_25000", strlen ("Token_25000")));
+
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test the intern operation of the Token_Int_Mapping: Known tokens get their existing integer; new tokens get the
+ * next free integer.
+ */
+extern void TEST_Token_Int_Mapping_Intern (void)
+{
+    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObjectWithCaseSensitivity(false);
+    char token [MAX_TOKEN_LENGTH];
+
+    // Every token two times: The second call must not create a new token
+    for (size_t i = 0; i < 25000; ++ i)
+    {
+        snprintf(token, sizeof (token), "Token_%zu", i);
+        ASSERT_EQUALS(i, TokenIntMapping_Intern(token_int_mapping, token, strlen (token)));
+        snprintf(token, sizeof (token), "TOKEN_%zu", i);
+        ASSERT_EQUALS(i, TokenIntMapping_Intern(token_int_mapping, token, strlen (token)));
+    }
+    ASSERT_EQUALS(25000, token_int_mapping->number_of_tokens);
+    ASSERT_EQUALS(50000, token_int_mapping->add_token_calls);
+
+    // Intern and the lookup return the same integer
+    for (size_t i = 0; i < 25000; i += 1000)
+    {
+        snprintf(token, sizeof (token), "token_%zu", i);
+        ASSERT_EQUALS(TokenIntMapping_TokenToInt(token_int_mapping, token, strlen (token)),
+                TokenIntMapping_Intern(token_int_mapping, token, strlen (token)));
+    }
+    ASSERT_EQUALS(false, TokenIntMapping_AddToken(token_int_mapping, "Token_0", strlen ("Token_0")));
+    ASSERT_EQUALS(25000, TokenIntMapping_Intern(token_int_mapping, "Token_25000", strlen ("Token_25000")));
+    ASSERT_EQUALS(25001, token_int_mapping->number_of_tokens);
+
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test the case-insensitive mode of the Token_Int_Mapping with ASCII and non-ASCII (UTF-8) tokens.
+ *
+ * The reverse mapping needs to return the token in the spelling of the first insertion.
+ */
+extern void TEST_Token_Int_Mapping_Case_Folding (void)
+{
+    struct Token_Int_Mapping* case_insensitive = TokenIntMapping_CreateObjectWithCaseSensitivity(false);
+    struct Token_Int_Mapping* case_sensitive = TokenIntMapping_CreateObject();
+    const char* const tokens [][2] =
+    {
+            { "BRCA1", "brca1" },
+            { "\u0391\u03bb\u03c6\u03b1-Synuclein", "\u03b1\u039b\u03a6\u0391-SYNUCLEIN" },   // Greek letters
+            { "\u00c4rger", "\u00e4RGER" },                                               // Latin-1
+            { "\u0411\u0435\u043b\u043e\u043a", "\u0431\u0415\u041b\u041e\u041a" }          // Cyrillic
+    };
+    char long_token [2][512];
+
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(tokens); ++ i)
+    {
+        const DATA_TYPE token_int_value = TokenIntMapping_Intern(case_insensitive, tokens [i][0], strlen (tokens [i][0]));
+        ASSERT_EQUALS(token_int_value, TokenIntMapping_Intern(case_insensitive, tokens [i][1], strlen (tokens [i][1])));
+        ASSERT_STRING_EQUALS(tokens [i][0], TokenIntMapping_IntToTokenPtr(case_insensitive, token_int_value));
+
+        ASSERT_EQUALS(false, TokenIntMapping_Intern(case_sensitive, tokens [i][0], strlen (tokens [i][0])) ==
+                TokenIntMapping_Intern(case_sensitive, tokens [i][1], strlen (tokens [i][1])));
+    }
+    ASSERT_EQUALS(COUNT_ARRAY_ELEMENTS(tokens), case_insensitive->number_of_tokens);
+    ASSERT_EQUALS(COUNT_ARRAY_ELEMENTS(tokens) * 2, case_sensitive->number_of_tokens);
+
+    // Keys, that are longer than the stack buffer for the keys
+    memset(long_token [0], 'a', sizeof (long_token [0]) - 1);
+    memset(long_token [1], 'A', sizeof (long_token [1]) - 1);
+    long_token [0][sizeof (long_token [0]) - 1] = '\0';
+    long_token [1][sizeof (long_token [1]) - 1] = '\0';
+    ASSERT_EQUALS(TokenIntMapping_Intern(case_insensitive, long_token [0], strlen (long_token [0])),
+            TokenIntMapping_TokenToInt(case_insensitive, long_token [1], strlen (long_token [1])));
+
+    TokenIntMapping_DeleteObject(case_insensitive);
+    case_insensitive = NULL;
+    TokenIntMapping_DeleteObject(case_sensitive);
+    case_sensitive = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test the merge of chunk local Token_Int_Mappings: The merged mapping needs to be equal with a mapping, that
+ * was created directly with all tokens.
+ */
+extern void TEST_Token_Int_Mapping_Merge (void)
+{
+    struct Token_Int_Mapping* direct_mapping = TokenIntMapping_CreateObjectWithCaseSensitivity(false);
+    struct Token_Int_Mapping* merged_mapping = TokenIntMapping_CreateObjectWithCaseSensitivity(false);
+    struct Token_Int_Mapping* local_mappings [3] = { NULL, NULL, NULL };
+    DATA_TYPE local_token_int_values [3][10000];
+    DATA_TYPE remap_table [10000];
+    char token [MAX_TOKEN_LENGTH];
+
+    // Three chunks with overlapping tokens (and different char cases)
+    for (size_t c = 0; c < COUNT_ARRAY_ELEMENTS(local_mappings); ++ c)
+    {
+        local_mappings [c] = TokenIntMapping_CreateObjectWithCaseSensitivity(false);
+
+        for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(local_token_int_values [c]); ++ i)
+        {
+            snprintf(token, sizeof (token), (i % 2 == 0) ? "Token_%zu" : "TOKEN_%zu", (c * 5000 + i) % 12000);
+            local_token_int_values [c][i] = TokenIntMapping_Intern(local_mappings [c], token, strlen (token));
+            TokenIntMapping_Intern(direct_mapping, token, strlen (token));
+        }
+    }
+
+    // Merge in the order of the chunks
+    for (size_t c = 0; c < COUNT_ARRAY_ELEMENTS(local_mappings); ++ c)
+    {
+        TokenIntMapping_Merge(merged_mapping, local_mappings [c], remap_table);
+
+        for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(local_token_int_values [c]); ++ i)
+        {
+            snprintf(token, sizeof (token), (i % 2 == 0) ? "Token_%zu" : "TOKEN_%zu", (c * 5000 + i) % 12000);
+            ASSERT_EQUALS(TokenIntMapping_TokenToInt(direct_mapping, token, strlen (token)),
+                    remap_table [local_token_int_values [c][i]]);
+        }
+    }
+
+    ASSERT_EQUALS(direct_mapping->number_of_tokens, merged_mapping->number_of_tokens);
+    for (DATA_TYPE token_int_value = 0; token_int_value < direct_mapping->number_of_tokens; ++ token_int_value)
+    {
+        ASSERT_STRING_EQUALS(TokenIntMapping_IntToTokenPtr(direct_mapping, token_int_value),
+                TokenIntMapping_IntToTokenPtr(merged_mapping, token_int_value));
+        ASSERT_EQUALS(TokenIntMapping_IsStopWord(direct_mapping, token_int_value),
+                TokenIntMapping_IsStopWord(merged_mapping, token_int_value));
+    }
+
+    for (size_t c = 0; c < COUNT_ARRAY_ELEMENTS(local_mappings); ++ c)
+    {
+        TokenIntMapping_DeleteObject(local_mappings [c]);
+        local_mappings [c] = NULL;
+    }
+    TokenIntMapping_DeleteObject(direct_mapping);
+    direct_mapping = NULL;
+    TokenIntMapping_DeleteObject(merged_mapping);
+    merged_mapping = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test the renumbering of the Token_Int_Mapping by the token frequencies: The most frequent tokens need to get
+ * the smallest integers and every token needs to be found with the new integer.
+ */
+extern void TEST_Token_Int_Mapping_Frequency_Ids (void)
+{
+    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObjectWithCaseSensitivity(false);
+    size_t frequencies [5000];
+    DATA_TYPE remap_table [5000];
+    char token [MAX_TOKEN_LENGTH];
+
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(frequencies); ++ i)
+    {
+        snprintf(token, sizeof (token), "Token_%zu", i);
+        ASSERT_EQUALS(i, TokenIntMapping_Intern(token_int_mapping, token, strlen (token)));
+        // Many tokens with the same frequency; their relative order needs to be unchanged
+        frequencies [i] = i % 7;
+    }
+
+    TokenIntMapping_RenumberByFrequency(token_int_mapping, frequencies, remap_table);
+    ASSERT_EQUALS(COUNT_ARRAY_ELEMENTS(frequencies), token_int_mapping->number_of_tokens);
+
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(frequencies); ++ i)
+    {
+        snprintf(token, sizeof (token), "Token_%zu", i);
+        ASSERT_STRING_EQUALS(token, TokenIntMapping_IntToTokenPtr(token_int_mapping, remap_table [i]));
+        snprintf(token, sizeof (token), "TOKEN_%zu", i);
+        ASSERT_EQUALS(remap_table [i], TokenIntMapping_TokenToInt(token_int_mapping, token, strlen (token)));
+
+        // Compare with the next old integer with the same frequency
+        if (i + 7 < COUNT_ARRAY_ELEMENTS(frequencies))
+        {
+            ASSERT_EQUALS(true, remap_table [i] < remap_table [i + 7]);
+        }
+        // Compare with the next old integer (always an other frequency)
+        if (i + 1 < COUNT_ARRAY_ELEMENTS(frequencies))
+        {
+            ASSERT_EQUALS(frequencies [i] > frequencies [i + 1], remap_table [i] < remap_table [i + 1]);
+        }
+    }
+    // The most frequent token with the smallest old integer
+    ASSERT_EQUALS(0, remap_table [6]);
+
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test the vocabulary snapshot of the Token_Int_Mapping: A loaded snapshot needs to contain the same mapping and
+ * new tokens need to be added in the overlay.
+ */
+extern void TEST_Token_Int_Mapping_Snapshot (void)
+{
+    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObjectWithCaseSensitivity(false);
+    char token [MAX_TOKEN_LENGTH];
+
+    for (size_t i = 0; i < 3000; ++ i)
+    {
+        snprintf(token, sizeof (token), "Token_%zu", i);
+        TokenIntMapping_Intern(token_int_mapping, token, strlen (token));
+    }
+    TokenIntMapping_Intern(token_int_mapping, "the", strlen ("the"));
+    TokenIntMapping_SaveSnapshot(token_int_mapping, TEST_SNAPSHOT_FILE);
+
+    struct Token_Int_Mapping* loaded_mapping = TokenIntMapping_CreateObjectFromSnapshot(TEST_SNAPSHOT_FILE);
+    ASSERT_EQUALS(token_int_mapping->number_of_tokens, loaded_mapping->number_of_tokens);
+    ASSERT_EQUALS(false, loaded_mapping->case_sensitive);
+    for (DATA_TYPE token_int_value = 0; token_int_value < token_int_mapping->number_of_tokens; ++ token_int_value)
+    {
+        ASSERT_STRING_EQUALS(TokenIntMapping_IntToTokenPtr(token_int_mapping, token_int_value),
+                TokenIntMapping_IntToTokenPtr(loaded_mapping, token_int_value));
+        ASSERT_EQUALS(TokenIntMapping_IsStopWord(token_int_mapping, token_int_value),
+                TokenIntMapping_IsStopWord(loaded_mapping, token_int_value));
+    }
+    ASSERT_EQUALS(true, TokenIntMapping_IsStopWord(loaded_mapping, TokenIntMapping_TokenToInt(loaded_mapping, "THE",
+            strlen ("THE"))));
+
+    // The first intern in this run determines the spelling and the stop word flag of a snapshot token (Same as
+    // without a snapshot); a lookup or a later intern does not
+    struct Token_Int_Mapping* fresh_mapping = TokenIntMapping_CreateObjectWithCaseSensitivity(false);
+    const DATA_TYPE fresh_the = TokenIntMapping_Intern(fresh_mapping, "The", strlen ("The"));
+    const DATA_TYPE loaded_the = TokenIntMapping_Intern(loaded_mapping, "The", strlen ("The"));
+    TokenIntMapping_Intern(loaded_mapping, "THE", strlen ("THE"));
+    ASSERT_EQUALS(3000, loaded_the);
+    ASSERT_STRING_EQUALS("The", TokenIntMapping_IntToTokenPtr(loaded_mapping, loaded_the));
+    ASSERT_EQUALS(TokenIntMapping_IsStopWord(fresh_mapping, fresh_the),
+            TokenIntMapping_IsStopWord(loaded_mapping, loaded_the));
+    TokenIntMapping_DeleteObject(fresh_mapping);
+    fresh_mapping = NULL;
+
+    // Known tokens keep their integer; new tokens (enough for a growth of all arrays) will be added in the overlay
+    for (size_t i = 0; i < 6000; ++ i)
+    {
+        snprintf(token, sizeof (token), "TOKEN_%zu", i);
+        const DATA_TYPE expected = (i < 3000) ? (DATA_TYPE) i : (DATA_TYPE) (i + 1);
+        ASSERT_EQUALS(expected, TokenIntMapping_Intern(loaded_mapping, token, strlen (token)));
+    }
+    for (size_t i = 0; i < 6000; ++ i)
+    {
+        snprintf(token, sizeof (token), "Token_%zu", i);
+        const DATA_TYPE expected = (i < 3000) ? (DATA_TYPE) i : (DATA_TYPE) (i + 1);
+        ASSERT_EQUALS(expected, TokenIntMapping_TokenToInt(loaded_mapping, token, strlen (token)));
+        // The reverse mapping returns the first spelling of this run
+        snprintf(token, sizeof (token), "TOKEN_%zu", i);
+        ASSERT_STRING_EQUALS(token, TokenIntMapping_IntToTokenPtr(loaded_mapping, expected));
+    }
+
+    // A snapshot of the snapshot with the overlay
+    TokenIntMapping_SaveSnapshot(loaded_mapping, TEST_SNAPSHOT_FILE);
+    struct Token_Int_Mapping* reloaded_mapping = TokenIntMapping_CreateObjectFromSnapshot(TEST_SNAPSHOT_FILE);
+    ASSERT_EQUALS(loaded_mapping->number_of_tokens, reloaded_mapping->number_of_tokens);
+    for (DATA_TYPE token_int_value = 0; token_int_value < loaded_mapping->number_of_tokens; ++ token_int_value)
+    {
+        ASSERT_STRING_EQUALS(TokenIntMapping_IntToTokenPtr(loaded_mapping, token_int_value),
+                TokenIntMapping_IntToTokenPtr(reloaded_mapping, token_int_value));
+    }
+
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+    TokenIntMapping_DeleteObject(loaded_mapping);
+    loaded_mapping = NULL;
+    TokenIntMapping_DeleteObject(reloaded_mapping);
+    reloaded_mapping = NULL;
+    remove(TEST_SNAPSHOT_FILE);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test the statistics of a Token_Int_Mapping: Counted calls, hit rates, load factor and the probe length
+ * histogram.
+ */
+extern void TEST_Token_Int_Mapping_Statistics (void)
+{
+    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObject();
+    token_int_mapping->measure_time = true;
+    char token [MAX_TOKEN_LENGTH];
+
+    // 1000 new tokens and 1000 known tokens
+    for (size_t i = 0; i < 2000; ++ i)
+    {
+        snprintf(token, sizeof (token), "token_%zu", i % 1000);
+        TokenIntMapping_Intern(token_int_mapping, token, strlen (token));
+    }
+    // 3 known and 1 unknown token
+    TokenIntMapping_CountedTokenToInt(token_int_mapping, "token_0", strlen ("token_0"));
+    TokenIntMapping_CountedTokenToInt(token_int_mapping, "token_1", strlen ("token_1"));
+    TokenIntMapping_CountedTokenToInt(token_int_mapping, "token_999", strlen ("token_999"));
+    TokenIntMapping_CountedTokenToInt(token_int_mapping, "token_1000", strlen ("token_1000"));
+    // The read-only lookup will not be counted
+    TokenIntMapping_TokenToInt(token_int_mapping, "token_2", strlen ("token_2"));
+
+    struct Token_Int_Mapping_Statistics statistics;
+    TokenIntMapping_GetStatistics(token_int_mapping, &statistics);
+
+    ASSERT_EQUALS(1000, statistics.number_of_tokens);
+    ASSERT_EQUALS(token_int_mapping->number_of_slots, statistics.number_of_slots);
+    ASSERT_EQUALS(true, statistics.load_factor > 0.0 && statistics.load_factor <= 0.5);
+    ASSERT_EQUALS(2000, statistics.intern_calls);
+    ASSERT_EQUALS(1000, statistics.intern_hits);
+    ASSERT_EQUALS(true, statistics.intern_hit_rate > 0.49 && statistics.intern_hit_rate < 0.51);
+    ASSERT_EQUALS(4, statistics.lookup_calls);
+    ASSERT_EQUALS(3, statistics.lookup_hits);
+    ASSERT_EQUALS(true, statistics.lookup_hit_rate > 0.74 && statistics.lookup_hit_rate < 0.76);
+    ASSERT_EQUALS(true, statistics.time_measured);
+    ASSERT_EQUALS(true, statistics.intern_seconds > 0.0);
+    ASSERT_EQUALS(true, statistics.bytes_per_token > 0.0);
+
+    // Every saved token is in exact one bucket of the histogram
+    size_t tokens_in_histogram = 0;
+    for (size_t i = 0; i < PROBE_LENGTH_HISTOGRAM_SIZE; ++ i)
+    {
+        tokens_in_histogram += statistics.probe_length_histogram [i];
+    }
+    ASSERT_EQUALS(1000, tokens_in_histogram);
+    ASSERT_EQUALS(true, statistics.max_probe_length >= 1 && statistics.avg_probe_length >= 1.0);
+
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+
+
+#ifdef TEST_SNAPSHOT_FILE
+#undef TEST_SNAPSHOT_FILE
+#endif /* TEST_SNAPSHOT_FILE */
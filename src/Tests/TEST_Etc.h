@@ -38,11 +38,57 @@ extern void TEST_ANSI_Esc_Seq (void);
  */
 extern void TEST_Tokenize_String (void);
 
+/**
+ * @brief Test the tokenization of a string with more tokens than the initial size of the Tokenized_String object.
+ */
+extern void TEST_Tokenize_Long_String (void);
+
 /**
  * @brief Test the Any_Print function. If a C11 compiler is given, the additional ANY_PRINT macro will be also tested.
  */
 extern void TEST_Any_Print (void);
 
+/**
+ * @brief Test, whether the stop word flags of the Token_Int_Mapping are equal with the results of the stop word list.
+ */
+extern void TEST_Token_Int_Mapping_Stop_Word_Flags (void);
+
+/**
+ * @brief Test the hash table of the Token_Int_Mapping: Round trip token -> int -> token after multiple growing steps.
+ */
+extern void TEST_Token_Int_Mapping_Hash_Table (void);
+
+/**
+ * @brief Test the intern operation of the Token_Int_Mapping: Known tokens get their existing integer.
+ */
+extern void TEST_Token_Int_Mapping_Intern (void);
+
+/**
+ * @brief Test the case-insensitive mode of the Token_Int_Mapping with ASCII and non-ASCII (UTF-8) tokens.
+ */
+extern void TEST_Token_Int_Mapping_Case_Folding (void);
+
+/**
+ * @brief Test the merge of chunk local Token_Int_Mappings: The merged mapping needs to be equal with a mapping, that
+ * was created directly with all tokens.
+ */
+extern void TEST_Token_Int_Mapping_Merge (void);
+
+/**
+ * @brief Test the renumbering of the Token_Int_Mapping by the token frequencies.
+ */
+extern void TEST_Token_Int_Mapping_Frequency_Ids (void);
+
+/**
+ * @brief Test the save and the load of a vocabulary snapshot of the Token_Int_Mapping.
+ */
+extern void TEST_Token_Int_Mapping_Snapshot (void);
+
+/**
+ * @brief Test the statistics of the Token_Int_Mapping (Counted calls, hit rates and the probe length histogram).
+ */
+extern void TEST_Token_Int_Mapping_Statistics (void);
+
 
 
 #ifdef __cplusplus
@@ -25,6 +25,7 @@
 #include "../Defines.h"
 #include "md5.h"
 #include "../Print_Tools.h"
+#include "../Misc.h"
 
 
 
@@ -58,6 +59,18 @@
 #error "The macro \"JSON_CHECK_FILE\" is already defined !"
 #endif /* JSON_CHECK_FILE */
 
+#ifndef NO_STRING_TOKENS_FILE_1
+#define NO_STRING_TOKENS_FILE_1 "./test_no_string_tokens_1.json" ///< Temporary first file with tokens without strings
+#else
+#error "The macro \"NO_STRING_TOKENS_FILE_1\" is already defined !"
+#endif /* NO_STRING_TOKENS_FILE_1 */
+
+#ifndef NO_STRING_TOKENS_FILE_2
+#define NO_STRING_TOKENS_FILE_2 "./test_no_string_tokens_2.json" ///< Temporary second file with tokens without strings
+#else
+#error "The macro \"NO_STRING_TOKENS_FILE_2\" is already defined !"
+#endif /* NO_STRING_TOKENS_FILE_2 */
+
 #ifndef TEST_EBM_FILE_MD5
 #define TEST_EBM_FILE_MD5 "d1205477fc08c6e278d905edfdd537fb"
 #else
@@ -93,6 +106,8 @@ _Static_assert(sizeof(FILE_1) > 0 + 1, "The macro \"FILE_1\" needs at least one
 _Static_assert(sizeof(FILE_2) > 0 + 1, "The macro \"FILE_2\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(FILE_CSV) > 0 + 1, "The macro \"FILE_CSV\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(OUT_FILE) > 0 + 1, "The macro \"OUT_FILE\" needs at least one char (plus '\0') !");
+_Static_assert(sizeof(NO_STRING_TOKENS_FILE_1) > 0 + 1, "The macro \"NO_STRING_TOKENS_FILE_1\" needs at least one char (plus '\0') !");
+_Static_assert(sizeof(NO_STRING_TOKENS_FILE_2) > 0 + 1, "The macro \"NO_STRING_TOKENS_FILE_2\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(TEST_EBM_FILE_MD5) > 0 + 1, "The macro \"TEST_EBM_FILE_MD5\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(INTERVENTION_10MB_FILE_MD5) > 0 + 1, "The macro \"INTERVENTION_10MB_FILE_MD5\" needs at least one char (plus '\0') !");
 _Static_assert(sizeof(GENE_OR_GENOME_FILE_MD5) > 0 + 1, "The macro \"GENE_OR_GENOME_FILE_MD5\" needs at least one char (plus '\0') !");
@@ -103,6 +118,8 @@ IS_CONST_STR(FILE_1)
 IS_CONST_STR(FILE_2)
 IS_CONST_STR(FILE_CSV)
 IS_CONST_STR(OUT_FILE)
+IS_CONST_STR(NO_STRING_TOKENS_FILE_1)
+IS_CONST_STR(NO_STRING_TOKENS_FILE_2)
 IS_CONST_STR(TEST_EBM_FILE_MD5)
 IS_CONST_STR(INTERVENTION_10MB_FILE_MD5)
 IS_CONST_STR(GENE_OR_GENOME_FILE_MD5)
@@ -156,6 +173,26 @@ IS_TYPE(EXPECTED_COUNT_INTERSECTIONS_SETS, int)
 #error "The macro \"EXTENSION_TEST\" is already defined !"
 #endif /* EXTENSION_TEST */
 
+/**
+ * @brief Run the intersection with two values of a CLI parameter and compare the MD5 sums of the two result files.
+ *
+ * The creation time will not be saved in the result files, so equal results create equal files. After the call the
+ * CLI parameter has the second value.
+ *
+ * @param[in] cli_parameter CLI parameter, that will be changed between the two runs
+ * @param[in] value_1 Value of the CLI parameter in the first run
+ * @param[in] value_2 Value of the CLI parameter in the second run
+ *
+ * @return true, if both result files have the same MD5 sum, otherwise false
+ */
+static _Bool
+Same_Result_Files_With_Two_Values
+(
+        int* const cli_parameter,
+        const int value_1,
+        const int value_2
+);
+
 
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -591,6 +628,275 @@ extern void TEST_Case_Insensitive_Comparison (void)
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Test, whether every intersection engine produces the same result file as its reference calculation.
+ *
+ * Every engine will be tested with the default and with switched input files (and results with only one token).
+ * The engines create the results in the order of the selected kernel; so the test works with every kernel.
+ */
+extern void TEST_Engine_Equivalence (void)
+{
+    struct Engine_Equivalence_Case
+    {
+        const char* engine_name;            ///< Name of the engine for the output
+        int* engine_cli_parameter;          ///< CLI parameter, that switches the engine on in the second run
+        _Bool inverted_index_reference;     ///< Is the inverted index used in both runs ? (Otherwise the nested loops)
+    };
+
+    // In the sorted merge test both calculations use the inverted index to find the candidates, because the test is
+    // otherwise very slow. So only the intersection of two data sets differs
+    const struct Engine_Equivalence_Case engine_cases [] =
+    {
+            { "inverted index", &GLOBAL_CLI_INVERTED_INDEX, false },
+            { "sorted merge",   &GLOBAL_CLI_SORTED_MERGE,   true  },
+            { "doc-major",      &GLOBAL_CLI_DOC_MAJOR,      false }
+    };
+    const char* const input_files [][2] = { { FILE_1, FILE_CSV }, { FILE_CSV, FILE_1 } };
+
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(engine_cases); ++ i)
+    {
+        const struct Engine_Equivalence_Case* const engine_case = &(engine_cases [i]);
+
+        for (size_t i2 = 0; i2 < COUNT_ARRAY_ELEMENTS(input_files); ++ i2)
+        {
+            Set_CLI_Parameter_To_Default_Values();
+
+            GLOBAL_CLI_INPUT_FILE = input_files [i2][0];
+            GLOBAL_CLI_INPUT_FILE2 = input_files [i2][1];
+            GLOBAL_CLI_OUTPUT_FILE = OUT_FILE;
+            GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN = (i2 > 0);
+            GLOBAL_CLI_INVERTED_INDEX = engine_case->inverted_index_reference;
+
+            printf("Check the %s engine with the input files \"%s\" and \"%s\"\n", engine_case->engine_name,
+                    input_files [i2][0], input_files [i2][1]);
+            ASSERT_EQUALS(true, Same_Result_Files_With_Two_Values(engine_case->engine_cli_parameter, false, true));
+        }
+    }
+
+    Set_CLI_Parameter_To_Default_Values();
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test, whether the multi threaded calculation produces the same result file as the single threaded
+ * calculation.
+ *
+ * The inverted index will be used, because the test is otherwise very slow.
+ */
+extern void TEST_Multithreaded_Calculation (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    /* Test with default input and output files */
+    GLOBAL_CLI_INPUT_FILE = FILE_1;
+    GLOBAL_CLI_INPUT_FILE2 = FILE_CSV;
+    GLOBAL_CLI_OUTPUT_FILE = OUT_FILE;
+    GLOBAL_CLI_INVERTED_INDEX = true;
+
+    ASSERT_EQUALS(true, Same_Result_Files_With_Two_Values(&GLOBAL_CLI_THREADS, 1, 4));
+
+    Set_CLI_Parameter_To_Default_Values();
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test, whether the full match determination (rarest token first) produces the same result file as the doc-major
+ * mode, that determines the full matches with the complete intersection of every candidate.
+ *
+ * The result files will be compared with their MD5 sums. The test will be done with and without results with only one
+ * token.
+ */
+extern void TEST_Full_Match_Engine (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    GLOBAL_CLI_INPUT_FILE = FILE_1;
+    GLOBAL_CLI_INPUT_FILE2 = FILE_CSV;
+    GLOBAL_CLI_OUTPUT_FILE = OUT_FILE;
+    GLOBAL_CLI_NO_PART_MATCHES = true;
+
+    const _Bool keep_results_with_one_token [] = { false, true };
+
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(keep_results_with_one_token); ++ i)
+    {
+        GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN = keep_results_with_one_token [i];
+
+        // Reference: The doc-major mode calculates the full intersection of every candidate
+        ASSERT_EQUALS(true, Same_Result_Files_With_Two_Values(&GLOBAL_CLI_DOC_MAJOR, true, false));
+    }
+
+    Set_CLI_Parameter_To_Default_Values();
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test the numbers of found tokens and sets, that Exec_Intersection() returns with --no_part_matches.
+ *
+ * The full match determination (rarest token first) only intersects the full match candidates. So its numbers exclude
+ * the partial matches. The doc-major mode intersects every candidate and returns the same numbers as without
+ * --no_part_matches. The expected numbers of the full matches are the numbers of the test files.
+ */
+extern void TEST_Full_Match_Engine_Counters (void)
+{
+    Set_CLI_Parameter_To_Default_Values();
+
+    uint_fast64_t number_of_intersection_sets_all = 0;
+    uint_fast64_t number_of_intersection_tokens_all = 0;
+
+    uint_fast64_t number_of_intersection_sets_doc_major = 0;
+    uint_fast64_t number_of_intersection_tokens_doc_major = 0;
+
+    uint_fast64_t number_of_intersection_sets_full_match = 0;
+    uint_fast64_t number_of_intersection_tokens_full_match = 0;
+
+    GLOBAL_CLI_INPUT_FILE = FILE_1;
+    GLOBAL_CLI_INPUT_FILE2 = FILE_CSV;
+    GLOBAL_CLI_OUTPUT_FILE = OUT_FILE;
+
+    // Reference: Partial and full matches
+    GLOBAL_CLI_INVERTED_INDEX = true;
+    Exec_Intersection(NAN, &number_of_intersection_tokens_all, &number_of_intersection_sets_all);
+    GLOBAL_CLI_INVERTED_INDEX = false;
+
+    GLOBAL_CLI_NO_PART_MATCHES = true;
+    GLOBAL_CLI_DOC_MAJOR = true;
+    Exec_Intersection(NAN, &number_of_intersection_tokens_doc_major, &number_of_intersection_sets_doc_major);
+
+    GLOBAL_CLI_DOC_MAJOR = false;
+    Exec_Intersection(NAN, &number_of_intersection_tokens_full_match, &number_of_intersection_sets_full_match);
+
+    ASSERT_EQUALS(number_of_intersection_sets_all, number_of_intersection_sets_doc_major);
+    ASSERT_EQUALS(number_of_intersection_tokens_all, number_of_intersection_tokens_doc_major);
+    ASSERT_EQUALS(110, number_of_intersection_sets_full_match);
+    ASSERT_EQUALS(246, number_of_intersection_tokens_full_match);
+    ASSERT("The full match determination does not exclude the partial matches !",
+            number_of_intersection_sets_full_match < number_of_intersection_sets_all);
+
+    Set_CLI_Parameter_To_Default_Values();
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Test the intersection with data sets, whose tokens arrays contain no strings (in both files).
+ *
+ * Such data sets have no tokens. Every engine needs to process the other data sets and return the same numbers.
+ */
+extern void TEST_Data_Sets_Without_String_Tokens (void)
+{
+    FILE* json_file = fopen(NO_STRING_TOKENS_FILE_1, "w");
+    ASSERT_FMSG(json_file != NULL, "Cannot create the test file \"%s\" !", NO_STRING_TOKENS_FILE_1);
+    fputs("{\"a\": {\"tokens\": [1]}, \"b\": {\"tokens\": [\"alpha\", \"beta\", \"gamma\"]}, "
+            "\"c\": {\"tokens\": [2, 3]}, \"d\": {\"tokens\": [\"beta\", \"delta\"]}}\n", json_file);
+    fclose(json_file);
+    json_file = NULL;
+
+    json_file = fopen(NO_STRING_TOKENS_FILE_2, "w");
+    ASSERT_FMSG(json_file != NULL, "Cannot create the test file \"%s\" !", NO_STRING_TOKENS_FILE_2);
+    fputs("{\"e\": {\"tokens\": [1]}, \"q\": {\"tokens\": [\"alpha\", \"beta\"]}, "
+            "\"r\": {\"tokens\": [\"delta\", \"gamma\", \"beta\"]}}\n", json_file);
+    fclose(json_file);
+    json_file = NULL;
+
+    // NULL: Without an engine parameter
+    int* const engine_cli_parameters [] =
+    {
+            NULL, &GLOBAL_CLI_INVERTED_INDEX, &GLOBAL_CLI_SORTED_MERGE, &GLOBAL_CLI_DOC_MAJOR,
+            &GLOBAL_CLI_NO_PART_MATCHES
+    };
+
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(engine_cli_parameters); ++ i)
+    {
+        uint_fast64_t number_of_intersection_sets = 0;
+        uint_fast64_t number_of_intersection_tokens = 0;
+
+        Set_CLI_Parameter_To_Default_Values();
+
+        GLOBAL_CLI_INPUT_FILE = NO_STRING_TOKENS_FILE_1;
+        GLOBAL_CLI_INPUT_FILE2 = NO_STRING_TOKENS_FILE_2;
+        GLOBAL_CLI_OUTPUT_FILE = OUT_FILE;
+        if (engine_cli_parameters [i] != NULL) { *(engine_cli_parameters [i]) = true; }
+
+        Exec_Intersection(NAN, &number_of_intersection_tokens, &number_of_intersection_sets);
+
+        // q and b: Full match; r with b and with d: Partial matches
+        const _Bool full_matches_only = (engine_cli_parameters [i] == &GLOBAL_CLI_NO_PART_MATCHES);
+        ASSERT_EQUALS((full_matches_only) ? 1 : 3, number_of_intersection_sets);
+        ASSERT_EQUALS((full_matches_only) ? 2 : 6, number_of_intersection_tokens);
+    }
+
+    Set_CLI_Parameter_To_Default_Values();
+    remove(NO_STRING_TOKENS_FILE_1);
+    remove(NO_STRING_TOKENS_FILE_2);
+
+    return;
+}
+
+//=====================================================================================================================
+
+/**
+ * @brief Run the intersection with two values of a CLI parameter and compare the MD5 sums of the two result files.
+ *
+ * The creation time will not be saved in the result files, so equal results create equal files. After the call the
+ * CLI parameter has the second value.
+ *
+ * @param[in] cli_parameter CLI parameter, that will be changed between the two runs
+ * @param[in] value_1 Value of the CLI parameter in the first run
+ * @param[in] value_2 Value of the CLI parameter in the second run
+ *
+ * @return true, if both result files have the same MD5 sum, otherwise false
+ */
+static _Bool
+Same_Result_Files_With_Two_Values
+(
+        int* const cli_parameter,
+        const int value_1,
+        const int value_2
+)
+{
+    uint_fast64_t number_of_intersection_sets = 0;
+    uint_fast64_t number_of_intersection_tokens = 0;
+    uint8_t* md5_sums [2] = { NULL, NULL };
+    const int values [2] = { value_1, value_2 };
+
+    GLOBAL_CLI_NO_TIMESTAMP = true;
+
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(values); ++ i)
+    {
+        *cli_parameter = values [i];
+        Exec_Intersection(NAN, &number_of_intersection_tokens, &number_of_intersection_sets);
+
+        FILE* result_file = fopen(OUT_FILE, "rb");
+        ASSERT_MSG(result_file != NULL, "Cannot open the result file !");
+        md5_sums [i] = md5File(result_file);
+        ASSERT_MSG(md5_sums [i] != NULL, "Cannot create the MD5 sum of the result file !");
+        fclose(result_file);
+        result_file = NULL;
+    }
+
+    const _Bool same_md5_sums = memcmp(md5_sums [0], md5_sums [1], MD5_SUM_LENGTH) == 0;
+
+    free(md5_sums [0]);
+    md5_sums [0] = NULL;
+    free(md5_sums [1]);
+    md5_sums [1] = NULL;
+
+    return same_md5_sums;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 
 
 #ifdef FILE_1
@@ -613,6 +919,14 @@ extern void TEST_Case_Insensitive_Comparison (void)
 #undef JSON_CHECK_FILE
 #endif /* JSON_CHECK_FILE */
 
+#ifdef NO_STRING_TOKENS_FILE_1
+#undef NO_STRING_TOKENS_FILE_1
+#endif /* NO_STRING_TOKENS_FILE_1 */
+
+#ifdef NO_STRING_TOKENS_FILE_2
+#undef NO_STRING_TOKENS_FILE_2
+#endif /* NO_STRING_TOKENS_FILE_2 */
+
 #ifdef TEST_EBM_FILE_MD5
 #undef TEST_EBM_FILE_MD5
 #endif /* TEST_EBM_FILE_MD5 */
@@ -158,6 +158,40 @@ extern void TEST_Is_Output_File_JSON_Compatible (void);
  */
 extern void TEST_Case_Insensitive_Comparison (void);
 
+/**
+ * @brief Test, whether every intersection engine (inverted index, sorted merge and doc-major) produces the same result
+ * file as its reference calculation.
+ *
+ * The test will be done with the default and with switched input files. Skipped cases will be printed.
+ */
+extern void TEST_Engine_Equivalence (void);
+
+/**
+ * @brief Test, whether the multi threaded calculation produces the same number of tokens and sets as the single
+ * threaded calculation.
+ */
+extern void TEST_Multithreaded_Calculation (void);
+
+/**
+ * @brief Test, whether the full match determination (rarest token first) produces the same result file as the doc-major
+ * mode.
+ *
+ * The test will be done with and without results with only one token.
+ */
+extern void TEST_Full_Match_Engine (void);
+
+/**
+ * @brief Test the numbers of found tokens and sets, that Exec_Intersection() returns with --no_part_matches.
+ *
+ * The full match determination only counts the full matches; the doc-major mode counts also the partial matches.
+ */
+extern void TEST_Full_Match_Engine_Counters (void);
+
+/**
+ * @brief Test the intersection with data sets, whose tokens arrays contain no strings.
+ */
+extern void TEST_Data_Sets_Without_String_Tokens (void);
+
 
 
 #ifdef __cplusplus
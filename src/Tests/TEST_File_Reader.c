@@ -11,8 +11,11 @@
 
 #include <stdbool.h>
 #include <ctype.h>
+#include <string.h>
 #include "../Misc.h"
+#include "../Print_Tools.h"
 #include "../File_Reader.h"
+#include "../Token_Int_Mapping.h"
 #include "md5.h"
 #include "../Error_Handling/Dynamic_Memory.h"
 #include "../Error_Handling/Assert_Msg.h"
@@ -36,6 +39,24 @@
 #error "The macro \"TEST_FILE_READER_TEST_FILE_MD5\" is already defined !"
 #endif /* TEST_FILE_READER_TEST_FILE_MD5 */
 
+#ifndef TEST_FILE_READER_LONG_TOKEN_FILE
+#define TEST_FILE_READER_LONG_TOKEN_FILE "./src/Tests/Test_Data/Gene_or_Genome.csv" ///< Test file with very long tokens
+#else
+#error "The macro \"TEST_FILE_READER_LONG_TOKEN_FILE\" is already defined !"
+#endif /* TEST_FILE_READER_LONG_TOKEN_FILE */
+
+#ifndef TEST_FILE_READER_LINES_FILE
+#define TEST_FILE_READER_LINES_FILE "./test_file_reader_lines.txt" ///< Temporary text file for the line reading checks
+#else
+#error "The macro \"TEST_FILE_READER_LINES_FILE\" is already defined !"
+#endif /* TEST_FILE_READER_LINES_FILE */
+
+#ifndef TEST_FILE_READER_JSON_FILE
+#define TEST_FILE_READER_JSON_FILE "./test_file_reader_fragments.json" ///< Temporary JSON file for the parser checks
+#else
+#error "The macro \"TEST_FILE_READER_JSON_FILE\" is already defined !"
+#endif /* TEST_FILE_READER_JSON_FILE */
+
 #ifndef NUMBER_OF_TOKENARRAYS
 #define NUMBER_OF_TOKENARRAYS 191 ///< Expected number of token arrays
 #else
@@ -60,10 +81,13 @@ _Static_assert(NUMBER_OF_TOKENARRAYS > 0, "The macro \"NUMBER_OF_TOKENARRAYS\" n
 _Static_assert(MAX_DATASET_ID_LENGTH > 0, "The macro \"MAX_DATASET_ID_LENGTH\" needs to be at least one !");
 _Static_assert(MAX_TOKENARRAY_LENGTH > 0, "The macro \"MAX_TOKENARRAY_LENGTH\" need to be at least one !");
 _Static_assert(sizeof(TEST_FILE_READER_TEST_FILE) > 0 + 1, "The macro \"TEST_FILE_READER_TEST_FILE\" is empty !");
+_Static_assert(sizeof(TEST_FILE_READER_LONG_TOKEN_FILE) > 0 + 1,
+        "The macro \"TEST_FILE_READER_LONG_TOKEN_FILE\" is empty !");
 _Static_assert(sizeof(TEST_FILE_READER_TEST_FILE_MD5) == 32 + 1,
         "The macro \"TEST_FILE_READER_TEST_FILE_MD5\" needs to be exact 32 char (+ '\0') !");
 
 IS_CONST_STR(TEST_FILE_READER_TEST_FILE)
+IS_CONST_STR(TEST_FILE_READER_LONG_TOKEN_FILE)
 IS_CONST_STR(TEST_FILE_READER_TEST_FILE_MD5)
 IS_TYPE(NUMBER_OF_TOKENARRAYS, int)
 IS_TYPE(MAX_DATASET_ID_LENGTH, int)
@@ -160,14 +184,429 @@ extern void TEST_Length_Of_The_First_25_Tokenarrays (void)
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Check, whether tokens, that are longer than MAX_TOKEN_LENGTH, are saved without truncation.
+ *
+ * The test file contains chemical names with more than 63 chars. Additionally every saved token length needs to be
+ * equal with the length of the token in the token memory.
+ */
+extern void TEST_Token_Memory_Without_Truncation (void)
+{
+    struct Token_List_Container* token_container = TokenListContainer_CreateObject (TEST_FILE_READER_LONG_TOKEN_FILE);
+    size_t sum_token_memory = 0;
+
+    for (uint_fast32_t i = 0; i < token_container->next_free_element; ++ i)
+    {
+        for (uint_fast32_t i2 = 0; i2 < token_container->token_lists [i].next_free_element; ++ i2)
+        {
+            const size_t token_length = TokenListContainer_GetTokenLength(token_container, i, i2);
+
+            ASSERT_EQUALS(strlen (TokenListContainer_GetToken(token_container, i, i2)), token_length);
+            sum_token_memory += token_length + 1;
+        }
+    }
+    ASSERT_EQUALS(token_container->token_memory_used, sum_token_memory);
+    ASSERT_EQUALS(true, TokenListContainer_GetLenghOfLongestToken(token_container) > MAX_TOKEN_LENGTH - 1);
+    ASSERT_EQUALS(true, token_container->list_of_long_tokens->next_free_c_str > 0);
+
+    TokenListContainer_DeleteObject(token_container);
+    token_container = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check the line reading with a text file: An empty line will be skipped (but counted), a line longer than the
+ * initial line buffer will be read completely and the last line needs no '\n'.
+ */
+extern void TEST_Read_Lines_Of_Text_File (void)
+{
+    FILE* lines_file = fopen (TEST_FILE_READER_LINES_FILE, "w");
+    ASSERT_FMSG(lines_file != NULL, "Cannot create the test file \"%s\" !", TEST_FILE_READER_LINES_FILE);
+    fputs ("alpha beta\n\ngamma delta epsilon\n", lines_file);
+    // 200 tokens with 31 chars: Longer than the initial line buffer
+    for (size_t i = 0; i < 200; ++ i)
+    {
+        fprintf (lines_file, "%s%.*s_%03zu", (i > 0) ? " " : "", 27, "long_token_long_token_long_token", i);
+    }
+    FCLOSE_AND_SET_TO_NULL(lines_file);
+
+    struct Token_List_Container* token_container = TokenListContainer_CreateObject (TEST_FILE_READER_LINES_FILE);
+
+    ASSERT_EQUALS(3, token_container->next_free_element);
+    ASSERT_EQUALS(2, token_container->token_lists [0].next_free_element);
+    ASSERT_EQUALS(3, token_container->token_lists [1].next_free_element);
+    ASSERT_EQUALS(200, token_container->token_lists [2].next_free_element);
+    ASSERT_STRING_EQUALS("Line 1", token_container->token_lists [0].dataset_id);
+    ASSERT_STRING_EQUALS("Line 3", token_container->token_lists [1].dataset_id);
+    ASSERT_STRING_EQUALS("Line 4", token_container->token_lists [2].dataset_id);
+    ASSERT_STRING_EQUALS("epsilon", TokenListContainer_GetToken(token_container, 1, 2));
+    ASSERT_STRING_EQUALS("long_token_long_token_long__199", TokenListContainer_GetToken(token_container, 2, 199));
+
+    TokenListContainer_DeleteObject(token_container);
+    token_container = NULL;
+    remove (TEST_FILE_READER_LINES_FILE);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether an empty line and a line with only white spaces create no dataset. The following datasets
+ * need the IDs of their own lines (Also with the parallel loading and the direct-to-id ingestion).
+ */
+extern void TEST_Skip_Text_Lines_Without_Tokens (void)
+{
+    FILE* lines_file = fopen (TEST_FILE_READER_LINES_FILE, "w");
+    ASSERT_FMSG(lines_file != NULL, "Cannot create the test file \"%s\" !", TEST_FILE_READER_LINES_FILE);
+    fputs ("alpha beta\n\n   \t \ngamma\ndelta epsilon\n", lines_file);
+    FCLOSE_AND_SET_TO_NULL(lines_file);
+
+    struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObject ();
+    struct Token_List_Container* token_containers [] =
+    {
+            TokenListContainer_CreateObject (TEST_FILE_READER_LINES_FILE),
+            TokenListContainer_CreateObjectParallel (TEST_FILE_READER_LINES_FILE, 4),
+            TokenListContainer_CreateObjectWithMapping (TEST_FILE_READER_LINES_FILE, 4, token_int_mapping)
+    };
+
+    for (size_t i = 0; i < COUNT_ARRAY_ELEMENTS(token_containers); ++ i)
+    {
+        ASSERT_EQUALS(3, token_containers [i]->next_free_element);
+        ASSERT_STRING_EQUALS("Line 1", token_containers [i]->token_lists [0].dataset_id);
+        ASSERT_STRING_EQUALS("Line 4", token_containers [i]->token_lists [1].dataset_id);
+        ASSERT_STRING_EQUALS("Line 5", token_containers [i]->token_lists [2].dataset_id);
+        ASSERT_EQUALS(2, token_containers [i]->token_lists [0].next_free_element);
+        ASSERT_EQUALS(1, token_containers [i]->token_lists [1].next_free_element);
+        ASSERT_EQUALS(2, token_containers [i]->token_lists [2].next_free_element);
+
+        TokenListContainer_DeleteObject(token_containers [i]);
+        token_containers [i] = NULL;
+    }
+    TokenIntMapping_DeleteObject(token_int_mapping);
+    token_int_mapping = NULL;
+    remove (TEST_FILE_READER_LINES_FILE);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check the JSON parser with escape sequences, non string tokens, tokens arrays without strings, char offsets
+ * after the tokens (and as object) and a malformed fragment, that needs to be rolled back completely.
+ */
+extern void TEST_Parse_JSON_Fragments (void)
+{
+    FILE* json_file = fopen (TEST_FILE_READER_JSON_FILE, "w");
+    ASSERT_FMSG(json_file != NULL, "Cannot create the test file \"%s\" !", TEST_FILE_READER_JSON_FILE);
+    fputs ("{\"1\": {\"abs_char_offsets\": [0, 10, 20], \"tokens\": [\"a\\u00e4b\", 5, \"c\\\"d\", \"e\\/f\"]}, "
+            "\"2\": {\"tokens\": []}, \"7\": {\"tokens\": [1]}, "
+            "\"3\": {\"text\": \"x y\", \"tokens\": [\"x\", \"y\"]}}\n", json_file);
+    // Invalid surrogate in the second dataset: The first dataset will be rolled back, too
+    fputs ("{\"4\": {\"tokens\": [\"lost\", \"tokens\"]}, \"5\": {\"tokens\": [\"\\udc00\"]}}\n", json_file);
+    fputs ("{\"6\": {\"tokens\": [\"after\\u0000cut\", \"\\ud83d\\ude00\"], \"abs_char_offsets\": {\"a\": 3, \"b\": 7}}}",
+            json_file);
+    FCLOSE_AND_SET_TO_NULL(json_file);
+
+    struct Token_List_Container* token_container = TokenListContainer_CreateObject (TEST_FILE_READER_JSON_FILE);
+
+    ASSERT_EQUALS(3, token_container->next_free_element);
+    ASSERT_STRING_EQUALS("1", token_container->token_lists [0].dataset_id);
+    ASSERT_STRING_EQUALS("3", token_container->token_lists [1].dataset_id);
+    ASSERT_STRING_EQUALS("6", token_container->token_lists [2].dataset_id);
+
+    ASSERT_EQUALS(3, token_container->token_lists [0].next_free_element);
+    ASSERT_STRING_EQUALS("a\xC3\xA4" "b", TokenListContainer_GetToken(token_container, 0, 0));
+    ASSERT_STRING_EQUALS("c\"d", TokenListContainer_GetToken(token_container, 0, 1));
+    ASSERT_STRING_EQUALS("e/f", TokenListContainer_GetToken(token_container, 0, 2));
+    ASSERT_EQUALS(10, token_container->token_lists [0].char_offsets [1]);
+    ASSERT_EQUALS(20, token_container->token_lists [0].char_offsets [2]);
+
+    ASSERT_EQUALS(2, token_container->token_lists [1].next_free_element);
+    ASSERT_EQUALS(2, token_container->token_lists [1].char_offsets [1]);
+
+    ASSERT_EQUALS(2, token_container->token_lists [2].next_free_element);
+    ASSERT_STRING_EQUALS("after", TokenListContainer_GetToken(token_container, 2, 0));
+    ASSERT_STRING_EQUALS("\xF0\x9F\x98\x80", TokenListContainer_GetToken(token_container, 2, 1));
+    ASSERT_EQUALS(7, token_container->token_lists [2].char_offsets [1]);
+
+    // The longest token of the rolled back fragment ("tokens") is not relevant
+    ASSERT_EQUALS(5, TokenListContainer_GetLenghOfLongestToken(token_container));
+
+    TokenListContainer_DeleteObject(token_container);
+    token_container = NULL;
+    remove (TEST_FILE_READER_JSON_FILE);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether the parallel loading creates the same containers like the serial loading. The JSON test file
+ * contains one large top level object (split between its members) and the text test file many lines (split between
+ * the lines).
+ */
+extern void TEST_Parallel_File_Loading (void)
+{
+    const char* const test_files [] = { TEST_FILE_READER_TEST_FILE, TEST_FILE_READER_LONG_TOKEN_FILE };
+
+    for (size_t f = 0; f < COUNT_ARRAY_ELEMENTS(test_files); ++ f)
+    {
+        struct Token_List_Container* serial_container = TokenListContainer_CreateObject (test_files [f]);
+        struct Token_List_Container* parallel_container = TokenListContainer_CreateObjectParallel (test_files [f], 4);
+
+        ASSERT_EQUALS(serial_container->next_free_element, parallel_container->next_free_element);
+        ASSERT_EQUALS(serial_container->token_memory_used, parallel_container->token_memory_used);
+        ASSERT_EQUALS(serial_container->longest_token_length, parallel_container->longest_token_length);
+        ASSERT_EQUALS(serial_container->list_of_long_tokens->next_free_c_str,
+                parallel_container->list_of_long_tokens->next_free_c_str);
+
+        for (uint_fast32_t i = 0; i < serial_container->next_free_element; ++ i)
+        {
+            const struct Token_List* const serial_list = &(serial_container->token_lists [i]);
+            const struct Token_List* const parallel_list = &(parallel_container->token_lists [i]);
+
+            ASSERT_STRING_EQUALS(serial_list->dataset_id, parallel_list->dataset_id);
+            ASSERT_EQUALS(serial_list->next_free_element, parallel_list->next_free_element);
+
+            for (uint_fast32_t i2 = 0; i2 < serial_list->next_free_element; ++ i2)
+            {
+                ASSERT_STRING_EQUALS(TokenListContainer_GetToken(serial_container, i, i2),
+                        TokenListContainer_GetToken(parallel_container, i, i2));
+                ASSERT_EQUALS(serial_list->char_offsets [i2], parallel_list->char_offsets [i2]);
+                ASSERT_EQUALS(serial_list->sentence_offsets [i2], parallel_list->sentence_offsets [i2]);
+                ASSERT_EQUALS(serial_list->word_offsets [i2], parallel_list->word_offsets [i2]);
+            }
+        }
+
+        TokenListContainer_DeleteObject(serial_container);
+        serial_container = NULL;
+        TokenListContainer_DeleteObject(parallel_container);
+        parallel_container = NULL;
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check the parallel loading of a JSON object, whose data sets contain nested objects and strings with
+ * braces and commas. The chunks may only be split between the top level members of the object.
+ */
+extern void TEST_Parallel_Loading_Of_Nested_JSON_Objects (void)
+{
+    // One line with more than two chunks (The nested members look like a member boundary on a flat scan)
+    FILE* json_file = fopen (TEST_FILE_READER_JSON_FILE, "w");
+    ASSERT_FMSG(json_file != NULL, "Cannot create the test file \"%s\" !", TEST_FILE_READER_JSON_FILE);
+    fputc ('{', json_file);
+    for (size_t i = 0; i < 2500; ++ i)
+    {
+        fprintf (json_file, "%s\"%zu\": {\"meta\": {\"source\": {\"name\": \"x}, \\\"y\\\": {\"}, "
+                "\"extra\": {\"depth\": [1, {\"k\": 2}]}}, \"tokens\": [\"alpha_%zu\", \"beta\", \"gamma_%zu\"]}",
+                (i > 0) ? ", " : "", i, i, i % 17);
+    }
+    fputs ("}\n", json_file);
+    fclose (json_file);
+    json_file = NULL;
+
+    struct Token_List_Container* serial_container = TokenListContainer_CreateObject (TEST_FILE_READER_JSON_FILE);
+    struct Token_List_Container* parallel_container =
+            TokenListContainer_CreateObjectParallel (TEST_FILE_READER_JSON_FILE, 4);
+
+    // No fall back to the parsing with one thread
+    ASSERT_FMSG(parallel_container->parsed_chunks >= 2, "The JSON object was parsed in %zu chunks !",
+            parallel_container->parsed_chunks);
+    ASSERT_EQUALS(2500, serial_container->next_free_element);
+    ASSERT_EQUALS(serial_container->next_free_element, parallel_container->next_free_element);
+    ASSERT_EQUALS(serial_container->token_memory_used, parallel_container->token_memory_used);
+
+    for (uint_fast32_t i = 0; i < serial_container->next_free_element; ++ i)
+    {
+        const struct Token_List* const serial_list = &(serial_container->token_lists [i]);
+        const struct Token_List* const parallel_list = &(parallel_container->token_lists [i]);
+
+        ASSERT_STRING_EQUALS(serial_list->dataset_id, parallel_list->dataset_id);
+        ASSERT_EQUALS(3, parallel_list->next_free_element);
+        ASSERT_EQUALS(serial_list->next_free_element, parallel_list->next_free_element);
+
+        for (uint_fast32_t i2 = 0; i2 < serial_list->next_free_element; ++ i2)
+        {
+            ASSERT_STRING_EQUALS(TokenListContainer_GetToken(serial_container, i, i2),
+                    TokenListContainer_GetToken(parallel_container, i, i2));
+        }
+    }
+
+    TokenListContainer_DeleteObject(serial_container);
+    serial_container = NULL;
+    TokenListContainer_DeleteObject(parallel_container);
+    parallel_container = NULL;
+    remove (TEST_FILE_READER_JSON_FILE);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check, whether the direct-to-id ingestion creates the same mapped integers and offsets like the interning of
+ * a normal container.
+ */
+extern void TEST_Direct_To_Id_Ingestion (void)
+{
+    const char* const test_files [] = { TEST_FILE_READER_TEST_FILE, TEST_FILE_READER_LONG_TOKEN_FILE };
+    const size_t thread_counts [] = { 1, 4 };
+
+    for (size_t f = 0; f < COUNT_ARRAY_ELEMENTS(test_files); ++ f)
+    {
+        // Reference: Intern the tokens of a normal container one after the other
+        struct Token_List_Container* token_container = TokenListContainer_CreateObject (test_files [f]);
+        struct Token_Int_Mapping* reference_mapping = TokenIntMapping_CreateObject ();
+        for (uint_fast32_t i = 0; i < token_container->next_free_element; ++ i)
+        {
+            for (uint_fast32_t i2 = 0; i2 < token_container->token_lists [i].next_free_element; ++ i2)
+            {
+                (void) TokenIntMapping_Intern(reference_mapping, TokenListContainer_GetToken(token_container, i, i2),
+                        TokenListContainer_GetTokenLength(token_container, i, i2));
+            }
+        }
+
+        for (size_t t = 0; t < COUNT_ARRAY_ELEMENTS(thread_counts); ++ t)
+        {
+            struct Token_Int_Mapping* token_int_mapping = TokenIntMapping_CreateObject ();
+            struct Token_List_Container* mapped_container =
+                    TokenListContainer_CreateObjectWithMapping (test_files [f], thread_counts [t], token_int_mapping);
+
+            // The chars of the tokens are only in the mapping
+            ASSERT_EQUALS(0, mapped_container->token_memory_used);
+            ASSERT_EQUALS(reference_mapping->number_of_tokens, token_int_mapping->number_of_tokens);
+            ASSERT_EQUALS(token_container->next_free_element, mapped_container->next_free_element);
+            ASSERT_EQUALS(token_container->list_of_long_tokens->next_free_c_str,
+                    mapped_container->list_of_long_tokens->next_free_c_str);
+
+            for (uint_fast32_t i = 0; i < token_container->next_free_element; ++ i)
+            {
+                const struct Token_List* const token_list = &(token_container->token_lists [i]);
+                const struct Token_List* const mapped_list = &(mapped_container->token_lists [i]);
+
+                ASSERT_STRING_EQUALS(token_list->dataset_id, mapped_list->dataset_id);
+                ASSERT_EQUALS(token_list->next_free_element, mapped_list->next_free_element);
+
+                for (uint_fast32_t i2 = 0; i2 < token_list->next_free_element; ++ i2)
+                {
+                    const char* const token = TokenListContainer_GetToken(token_container, i, i2);
+                    ASSERT_EQUALS(TokenIntMapping_TokenToInt(reference_mapping, token, strlen (token)),
+                            TokenListContainer_GetTokenIntValue(mapped_container, i, i2));
+                    ASSERT_EQUALS(token_list->char_offsets [i2], mapped_list->char_offsets [i2]);
+                    ASSERT_EQUALS(token_list->sentence_offsets [i2], mapped_list->sentence_offsets [i2]);
+                    ASSERT_EQUALS(token_list->word_offsets [i2], mapped_list->word_offsets [i2]);
+                }
+            }
+
+            // Only the dataset IDs stay after the deletion of the tokens
+            TokenListContainer_DeleteTokens(mapped_container);
+            ASSERT_EQUALS(0, TokenListContainer_CountAllTokens(mapped_container));
+            ASSERT_EQUALS(token_container->next_free_element, mapped_container->next_free_element);
+            if (token_container->next_free_element > 0)
+            {
+                ASSERT_STRING_EQUALS(token_container->token_lists [0].dataset_id,
+                        mapped_container->token_lists [0].dataset_id);
+            }
+
+            TokenListContainer_DeleteObject(mapped_container);
+            mapped_container = NULL;
+            TokenIntMapping_DeleteObject(token_int_mapping);
+            token_int_mapping = NULL;
+        }
+
+        TokenIntMapping_DeleteObject(reference_mapping);
+        reference_mapping = NULL;
+        TokenListContainer_DeleteObject(token_container);
+        token_container = NULL;
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check the geometric growth of a Token_List: A line with many tokens needs only a few reallocs and all
+ * columns of the list are in one memory block, without losing the values after a reallocation.
+ */
+extern void TEST_Token_List_Geometric_Growth (void)
+{
+    FILE* lines_file = fopen (TEST_FILE_READER_LINES_FILE, "w");
+    ASSERT_FMSG(lines_file != NULL, "Cannot create the test file \"%s\" !", TEST_FILE_READER_LINES_FILE);
+    for (size_t i = 0; i < 5000; ++ i)
+    {
+        fprintf (lines_file, "%stok%04zu", (i > 0) ? " " : "", i);
+    }
+    fputs ("\nshort line\n", lines_file);
+    FCLOSE_AND_SET_TO_NULL(lines_file);
+
+    struct Token_List_Container* token_container = TokenListContainer_CreateObject (TEST_FILE_READER_LINES_FILE);
+
+    ASSERT_EQUALS(2, token_container->next_free_element);
+    ASSERT_EQUALS(5000, token_container->token_lists [0].next_free_element);
+    ASSERT_EQUALS(2, token_container->token_lists [1].next_free_element);
+    // Step size 15 would need more than 300 reallocs for the long line; doubling from 16 only 9
+    ASSERT_EQUALS(true, token_container->realloc_calls < 32);
+
+    for (uint_fast32_t i = 0; i < token_container->next_free_element; ++ i)
+    {
+        const struct Token_List* const token_list = &(token_container->token_lists [i]);
+
+        // Order of the columns in the block: handles, char offsets, word offsets, sentence offsets
+        ASSERT_EQUALS((void*) (token_list->tokens + token_list->allocated_tokens), (void*) token_list->char_offsets);
+        ASSERT_EQUALS((void*) (token_list->char_offsets + token_list->allocated_tokens),
+                (void*) token_list->word_offsets);
+        ASSERT_EQUALS((void*) (token_list->word_offsets + token_list->allocated_tokens),
+                (void*) token_list->sentence_offsets);
+    }
+    for (uint_fast32_t i2 = 1; i2 < token_container->token_lists [0].next_free_element; ++ i2)
+    {
+        ASSERT_EQUALS(true, token_container->token_lists [0].char_offsets [i2 - 1] <
+                token_container->token_lists [0].char_offsets [i2]);
+    }
+    ASSERT_STRING_EQUALS("tok0000", TokenListContainer_GetToken(token_container, 0, 0));
+    ASSERT_STRING_EQUALS("tok4999", TokenListContainer_GetToken(token_container, 0, 4999));
+    ASSERT_STRING_EQUALS("line", TokenListContainer_GetToken(token_container, 1, 1));
+
+    TokenListContainer_DeleteObject(token_container);
+    token_container = NULL;
+    remove (TEST_FILE_READER_LINES_FILE);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 #ifdef TEST_FILE_READER_TEST_FILE
 #undef TEST_FILE_READER_TEST_FILE
 #endif /* TEST_FILE_READER_TEST_FILE */
 
+#ifdef TEST_FILE_READER_LONG_TOKEN_FILE
+#undef TEST_FILE_READER_LONG_TOKEN_FILE
+#endif /* TEST_FILE_READER_LONG_TOKEN_FILE */
+
 #ifdef TEST_FILE_READER_TEST_FILE_MD5
 #undef TEST_FILE_READER_TEST_FILE_MD5
 #endif /* TEST_FILE_READER_TEST_FILE_MD5 */
 
+#ifdef TEST_FILE_READER_LINES_FILE
+#undef TEST_FILE_READER_LINES_FILE
+#endif /* TEST_FILE_READER_LINES_FILE */
+
+#ifdef TEST_FILE_READER_JSON_FILE
+#undef TEST_FILE_READER_JSON_FILE
+#endif /* TEST_FILE_READER_JSON_FILE */
+
 #ifdef NUMBER_OF_TOKENARRAYS
 #undef NUMBER_OF_TOKENARRAYS
 #endif /* NUMBER_OF_TOKENARRAYS */
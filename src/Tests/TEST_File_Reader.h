@@ -37,6 +37,48 @@ extern void TEST_Max_Tokenarray_Length (void);
  */
 extern void TEST_Length_Of_The_First_25_Tokenarrays (void);
 
+/**
+ * @brief Check, whether tokens, that are longer than MAX_TOKEN_LENGTH, are saved without truncation.
+ */
+extern void TEST_Token_Memory_Without_Truncation (void);
+
+/**
+ * @brief Check the line reading of a text file (Empty line, long line and a last line without '\n').
+ */
+extern void TEST_Read_Lines_Of_Text_File (void);
+
+/**
+ * @brief Check, whether an empty line and a line with only white spaces create no dataset.
+ */
+extern void TEST_Skip_Text_Lines_Without_Tokens (void);
+
+/**
+ * @brief Check the JSON parser (Escape sequences, char offsets and the roll back of a malformed fragment).
+ */
+extern void TEST_Parse_JSON_Fragments (void);
+
+/**
+ * @brief Check, whether the parallel loading creates the same containers like the serial loading.
+ */
+extern void TEST_Parallel_File_Loading (void);
+
+/**
+ * @brief Check the parallel loading of a JSON object, whose data sets contain nested objects and strings with
+ * braces and commas.
+ */
+extern void TEST_Parallel_Loading_Of_Nested_JSON_Objects (void);
+
+/**
+ * @brief Check, whether the direct-to-id ingestion creates the same mapped integers and offsets like the interning of
+ * a normal container.
+ */
+extern void TEST_Direct_To_Id_Ingestion (void);
+
+/**
+ * @brief Check the geometric growth of a Token_List and the layout of its columns in one memory block.
+ */
+extern void TEST_Token_List_Geometric_Growth (void);
+
 
 
 #ifdef __cplusplus
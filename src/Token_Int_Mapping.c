@@ -9,526 +9,2169 @@
  *
  * Of course after the intersection it is necessary to invert the mapping. (This could be done with "Int_To_Token()")
  *
+ * The mapped integers are dense: The n-th added token gets the value n - 1. So the reverse mapping is only an array
+ * access.
+ *
  * @date 23.06.2022
  * @author Gyps
  */
 
 #include "Token_Int_Mapping.h"
 #include <string.h>
-#include <ctype.h>
+#include <stdlib.h>
 #include "Error_Handling/Assert_Msg.h"
 #include "Error_Handling/Dynamic_Memory.h"
 #include "Print_Tools.h"
 #include "File_Reader.h"
 #include "Misc.h"
+#include "Stop_Words/Stop_Words.h"
+#include "UTF8/utf8.h"
+
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
 
 
 
 /**
- * @brief Memory for the number of tokens per C-String.
+ * @brief Number of tokens, that can be saved without a reallocation of the per token arrays.
+ *
+ * If a reallocation is necessary, the size will be doubled.
+ */
+#ifndef TOKENS_INITIAL_SIZE
+#define TOKENS_INITIAL_SIZE 1024
+#else
+#error "The macro \"TOKENS_INITIAL_SIZE\" is already defined !"
+#endif /* TOKENS_INITIAL_SIZE */
+
+/**
+ * @brief Initial size of the token memory in bytes.
  *
- * It is also the allocation step size, if a reallocation is necessary.
+ * If a reallocation is necessary, the size will be doubled.
  */
-#ifndef C_STR_ALLOCATION_STEP_SIZE
-#define C_STR_ALLOCATION_STEP_SIZE 100
+#ifndef TOKEN_MEMORY_INITIAL_SIZE
+#define TOKEN_MEMORY_INITIAL_SIZE (TOKENS_INITIAL_SIZE * 16)
 #else
-#error "The macro \"C_STR_ALLOCATION_STEP_SIZE\" is already defined !"
-#endif /* C_STR_ALLOCATION_STEP_SIZE */
+#error "The macro \"TOKEN_MEMORY_INITIAL_SIZE\" is already defined !"
+#endif /* TOKEN_MEMORY_INITIAL_SIZE */
 
 /**
  * @brief Check, whether the macro values are valid.
  */
 #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
-_Static_assert(C_STR_ALLOCATION_STEP_SIZE > 0, "The marco \"C_STR_ALLOCATION_STEP_SIZE\" is zero !");
+_Static_assert(TOKENS_INITIAL_SIZE > 0, "The marco \"TOKENS_INITIAL_SIZE\" is zero !");
+_Static_assert(TOKEN_MEMORY_INITIAL_SIZE > 0, "The marco \"TOKEN_MEMORY_INITIAL_SIZE\" is zero !");
+
+IS_TYPE(TOKENS_INITIAL_SIZE, int)
+IS_TYPE(TOKEN_MEMORY_INITIAL_SIZE, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+/**
+ * @brief Number of slots of the hash table at the creation. (Needs to be a power of two)
+ */
+#ifndef HASH_TABLE_INITIAL_SLOTS
+#define HASH_TABLE_INITIAL_SLOTS 1024
+#else
+#error "The macro \"HASH_TABLE_INITIAL_SLOTS\" is already defined !"
+#endif /* HASH_TABLE_INITIAL_SLOTS */
+
+/**
+ * @brief Max. load factor of the hash table in percent. With a higher load factor the number of slots will be doubled.
+ */
+#ifndef HASH_TABLE_MAX_LOAD_PERCENT
+#define HASH_TABLE_MAX_LOAD_PERCENT 50
+#else
+#error "The macro \"HASH_TABLE_MAX_LOAD_PERCENT\" is already defined !"
+#endif /* HASH_TABLE_MAX_LOAD_PERCENT */
+
+/**
+ * @brief Size of the stack buffer for the case folded key of a searched token. Longer keys need a dynamic buffer.
+ */
+#ifndef KEY_STACK_BUFFER_SIZE
+#define KEY_STACK_BUFFER_SIZE 256
+#else
+#error "The macro \"KEY_STACK_BUFFER_SIZE\" is already defined !"
+#endif /* KEY_STACK_BUFFER_SIZE */
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert((HASH_TABLE_INITIAL_SLOTS & (HASH_TABLE_INITIAL_SLOTS - 1)) == 0,
+        "The marco \"HASH_TABLE_INITIAL_SLOTS\" needs to be a power of two !");
+_Static_assert(HASH_TABLE_MAX_LOAD_PERCENT > 0 && HASH_TABLE_MAX_LOAD_PERCENT < 100,
+        "The marco \"HASH_TABLE_MAX_LOAD_PERCENT\" needs to be in the interval (0, 100) !");
+
+IS_TYPE(HASH_TABLE_INITIAL_SLOTS, int)
+IS_TYPE(HASH_TABLE_MAX_LOAD_PERCENT, int)
+_Static_assert(KEY_STACK_BUFFER_SIZE > 0, "The marco \"KEY_STACK_BUFFER_SIZE\" is zero !");
+IS_TYPE(KEY_STACK_BUFFER_SIZE, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+/**
+ * @brief Magic bytes at the begin of a vocabulary snapshot file.
+ */
+#ifndef SNAPSHOT_MAGIC
+#define SNAPSHOT_MAGIC "TIMSNAP"
+#else
+#error "The macro \"SNAPSHOT_MAGIC\" is already defined !"
+#endif /* SNAPSHOT_MAGIC */
+
+/**
+ * @brief Version of the snapshot format.
+ *
+ * Needs to be increased with every change of the file layout, of the slot struct or of the hash function, because a
+ * snapshot will be used without a rehash.
+ */
+#ifndef SNAPSHOT_FORMAT_VERSION
+#define SNAPSHOT_FORMAT_VERSION 1
+#else
+#error "The macro \"SNAPSHOT_FORMAT_VERSION\" is already defined !"
+#endif /* SNAPSHOT_FORMAT_VERSION */
+
+/**
+ * @brief Alignment of the sections in a snapshot file. (The sections will be used directly as arrays)
+ */
+#ifndef SNAPSHOT_SECTION_ALIGNMENT
+#define SNAPSHOT_SECTION_ALIGNMENT 64
+#else
+#error "The macro \"SNAPSHOT_SECTION_ALIGNMENT\" is already defined !"
+#endif /* SNAPSHOT_SECTION_ALIGNMENT */
+
+/**
+ * @brief Known value in the snapshot header to detect a snapshot with a different byte order.
+ */
+#ifndef SNAPSHOT_BYTE_ORDER_MARK
+#define SNAPSHOT_BYTE_ORDER_MARK 0x01020304u
+#else
+#error "The macro \"SNAPSHOT_BYTE_ORDER_MARK\" is already defined !"
+#endif /* SNAPSHOT_BYTE_ORDER_MARK */
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(sizeof (SNAPSHOT_MAGIC) == 8, "The marco \"SNAPSHOT_MAGIC\" needs exact 7 chars !");
+_Static_assert(SNAPSHOT_FORMAT_VERSION > 0, "The marco \"SNAPSHOT_FORMAT_VERSION\" is zero !");
+_Static_assert((SNAPSHOT_SECTION_ALIGNMENT & (SNAPSHOT_SECTION_ALIGNMENT - 1)) == 0,
+        "The marco \"SNAPSHOT_SECTION_ALIGNMENT\" needs to be a power of two !");
+
+IS_TYPE(SNAPSHOT_FORMAT_VERSION, int)
+IS_TYPE(SNAPSHOT_SECTION_ALIGNMENT, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+/**
+ * @brief Frequency of a mapped integer. (Only used for the renumbering of the mapped integers)
+ */
+struct Token_Frequency
+{
+    size_t frequency;               ///< Frequency of the token
+    DATA_TYPE token_int_value;      ///< Old mapped integer
+};
+
+/**
+ * @brief Header of a vocabulary snapshot file.
+ *
+ * The sections of the file have the same layout as the arrays in the memory. So a snapshot can be used directly after
+ * the mapping without any parsing or rehashing.
+ */
+struct Token_Int_Mapping_Snapshot_Header
+{
+    char magic [8];                 ///< SNAPSHOT_MAGIC
+    uint32_t version;               ///< SNAPSHOT_FORMAT_VERSION
+    uint32_t byte_order_mark;       ///< SNAPSHOT_BYTE_ORDER_MARK in the byte order of the writer
+    uint32_t size_of_size_t;        ///< sizeof (size_t) of the writer
+    uint32_t size_of_data_type;     ///< sizeof (DATA_TYPE) of the writer
+    uint32_t size_of_slot;          ///< sizeof (struct Token_Int_Mapping_Slot) of the writer
+    uint32_t case_sensitive;        ///< Case sensitivity of the saved mapping
+    uint64_t number_of_tokens;      ///< Number of saved tokens
+    uint64_t number_of_slots;       ///< Number of slots of the saved hash table
+    uint64_t token_memory_size;     ///< Used bytes of the saved token memory
+    uint64_t offsets_section;       ///< File position of the offset array
+    uint64_t flags_section;         ///< File position of the stop word flags
+    uint64_t slots_section;         ///< File position of the hash table
+    uint64_t token_memory_section;  ///< File position of the token memory
+    uint64_t file_size;             ///< Size of the whole file
+};
+
+/**
+ * @brief Hash function for the hash table.
+ *
+ * FNV-1a over the key of a token with a final avalanche step. In the case-insensitive mode the key is already case
+ * folded; so the chars can be used directly.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input_str Input C-String
+ * @param[in] input_str_length Length of the input string
+ *
+ * @return Hash value
+ */
+static inline uint32_t
+Token_Hash_Function
+(
+        const char* const input_str,
+        const size_t input_str_length
+);
+
+/**
+ * @brief Get the saved key of a mapped integer.
+ *
+ * In the case-sensitive mode the key is the token itself. Otherwise the key follows directly after the token.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token_int_value Mapped integer (Needs to be valid)
+ * @param[in] token_length Length of the saved token
+ *
+ * @return Pointer to the saved key
+ */
+static inline const char*
+Saved_Key_Of_Int_Value
+(
+        const struct Token_Int_Mapping* const object,
+        const DATA_TYPE token_int_value,
+        const size_t token_length
+);
+
+/**
+ * @brief Create the key of a token. The key will be used for the hash value and for the comparison.
+ *
+ * In the case-sensitive mode the token itself is the key. Otherwise the case folded token will be written in a key
+ * buffer: Short keys use the given stack buffer; longer keys need a dynamic buffer, that the caller needs to free.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token Token
+ * @param[in] token_length Length of the token
+ * @param[out] key_stack_buffer Buffer with KEY_STACK_BUFFER_SIZE bytes
+ * @param[out] key_dynamic_buffer Dynamic buffer for long keys (NULL, if not used)
+ *
+ * @return Pointer to the key (It has the same length as the token)
+ */
+static inline const char*
+Create_Key
+(
+        const struct Token_Int_Mapping* const restrict object,
+        const char* const restrict token,
+        const size_t token_length,
+        char* const restrict key_stack_buffer,
+        char** const restrict key_dynamic_buffer
+);
+
+/**
+ * @brief Search the slot of a token in the hash table (Linear probing).
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token Key of the searched token
+ * @param[in] token_length Length of the key
+ * @param[in] hash Hash value of the key
+ * @param[out] probes Number of visited slots
+ *
+ * @return Index of the slot with the token or of the first empty slot, if the token is not in the hash table
+ */
+static inline size_t
+Find_Slot
+(
+        const struct Token_Int_Mapping* const restrict object,
+        const char* const restrict token,
+        const size_t token_length,
+        const uint32_t hash,
+        size_t* const restrict probes
+);
+
+/**
+ * @brief Get the mapped integer of a token with a known key and hash value. If the token is not in the mapping object,
+ * it will be added.
+ *
+ * This is the common part of TokenIntMapping_Intern() and TokenIntMapping_Merge().
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] new_token New token
+ * @param[in] key Key of the new token (see Create_Key())
+ * @param[in] new_token_length Length of the new token (and of the key)
+ * @param[in] hash Hash value of the key
+ * @param[in] stop_word_flag Known stop word flag of the token (NULL: The flag will be determined, if necessary)
+ *
+ * @return Mapping integer of the existing or the new token
+ */
+static DATA_TYPE
+Intern_Key
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict new_token,
+        const char* const restrict key,
+        const size_t new_token_length,
+        const uint32_t hash,
+        const _Bool* const restrict stop_word_flag
+);
+
+/**
+ * @brief Use the spelling of the first intern in this run for a snapshot token.
+ *
+ * Without a snapshot the first spelling of a token in the run will be saved and the stop word flag belongs to this
+ * spelling. In the case-insensitive mode the snapshot can contain a different spelling with the same key. The spelling
+ * will be overwritten in place (The key and so the length are the same; the snapshot memory is a private copy) and the
+ * stop word flag will be determined again.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token_int_value Mapped integer of the snapshot token
+ * @param[in] new_token Spelling of the first intern in this run
+ * @param[in] new_token_length Length of the spelling (Same as the length of the saved token)
+ * @param[in] stop_word_flag Known stop word flag of the spelling (NULL: The flag will be determined)
+ */
+static void
+Use_Spelling_Of_This_Run
+(
+        struct Token_Int_Mapping* const restrict object,
+        const DATA_TYPE token_int_value,
+        const char* const restrict new_token,
+        const size_t new_token_length,
+        const _Bool* const restrict stop_word_flag
+);
+
+/**
+ * @brief Get the length of the saved token of a mapped integer.
+ *
+ * The length is the distance to the next token in the token memory. (In the case-insensitive mode the key is between
+ * the tokens)
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token_int_value Mapped integer (Needs to be valid)
+ *
+ * @return Length of the saved token
+ */
+static inline size_t
+Saved_Token_Length
+(
+        const struct Token_Int_Mapping* const object,
+        const DATA_TYPE token_int_value
+);
+
+/**
+ * @brief Comparison function for qsort: Higher frequency first; with the same frequency the smaller old integer first.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] a First struct Token_Frequency
+ * @param[in] b Second struct Token_Frequency
+ *
+ * @return Comparison result for qsort
+ */
+static int
+Compare_Token_Frequencies
+(
+        const void* a,
+        const void* b
+);
+
+/**
+ * @brief Get the address of a token memory offset.
+ *
+ * The offsets below snapshot_token_memory_size are in the loaded snapshot. All other offsets are in the token memory
+ * (overlay). Without a snapshot every offset is in the token memory.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] offset Token memory offset
+ *
+ * @return Address of the offset
+ */
+static inline const char*
+Token_Memory_Address
+(
+        const struct Token_Int_Mapping* const object,
+        const size_t offset
+);
+
+/**
+ * @brief Is the given memory a part of the loaded snapshot ?
+ *
+ * Such memory cannot be reallocated or freed.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] memory Memory address
+ *
+ * @return true, if the memory is a part of the snapshot, otherwise false
+ */
+static inline _Bool
+Is_Snapshot_Memory
+(
+        const struct Token_Int_Mapping* const object,
+        const void* const memory
+);
+
+/**
+ * @brief Round a file position up to the next section alignment of a snapshot file.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] file_position File position
+ *
+ * @return Aligned file position
+ */
+static inline uint64_t
+Align_Snapshot_Section
+(
+        const uint64_t file_position
+);
+
+/**
+ * @brief Check a section of a snapshot file: The section needs to be aligned, it must not begin before the end of the
+ * previous section and it needs to be completely in the file.
+ *
+ * Asserts:
+ *      element_size > 0
+ *
+ * @param[in] section_position File position of the section
+ * @param[in] number_of_elements Number of elements in the section
+ * @param[in] element_size Size of one element in bytes
+ * @param[in, out] previous_section_end End of the previous section; after the call: End of this section (Only, if the
+ *      section is valid)
+ * @param[in] file_size Size of the whole file
+ *
+ * @return true, if the section is valid, otherwise false
+ */
+static _Bool
+Is_Valid_Snapshot_Section
+(
+        const uint64_t section_position,
+        const uint64_t number_of_elements,
+        const size_t element_size,
+        uint64_t* const previous_section_end,
+        const uint64_t file_size
+);
+
+/**
+ * @brief Check the content of the snapshot sections, that will be used for memory accesses: Every token offset needs
+ * to be in the token memory and larger than the previous one, every used slot needs a valid mapped integer with the
+ * length of the saved key and the token memory needs to end with a terminator byte.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] token_offsets Token offsets of the snapshot
+ * @param[in] number_of_tokens Number of tokens
+ * @param[in] slots Slots of the snapshot
+ * @param[in] number_of_slots Number of slots
+ * @param[in] token_memory Token memory of the snapshot
+ * @param[in] token_memory_size Size of the token memory in bytes
+ * @param[in] case_sensitive Was the snapshot created in the case-sensitive mode ?
+ *
+ * @return true, if the content is valid, otherwise false
+ */
+static _Bool
+Is_Valid_Snapshot_Content
+(
+        const size_t* const restrict token_offsets,
+        const uint64_t number_of_tokens,
+        const struct Token_Int_Mapping_Slot* const restrict slots,
+        const uint64_t number_of_slots,
+        const char* const restrict token_memory,
+        const uint64_t token_memory_size,
+        const _Bool case_sensitive
+);
+
+/**
+ * @brief Write a section of a snapshot file. The gap between the current file position and the section will be filled
+ * with zeros.
+ *
+ * Asserts:
+ *      *file_position <= section_position
+ *      All write operations are successful
+ *
+ * @param[in] snapshot_file Opened snapshot file
+ * @param[in] file_name Name of the snapshot file (Only for error messages)
+ * @param[in, out] file_position Current file position
+ * @param[in] section_position File position of the section
+ * @param[in] data Data of the section
+ * @param[in] data_size Size of the data in bytes
+ */
+static void
+Write_Snapshot_Section
+(
+        FILE* const restrict snapshot_file,
+        const char* const restrict file_name,
+        uint64_t* const restrict file_position,
+        const uint64_t section_position,
+        const void* const restrict data,
+        const size_t data_size
+);
+
+/**
+ * @brief Make a snapshot file accessible in the memory: With mmap() (private copy-on-write mapping), if available.
+ * Otherwise the file will be read in a dynamic memory.
+ *
+ * Asserts:
+ *      The file can be opened and accessed
+ *      The file is larger than a snapshot header
+ *
+ * @param[in] object Token_Int_Mapping object, that gets the snapshot
+ * @param[in] file_name Name of the snapshot file
+ */
+static void
+Open_Snapshot
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict file_name
+);
+
+/**
+ * @brief Determine the used bytes of the whole mapping: Object, tokens, per token arrays and used slots.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ *
+ * @return Used bytes
+ */
+static size_t
+Used_Memory_Size
+(
+        const struct Token_Int_Mapping* const object
+);
+
+/**
+ * @brief Double the number of slots of the hash table.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ */
+static void
+Grow_Hash_Table
+(
+        struct Token_Int_Mapping* const object
+);
+
+/**
+ * @brief Create new dynamic Token_Int_Mapping object.
+ *
+ * This is the internal creation function, that will be used from the public creation functions:
+ * - TokenIntMapping_CreateObject
+ * - TokenIntMapping_CreateObjectWithCaseSensitivity
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Pointer to the new object
+ */
+static struct Token_Int_Mapping*
+TokenIntMapping_CreateObject_Internal
+(
+        const _Bool case_sensitive
+);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create new dynamic Token_Int_Mapping object with case-sensitive comparison of the tokens
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @return Pointer to the new object
+ */
+extern struct Token_Int_Mapping*
+TokenIntMapping_CreateObject
+(
+        void
+)
+{
+    return TokenIntMapping_CreateObject_Internal(true);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create new dynamic Token_Int_Mapping object with the given case sensitivity.
+ *
+ * In the case-insensitive mode the tokens will be compared with their UTF-8 aware case folded keys.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] case_sensitive Case-sensitive comparison of the tokens ?
+ *
+ * @return Pointer to the new object
+ */
+extern struct Token_Int_Mapping*
+TokenIntMapping_CreateObjectWithCaseSensitivity
+(
+        const _Bool case_sensitive
+)
+{
+    return TokenIntMapping_CreateObject_Internal(case_sensitive);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Delete a dynamic allocated Token_Int_Mapping object.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Token_Int_Mapping object
+ */
+extern void
+TokenIntMapping_DeleteObject
+(
+        struct Token_Int_Mapping* object
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+
+    // Delete the inner objects (The arrays in a snapshot will be released with the snapshot)
+    FREE_AND_SET_TO_NULL(object->token_memory);
+    if (! Is_Snapshot_Memory(object, object->token_offsets)) { FREE_AND_SET_TO_NULL(object->token_offsets); }
+    if (! Is_Snapshot_Memory(object, object->stop_word_flags)) { FREE_AND_SET_TO_NULL(object->stop_word_flags); }
+    if (! Is_Snapshot_Memory(object, object->slots)) { FREE_AND_SET_TO_NULL(object->slots); }
+    if (object->snapshot_tokens_seen != NULL) { FREE_AND_SET_TO_NULL(object->snapshot_tokens_seen); }
+    if (object->snapshot != NULL)
+    {
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+        if (object->snapshot_is_mapped)
+        {
+            const int munmap_result = munmap (object->snapshot, object->snapshot_size);
+            ASSERT_FMSG(munmap_result == 0, "Cannot unmap the vocabulary snapshot: %s", strerror(errno));
+            object->snapshot = NULL;
+        }
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+        if (object->snapshot != NULL) { FREE_AND_SET_TO_NULL(object->snapshot); }
+    }
+    FREE_AND_SET_TO_NULL(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Get the mapped integer of a token. If the token is not in the mapping object, it will be added.
+ *
+ * The search for an existing token and the insertion of a new token use the same probe in the hash table. So a token
+ * will be hashed and compared only once. The expected runtime is O(1).
+ *
+ *
+ * How the mapping integers works:
+ * The mapped integers are assigned densely from 0 in the order of the insertion. The mapped integer is the index of the
+ * token in the offset array; so the reverse mapping (int -> token) needs no search.
+ *
+ *
+ * Asserts:
+ *      object != NULL
+ *      new_token != NULL
+ *      new_token_length > 0
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] new_token New token
+ * @param[in] new_token_length Length of the new token
+ *
+ * @return Mapping integer of the existing or the new token
+ */
+extern DATA_TYPE
+TokenIntMapping_Intern
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict new_token,
+        const size_t new_token_length
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_MSG(new_token != NULL, "New token is NULL !");
+    ASSERT_MSG(new_token_length > 0, "New token has the length 0 !");
+    ASSERT_FMSG(new_token_length <= UINT32_MAX, "New token is too long for the hash table ! Got: %zu !",
+            new_token_length);
+
+    const uint64_t start_time = (object->measure_time) ? Current_Time_In_Ns() : 0;
+
+    char key_stack_buffer [KEY_STACK_BUFFER_SIZE];
+    char* key_dynamic_buffer = NULL;
+    const char* const key = Create_Key(object, new_token, new_token_length, key_stack_buffer, &key_dynamic_buffer);
+
+    const DATA_TYPE result = Intern_Key(object, new_token, key, new_token_length,
+            Token_Hash_Function(key, new_token_length), NULL);
+    if (key_dynamic_buffer != NULL) { FREE_AND_SET_TO_NULL(key_dynamic_buffer); }
+
+    if (object->measure_time) { object->add_token_time_ns += Current_Time_In_Ns() - start_time; }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Add token to the mapping object.
+ *
+ * The return value is an flag and indicates whether the operation was successful. The process is not successful, if
+ * the token already exists in the mapping table. In this case there will be NO duplicate in the mapping table.
+ *
+ * See TokenIntMapping_Intern() for the details of the insertion.
+ *
+ * Asserts:
+ *      object != NULL
+ *      new_token != NULL
+ *      new_token_length > 0
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] new_token New token
+ * @param[in] new_token_length Length of the new token
+ *
+ * @return Flag, which indicates, whether the operation was successful.
+ */
+extern _Bool
+TokenIntMapping_AddToken
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict new_token,
+        const size_t new_token_length
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+
+    const size_t old_number_of_tokens = object->number_of_tokens;
+    TokenIntMapping_Intern(object, new_token, new_token_length);
+
+    return object->number_of_tokens != old_number_of_tokens;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Merge a (chunk local) Token_Int_Mapping into a global Token_Int_Mapping.
+ *
+ * The tokens of the local mapping will be interned in the global mapping in the order of their local integers. So the
+ * global integers are exact the same as if the tokens of the chunks were added directly to the global mapping in the
+ * order of the chunks. The saved keys and the stop word flags of the local mapping will be reused.
+ *
+ * This is the merge step of the parallel construction: Every thread builds a local mapping for its chunk of the input
+ * data. After that the local mappings will be merged (single threaded) in the order of the chunks.
+ *
+ * Asserts:
+ *      global_mapping != NULL
+ *      local_mapping != NULL
+ *      remap_table != NULL
+ *      global_mapping->case_sensitive == local_mapping->case_sensitive
+ *
+ * @param[in] global_mapping Global Token_Int_Mapping object
+ * @param[in] local_mapping Local Token_Int_Mapping object
+ * @param[out] remap_table Global integer for every local integer (Needs local_mapping->number_of_tokens elements)
+ *
+ * @return Number of tokens, that were added to the global mapping
+ */
+extern size_t
+TokenIntMapping_Merge
+(
+        struct Token_Int_Mapping* const restrict global_mapping,
+        const struct Token_Int_Mapping* const restrict local_mapping,
+        DATA_TYPE* const restrict remap_table
+)
+{
+    ASSERT_MSG(global_mapping != NULL, "Global Token_Int_Mapping object is NULL !");
+    ASSERT_MSG(local_mapping != NULL, "Local Token_Int_Mapping object is NULL !");
+    ASSERT_MSG(remap_table != NULL, "Remap table is NULL !");
+    ASSERT_MSG(global_mapping->case_sensitive == local_mapping->case_sensitive,
+            "The mappings use a different case sensitivity !");
+
+    const size_t old_number_of_tokens = global_mapping->number_of_tokens;
+    const uint64_t start_time = (global_mapping->measure_time) ? Current_Time_In_Ns() : 0;
+
+    for (DATA_TYPE local_int_value = 0; local_int_value < local_mapping->number_of_tokens; ++ local_int_value)
+    {
+        const size_t token_length = Saved_Token_Length(local_mapping, local_int_value);
+        const char* const key = Saved_Key_Of_Int_Value(local_mapping, local_int_value, token_length);
+
+        remap_table [local_int_value] = Intern_Key(global_mapping,
+                Token_Memory_Address(local_mapping, local_mapping->token_offsets [local_int_value]), key, token_length,
+                Token_Hash_Function(key, token_length), &(local_mapping->stop_word_flags [local_int_value]));
+    }
+
+    if (global_mapping->measure_time) { global_mapping->add_token_time_ns += Current_Time_In_Ns() - start_time; }
+
+    return global_mapping->number_of_tokens - old_number_of_tokens;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Renumber the mapped integers, so that the tokens with the highest frequency get the smallest integers.
+ *
+ * Tokens with the same frequency keep their relative order. The token memory will be rebuilt in the new order; so the
+ * saved tokens of the small integers are also neighbours in the memory.
+ *
+ * All data, that uses the old integers, needs to be remapped with the remap table. (E.g. DocumentWordList_RemapData())
+ *
+ * Asserts:
+ *      object != NULL
+ *      frequencies != NULL
+ *      remap_table != NULL
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] frequencies Frequency of every mapped integer (Needs object->number_of_tokens elements)
+ * @param[out] remap_table New integer for every old integer (Needs object->number_of_tokens elements)
+ */
+extern void
+TokenIntMapping_RenumberByFrequency
+(
+        struct Token_Int_Mapping* const restrict object,
+        const size_t* const restrict frequencies,
+        DATA_TYPE* const restrict remap_table
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_MSG(frequencies != NULL, "Frequency array is NULL !");
+    ASSERT_MSG(remap_table != NULL, "Remap table is NULL !");
+
+    const size_t number_of_tokens = object->number_of_tokens;
+    if (number_of_tokens == 0) { return; }
+
+    struct Token_Frequency* order =
+            (struct Token_Frequency*) MALLOC(number_of_tokens * sizeof (struct Token_Frequency));
+    ASSERT_ALLOC(order, "Cannot allocate memory for the renumbering of the tokens !",
+            number_of_tokens * sizeof (struct Token_Frequency));
+    for (size_t i = 0; i < number_of_tokens; ++ i)
+    {
+        order [i].frequency = frequencies [i];
+        order [i].token_int_value = (DATA_TYPE) i;
+    }
+    qsort (order, number_of_tokens, sizeof (struct Token_Frequency), Compare_Token_Frequencies);
+
+    // Rebuild the token memory and the per token arrays in the new order
+    // With a snapshot the rebuilt token memory contains also the snapshot tokens
+    const size_t new_token_memory_size = (object->token_memory_used > object->token_memory_allocated) ?
+            object->token_memory_used : object->token_memory_allocated;
+    char* new_token_memory = (char*) MALLOC(new_token_memory_size * sizeof (char));
+    ASSERT_ALLOC(new_token_memory, "Cannot allocate memory for the renumbering of the tokens !",
+            new_token_memory_size * sizeof (char));
+    size_t* new_token_offsets = (size_t*) MALLOC(object->allocated_tokens * sizeof (size_t));
+    ASSERT_ALLOC(new_token_offsets, "Cannot allocate memory for the renumbering of the tokens !",
+            object->allocated_tokens * sizeof (size_t));
+    _Bool* new_stop_word_flags = (_Bool*) MALLOC(object->allocated_tokens * sizeof (_Bool));
+    ASSERT_ALLOC(new_stop_word_flags, "Cannot allocate memory for the renumbering of the tokens !",
+            object->allocated_tokens * sizeof (_Bool));
+
+    size_t new_token_memory_used = 0;
+    for (size_t i = 0; i < number_of_tokens; ++ i)
+    {
+        const DATA_TYPE old_int_value = order [i].token_int_value;
+        const size_t token_length = Saved_Token_Length(object, old_int_value);
+        // In the case-insensitive mode the key follows the token
+        const size_t saved_bytes = (object->case_sensitive) ? token_length + 1 : (token_length + 1) * 2;
+
+        memcpy (new_token_memory + new_token_memory_used,
+                Token_Memory_Address(object, object->token_offsets [old_int_value]), saved_bytes);
+        new_token_offsets [i] = new_token_memory_used;
+        new_stop_word_flags [i] = object->stop_word_flags [old_int_value];
+        new_token_memory_used += saved_bytes;
+
+        remap_table [old_int_value] = (DATA_TYPE) i;
+    }
+    FREE_AND_SET_TO_NULL(order);
+
+    FREE_AND_SET_TO_NULL(object->token_memory);
+    if (! Is_Snapshot_Memory(object, object->token_offsets)) { FREE_AND_SET_TO_NULL(object->token_offsets); }
+    if (! Is_Snapshot_Memory(object, object->stop_word_flags)) { FREE_AND_SET_TO_NULL(object->stop_word_flags); }
+    object->token_memory                = new_token_memory;
+    object->token_memory_used           = new_token_memory_used;
+    object->token_memory_allocated      = new_token_memory_size;
+    object->token_offsets               = new_token_offsets;
+    object->stop_word_flags             = new_stop_word_flags;
+    object->snapshot_token_memory       = NULL;
+    object->snapshot_token_memory_size  = 0;
+    // The snapshot tokens are now a part of the token memory and they got new integers
+    if (object->snapshot_tokens_seen != NULL) { FREE_AND_SET_TO_NULL(object->snapshot_tokens_seen); }
+    object->snapshot_number_of_tokens   = 0;
+
+    // The hash values and the key lengths in the hash table are still valid; only the mapped integers change
+    for (size_t i = 0; i < object->number_of_slots; ++ i)
+    {
+        if (object->slots [i].length != 0)
+        {
+            object->slots [i].token_int_value = remap_table [object->slots [i].token_int_value];
+        }
+    }
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create a Token_Int_Mapping object from a vocabulary snapshot. (See TokenIntMapping_SaveSnapshot())
+ *
+ * The snapshot will be mapped in the memory (copy-on-write) and used directly: No parsing and no rehashing. New tokens
+ * will be saved in a dynamic overlay on top of the snapshot; the snapshot file itself will never be changed.
+ *
+ * In the case-insensitive mode the first intern of a snapshot token replaces the spelling of the snapshot with the
+ * given spelling and determines the stop word flag again. So the results are the same as without a snapshot.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      The file is a valid snapshot, that was created with the same format version on a compatible system
+ *
+ * @param[in] file_name Name of the snapshot file
+ *
+ * @return Pointer to the new object
+ */
+extern struct Token_Int_Mapping*
+TokenIntMapping_CreateObjectFromSnapshot
+(
+        const char* const file_name
+)
+{
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    struct Token_Int_Mapping* new_object = (struct Token_Int_Mapping*) CALLOC(1, sizeof (struct Token_Int_Mapping));
+    ASSERT_ALLOC(new_object, "Cannot create a new token int mapping !", sizeof (struct Token_Int_Mapping));
+
+    Open_Snapshot(new_object, file_name);
+
+    const struct Token_Int_Mapping_Snapshot_Header* const header =
+            (const struct Token_Int_Mapping_Snapshot_Header*) new_object->snapshot;
+    ASSERT_FMSG(memcmp(header->magic, SNAPSHOT_MAGIC, sizeof (header->magic)) == 0,
+            "The file \"%s\" is not a vocabulary snapshot !", file_name);
+    ASSERT_FMSG(header->version == SNAPSHOT_FORMAT_VERSION, "The vocabulary snapshot \"%s\" has the format version %"
+            PRIu32 "; expected: %d !", file_name, header->version, SNAPSHOT_FORMAT_VERSION);
+    ASSERT_FMSG(header->byte_order_mark == SNAPSHOT_BYTE_ORDER_MARK && header->size_of_size_t == sizeof (size_t) &&
+            header->size_of_data_type == sizeof (DATA_TYPE) &&
+            header->size_of_slot == sizeof (struct Token_Int_Mapping_Slot),
+            "The vocabulary snapshot \"%s\" was created on an incompatible system !", file_name);
+    ASSERT_FMSG(header->file_size == new_object->snapshot_size &&
+            header->number_of_slots > 0 && (header->number_of_slots & (header->number_of_slots - 1)) == 0 &&
+            header->number_of_tokens < header->number_of_slots,
+            "The vocabulary snapshot \"%s\" is damaged !", file_name);
+
+    // Every section needs to be aligned and completely in the file; the order is the same as in the saving
+    uint64_t section_end = sizeof (struct Token_Int_Mapping_Snapshot_Header);
+    const _Bool valid_sections =
+            Is_Valid_Snapshot_Section(header->offsets_section, header->number_of_tokens, sizeof (size_t),
+                    &section_end, header->file_size) &&
+            Is_Valid_Snapshot_Section(header->flags_section, header->number_of_tokens, sizeof (_Bool),
+                    &section_end, header->file_size) &&
+            Is_Valid_Snapshot_Section(header->slots_section, header->number_of_slots,
+                    sizeof (struct Token_Int_Mapping_Slot), &section_end, header->file_size) &&
+            Is_Valid_Snapshot_Section(header->token_memory_section, header->token_memory_size, sizeof (char),
+                    &section_end, header->file_size);
+    ASSERT_FMSG(valid_sections, "The vocabulary snapshot \"%s\" is damaged !", file_name);
+
+    // Every token and every used slot needs to be in the token memory
+    const _Bool valid_content =
+            Is_Valid_Snapshot_Content((const size_t*) (new_object->snapshot + header->offsets_section),
+                    header->number_of_tokens,
+                    (const struct Token_Int_Mapping_Slot*) (new_object->snapshot + header->slots_section),
+                    header->number_of_slots, new_object->snapshot + header->token_memory_section,
+                    header->token_memory_size, header->case_sensitive != 0);
+    ASSERT_FMSG(valid_content, "The vocabulary snapshot \"%s\" is damaged !", file_name);
+
+    // The arrays will be used directly in the snapshot memory
+    new_object->token_offsets       = (size_t*) (new_object->snapshot + header->offsets_section);
+    new_object->stop_word_flags     = (_Bool*) (new_object->snapshot + header->flags_section);
+    new_object->slots               = (struct Token_Int_Mapping_Slot*) (new_object->snapshot + header->slots_section);
+    new_object->number_of_tokens    = (size_t) header->number_of_tokens;
+    new_object->allocated_tokens    = (size_t) header->number_of_tokens;
+    new_object->number_of_slots     = (size_t) header->number_of_slots;
+    new_object->case_sensitive      = (header->case_sensitive != 0) ? true : false;
+
+    new_object->snapshot_token_memory       = new_object->snapshot + header->token_memory_section;
+    new_object->snapshot_token_memory_size  = (size_t) header->token_memory_size;
+    new_object->token_memory_used           = (size_t) header->token_memory_size;
+
+    // Overlay for the new tokens
+    new_object->token_memory = (char*) MALLOC(TOKEN_MEMORY_INITIAL_SIZE * sizeof (char));
+    ASSERT_ALLOC(new_object->token_memory, "Cannot allocate memory for the token int mapping !",
+            TOKEN_MEMORY_INITIAL_SIZE * sizeof (char));
+    new_object->token_memory_allocated = TOKEN_MEMORY_INITIAL_SIZE;
+
+    // In the case-insensitive mode the spellings of the snapshot will be replaced with the first spellings of this run
+    new_object->snapshot_number_of_tokens = new_object->number_of_tokens;
+    if (! new_object->case_sensitive && new_object->snapshot_number_of_tokens > 0)
+    {
+        new_object->snapshot_tokens_seen = (_Bool*) CALLOC(new_object->snapshot_number_of_tokens, sizeof (_Bool));
+        ASSERT_ALLOC(new_object->snapshot_tokens_seen, "Cannot allocate memory for the token int mapping !",
+                new_object->snapshot_number_of_tokens * sizeof (_Bool));
+    }
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Save the Token_Int_Mapping (mapped integers, tokens, stop word flags and the hash table) as a versioned
+ * binary vocabulary snapshot.
+ *
+ * The file can be used with TokenIntMapping_CreateObjectFromSnapshot(). An existing file will be overwritten.
+ *
+ * Asserts:
+ *      object != NULL
+ *      file_name != NULL
+ *      The file can be written
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] file_name Name of the snapshot file
+ */
+extern void
+TokenIntMapping_SaveSnapshot
+(
+        const struct Token_Int_Mapping* const restrict object,
+        const char* const restrict file_name
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_MSG(file_name != NULL, "File name is NULL !");
+
+    struct Token_Int_Mapping_Snapshot_Header header;
+    memset(&header, '\0', sizeof (header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof (header.magic));
+    header.version              = SNAPSHOT_FORMAT_VERSION;
+    header.byte_order_mark      = SNAPSHOT_BYTE_ORDER_MARK;
+    header.size_of_size_t       = (uint32_t) sizeof (size_t);
+    header.size_of_data_type    = (uint32_t) sizeof (DATA_TYPE);
+    header.size_of_slot         = (uint32_t) sizeof (struct Token_Int_Mapping_Slot);
+    header.case_sensitive       = (object->case_sensitive) ? 1 : 0;
+    header.number_of_tokens     = (uint64_t) object->number_of_tokens;
+    header.number_of_slots      = (uint64_t) object->number_of_slots;
+    header.token_memory_size    = (uint64_t) object->token_memory_used;
+
+    header.offsets_section      = Align_Snapshot_Section(sizeof (header));
+    header.flags_section        = Align_Snapshot_Section(header.offsets_section +
+            object->number_of_tokens * sizeof (size_t));
+    header.slots_section        = Align_Snapshot_Section(header.flags_section +
+            object->number_of_tokens * sizeof (_Bool));
+    header.token_memory_section = Align_Snapshot_Section(header.slots_section +
+            object->number_of_slots * sizeof (struct Token_Int_Mapping_Slot));
+    header.file_size            = header.token_memory_section + header.token_memory_size;
+
+    FILE* snapshot_file = fopen(file_name, "wb");
+    ASSERT_FMSG(snapshot_file != NULL, "Cannot open/create the vocabulary snapshot \"%s\" !", file_name);
+
+    uint64_t file_position = 0;
+    Write_Snapshot_Section(snapshot_file, file_name, &file_position, 0, &header, sizeof (header));
+    Write_Snapshot_Section(snapshot_file, file_name, &file_position, header.offsets_section, object->token_offsets,
+            object->number_of_tokens * sizeof (size_t));
+    Write_Snapshot_Section(snapshot_file, file_name, &file_position, header.flags_section, object->stop_word_flags,
+            object->number_of_tokens * sizeof (_Bool));
+    Write_Snapshot_Section(snapshot_file, file_name, &file_position, header.slots_section, object->slots,
+            object->number_of_slots * sizeof (struct Token_Int_Mapping_Slot));
+    // The offsets of the overlay tokens start directly after the snapshot tokens
+    Write_Snapshot_Section(snapshot_file, file_name, &file_position, header.token_memory_section,
+            object->snapshot_token_memory, object->snapshot_token_memory_size);
+    Write_Snapshot_Section(snapshot_file, file_name, &file_position, file_position, object->token_memory,
+            object->token_memory_used - object->snapshot_token_memory_size);
+
+    const int close_result = fclose(snapshot_file);
+    ASSERT_FMSG(close_result != EOF, "Cannot close the vocabulary snapshot \"%s\" !", file_name);
+    snapshot_file = NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Print the number of tokens and the usage of the token memory.
+ *
+ * This function is especially useful in the debugging.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Token_Int_Mapping object
+ */
+extern void
+TokenIntMapping_ShowTokenMemoryUsage
+(
+        const struct Token_Int_Mapping* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+
+    printf ("Tokens:             %zu (allocated: %zu | %.2f %% used)\n", object->number_of_tokens,
+            object->allocated_tokens, Determine_Percent(object->number_of_tokens, object->allocated_tokens));
+    if (object->snapshot != NULL)
+    {
+        printf ("Snapshot tokens:    %zu B (%s)\n", object->snapshot_token_memory_size,
+                (object->snapshot_is_mapped) ? "mapped" : "read");
+    }
+    printf ("Token memory:       %zu B (allocated: %zu B | %.2f %% used)\n",
+            object->token_memory_used - object->snapshot_token_memory_size, object->token_memory_allocated,
+            Determine_Percent(object->token_memory_used - object->snapshot_token_memory_size,
+                    object->token_memory_allocated));
+    // In the case-insensitive mode every token is followed by its key with the same length. So only the half of the
+    // token memory belongs to the saved tokens
+    const size_t saved_token_memory = (object->case_sensitive) ? object->token_memory_used :
+            object->token_memory_used / 2;
+    printf ("Avg. token length:  %.3f\n\n", (object->number_of_tokens > 0) ?
+            (double) (saved_token_memory - object->number_of_tokens) / (double) object->number_of_tokens : 0.0);
+
+    TokenIntMapping_ShowMemoryUsage(object);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Print information about the allocated memory size and the used memory size.
+ *
+ * This function is especially useful in the debugging.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Token_Int_Mapping object
+ */
+extern void
+TokenIntMapping_ShowMemoryUsage
+(
+        const struct Token_Int_Mapping* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+
+    size_t allocated_memory = sizeof (struct Token_Int_Mapping) +
+            object->number_of_slots * sizeof (struct Token_Int_Mapping_Slot);
+    allocated_memory += object->token_memory_allocated * sizeof (char);
+    allocated_memory += object->allocated_tokens * (sizeof (size_t) + sizeof (_Bool));
+    const size_t used_memory = Used_Memory_Size(object);
+
+    const int field_size = (int) ((Count_Number_Of_Digits(allocated_memory) > Count_Number_Of_Digits(used_memory)) ?
+            Count_Number_Of_Digits(allocated_memory) : Count_Number_Of_Digits(used_memory));
+    UNUSED(field_size);
+
+    printf ("Allocated Token_Int_Mapping size: ");
+    Print_Memory_Size_As_B_KB_MB(allocated_memory);
+    //printf ("Allocated Token_Int_Mapping size: %*zu B (%.3f KB | %.3f MB)\n", field_size, allocated_memory,
+    //        (double) allocated_memory / 1024.0, (double) allocated_memory / 1024.0 / 1024.0);
+    printf ("Used Token_Int_Mapping size:      ");
+    Print_Memory_Size_As_B_KB_MB(used_memory);
+    //printf (" (used: %.2f %%)\n", Determine_Percent(used_memory, allocated_memory));
+    //printf ("Used Token_Int_Mapping size:      %*zu B (%.3f KB | %.3f MB) (used: %.2f %%)\n", field_size, used_memory,
+    //        (double) used_memory / 1024.0, (double) used_memory / 1024.0 / 1024.0,
+    //        Determine_Percent(used_memory, allocated_memory));
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Print statistics of the hash table: Load factor and the probe lengths.
+ *
+ * The probe length of a token is the number of visited slots to find the token (or the empty slot for a new token).
+ * The statistics of the saved tokens will be determined in this function; the statistics of the TokenIntMapping_AddToken()
+ * calls were counted in the calls.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Token_Int_Mapping object
+ */
+extern void
+TokenIntMapping_ShowHashTableStatistics
+(
+        const struct Token_Int_Mapping* const object
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+
+    // The same values as in the JSON export of the statistics
+    struct Token_Int_Mapping_Statistics statistics;
+    TokenIntMapping_GetStatistics(object, &statistics);
+
+    printf ("Hash table slots:              %zu (%zu tokens | load factor: %.2f %%)\n", statistics.number_of_slots,
+            statistics.number_of_tokens, statistics.load_factor * 100.0);
+    printf ("Probe length of saved tokens:  avg. %.3f | max. %zu\n", statistics.avg_probe_length,
+            statistics.max_probe_length);
+    printf ("Probe length of add calls:     avg. %.3f | max. %zu (%zu calls)\n", statistics.avg_intern_probe_length,
+            statistics.max_intern_probe_length, statistics.intern_calls);
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the statistics of the mapping.
+ *
+ * The probe lengths of the saved tokens will be determined in this function (one pass over the hash table); all other
+ * values were counted in the calls.
+ *
+ * Asserts:
+ *      object != NULL
+ *      result != NULL
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[out] result Statistics
+ */
+extern void
+TokenIntMapping_GetStatistics
+(
+        const struct Token_Int_Mapping* const restrict object,
+        struct Token_Int_Mapping_Statistics* const restrict result
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_MSG(result != NULL, "Result statistics object is NULL !");
+
+    memset (result, '\0', sizeof (struct Token_Int_Mapping_Statistics));
+
+    // Probe length of the saved tokens: Distance between the slot, that the hash value selects, and the real slot
+    const size_t mask = object->number_of_slots - 1;
+    size_t sum_probe_lengths = 0;
+    for (size_t i = 0; i < object->number_of_slots; ++ i)
+    {
+        if (object->slots [i].length == 0) { continue; }
+
+        const size_t probe_length = ((i - (object->slots [i].hash & mask)) & mask) + 1;
+        sum_probe_lengths += probe_length;
+        if (probe_length > result->max_probe_length) { result->max_probe_length = probe_length; }
+        ++ result->probe_length_histogram [(probe_length < PROBE_LENGTH_HISTOGRAM_SIZE) ?
+                probe_length - 1 : PROBE_LENGTH_HISTOGRAM_SIZE - 1];
+    }
+
+    result->number_of_tokens        = object->number_of_tokens;
+    result->number_of_slots         = object->number_of_slots;
+    result->load_factor             = (object->number_of_slots > 0) ?
+            (double) object->number_of_tokens / (double) object->number_of_slots : 0.0;
+    result->avg_probe_length        = (object->number_of_tokens > 0) ?
+            (double) sum_probe_lengths / (double) object->number_of_tokens : 0.0;
+
+    result->intern_calls            = object->add_token_calls;
+    result->intern_hits             = object->add_token_hits;
+    result->intern_hit_rate         = (object->add_token_calls > 0) ?
+            (double) object->add_token_hits / (double) object->add_token_calls : 0.0;
+    result->avg_intern_probe_length = (object->add_token_calls > 0) ?
+            (double) object->add_token_probes / (double) object->add_token_calls : 0.0;
+    result->max_intern_probe_length = object->max_probe_length;
+
+    result->lookup_calls            = object->lookup_calls;
+    result->lookup_hits             = object->lookup_hits;
+    result->lookup_hit_rate         = (object->lookup_calls > 0) ?
+            (double) object->lookup_hits / (double) object->lookup_calls : 0.0;
+
+    result->token_memory_used       = object->token_memory_used;
+    result->memory_used             = Used_Memory_Size(object);
+    result->bytes_per_token         = (object->number_of_tokens > 0) ?
+            (double) result->memory_used / (double) object->number_of_tokens : 0.0;
+
+    result->time_measured           = object->measure_time;
+    result->intern_seconds          = (double) object->add_token_time_ns / 1e9;
+    result->lookup_seconds          = (double) object->lookup_time_ns / 1e9;
+
+    result->from_snapshot           = object->snapshot != NULL;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the integer value for the given token. (token -> int)
+ *
+ * The object will not be changed. So this function can be used from multiple threads at the same time, as long as no
+ * new token will be added. The call will not be counted in the statistics; see TokenIntMapping_CountedTokenToInt().
+ *
+ * Asserts:
+ *      object != NULL
+ *      search_token != NULL
+ *      search_token_length > 0
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] search_token Given token
+ * @param[in] search_token_length Token length
+ *
+ * @return Mapping integer or UINT_FAST32_MAX, if the token is not in the mapping list
+ */
+extern DATA_TYPE
+TokenIntMapping_TokenToInt
+(
+        const struct Token_Int_Mapping* const restrict object,
+        const char* const restrict search_token,
+        const size_t search_token_length
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_MSG(search_token != NULL, "New token is NULL !");
+    ASSERT_MSG(search_token_length > 0, "New token has the length 0 !");
+
+    char key_stack_buffer [KEY_STACK_BUFFER_SIZE];
+    char* key_dynamic_buffer = NULL;
+    const char* const key = Create_Key(object, search_token, search_token_length, key_stack_buffer,
+            &key_dynamic_buffer);
+    DATA_TYPE result = DATA_TYPE_MAX;
+
+    size_t probes = 0;
+    const size_t slot = Find_Slot(object, key, search_token_length, Token_Hash_Function(key, search_token_length),
+            &probes);
+
+    // An empty slot means, that the token is not in the mapping list
+    if (object->slots [slot].length != 0) { result = object->slots [slot].token_int_value; }
+    if (key_dynamic_buffer != NULL) { FREE_AND_SET_TO_NULL(key_dynamic_buffer); }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Determine the integer value for the given token (token -> int) and count the call in the statistics of the
+ * object. With measure_time the time of the call will be measured, too.
+ *
+ * The counters will be changed. So this function cannot be used from multiple threads at the same time.
+ *
+ * Asserts:
+ *      object != NULL
+ *      search_token != NULL
+ *      search_token_length > 0
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] search_token Given token
+ * @param[in] search_token_length Token length
+ *
+ * @return Mapping integer or UINT_FAST32_MAX, if the token is not in the mapping list
+ */
+extern DATA_TYPE
+TokenIntMapping_CountedTokenToInt
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict search_token,
+        const size_t search_token_length
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+
+    const uint64_t start_time = (object->measure_time) ? Current_Time_In_Ns() : 0;
+    const DATA_TYPE result = TokenIntMapping_TokenToInt(object, search_token, search_token_length);
+
+    ++ object->lookup_calls;
+    if (result != DATA_TYPE_MAX) { ++ object->lookup_hits; }
+    if (object->measure_time) { object->lookup_time_ns += Current_Time_In_Ns() - start_time; }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Reverse the mapping. int -> token
+ *
+ * The mapped integer is the index in the offset array. So no search is necessary.
+ *
+ * The result is a pointer into the token memory of the object; there is no copy. So this function can be used from
+ * multiple threads at the same time. The pointer is valid as long as no new token will be added.
+ *
+ * Asserts:
+ *      object != NULL
+ *      token_int_value is a valid mapped integer
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token_int_value Mapped integer
+ *
+ * @return Pointer to the saved token
+ */
+extern const char*
+TokenIntMapping_IntToTokenPtr
+(
+        const struct Token_Int_Mapping* const object,
+        const DATA_TYPE token_int_value
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_FMSG(token_int_value < object->number_of_tokens, "Token integer value %" PRIuFAST32 " is not a valid "
+            "mapped integer !", (uint_fast32_t) token_int_value);
+
+    return Token_Memory_Address(object, object->token_offsets [token_int_value]);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Reverse the mapping and copy the token in the given memory. int -> token
+ *
+ * Asserts:
+ *      object != NULL
+ *      token_int_value is a valid mapped integer
+ *      result_token_memory != NULL
+ *      result_token_memory_size > 0
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token_int_value Mapped integer
+ * @param[out] result_token_memory Memory, where the result token starts
+ * @param[in] result_token_memory_size length of the result token
+ */
+extern void
+TokenIntMapping_IntToToken
+(
+        const struct Token_Int_Mapping* const restrict object,
+        const DATA_TYPE token_int_value,
+        char* const restrict result_token_memory,
+        const size_t result_token_memory_size
+)
+{
+    ASSERT_MSG(result_token_memory != NULL, "The result token memory is NULL !");
+    ASSERT_MSG(result_token_memory_size > 0, "The length of the result token memory is 0 !");
+
+    strncpy(result_token_memory, TokenIntMapping_IntToTokenPtr(object, token_int_value), result_token_memory_size - 1);
+    result_token_memory [result_token_memory_size - 1] = '\0';
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Is the token with the given mapped integer a stop word ?
+ *
+ * The mapped integer is the index in the flag array. So no search and no string comparison is necessary.
+ *
+ * Asserts:
+ *      object != NULL
+ *      token_int_value is a valid mapped integer
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token_int_value Mapped integer
+ *
+ * @return true, if the token is a stop word, otherwise false
+ */
+extern _Bool
+TokenIntMapping_IsStopWord
+(
+        const struct Token_Int_Mapping* const object,
+        const DATA_TYPE token_int_value
+)
+{
+    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_FMSG(token_int_value < object->number_of_tokens, "Token integer value %" PRIuFAST32 " is not a valid "
+            "mapped integer !", (uint_fast32_t) token_int_value);
+
+    return object->stop_word_flags [token_int_value];
+}
+
+//=====================================================================================================================
+
+static struct Token_Int_Mapping*
+TokenIntMapping_CreateObject_Internal
+(
+        const _Bool case_sensitive
+)
+{
+    // Outer object
+    struct Token_Int_Mapping* new_object = (struct Token_Int_Mapping*) CALLOC(1, sizeof (struct Token_Int_Mapping));
+    ASSERT_ALLOC(new_object, "Cannot create a new token int mapping !", sizeof (struct Token_Int_Mapping));
+
+    // Token memory and the per token arrays
+    new_object->token_memory = (char*) MALLOC(TOKEN_MEMORY_INITIAL_SIZE * sizeof (char));
+    ASSERT_ALLOC(new_object->token_memory, "Cannot allocate memory for the token int mapping !",
+            TOKEN_MEMORY_INITIAL_SIZE * sizeof (char));
+    new_object->token_memory_allocated = TOKEN_MEMORY_INITIAL_SIZE;
+
+    new_object->token_offsets = (size_t*) MALLOC(TOKENS_INITIAL_SIZE * sizeof (size_t));
+    ASSERT_ALLOC(new_object->token_offsets, "Cannot allocate memory for the token int mapping !",
+            TOKENS_INITIAL_SIZE * sizeof (size_t));
+    new_object->stop_word_flags = (_Bool*) MALLOC(TOKENS_INITIAL_SIZE * sizeof (_Bool));
+    ASSERT_ALLOC(new_object->stop_word_flags, "Cannot allocate memory for the token int mapping !",
+            TOKENS_INITIAL_SIZE * sizeof (_Bool));
+    new_object->allocated_tokens = TOKENS_INITIAL_SIZE;
+
+    new_object->slots = (struct Token_Int_Mapping_Slot*) CALLOC(HASH_TABLE_INITIAL_SLOTS,
+            sizeof (struct Token_Int_Mapping_Slot));
+    ASSERT_ALLOC(new_object->slots, "Cannot allocate memory for the hash table of the token int mapping !",
+            HASH_TABLE_INITIAL_SLOTS * sizeof (struct Token_Int_Mapping_Slot));
+    new_object->number_of_slots = HASH_TABLE_INITIAL_SLOTS;
+
+    new_object->case_sensitive = case_sensitive;
+
+    return new_object;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Hash function for the hash table.
+ *
+ * FNV-1a over the key of a token with a final avalanche step. In the case-insensitive mode the key is already case
+ * folded; so the chars can be used directly.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] input_str Input C-String
+ * @param[in] input_str_length Length of the input string
+ *
+ * @return Hash value
+ */
+static inline uint32_t
+Token_Hash_Function
+(
+        const char* const input_str,
+        const size_t input_str_length
+)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < input_str_length; ++ i)
+    {
+        hash ^= (uint32_t) (unsigned char) input_str [i];
+        hash *= 16777619u;
+    }
+
+    // Avalanche step: Every input bit affects the lower bits, that select the slot
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Get the saved key of a mapped integer.
+ *
+ * In the case-sensitive mode the key is the token itself. Otherwise the key follows directly after the token.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token_int_value Mapped integer (Needs to be valid)
+ * @param[in] token_length Length of the saved token
+ *
+ * @return Pointer to the saved key
+ */
+static inline const char*
+Saved_Key_Of_Int_Value
+(
+        const struct Token_Int_Mapping* const object,
+        const DATA_TYPE token_int_value,
+        const size_t token_length
+)
+{
+    const size_t key_offset = (object->case_sensitive) ? 0 : token_length + 1;
+
+    return Token_Memory_Address(object, object->token_offsets [token_int_value] + key_offset);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Create the key of a token. The key will be used for the hash value and for the comparison.
+ *
+ * In the case-sensitive mode the token itself is the key. Otherwise the case folded token will be written in a key
+ * buffer: Short keys use the given stack buffer; longer keys need a dynamic buffer, that the caller needs to free.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token Token
+ * @param[in] token_length Length of the token
+ * @param[out] key_stack_buffer Buffer with KEY_STACK_BUFFER_SIZE bytes
+ * @param[out] key_dynamic_buffer Dynamic buffer for long keys (NULL, if not used)
+ *
+ * @return Pointer to the key (It has the same length as the token)
+ */
+static inline const char*
+Create_Key
+(
+        const struct Token_Int_Mapping* const restrict object,
+        const char* const restrict token,
+        const size_t token_length,
+        char* const restrict key_stack_buffer,
+        char** const restrict key_dynamic_buffer
+)
+{
+    if (object->case_sensitive) { return token; }
+
+    char* key = key_stack_buffer;
+    if (token_length > KEY_STACK_BUFFER_SIZE)
+    {
+        *key_dynamic_buffer = (char*) MALLOC(token_length * sizeof (char));
+        ASSERT_ALLOC(*key_dynamic_buffer, "Cannot allocate memory for a token key !", token_length * sizeof (char));
+        key = *key_dynamic_buffer;
+    }
+    u8_fold_case(key, token, token_length);
+
+    return key;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Search the slot of a token in the hash table (Linear probing).
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token Key of the searched token
+ * @param[in] token_length Length of the key
+ * @param[in] hash Hash value of the key
+ * @param[out] probes Number of visited slots
+ *
+ * @return Index of the slot with the token or of the first empty slot, if the token is not in the hash table
+ */
+static inline size_t
+Find_Slot
+(
+        const struct Token_Int_Mapping* const restrict object,
+        const char* const restrict token,
+        const size_t token_length,
+        const uint32_t hash,
+        size_t* const restrict probes
+)
+{
+    const size_t mask = object->number_of_slots - 1;
+    size_t slot = hash & mask;
+    size_t visited_slots = 1;
+
+    // The load factor guarantees, that there is always a empty slot
+    while (object->slots [slot].length != 0)
+    {
+        // Before the comparison: Have the strings the same hash value and the same length ?
+        if (object->slots [slot].hash == hash && object->slots [slot].length == token_length &&
+                memcmp (token, Saved_Key_Of_Int_Value(object, object->slots [slot].token_int_value, token_length),
+                        token_length) == 0)
+        {
+            break;
+        }
+        slot = (slot + 1) & mask;
+        ++ visited_slots;
+    }
+
+    *probes = visited_slots;
+
+    return slot;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Double the number of slots of the hash table.
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ */
+static void
+Grow_Hash_Table
+(
+        struct Token_Int_Mapping* const object
+)
+{
+    const size_t new_number_of_slots = object->number_of_slots << 1;
+    const size_t new_mask = new_number_of_slots - 1;
+
+    struct Token_Int_Mapping_Slot* new_slots = (struct Token_Int_Mapping_Slot*) CALLOC(new_number_of_slots,
+            sizeof (struct Token_Int_Mapping_Slot));
+    ASSERT_ALLOC(new_slots, "Cannot increase the hash table of the token int mapping !",
+            new_number_of_slots * sizeof (struct Token_Int_Mapping_Slot));
+
+    // The saved hash values make a rehash without string operations possible
+    for (size_t i = 0; i < object->number_of_slots; ++ i)
+    {
+        if (object->slots [i].length == 0) { continue; }
+
+        size_t slot = object->slots [i].hash & new_mask;
+        while (new_slots [slot].length != 0) { slot = (slot + 1) & new_mask; }
+        new_slots [slot] = object->slots [i];
+    }
+
+    if (! Is_Snapshot_Memory(object, object->slots)) { FREE_AND_SET_TO_NULL(object->slots); }
+    object->slots = new_slots;
+    object->number_of_slots = new_number_of_slots;
+
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Get the mapped integer of a token with a known key and hash value. If the token is not in the mapping object,
+ * it will be added.
+ *
+ * This is the common part of TokenIntMapping_Intern() and TokenIntMapping_Merge().
+ *
+ * Asserts:
+ *      N/A
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] new_token New token
+ * @param[in] key Key of the new token (see Create_Key())
+ * @param[in] new_token_length Length of the new token (and of the key)
+ * @param[in] hash Hash value of the key
+ * @param[in] stop_word_flag Known stop word flag of the token (NULL: The flag will be determined, if necessary)
+ *
+ * @return Mapping integer of the existing or the new token
+ */
+static DATA_TYPE
+Intern_Key
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict new_token,
+        const char* const restrict key,
+        const size_t new_token_length,
+        const uint32_t hash,
+        const _Bool* const restrict stop_word_flag
+)
+{
+    // Is the new token already in the list ?
+    size_t probes = 0;
+    size_t slot = Find_Slot(object, key, new_token_length, hash, &probes);
+
+    ++ object->add_token_calls;
+    object->add_token_probes += probes;
+    if (probes > object->max_probe_length) { object->max_probe_length = probes; }
+
+    // Token already exists
+    if (object->slots [slot].length != 0)
+    {
+        ++ object->add_token_hits;
+        const DATA_TYPE token_int_value = object->slots [slot].token_int_value;
+        if (object->snapshot_tokens_seen != NULL && token_int_value < object->snapshot_number_of_tokens &&
+                ! object->snapshot_tokens_seen [token_int_value])
+        {
+            Use_Spelling_Of_This_Run(object, token_int_value, new_token, new_token_length, stop_word_flag);
+        }
+        return token_int_value;
+    }
+
+    // The token will be saved with the full length (No truncation to MAX_TOKEN_LENGTH)
+    const size_t saved_token_length = new_token_length;
+    const DATA_TYPE new_mapping_int = (DATA_TYPE) object->number_of_tokens;
+    // In the case-insensitive mode the key will be saved after the token
+    const size_t needed_memory = (object->case_sensitive) ? saved_token_length + 1 : (saved_token_length + 1) * 2;
+
+    // With a snapshot the new tokens will be appended to the overlay
+    const size_t overlay_memory_used = object->token_memory_used - object->snapshot_token_memory_size;
+
+    // Is more memory necessary to hold the new token ? Yes: Realloc the memory
+    if (overlay_memory_used + needed_memory > object->token_memory_allocated)
+    {
+        size_t new_size = object->token_memory_allocated * 2;
+        while (overlay_memory_used + needed_memory > new_size) { new_size *= 2; }
+
+        char* tmp_ptr = (char*) REALLOC(object->token_memory, new_size * sizeof (char));
+        ASSERT_ALLOC(tmp_ptr, "Cannot reallocate memory for token to int mapping data !", new_size * sizeof (char));
+
+        object->token_memory            = tmp_ptr;
+        object->token_memory_allocated  = new_size;
+    }
+    if (object->number_of_tokens >= object->allocated_tokens)
+    {
+        const size_t new_size = (object->allocated_tokens > 0) ? object->allocated_tokens * 2 : TOKENS_INITIAL_SIZE;
+        size_t* tmp_ptr = NULL;
+        _Bool* tmp_ptr_2 = NULL;
+
+        if (Is_Snapshot_Memory(object, object->token_offsets))
+        {
+            // The arrays in a snapshot cannot be reallocated; they need to be copied
+            tmp_ptr = (size_t*) MALLOC(new_size * sizeof (size_t));
+            ASSERT_ALLOC(tmp_ptr, "Cannot allocate memory for token to int mapping data !", new_size * sizeof (size_t));
+            memcpy (tmp_ptr, object->token_offsets, object->number_of_tokens * sizeof (size_t));
+
+            tmp_ptr_2 = (_Bool*) MALLOC(new_size * sizeof (_Bool));
+            ASSERT_ALLOC(tmp_ptr_2, "Cannot allocate memory for token to int mapping data !",
+                    new_size * sizeof (_Bool));
+            memcpy (tmp_ptr_2, object->stop_word_flags, object->number_of_tokens * sizeof (_Bool));
+        }
+        else
+        {
+            tmp_ptr = (size_t*) REALLOC(object->token_offsets, new_size * sizeof (size_t));
+            ASSERT_ALLOC(tmp_ptr, "Cannot reallocate memory for token to int mapping data !",
+                    new_size * sizeof (size_t));
+
+            tmp_ptr_2 = (_Bool*) REALLOC(object->stop_word_flags, new_size * sizeof (_Bool));
+            ASSERT_ALLOC(tmp_ptr_2, "Cannot reallocate memory for token to int mapping data !",
+                    new_size * sizeof (_Bool));
+        }
+
+        object->token_offsets       = tmp_ptr;
+        object->stop_word_flags     = tmp_ptr_2;
+        object->allocated_tokens    = new_size;
+    }
+
+    // Append the token to the token memory
+    char* const saved_token = &(object->token_memory [overlay_memory_used]);
+    memcpy (saved_token, new_token, saved_token_length);
+    saved_token [saved_token_length] = '\0';
+    if (! object->case_sensitive)
+    {
+        memcpy (saved_token + saved_token_length + 1, key, saved_token_length);
+        saved_token [saved_token_length + 1 + saved_token_length] = '\0';
+    }
+    object->token_offsets [new_mapping_int] = object->token_memory_used;
+    object->token_memory_used += needed_memory;
+
+    // The stop word check uses the saved token, because the reverse mapping returns exact this token
+    object->stop_word_flags [new_mapping_int] = (stop_word_flag != NULL) ? *stop_word_flag :
+            Is_Word_In_Stop_Word_List(saved_token, saved_token_length, ENG);
 
-IS_TYPE(C_STR_ALLOCATION_STEP_SIZE, int)
-#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+    // Insert the token in the hash table
+    object->slots [slot].hash = hash;
+    object->slots [slot].length = (uint32_t) saved_token_length;
+    object->slots [slot].token_int_value = new_mapping_int;
+    ++ object->number_of_tokens;
 
-/**
- * @brief A very very very simple "hash function".
- *
- * This function is used to calculate a number for distributing the tokens in different C-Strings.
- *
- * All char of the token will be interpreted as ASCII integer, added and modulo C_STR_ARRAYS.
- *
- * Asserts:
- *      input_str != NULL
- *      input_str_length > 0
- *
- * @param[in] input_str Input C-String
- * @param[in] input_str_length Length of the input string
- *
- * @return The result
- */
-static inline uint_fast32_t
-Pseudo_Hash_Function
-(
-        const char* const input_str,
-        const size_t input_str_length
-);
+    if (object->number_of_tokens * 100 > object->number_of_slots * HASH_TABLE_MAX_LOAD_PERCENT)
+    {
+        Grow_Hash_Table(object);
+    }
+
+    return new_mapping_int;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Create new dynamic Token_Int_Mapping object.
+ * @brief Use the spelling of the first intern in this run for a snapshot token.
  *
- * This is the internal creation function, that will be used from the public creation functions:
- * - TokenIntMapping_CreateObject
- * - TokenIntMapping_CreateObjectWithGivenCmpFunction
+ * Without a snapshot the first spelling of a token in the run will be saved and the stop word flag belongs to this
+ * spelling. In the case-insensitive mode the snapshot can contain a different spelling with the same key. The spelling
+ * will be overwritten in place (The key and so the length are the same; the snapshot memory is a private copy) and the
+ * stop word flag will be determined again.
  *
  * Asserts:
  *      N/A
  *
- * @return Pointer to the new object
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token_int_value Mapped integer of the snapshot token
+ * @param[in] new_token Spelling of the first intern in this run
+ * @param[in] new_token_length Length of the spelling (Same as the length of the saved token)
+ * @param[in] stop_word_flag Known stop word flag of the spelling (NULL: The flag will be determined)
  */
-static struct Token_Int_Mapping*
-TokenIntMapping_CreateObject_Internal
+static void
+Use_Spelling_Of_This_Run
 (
-        Cmp_Func cmp_func
-);
+        struct Token_Int_Mapping* const restrict object,
+        const DATA_TYPE token_int_value,
+        const char* const restrict new_token,
+        const size_t new_token_length,
+        const _Bool* const restrict stop_word_flag
+)
+{
+    char* const saved_token = object->snapshot_token_memory + object->token_offsets [token_int_value];
+    memcpy (saved_token, new_token, new_token_length);
+    object->stop_word_flags [token_int_value] = (stop_word_flag != NULL) ? *stop_word_flag :
+            Is_Word_In_Stop_Word_List(saved_token, new_token_length, ENG);
+    object->snapshot_tokens_seen [token_int_value] = true;
+
+    return;
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Create new dynamic Token_Int_Mapping object with the default comparison function (strncmp: case-sensitive
- * comparison)
+ * @brief Get the length of the saved token of a mapped integer.
+ *
+ * The length is the distance to the next token in the token memory. (In the case-insensitive mode the key is between
+ * the tokens)
  *
  * Asserts:
  *      N/A
  *
- * @return Pointer to the new object
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token_int_value Mapped integer (Needs to be valid)
+ *
+ * @return Length of the saved token
  */
-extern struct Token_Int_Mapping*
-TokenIntMapping_CreateObject
+static inline size_t
+Saved_Token_Length
 (
-        void
+        const struct Token_Int_Mapping* const object,
+        const DATA_TYPE token_int_value
 )
 {
-    return TokenIntMapping_CreateObject_Internal(&strncmp);
+    const size_t next_offset = ((size_t) token_int_value + 1 < object->number_of_tokens) ?
+            object->token_offsets [token_int_value + 1] : object->token_memory_used;
+    const size_t saved_bytes = next_offset - object->token_offsets [token_int_value];
+
+    return ((object->case_sensitive) ? saved_bytes : saved_bytes / 2) - 1;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Create new dynamic Token_Int_Mapping object with user-defined comparison function for the tokens.
+ * @brief Comparison function for qsort: Higher frequency first; with the same frequency the smaller old integer first.
  *
  * Asserts:
  *      N/A
  *
- * @param[in] cmp_func User-defined comparison function for the tokens.
+ * @param[in] a First struct Token_Frequency
+ * @param[in] b Second struct Token_Frequency
  *
- * @return Pointer to the new object
+ * @return Comparison result for qsort
  */
-extern struct Token_Int_Mapping*
-TokenIntMapping_CreateObjectWithGivenCmpFunction
+static int
+Compare_Token_Frequencies
 (
-        Cmp_Func cmp_func
+        const void* a,
+        const void* b
 )
 {
-    return TokenIntMapping_CreateObject_Internal(cmp_func);
+    const struct Token_Frequency* const token_a = (const struct Token_Frequency*) a;
+    const struct Token_Frequency* const token_b = (const struct Token_Frequency*) b;
+
+    if (token_a->frequency != token_b->frequency)
+    {
+        return (token_a->frequency > token_b->frequency) ? -1 : 1;
+    }
+
+    return (token_a->token_int_value < token_b->token_int_value) ? -1 :
+            ((token_a->token_int_value > token_b->token_int_value) ? 1 : 0);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Delete a dynamic allocated Token_Int_Mapping object.
+ * @brief Get the address of a token memory offset.
+ *
+ * The offsets below snapshot_token_memory_size are in the loaded snapshot. All other offsets are in the token memory
+ * (overlay). Without a snapshot every offset is in the token memory.
  *
  * Asserts:
- *      object != NULL
+ *      N/A
  *
  * @param[in] object Token_Int_Mapping object
+ * @param[in] offset Token memory offset
+ *
+ * @return Address of the offset
  */
-extern void
-TokenIntMapping_DeleteObject
+static inline const char*
+Token_Memory_Address
 (
-        struct Token_Int_Mapping* object
+        const struct Token_Int_Mapping* const object,
+        const size_t offset
 )
 {
-    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
-    object->cmp_func = NULL;
-
-    // Delete the inner objects
-    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
-    {
-        free(object->c_str_arrays [i]);
-        object->c_str_arrays [i] = NULL;
-        free(object->int_mapping [i]);
-        object->int_mapping [i] = NULL;
-//        FREE_AND_SET_TO_NULL(object->c_str_arrays [i]);
-//        FREE_AND_SET_TO_NULL(object->int_mapping [i]);
-    }
-    GLOBAL_free_calls += (C_STR_ARRAYS << 1);
-    FREE_AND_SET_TO_NULL(object);
-
-    return;
+    return (offset < object->snapshot_token_memory_size) ? object->snapshot_token_memory + offset :
+            object->token_memory + (offset - object->snapshot_token_memory_size);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Add token to the mapping object.
- *
- * The return value is an flag and indicates whether the operation was successful. The process is not successful, if
- * the token already exists in the mapping table. In this case there will be NO duplicate in the mapping table.
- *
- *
- * How the mapping integers works:
- * The first two digits are equal with the integer mapping array index.
- *
- * The reason:
- * For the reverse mapping process (int -> token) it is necessary, that in the integer values the corresponding
- * integer mapping array index is coded. This will be done with the first two digits. You know with a int
- * value - e.g. a 1942 - that this value can only occur in the integer mapping array with the index 42.
- *
- * Okay. But for adding a token in the mapping we need to encode the knowledge of our chosen C-String array in
- * the mapped integer value.
- *
- * The idea:
- * - Find the maximum value in the selected integer mapping array. In our example: 1942
- * - Remove the encoding:                                           1942 / 100 (C_STR_ARRAYS)   -> 19
- * - Increment the value:                                           19 + 1                      -> 20
- * - Shift the value two digits (in decimal system) to the left:    20 * 100 (C_STR_ARRAYS)     -> 2000
- * - Add the encoding (the chosen C-String array):                  2000 + 42                   -> 2042
+ * @brief Is the given memory a part of the loaded snapshot ?
  *
+ * Such memory cannot be reallocated or freed.
  *
  * Asserts:
- *      object != NULL
- *      new_token != NULL
- *      new_token_length > 0
+ *      N/A
  *
  * @param[in] object Token_Int_Mapping object
- * @param[in] new_token New token
- * @param[in] new_token_length Length of the new token
+ * @param[in] memory Memory address
  *
- * @return Flag, which indicates, whether the operation was successful.
+ * @return true, if the memory is a part of the snapshot, otherwise false
  */
-extern _Bool
-TokenIntMapping_AddToken
+static inline _Bool
+Is_Snapshot_Memory
 (
-        struct Token_Int_Mapping* const restrict object,
-        const char* const restrict new_token,
-        const size_t new_token_length
+        const struct Token_Int_Mapping* const object,
+        const void* const memory
 )
 {
-    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
-    ASSERT_MSG(new_token != NULL, "New token is NULL !");
-    ASSERT_MSG(new_token_length > 0, "New token has the length 0 !");
-
-    const uint_fast32_t chosen_c_string_array = Pseudo_Hash_Function (new_token, new_token_length);
+    if (object->snapshot == NULL) { return false; }
 
-    // Is more memory necessary to hold the new token ? Yes: Realloc the memory
-    if (object->c_str_array_lengths [chosen_c_string_array] >= object->allocated_c_strings_in_array [chosen_c_string_array])
-    {
-        static size_t token_to_int_realloc_counter = 0;
-        ++ token_to_int_realloc_counter;
-
-        const size_t old_size = object->allocated_c_strings_in_array [chosen_c_string_array];
-        const size_t new_size = old_size + C_STR_ALLOCATION_STEP_SIZE;
-        const size_t new_c_string_array_size    = new_size * MAX_TOKEN_LENGTH * sizeof (char);
-        const size_t new_int_mapping_array_size = new_size * 1 * sizeof (uint_fast32_t); // NO MAX_TOKEN_LENGTH !
-
-        // Reallocate the c strings and the int mapping memory
-        char* tmp_ptr = (char*) REALLOC(object->c_str_arrays [chosen_c_string_array], new_c_string_array_size);
-        ASSERT_ALLOC(tmp_ptr, "Cannot reallocate memory for token to int mapping data !", new_c_string_array_size);
-        memset(tmp_ptr + (old_size * MAX_TOKEN_LENGTH), '\0', C_STR_ALLOCATION_STEP_SIZE * MAX_TOKEN_LENGTH *
-                sizeof (char));
-
-        DATA_TYPE* tmp_ptr_2 = (DATA_TYPE*) REALLOC(object->int_mapping [chosen_c_string_array], new_int_mapping_array_size);
-        ASSERT_ALLOC(tmp_ptr_2, "Cannot reallocate memory for token to int mapping data !", new_int_mapping_array_size);
-        memset(tmp_ptr_2 + (old_size), '\0', C_STR_ALLOCATION_STEP_SIZE * 1 * sizeof (DATA_TYPE)); // NO MAX_TOKEN_LENGTH !
-
-        object->c_str_arrays [chosen_c_string_array]    = tmp_ptr;
-        object->int_mapping [chosen_c_string_array]     = tmp_ptr_2;
-
-        object->allocated_c_strings_in_array [chosen_c_string_array] = new_size;
-
-        //PRINTF_FFLUSH("Token to int realloc. From %zu to %zu objects (%zu times)\n", old_size, new_size,
-        //        token_to_int_realloc_counter);
-    }
-
-    char* start_to_str = object->c_str_arrays [chosen_c_string_array];
-    char* to_str = start_to_str;
-    DATA_TYPE* int_mapping_array = object->int_mapping [chosen_c_string_array];
-    const uint_fast32_t c_str_array_length = object->c_str_array_lengths [chosen_c_string_array];
-
-    // Is the new token already in the list ?
-    _Bool token_already_in_list = false;
-    for (uint_fast32_t i = 0; i < c_str_array_length; ++ i)
-    {
-        // Pre check the first char to avoid compare strings calls
-        // It is possible, that the program does a case insensitive comparison. For this case only a lower comparison
-        // will always produce the right result !
-        if (tolower(new_token [0]) == tolower(to_str [0]))
-        {
-            // Before the comparison: Have the strings the same length ?
-            if (new_token_length == strlen (to_str))
-            {
-                if (object->cmp_func (new_token, to_str, new_token_length) == 0)
-                {
-                    token_already_in_list = true;
-                    break;
-                }
-            }
-        }
-        to_str += MAX_TOKEN_LENGTH;
-    }
-    to_str = start_to_str;
+    const uintptr_t address = (uintptr_t) memory;
+    const uintptr_t snapshot_begin = (uintptr_t) object->snapshot;
 
-    if (! token_already_in_list)
-    {
-        strncpy (&(to_str [object->c_str_array_lengths [chosen_c_string_array] * MAX_TOKEN_LENGTH]),
-                new_token, MAX_TOKEN_LENGTH - 1);// ((new_token_length >= MAX_TOKEN_LENGTH) ? MAX_TOKEN_LENGTH - 1 : new_token_length));
-        to_str [object->c_str_array_lengths [chosen_c_string_array] * MAX_TOKEN_LENGTH + MAX_TOKEN_LENGTH - 1] = '\0';
-
-        // Guarantee a zero byte at the end
-        //to_str [((object->c_str_array_lengths [chosen_c_string_array] + 1) * MAX_TOKEN_LENGTH) - 1] = '\0';
-
-        // Find the max. mapping integer in the chosen array
-        DATA_TYPE max_mapping_int_in_chosen_array = 0;
-        for (uint_fast32_t i = 0; i < c_str_array_length; ++ i)
-        {
-            if (int_mapping_array [i] > max_mapping_int_in_chosen_array)
-            {
-                max_mapping_int_in_chosen_array = int_mapping_array [i];
-            }
-        }
-        max_mapping_int_in_chosen_array /= C_STR_ARRAYS;                        // Remove encoding
-        ++ max_mapping_int_in_chosen_array;                                     // Increment value
-        max_mapping_int_in_chosen_array *= C_STR_ARRAYS;                        // Shift two digits (in decimal system) to the left
-        max_mapping_int_in_chosen_array += (DATA_TYPE) chosen_c_string_array;   // Add the encoding in the fist two digits
-        // For a detailed description about the encoding system: See the function comment !
-
-                /*object->c_str_array_lengths [chosen_c_string_array] + (chosen_c_string_array * C_STR_ARRAYS);
-        if (count_c_str_array_lengths / C_STR_ARRAYS >= C_STR_ARRAYS)
-            printf ("\n%d || %d\n", count_c_str_array_lengths, count_c_str_array_lengths / C_STR_ARRAYS);*/
-
-        int_mapping_array [object->c_str_array_lengths [chosen_c_string_array]] = max_mapping_int_in_chosen_array;
-        object->c_str_array_lengths [chosen_c_string_array] ++;
-    }
-
-    return ! token_already_in_list;
+    return address >= snapshot_begin && address < snapshot_begin + object->snapshot_size;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Print the number of tokens in all C-Strings.
- *
- * This function is especially useful in the debugging.
+ * @brief Round a file position up to the next section alignment of a snapshot file.
  *
  * Asserts:
- *      object != NULL
+ *      N/A
  *
- * @param[in] object Token_Int_Mapping object
+ * @param[in] file_position File position
+ *
+ * @return Aligned file position
  */
-extern void
-TokenIntMapping_ShowStringArrayUsage
+static inline uint64_t
+Align_Snapshot_Section
 (
-        const struct Token_Int_Mapping* const object
+        const uint64_t file_position
 )
 {
-    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
-
-    // Find the maximum values (used elements and allocated sizes)
-    size_t max_allocated            = 0;
-    size_t max_used                 = 0;
-    size_t sum_allocated_tokens     = 0;
-    size_t sum_tokens               = 0;
-    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
-    {
-        if (object->allocated_c_strings_in_array [i] > max_allocated)
-        {
-            max_allocated = object->allocated_c_strings_in_array [i];
-        }
-        if (object->c_str_array_lengths [i] > max_used)
-        {
-            max_used = object->c_str_array_lengths [i];
-        }
-        sum_allocated_tokens += object->allocated_c_strings_in_array [i];
-        sum_tokens += object->c_str_array_lengths [i];
-    }
-
-    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
-    {
-        printf ("[%2zu] allocated: %*zu | used: %*" PRIuFAST32 " (%.2f %% used)\n", i,
-                (int) Count_Number_Of_Digits(max_allocated), max_allocated, (int) Count_Number_Of_Digits(max_used),
-                object->c_str_array_lengths [i], Determine_Percent(object->c_str_array_lengths [i],
-                        object->allocated_c_strings_in_array [i]));
-    }
-    printf ("Sum allocated tokens: %zu\n", sum_allocated_tokens);
-    printf ("Sum used tokens:      %zu (%.2f %% used)\n\n", sum_tokens,
-            Determine_Percent(sum_tokens, sum_allocated_tokens));
-
-    TokenIntMapping_ShowMemoryUsage(object);
-
-    return;
+    return (file_position + (SNAPSHOT_SECTION_ALIGNMENT - 1)) & ~((uint64_t) (SNAPSHOT_SECTION_ALIGNMENT - 1));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Print information about the allocated memory size and the used memory size.
- *
- * This function is especially useful in the debugging.
+ * @brief Check a section of a snapshot file: The section needs to be aligned, it must not begin before the end of the
+ * previous section and it needs to be completely in the file.
  *
  * Asserts:
- *      object != NULL
+ *      element_size > 0
  *
- * @param[in] object Token_Int_Mapping object
+ * @param[in] section_position File position of the section
+ * @param[in] number_of_elements Number of elements in the section
+ * @param[in] element_size Size of one element in bytes
+ * @param[in, out] previous_section_end End of the previous section; after the call: End of this section (Only, if the
+ *      section is valid)
+ * @param[in] file_size Size of the whole file
+ *
+ * @return true, if the section is valid, otherwise false
  */
-extern void
-TokenIntMapping_ShowMemoryUsage
+static _Bool
+Is_Valid_Snapshot_Section
 (
-        const struct Token_Int_Mapping* const object
+        const uint64_t section_position,
+        const uint64_t number_of_elements,
+        const size_t element_size,
+        uint64_t* const previous_section_end,
+        const uint64_t file_size
 )
 {
-    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
+    ASSERT_MSG(element_size > 0, "The element size of a snapshot section is 0 !");
 
-    size_t allocated_memory = sizeof (struct Token_Int_Mapping);
-    size_t used_memory      = sizeof (struct Token_Int_Mapping);
-    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
-    {
-        allocated_memory += object->allocated_c_strings_in_array [i] * MAX_TOKEN_LENGTH * sizeof (char);
-        allocated_memory += object->allocated_c_strings_in_array [i] * sizeof (uint_fast32_t);
-        used_memory += object->c_str_array_lengths [i] * MAX_TOKEN_LENGTH * sizeof (char);
-        used_memory += object->c_str_array_lengths [i] * sizeof (uint_fast32_t);
-    }
-
-    const int field_size = (int) ((Count_Number_Of_Digits(allocated_memory) > Count_Number_Of_Digits(used_memory)) ?
-            Count_Number_Of_Digits(allocated_memory) : Count_Number_Of_Digits(used_memory));
-    UNUSED(field_size);
+    if (section_position != Align_Snapshot_Section(section_position)) { return false; }
+    if (section_position < *previous_section_end || section_position > file_size) { return false; }
+    // Division instead of a multiplication: A damaged number of elements must not create an overflow
+    if (number_of_elements > (file_size - section_position) / element_size) { return false; }
 
-    printf ("Allocated Token_Int_Mapping size: ");
-    Print_Memory_Size_As_B_KB_MB(allocated_memory);
-    //printf ("Allocated Token_Int_Mapping size: %*zu B (%.3f KB | %.3f MB)\n", field_size, allocated_memory,
-    //        (double) allocated_memory / 1024.0, (double) allocated_memory / 1024.0 / 1024.0);
-    printf ("Used Token_Int_Mapping size:      ");
-    Print_Memory_Size_As_B_KB_MB(used_memory);
-    //printf (" (used: %.2f %%)\n", Determine_Percent(used_memory, allocated_memory));
-    //printf ("Used Token_Int_Mapping size:      %*zu B (%.3f KB | %.3f MB) (used: %.2f %%)\n", field_size, used_memory,
-    //        (double) used_memory / 1024.0, (double) used_memory / 1024.0 / 1024.0,
-    //        Determine_Percent(used_memory, allocated_memory));
+    *previous_section_end = section_position + number_of_elements * element_size;
 
-    return;
+    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Determine the integer value for the given token. (token -> int)
+ * @brief Check the content of the snapshot sections, that will be used for memory accesses: Every token offset needs
+ * to be in the token memory and larger than the previous one, every used slot needs a valid mapped integer with the
+ * length of the saved key and the token memory needs to end with a terminator byte.
  *
  * Asserts:
- *      object != NULL
- *      search_token != NULL
- *      search_token_length > 0
+ *      N/A
  *
- * @param[in] object Token_Int_Mapping object
- * @param[in] search_token Given token
- * @param[in] search_token_length Token length
+ * @param[in] token_offsets Token offsets of the snapshot
+ * @param[in] number_of_tokens Number of tokens
+ * @param[in] slots Slots of the snapshot
+ * @param[in] number_of_slots Number of slots
+ * @param[in] token_memory Token memory of the snapshot
+ * @param[in] token_memory_size Size of the token memory in bytes
+ * @param[in] case_sensitive Was the snapshot created in the case-sensitive mode ?
  *
- * @return Mapping integer or UINT_FAST32_MAX, if the token is not in the mapping list
+ * @return true, if the content is valid, otherwise false
  */
-extern DATA_TYPE
-TokenIntMapping_TokenToInt
+static _Bool
+Is_Valid_Snapshot_Content
 (
-        const struct Token_Int_Mapping* const restrict object,
-        const char* const restrict search_token,
-        const size_t search_token_length
+        const size_t* const restrict token_offsets,
+        const uint64_t number_of_tokens,
+        const struct Token_Int_Mapping_Slot* const restrict slots,
+        const uint64_t number_of_slots,
+        const char* const restrict token_memory,
+        const uint64_t token_memory_size,
+        const _Bool case_sensitive
 )
 {
-    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
-    ASSERT_MSG(search_token != NULL, "New token is NULL !");
-    ASSERT_MSG(search_token_length > 0, "New token has the length 0 !");
+    if (token_memory_size > 0 && token_memory [token_memory_size - 1] != '\0') { return false; }
 
-    DATA_TYPE result = DATA_TYPE_MAX;
-    const uint_fast32_t chosen_c_string_array = Pseudo_Hash_Function (search_token, search_token_length);
-    _Bool token_found = false;
-    uint_fast32_t i = 0;
-    char* c_string_array = object->c_str_arrays [chosen_c_string_array];
-    const uint_fast32_t c_str_array_length = object->c_str_array_lengths [chosen_c_string_array];
-
-    // Search in the C-String, where the token would be, when it is already in the mapping list
-    for (; i < c_str_array_length; ++ i)
+    for (uint64_t i = 0; i < number_of_tokens; ++ i)
     {
-        // Pre check the first char to avoid compare string calls
-        // It is possible, that the program does a case insensitive comparison. For this case only a lower comparison
-        // will always produce the right result !
-        if (tolower(search_token [0]) == tolower(c_string_array [0]))
-        {
-            // Before the comparison: Have the strings the same length ?
-            if (search_token_length == strlen(c_string_array))
-            {
-                if (object->cmp_func (search_token, c_string_array, search_token_length) == 0)
-                {
-                    token_found = true;
-                    break;
-                }
-            }
-        }
-        c_string_array += MAX_TOKEN_LENGTH;
+        if (token_offsets [i] >= token_memory_size) { return false; }
+        if (i > 0 && token_offsets [i] <= token_offsets [i - 1]) { return false; }
     }
 
-    // If the token is in the list, get the mapped integer value
-    if (token_found)
+    for (uint64_t i = 0; i < number_of_slots; ++ i)
     {
-        result = object->int_mapping [chosen_c_string_array][i];
+        if (slots [i].length == 0) { continue; }
+        if ((uint64_t) slots [i].token_int_value >= number_of_tokens) { return false; }
+
+        // Same calculation as in Saved_Token_Length(): The key must not reach the next token
+        const uint64_t int_value = (uint64_t) slots [i].token_int_value;
+        const uint64_t next_offset = (int_value + 1 < number_of_tokens) ? token_offsets [int_value + 1] :
+                token_memory_size;
+        const uint64_t saved_bytes = next_offset - token_offsets [int_value];
+        const uint64_t token_length = ((case_sensitive) ? saved_bytes : saved_bytes / 2) - 1;
+        if (slots [i].length != token_length) { return false; }
     }
 
-    return result;
+    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief Reverse the mapping. int -> token
- *
- * In the integer numbers the corresponding index for the integer mapping array is encoded in the first two digits of
- * the integer value.
- *
- * E.g.: The value 2911 can only appear in the integer mapping array with the index 11. It is NOT necessary to search in
- *       all arrays.
- *
- * So the int value indicates in which array is the corresponding C-String
+ * @brief Write a section of a snapshot file. The gap between the current file position and the section will be filled
+ * with zeros.
  *
  * Asserts:
- *      object != NULL
- *      token_int_value != UINT_FAST32_MAX
- *      result_token_memory != NULL
- *      result_token_memory_size > 0
+ *      *file_position <= section_position
+ *      All write operations are successful
  *
- * @param[in] object Token_Int_Mapping object
- * @param[in] token_int_value Mapped integer
- * @param[out] result_token_memory Memory, where the result token starts
- * @param[in] result_token_memory_size length of the result token
+ * @param[in] snapshot_file Opened snapshot file
+ * @param[in] file_name Name of the snapshot file (Only for error messages)
+ * @param[in, out] file_position Current file position
+ * @param[in] section_position File position of the section
+ * @param[in] data Data of the section
+ * @param[in] data_size Size of the data in bytes
  */
-extern void
-TokenIntMapping_IntToToken
+static void
+Write_Snapshot_Section
 (
-        const struct Token_Int_Mapping* const restrict object,
-        const DATA_TYPE token_int_value,
-        char* const restrict result_token_memory,
-        const size_t result_token_memory_size
+        FILE* const restrict snapshot_file,
+        const char* const restrict file_name,
+        uint64_t* const restrict file_position,
+        const uint64_t section_position,
+        const void* const restrict data,
+        const size_t data_size
 )
 {
-    ASSERT_MSG(object != NULL, "Token_Int_Mapping object is NULL !");
-    ASSERT_MSG(token_int_value != DATA_TYPE_MAX, "Token integer value is UINT_FAST32_MAX ! This value indicates "
-            "errors and therefore cannot be a valid input !");
-    ASSERT_MSG(result_token_memory != NULL, "The result token memory is NULL !");
-    ASSERT_MSG(result_token_memory_size > 0, "The length of the result token memory is 0 !");
+    static const char zeros [SNAPSHOT_SECTION_ALIGNMENT] = { '\0' };
 
-    // Use the encoded information (the first two digits) to find the corresponding index for the integer mapping array
-    // The idea: With this, it is not necessary to search in the whole mapping data to find the specific information
-    //           Especially when the mapped integer is not in the list, it will costs many computation time
-    const uint_fast32_t chosen_c_string_array = token_int_value % C_STR_ARRAYS;
+    ASSERT_FMSG(*file_position <= section_position, "Invalid section position %" PRIu64 " in the snapshot \"%s\" !",
+            section_position, file_name);
 
-    const char* c_string_array = object->c_str_arrays [chosen_c_string_array];
+    // Padding between the sections
+    while (*file_position < section_position)
+    {
+        const size_t padding = (section_position - *file_position > sizeof (zeros)) ? sizeof (zeros) :
+                (size_t) (section_position - *file_position);
+        const size_t written_padding = fwrite(zeros, 1, padding, snapshot_file);
+        ASSERT_FMSG(written_padding == padding, "Error while writing in the file \"%s\" !", file_name);
+        *file_position += padding;
+    }
 
-    for (size_t i2 = 0; i2 < object->c_str_array_lengths [chosen_c_string_array]; ++ i2)
+    if (data_size > 0)
     {
-        if (object->int_mapping [chosen_c_string_array][i2] == token_int_value)
-        {
-            strncpy(result_token_memory, &(c_string_array [i2 * MAX_TOKEN_LENGTH]), result_token_memory_size - 1);
-            result_token_memory [result_token_memory_size - 1] = '\0';
-            break;
-        }
+        const size_t written_bytes = fwrite(data, 1, data_size, snapshot_file);
+        ASSERT_FMSG(written_bytes == data_size, "Error while writing in the file \"%s\" !", file_name);
+        *file_position += data_size;
     }
 
     return;
@@ -537,109 +2180,128 @@ TokenIntMapping_IntToToken
 //---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief This function is comparable with the Int_To_Token() function. But it uses a static array as result memory.
- *
- * With the address and the length of the static memory this function delegates the data to Int_To_Token().
+ * @brief Make a snapshot file accessible in the memory: With mmap() (private copy-on-write mapping), if available.
+ * Otherwise the file will be read in a dynamic memory.
  *
  * Asserts:
- *      N/A (Int_To_Token() do the checks)
+ *      The file can be opened and accessed
+ *      The file is larger than a snapshot header
  *
- * @param[in] object Token_Int_Mapping object
- * @param[in] token_int_value Mapped integer
- *
- * @return Pointer to the modified static array
+ * @param[in] object Token_Int_Mapping object, that gets the snapshot
+ * @param[in] file_name Name of the snapshot file
  */
-extern const char*
-TokenIntMapping_IntToTokenStaticMem
+static void
+Open_Snapshot
 (
-        const struct Token_Int_Mapping* const object,
-        const DATA_TYPE token_int_value
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict file_name
 )
 {
-    static char result_token [MAX_TOKEN_LENGTH];
+#if defined(__unix__) && defined(_POSIX_C_SOURCE)
+    const int file_descriptor = open(file_name, O_RDONLY);
+    ASSERT_FMSG(file_descriptor != -1, "Cannot open the vocabulary snapshot \"%s\": %s", file_name, strerror(errno));
+
+    struct stat file_info;
+    const int fstat_result = fstat(file_descriptor, &file_info);
+    ASSERT_FMSG(fstat_result == 0, "Cannot determine the size of the vocabulary snapshot \"%s\": %s", file_name,
+            strerror(errno));
+    ASSERT_FMSG((size_t) file_info.st_size >= sizeof (struct Token_Int_Mapping_Snapshot_Header),
+            "The file \"%s\" is too small for a vocabulary snapshot !", file_name);
+
+    // Private mapping: Only the pages, that will be changed (e.g. by new tokens in the hash table), will be copied
+    void* const mapping = mmap(NULL, (size_t) file_info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+            file_descriptor, 0);
+    ASSERT_FMSG(mapping != MAP_FAILED, "Cannot map the vocabulary snapshot \"%s\": %s", file_name, strerror(errno));
+    close(file_descriptor);
+
+    object->snapshot            = (char*) mapping;
+    object->snapshot_size       = (size_t) file_info.st_size;
+    object->snapshot_is_mapped  = true;
+#else
+    // Fallback without mmap(): Read the whole file
+    FILE* snapshot_file = fopen(file_name, "rb");
+    ASSERT_FMSG(snapshot_file != NULL, "Cannot open the vocabulary snapshot \"%s\" !", file_name);
 
-    TokenIntMapping_IntToToken(object, token_int_value, result_token, COUNT_ARRAY_ELEMENTS(result_token));
+    const int_fast64_t file_size = Determine_FILE_Size(snapshot_file);
+    ASSERT_FMSG(file_size >= (int_fast64_t) sizeof (struct Token_Int_Mapping_Snapshot_Header),
+            "The file \"%s\" is too small for a vocabulary snapshot !", file_name);
 
-    return result_token;
+    object->snapshot = (char*) MALLOC((size_t) file_size);
+    ASSERT_ALLOC(object->snapshot, "Cannot allocate memory for the vocabulary snapshot !", (size_t) file_size);
+    const size_t read_bytes = fread(object->snapshot, 1, (size_t) file_size, snapshot_file);
+    ASSERT_FMSG(read_bytes == (size_t) file_size, "Cannot read the vocabulary snapshot \"%s\" !", file_name);
+    FCLOSE_WITH_NAME_AND_SET_TO_NULL(snapshot_file, file_name);
+
+    object->snapshot_size       = (size_t) file_size;
+    object->snapshot_is_mapped  = false;
+#endif /* defined(__unix__) && defined(_POSIX_C_SOURCE) */
+
+    return;
 }
 
-//=====================================================================================================================
+//---------------------------------------------------------------------------------------------------------------------
 
 /**
- * @brief A very very very simple "hash function".
- *
- * This function is used to calculate a number for distributing the tokens in different C-Strings.
- *
- * All char of the token will be interpreted as ASCII integer, added and modulo C_STR_ARRAYS.
+ * @brief Determine the used bytes of the whole mapping: Object, tokens, per token arrays and used slots.
  *
  * Asserts:
- *      input_str != NULL
- *      input_str_length > 0
+ *      N/A
  *
- * @param[in] input_str Input C-String
- * @param[in] input_str_length Length of the input string
+ * @param[in] object Token_Int_Mapping object
  *
- * @return The result
+ * @return Used bytes
  */
-static inline uint_fast32_t
-Pseudo_Hash_Function
+static size_t
+Used_Memory_Size
 (
-        const char* const input_str,
-        const size_t input_str_length
+        const struct Token_Int_Mapping* const object
 )
 {
-    ASSERT_MSG(input_str != NULL, "Input string is NULL !");
-    ASSERT_MSG(input_str_length > 0, "Input string length is 0 !");
-
-    uint_fast32_t sum_char_in_new_token = 0;
-    // Add char per char
-    // It is important to use the lower char, because in case of case insensitive comparison the pseudo hash function
-    // needs to be equal, even with different char cases !
-    for (size_t i = 0; i < input_str_length; ++ i)
-    {
-        sum_char_in_new_token = (uint_fast32_t) (tolower(input_str [i])) + sum_char_in_new_token;
-    }
+    size_t used_memory = sizeof (struct Token_Int_Mapping) +
+            object->number_of_tokens * sizeof (struct Token_Int_Mapping_Slot);
+    used_memory += object->token_memory_used * sizeof (char);
+    used_memory += object->number_of_tokens * (sizeof (size_t) + sizeof (_Bool));
 
-    return (sum_char_in_new_token % C_STR_ARRAYS);
+    return used_memory;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 
-static struct Token_Int_Mapping*
-TokenIntMapping_CreateObject_Internal
-(
-        Cmp_Func cmp_func
-)
-{
-    ASSERT_MSG(cmp_func != NULL, "Comparison function pointer is NULL !");
 
-    // Outer object
-    struct Token_Int_Mapping* new_object = (struct Token_Int_Mapping*) CALLOC(1, sizeof (struct Token_Int_Mapping));
-    ASSERT_ALLOC(new_object, "Cannot create a new token int mapping !", sizeof (struct Token_Int_Mapping));
 
-    // Inner C-Strings and memory for the mapping integer values
-    for (size_t i = 0; i < C_STR_ARRAYS; ++ i)
-    {
-        new_object->c_str_arrays [i] = (char*) CALLOC(C_STR_ALLOCATION_STEP_SIZE, sizeof (char) * MAX_TOKEN_LENGTH);
-        ASSERT_ALLOC(new_object->c_str_arrays [i], "Cannot allocate memory for the token int mapping !",
-                C_STR_ALLOCATION_STEP_SIZE * sizeof (char) * MAX_TOKEN_LENGTH);
 
-        new_object->int_mapping [i] = (DATA_TYPE*) CALLOC(C_STR_ALLOCATION_STEP_SIZE, sizeof (DATA_TYPE) * 1);
-        ASSERT_ALLOC(new_object->c_str_arrays [i], "Cannot allocate memory for the token int mapping !",
-                C_STR_ALLOCATION_STEP_SIZE * sizeof (DATA_TYPE) * 1); // NO MAX_TOKEN_LENGTH !
+#ifdef TOKENS_INITIAL_SIZE
+#undef TOKENS_INITIAL_SIZE
+#endif /* TOKENS_INITIAL_SIZE */
 
-        new_object->allocated_c_strings_in_array [i] = C_STR_ALLOCATION_STEP_SIZE;
-    }
+#ifdef TOKEN_MEMORY_INITIAL_SIZE
+#undef TOKEN_MEMORY_INITIAL_SIZE
+#endif /* TOKEN_MEMORY_INITIAL_SIZE */
 
-    new_object->cmp_func = cmp_func;
+#ifdef HASH_TABLE_INITIAL_SLOTS
+#undef HASH_TABLE_INITIAL_SLOTS
+#endif /* HASH_TABLE_INITIAL_SLOTS */
 
-    return new_object;
-}
+#ifdef HASH_TABLE_MAX_LOAD_PERCENT
+#undef HASH_TABLE_MAX_LOAD_PERCENT
+#endif /* HASH_TABLE_MAX_LOAD_PERCENT */
 
-//---------------------------------------------------------------------------------------------------------------------
+#ifdef KEY_STACK_BUFFER_SIZE
+#undef KEY_STACK_BUFFER_SIZE
+#endif /* KEY_STACK_BUFFER_SIZE */
+
+#ifdef SNAPSHOT_MAGIC
+#undef SNAPSHOT_MAGIC
+#endif /* SNAPSHOT_MAGIC */
 
+#ifdef SNAPSHOT_FORMAT_VERSION
+#undef SNAPSHOT_FORMAT_VERSION
+#endif /* SNAPSHOT_FORMAT_VERSION */
 
+#ifdef SNAPSHOT_SECTION_ALIGNMENT
+#undef SNAPSHOT_SECTION_ALIGNMENT
+#endif /* SNAPSHOT_SECTION_ALIGNMENT */
 
-#ifdef C_STR_ALLOCATION_STEP_SIZE
-#undef C_STR_ALLOCATION_STEP_SIZE
-#endif /* C_STR_ALLOCATION_STEP_SIZE */
+#ifdef SNAPSHOT_BYTE_ORDER_MARK
+#undef SNAPSHOT_BYTE_ORDER_MARK
+#endif /* SNAPSHOT_BYTE_ORDER_MARK */
@@ -9,6 +9,9 @@
  *
  * Of course after the intersection it is necessary to invert the mapping. (This could be done with "Int_To_Token()")
  *
+ * The mapped integers are dense: The n-th added token gets the value n - 1. So the reverse mapping is only an array
+ * access.
+ *
  * @date 23.06.2022
  * @author Gyps
  */
@@ -31,21 +34,10 @@ extern "C"
 
 
 /**
- * @brief Number of C-Strings per object.
+ * @brief Expected maximum length of a token (inkl. the terminator byte)
  *
- * This value can be altered to make the memory usage more efficient or to reduce the number of reallocs in the
- * runtime.
- */
-#ifndef C_STR_ARRAYS
-#define C_STR_ARRAYS 100
-#else
-#error "The macro \"C_STR_ARRAYS\" is already defined !"
-#endif /* C_STR_ARRAYS */
-
-/**
- * @brief Maximum length of a token (inkl. the terminator byte)
- *
- * The value is a approximate order of magnitude and could be change in the future.
+ * Tokens are stored with variable length. Longer tokens will NOT be truncated, they will only be reported as long
+ * tokens (--show_too_long_tokens).
  */
 #ifndef MAX_TOKEN_LENGTH
 #define MAX_TOKEN_LENGTH 64
@@ -57,57 +49,177 @@ extern "C"
  * @brief Check, whether the macro values are valid.
  */
 #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
-_Static_assert(C_STR_ARRAYS == 100, "The marco \"C_STR_ARRAYS\" needs to be 100 !");
 _Static_assert(MAX_TOKEN_LENGTH > 0, "The marco \"MAX_TOKEN_LENGTH\" is zero !");
 
-IS_TYPE(C_STR_ARRAYS, int)
 IS_TYPE(MAX_TOKEN_LENGTH, int)
 #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
 
-typedef int (*Cmp_Func) (const char*, const char*, size_t);
+/**
+ * @brief Number of buckets in the probe length histogram of the statistics.
+ *
+ * Bucket i counts the saved tokens with the probe length i + 1. The last bucket counts all longer probes, too.
+ */
+#ifndef PROBE_LENGTH_HISTOGRAM_SIZE
+#define PROBE_LENGTH_HISTOGRAM_SIZE 16
+#else
+#error "The macro \"PROBE_LENGTH_HISTOGRAM_SIZE\" is already defined !"
+#endif /* PROBE_LENGTH_HISTOGRAM_SIZE */
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(PROBE_LENGTH_HISTOGRAM_SIZE > 1, "The marco \"PROBE_LENGTH_HISTOGRAM_SIZE\" needs to be at least 2 !");
+
+IS_TYPE(PROBE_LENGTH_HISTOGRAM_SIZE, int)
+#endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L */
+
+//=====================================================================================================================
+
+/**
+ * @brief One slot of the hash table, that maps a token to the integer value.
+ */
+struct Token_Int_Mapping_Slot
+{
+    uint32_t hash;                  ///< Hash value of the token (Saves the string hashing while growing the table)
+    uint32_t length;                ///< Length of the saved key; 0 means, that the slot is empty
+    DATA_TYPE token_int_value;      ///< Mapped integer; this value is the index in the offset array
+};
 
 //=====================================================================================================================
 
 struct Token_Int_Mapping
 {
     /**
-     * @brief C-String arrays containing the tokens.
+     * @brief Memory containing the tokens.
+     *
+     * It is a flat memory model. This means, that one C-String contains all tokens (with the terminator byte) one
+     * after the other.
+     *
+     * In the case-insensitive mode the case folded key of a token follows directly after the token. (The key has the
+     * same length as the token)
+     */
+    char* token_memory;
+    size_t token_memory_used;       ///< Used bytes in the token memory (inkl. the tokens of a snapshot)
+    size_t token_memory_allocated;  ///< Allocated bytes for the token memory
+
+    /**
+     * @brief Offsets of the tokens in the token memory. The mapped integer is the index in this array.
+     */
+    size_t* token_offsets;
+
+    /**
+     * @brief Is the token a stop word ?
      *
-     * It is a flat memory model. This means, that one C-String contains multiple tokens. Every token is saved as an
-     * interval in the C-String.
+     * The flag will be determined only once, when the token is added to the mapping. So a stop word check in the
+     * intersection calculation is possible without the reverse mapping and a string comparison.
      */
-    char* c_str_arrays [C_STR_ARRAYS];
+    _Bool* stop_word_flags;
 
-    DATA_TYPE* int_mapping [C_STR_ARRAYS];          ///< Mapping integers
+    size_t allocated_tokens;        ///< Allocated number of elements in the offset array and in the flag array
 
     /**
-     * @brief Allocated number of tokens for the C-String. This means, that every C-String has individual allocation
-     * sizes !
+     * @brief Open-addressing hash table (linear probing) for the token -> int search.
+     *
+     * Without this table every search needs a linear scan over the chosen C-String array.
      */
-    size_t allocated_c_strings_in_array [C_STR_ARRAYS];
+    struct Token_Int_Mapping_Slot* slots;
+    size_t number_of_slots;         ///< Number of slots (Always a power of two)
+    size_t number_of_tokens;        ///< Number of used slots (This is also the next mapped integer)
+
+    size_t add_token_calls;         ///< Number of TokenIntMapping_Intern() calls (inkl. the AddToken() calls)
+    size_t add_token_probes;        ///< Sum of the visited slots in all TokenIntMapping_Intern() calls
+    size_t max_probe_length;        ///< Max. visited slots in one TokenIntMapping_Intern() call
+    size_t add_token_hits;          ///< TokenIntMapping_Intern() calls, that found an existing token
+    size_t lookup_calls;            ///< Number of TokenIntMapping_CountedTokenToInt() calls
+    size_t lookup_hits;             ///< TokenIntMapping_CountedTokenToInt() calls, that found the token
 
     /**
-     * @brief Used number of tokens per C-String.
+     * @brief Measure the time of the TokenIntMapping_Intern() and TokenIntMapping_CountedTokenToInt() calls ?
+     *
+     * Off by default, because two clock reads per call are not free. The counters above are always active.
      */
-    uint_fast32_t c_str_array_lengths [C_STR_ARRAYS];
+    _Bool measure_time;
+    uint64_t add_token_time_ns;     ///< Time of all TokenIntMapping_Intern() calls in ns (Only with measure_time)
+    uint64_t lookup_time_ns;        ///< Time of the counted lookup calls in ns (Only with measure_time)
 
     /**
-     * @brief Compare function for the tokens; this function can be used to make a case-insensitive comparison possible.
+     * @brief Case-sensitive comparison of the tokens ?
      *
-     * Such a function pointer is necessary to make a consistent token comparison while loading data and in the
-     * token -> int mapping process.
+     * In the case-insensitive mode every token will be case folded once (UTF-8 aware) into a key. The hash value and
+     * the comparison (memcmp) use only the key. So both modes need the same work per token.
      *
-     * It is not possible to use different comparison functions in the loading process and in the mapping process. A
-     * inconsistent mapping table with wrong data would be the result.
+     * It is not possible to change the mode after the creation. A inconsistent mapping table with wrong data would be
+     * the result.
      */
-    Cmp_Func cmp_func;
+    _Bool case_sensitive;
+
+    /**
+     * @brief Loaded vocabulary snapshot or NULL. (See TokenIntMapping_CreateObjectFromSnapshot())
+     *
+     * The offset array, the flag array and the hash table point directly into the snapshot, until they need to grow.
+     * The tokens of the snapshot stay in the snapshot; new tokens will be saved in the token memory as an overlay. The
+     * offsets of the overlay tokens start with snapshot_token_memory_size.
+     */
+    char* snapshot;
+    size_t snapshot_size;               ///< Size of the snapshot in bytes
+    char* snapshot_token_memory;        ///< Tokens of the snapshot (A part of the snapshot)
+    size_t snapshot_token_memory_size;  ///< Bytes of the snapshot tokens
+    _Bool snapshot_is_mapped;           ///< Snapshot mapped with mmap() ? (Otherwise it was read in a dynamic memory)
+
+    /**
+     * @brief Was the snapshot token already interned in this run ? (Only in the case-insensitive mode; otherwise NULL)
+     *
+     * Without a snapshot the first spelling of a token in the run will be saved. To get the same results with a
+     * snapshot, the first intern of a snapshot token in this run overwrites the spelling of the snapshot (The key and
+     * so the length are the same) and determines the stop word flag again.
+     */
+    _Bool* snapshot_tokens_seen;
+    size_t snapshot_number_of_tokens;   ///< Number of tokens in the snapshot (Elements of snapshot_tokens_seen)
 };
 
 //=====================================================================================================================
 
 /**
- * @brief Create new dynamic Token_Int_Mapping object with the default comparison function (strncmp: case-sensitive
- * comparison)
+ * @brief Statistics of a Token_Int_Mapping: Vocabulary, quality of the hash table and the work of the calls.
+ *
+ * The probe lengths belong to the saved tokens: Number of visited slots to find a saved token in the hash table.
+ */
+struct Token_Int_Mapping_Statistics
+{
+    size_t number_of_tokens;        ///< Distinct tokens in the mapping
+    size_t number_of_slots;         ///< Slots of the hash table
+    double load_factor;             ///< number_of_tokens / number_of_slots
+
+    /**
+     * @brief Number of saved tokens for every probe length. (See PROBE_LENGTH_HISTOGRAM_SIZE)
+     */
+    size_t probe_length_histogram [PROBE_LENGTH_HISTOGRAM_SIZE];
+    double avg_probe_length;        ///< Average probe length of the saved tokens
+    size_t max_probe_length;        ///< Max. probe length of the saved tokens
+
+    size_t intern_calls;            ///< TokenIntMapping_Intern() calls (inkl. the AddToken() and Merge() calls)
+    size_t intern_hits;             ///< Intern calls, that found an existing token
+    double intern_hit_rate;         ///< intern_hits / intern_calls (0.0 without calls)
+    double avg_intern_probe_length; ///< Average visited slots per intern call
+    size_t max_intern_probe_length; ///< Max. visited slots in one intern call
+
+    size_t lookup_calls;            ///< TokenIntMapping_CountedTokenToInt() calls
+    size_t lookup_hits;             ///< Lookup calls, that found the token
+    double lookup_hit_rate;         ///< lookup_hits / lookup_calls (0.0 without calls)
+
+    size_t token_memory_used;       ///< Bytes of the saved tokens (inkl. the case folded keys and the snapshot tokens)
+    double bytes_per_token;         ///< Bytes of the whole mapping per token
+    size_t memory_used;             ///< Used bytes of the whole mapping (Tokens, arrays and hash table)
+
+    _Bool time_measured;            ///< Were the times measured ? (Otherwise the times are 0.0)
+    double intern_seconds;          ///< Time of all intern calls
+    double lookup_seconds;          ///< Time of all lookup calls
+
+    _Bool from_snapshot;            ///< Was the mapping loaded from a snapshot ?
+};
+
+//=====================================================================================================================
+
+/**
+ * @brief Create new dynamic Token_Int_Mapping object with case-sensitive comparison of the tokens
  *
  * Asserts:
  *      N/A
@@ -121,19 +233,21 @@ TokenIntMapping_CreateObject
 );
 
 /**
- * @brief Create new dynamic Token_Int_Mapping object with user-defined comparison function for the tokens.
+ * @brief Create new dynamic Token_Int_Mapping object with the given case sensitivity.
+ *
+ * In the case-insensitive mode the tokens will be compared with their UTF-8 aware case folded keys.
  *
  * Asserts:
  *      N/A
  *
- * @param[in] cmp_func User-defined comparison function for the tokens.
+ * @param[in] case_sensitive Case-sensitive comparison of the tokens ?
  *
  * @return Pointer to the new object
  */
 extern struct Token_Int_Mapping*
-TokenIntMapping_CreateObjectWithGivenCmpFunction
+TokenIntMapping_CreateObjectWithCaseSensitivity
 (
-        Cmp_Func cmp_func
+        const _Bool case_sensitive
 );
 
 /**
@@ -151,30 +265,43 @@ TokenIntMapping_DeleteObject
 );
 
 /**
- * @brief Add token to the mapping object.
+ * @brief Get the mapped integer of a token. If the token is not in the mapping object, it will be added.
  *
- * The return value is an flag and indicates whether the operation was successful. The process is not successful, if
- * the token already exists in the mapping table. In this case there will be NO duplicate in the mapping table.
+ * The search for an existing token and the insertion of a new token use the same probe in the hash table. So a token
+ * will be hashed and compared only once. The expected runtime is O(1).
  *
  *
  * How the mapping integers works:
- * The first two digits are equal with the integer mapping array index.
+ * The mapped integers are assigned densely from 0 in the order of the insertion. The mapped integer is the index of the
+ * token in the offset array; so the reverse mapping (int -> token) needs no search.
  *
- * The reason:
- * For the reverse mapping process (int -> token) it is necessary, that in the integer values the corresponding
- * integer mapping array index is coded. This will be done with the first two digits. You know with a int
- * value - e.g. a 1942 - that this value can only occur in the integer mapping array with the index 42.
  *
- * Okay. But for adding a token in the mapping we need to encode the knowledge of our chosen C-String array in
- * the mapped integer value.
+ * Asserts:
+ *      object != NULL
+ *      new_token != NULL
+ *      new_token_length > 0
  *
- * The idea:
- * - Find the maximum value in the selected integer mapping array. In our example: 1942
- * - Remove the encoding:                                           1942 / 100 (C_STR_ARRAYS)   -> 19
- * - Increment the value:                                           19 + 1                      -> 20
- * - Shift the value two digits (in decimal system) to the left:    20 * 100 (C_STR_ARRAYS)     -> 2000
- * - Add the encoding (the chosen C-String array):                  2000 + 42                   -> 2042
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] new_token New token
+ * @param[in] new_token_length Length of the new token
  *
+ * @return Mapping integer of the existing or the new token
+ */
+extern DATA_TYPE
+TokenIntMapping_Intern
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict new_token,
+        const size_t new_token_length
+);
+
+/**
+ * @brief Add token to the mapping object.
+ *
+ * The return value is an flag and indicates whether the operation was successful. The process is not successful, if
+ * the token already exists in the mapping table. In this case there will be NO duplicate in the mapping table.
+ *
+ * See TokenIntMapping_Intern() for the details of the insertion.
  *
  * Asserts:
  *      object != NULL
@@ -196,7 +323,106 @@ TokenIntMapping_AddToken
 );
 
 /**
- * @brief Print the number of tokens in all C-Strings.
+ * @brief Merge a (chunk local) Token_Int_Mapping into a global Token_Int_Mapping.
+ *
+ * The tokens of the local mapping will be interned in the global mapping in the order of their local integers. So the
+ * global integers are exact the same as if the tokens of the chunks were added directly to the global mapping in the
+ * order of the chunks. The saved keys and the stop word flags of the local mapping will be reused.
+ *
+ * This is the merge step of the parallel construction: Every thread builds a local mapping for its chunk of the input
+ * data. After that the local mappings will be merged (single threaded) in the order of the chunks.
+ *
+ * Asserts:
+ *      global_mapping != NULL
+ *      local_mapping != NULL
+ *      remap_table != NULL
+ *      global_mapping->case_sensitive == local_mapping->case_sensitive
+ *
+ * @param[in] global_mapping Global Token_Int_Mapping object
+ * @param[in] local_mapping Local Token_Int_Mapping object
+ * @param[out] remap_table Global integer for every local integer (Needs local_mapping->number_of_tokens elements)
+ *
+ * @return Number of tokens, that were added to the global mapping
+ */
+extern size_t
+TokenIntMapping_Merge
+(
+        struct Token_Int_Mapping* const restrict global_mapping,
+        const struct Token_Int_Mapping* const restrict local_mapping,
+        DATA_TYPE* const restrict remap_table
+);
+
+/**
+ * @brief Renumber the mapped integers, so that the tokens with the highest frequency get the smallest integers.
+ *
+ * Tokens with the same frequency keep their relative order. The token memory will be rebuilt in the new order; so the
+ * saved tokens of the small integers are also neighbours in the memory.
+ *
+ * All data, that uses the old integers, needs to be remapped with the remap table. (E.g. DocumentWordList_RemapData())
+ *
+ * Asserts:
+ *      object != NULL
+ *      frequencies != NULL
+ *      remap_table != NULL
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] frequencies Frequency of every mapped integer (Needs object->number_of_tokens elements)
+ * @param[out] remap_table New integer for every old integer (Needs object->number_of_tokens elements)
+ */
+extern void
+TokenIntMapping_RenumberByFrequency
+(
+        struct Token_Int_Mapping* const restrict object,
+        const size_t* const restrict frequencies,
+        DATA_TYPE* const restrict remap_table
+);
+
+/**
+ * @brief Create a Token_Int_Mapping object from a vocabulary snapshot. (See TokenIntMapping_SaveSnapshot())
+ *
+ * The snapshot will be mapped in the memory (copy-on-write) and used directly: No parsing and no rehashing. New tokens
+ * will be saved in a dynamic overlay on top of the snapshot; the snapshot file itself will never be changed.
+ *
+ * In the case-insensitive mode the first intern of a snapshot token replaces the spelling of the snapshot with the
+ * given spelling and determines the stop word flag again. So the results are the same as without a snapshot.
+ *
+ * Asserts:
+ *      file_name != NULL
+ *      The file is a valid snapshot, that was created with the same format version on a compatible system
+ *
+ * @param[in] file_name Name of the snapshot file
+ *
+ * @return Pointer to the new object
+ */
+extern struct Token_Int_Mapping*
+TokenIntMapping_CreateObjectFromSnapshot
+(
+        const char* const file_name
+);
+
+/**
+ * @brief Save the Token_Int_Mapping (mapped integers, tokens, stop word flags and the hash table) as a versioned
+ * binary vocabulary snapshot.
+ *
+ * The file can be used with TokenIntMapping_CreateObjectFromSnapshot(). An existing file will be overwritten.
+ *
+ * Asserts:
+ *      object != NULL
+ *      file_name != NULL
+ *      The file can be written
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] file_name Name of the snapshot file
+ */
+extern void
+TokenIntMapping_SaveSnapshot
+(
+        const struct Token_Int_Mapping* const restrict object,
+        const char* const restrict file_name
+);
+
+/**
+ * @brief Print the number of tokens and the usage of the token memory.
  *
  * This function is especially useful in the debugging.
  *
@@ -206,7 +432,7 @@ TokenIntMapping_AddToken
  * @param[in] object Token_Int_Mapping object
  */
 extern void
-TokenIntMapping_ShowStringArrayUsage
+TokenIntMapping_ShowTokenMemoryUsage
 (
         const struct Token_Int_Mapping* const object
 );
@@ -227,9 +453,50 @@ TokenIntMapping_ShowMemoryUsage
         const struct Token_Int_Mapping* const object
 );
 
+/**
+ * @brief Print statistics of the hash table: Load factor and the probe lengths.
+ *
+ * The probe length of a token is the number of visited slots to find the token (or the empty slot for a new token).
+ * The statistics of the saved tokens will be determined in this function; the statistics of the TokenIntMapping_AddToken()
+ * calls were counted in the calls.
+ *
+ * Asserts:
+ *      object != NULL
+ *
+ * @param[in] object Token_Int_Mapping object
+ */
+extern void
+TokenIntMapping_ShowHashTableStatistics
+(
+        const struct Token_Int_Mapping* const object
+);
+
+/**
+ * @brief Determine the statistics of the mapping.
+ *
+ * The probe lengths of the saved tokens will be determined in this function (one pass over the hash table); all other
+ * values were counted in the calls.
+ *
+ * Asserts:
+ *      object != NULL
+ *      result != NULL
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[out] result Statistics
+ */
+extern void
+TokenIntMapping_GetStatistics
+(
+        const struct Token_Int_Mapping* const restrict object,
+        struct Token_Int_Mapping_Statistics* const restrict result
+);
+
 /**
  * @brief Determine the integer value for the given token. (token -> int)
  *
+ * The object will not be changed. So this function can be used from multiple threads at the same time, as long as no
+ * new token will be added. The call will not be counted in the statistics; see TokenIntMapping_CountedTokenToInt().
+ *
  * Asserts:
  *      object != NULL
  *      search_token != NULL
@@ -249,20 +516,61 @@ TokenIntMapping_TokenToInt
         const size_t search_token_length
 );
 
+/**
+ * @brief Determine the integer value for the given token (token -> int) and count the call in the statistics of the
+ * object. With measure_time the time of the call will be measured, too.
+ *
+ * The counters will be changed. So this function cannot be used from multiple threads at the same time.
+ *
+ * Asserts:
+ *      object != NULL
+ *      search_token != NULL
+ *      search_token_length > 0
+ *
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] search_token Given token
+ * @param[in] search_token_length Token length
+ *
+ * @return Mapping integer or UINT_FAST32_MAX, if the token is not in the mapping list
+ */
+extern DATA_TYPE
+TokenIntMapping_CountedTokenToInt
+(
+        struct Token_Int_Mapping* const restrict object,
+        const char* const restrict search_token,
+        const size_t search_token_length
+);
+
 /**
  * @brief Reverse the mapping. int -> token
  *
- * In the integer numbers the corresponding index for the integer mapping array is encoded in the first two digits of
- * the integer value.
+ * The mapped integer is the index in the offset array. So no search is necessary.
+ *
+ * The result is a pointer into the token memory of the object; there is no copy. So this function can be used from
+ * multiple threads at the same time. The pointer is valid as long as no new token will be added.
+ *
+ * Asserts:
+ *      object != NULL
+ *      token_int_value is a valid mapped integer
  *
- * E.g.: The value 2911 can only appear in the integer mapping array with the index 11. It is NOT necessary to search in
- *       all arrays.
+ * @param[in] object Token_Int_Mapping object
+ * @param[in] token_int_value Mapped integer
  *
- * So the int value indicates in which array is the corresponding C-String
+ * @return Pointer to the saved token
+ */
+extern const char*
+TokenIntMapping_IntToTokenPtr
+(
+        const struct Token_Int_Mapping* const object,
+        const DATA_TYPE token_int_value
+);
+
+/**
+ * @brief Reverse the mapping and copy the token in the given memory. int -> token
  *
  * Asserts:
  *      object != NULL
- *      token_int_value != UINT_FAST32_MAX
+ *      token_int_value is a valid mapped integer
  *      result_token_memory != NULL
  *      result_token_memory_size > 0
  *
@@ -281,20 +589,21 @@ TokenIntMapping_IntToToken
 );
 
 /**
- * @brief This function is comparable with the Int_To_Token() function. But it uses a static array as result memory.
+ * @brief Is the token with the given mapped integer a stop word ?
  *
- * With the address and the length of the static memory this function delegates the data to Int_To_Token().
+ * The mapped integer is the index in the flag array. So no search and no string comparison is necessary.
  *
  * Asserts:
- *      N/A (Int_To_Token() do the checks)
+ *      object != NULL
+ *      token_int_value is a valid mapped integer
  *
  * @param[in] object Token_Int_Mapping object
  * @param[in] token_int_value Mapped integer
  *
- * @return Pointer to the modified static array
+ * @return true, if the token is a stop word, otherwise false
  */
-extern const char*
-TokenIntMapping_IntToTokenStaticMem
+extern _Bool
+TokenIntMapping_IsStopWord
 (
         const struct Token_Int_Mapping* const object,
         const DATA_TYPE token_int_value
@@ -520,3 +520,78 @@ int u8_contains_string_u8_char(char* str)
     return result;
 }
 #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L */
+
+u_int32_t u8_fold_char(const u_int32_t ch)
+{
+    if (ch < 0x80) {
+        return (ch >= 'A' && ch <= 'Z') ? ch + ('a' - 'A') : ch;
+    }
+    /* Latin-1 (without the multiplication sign) */
+    if (ch >= 0xC0 && ch <= 0xDE && ch != 0xD7) {
+        return ch + 0x20;
+    }
+    /* Latin Extended-A: upper and lower char are neighbours */
+    if ((ch >= 0x100 && ch <= 0x12F) || (ch >= 0x132 && ch <= 0x137) || (ch >= 0x14A && ch <= 0x177)) {
+        return ch | 1;
+    }
+    if ((ch >= 0x139 && ch <= 0x148) || (ch >= 0x179 && ch <= 0x17E)) {
+        return (ch & 1) ? ch + 1 : ch;
+    }
+    if (ch == 0x178) {
+        return 0xFF;
+    }
+    /* Greek */
+    if ((ch >= 0x391 && ch <= 0x3A1) || (ch >= 0x3A3 && ch <= 0x3AB)) {
+        return ch + 0x20;
+    }
+    switch (ch) {
+    case 0x386: return 0x3AC;
+    case 0x388: case 0x389: case 0x38A: return ch + 0x25;
+    case 0x38C: return 0x3CC;
+    case 0x38E: case 0x38F: return ch + 0x3F;
+    case 0x3C2: return 0x3C3; /* final sigma */
+    default: break;
+    }
+    /* Cyrillic */
+    if (ch >= 0x410 && ch <= 0x42F) {
+        return ch + 0x20;
+    }
+    if (ch >= 0x400 && ch <= 0x40F) {
+        return ch + 0x50;
+    }
+
+    return ch;
+}
+
+void u8_fold_case(char *dest, const char *src, const size_t srcsz)
+{
+    size_t i = 0;
+
+    while (i < srcsz) {
+        const unsigned char c = (unsigned char) src[i];
+
+        if (c < 0x80) {
+            dest[i] = (c >= 'A' && c <= 'Z') ? (char) (c + ('a' - 'A')) : (char) c;
+            i++;
+        }
+        /* all folded chars are in the two byte range */
+        else if ((c & 0xE0) == 0xC0 && i + 1 < srcsz && !isutf(src[i+1])) {
+            const u_int32_t ch = ((u_int32_t) (c & 0x1F) << 6) | ((u_int32_t) src[i+1] & 0x3F);
+            const u_int32_t folded = (ch >= 0x80) ? u8_fold_char(ch) : ch;
+
+            if (folded != ch) {
+                dest[i] = (char) (0xC0 | (folded >> 6));
+                dest[i+1] = (char) (0x80 | (folded & 0x3F));
+            }
+            else {
+                dest[i] = src[i];
+                dest[i+1] = src[i+1];
+            }
+            i += 2;
+        }
+        else {
+            dest[i] = src[i];
+            i++;
+        }
+    }
+}
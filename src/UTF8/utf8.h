@@ -89,3 +89,11 @@ _Bool u8_contains_string_u8_char(char* str);
 /* Contains the string at least one UTF8 char? */
 int u8_contains_string_u8_char(char* str);
 #endif /* defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L */
+
+/* simple case folding of a single char; only mappings, that don't change the length
+   of the UTF-8 sequence, are used (ASCII, Latin-1, Latin Extended-A, Greek, Cyrillic) */
+u_int32_t u8_fold_char(const u_int32_t ch);
+
+/* case folding of srcsz bytes from src to dest; the folded string has exact the same
+   length in bytes as the source. dest will not be null terminated */
+void u8_fold_case(char *dest, const char *src, const size_t srcsz);
@@ -164,6 +164,7 @@ IS_CONST_STR(N_A)
 #include "ANSI_Esc_Seq.h"
 #include "Defines.h"
 #include "CPUID.h"
+#include "String_Tools.h"
 
 #include "Tests/tinytest.h"
 #include "Tests/TEST_cJSON_Parser.h"
@@ -245,16 +246,38 @@ int main (const int argc, const char* argv [])
                     "Calculate sentence offsets", NULL, 0, 0),
             OPT_BOOLEAN('w', "word_offset", &GLOBAL_CLI_WORD_OFFSET,
                     "Calculate word offsets (On by default)", NULL, 0, 0),
-            OPT_BOOLEAN('\0', "show_too_long_tokens", &GLOBAL_CLI_SHOW_TOO_LONG_TOKENS,
-                    "Show too long tokens in the result file", NULL, 0, 0),
+            OPT_BOOLEAN('\0', "show_too_long_tokens", &GLOBAL_CLI_SHOW_LONG_TOKENS,
+                    "Show too long tokens in the result file (Tokens, that are longer than the expected max. length; "
+                    "they will not be truncated)", NULL, 0, 0),
             OPT_BOOLEAN('\0', "no_part_matches", &GLOBAL_CLI_NO_PART_MATCHES,
-                    "Don't show partial matches in the output file", NULL, 0, 0),
+                    "Don't show partial matches in the output file (Without --doc_major only the full match "
+                    "candidates will be intersected, so the printed numbers of found tokens and sets exclude the "
+                    "partial matches)", NULL, 0, 0),
             OPT_BOOLEAN('\0', "no_full_matches", &GLOBAL_CLI_NO_FULL_MATCHES,
                     "Don't show full matches in the output file", NULL, 0, 0),
             OPT_BOOLEAN('k', "keep_single_token_results", &GLOBAL_CLI_KEEP_RESULTS_WITH_ONE_TOKEN,
                     "Keep results with only one token", NULL, 0, 0),
             OPT_BOOLEAN('c', "case_sensitive_token_cmp", &GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON,
                     "Do a case sensitive comparison of the tokens", NULL, 0, 0),
+            OPT_BOOLEAN('\0', "inverted_index", &GLOBAL_CLI_INVERTED_INDEX,
+                    "Use posting lists to find the data sets with intersections (Same results)", NULL, 0, 0),
+            OPT_BOOLEAN('\0', "sorted_merge", &GLOBAL_CLI_SORTED_MERGE,
+                    "Intersect the data sets with a merge of the once sorted data sets (Same results)", NULL, 0,
+                    0),
+            OPT_BOOLEAN('\0', "doc_major", &GLOBAL_CLI_DOC_MAJOR,
+                    "Read every data set of the first file only once to find the intersections (Same results)", NULL,
+                    0, 0),
+            OPT_BOOLEAN('\0', "frequency_ids", &GLOBAL_CLI_FREQUENCY_IDS,
+                    "Give the most frequent tokens the smallest mapped integers (Same results)", NULL, 0, 0),
+            OPT_STRING('\0', "save_vocab", &GLOBAL_CLI_SAVE_VOCAB,
+                    "Save the token int mapping as vocabulary snapshot in this file", NULL, 0, 0),
+            OPT_STRING('\0', "load_vocab", &GLOBAL_CLI_LOAD_VOCAB,
+                    "Start with the token int mapping of this vocabulary snapshot (Same results)", NULL, 0, 0),
+            OPT_STRING('\0', "stats_json", &GLOBAL_CLI_STATS_JSON,
+                    "Save the statistics of the token int mapping as JSON in this file", NULL, 0, 0),
+            OPT_INTEGER('\0', "threads", &GLOBAL_CLI_THREADS,
+                    "Number of threads for the token mapping and the intersection calculation (Same results)",
+                    NULL, 0, 0),
 
             OPT_GROUP("Debug / test functions"),
             OPT_BOOLEAN('T', "run_all_test_functions", &GLOBAL_RUN_ALL_TEST_FUNCTIONS,
@@ -263,6 +286,8 @@ int main (const int argc, const char* argv [])
                      "Abort the calculation at this percent", NULL, 0, 0),
             OPT_BOOLEAN('n', "no_cpu_extensions", &GLOBAL_CLI_NO_CPU_EXTENSIONS,
                     "Don't use CPU extensions, even if there available on the host", NULL, 0, 0),
+            OPT_STRING('\0', "kernel", &GLOBAL_CLI_KERNEL,
+                    "Use this intersection kernel (auto, avx2, avx, sse4_1, sse2, mmx, none)", NULL, 0, 0),
             OPT_BOOLEAN('\0', "no_timestamp", &GLOBAL_CLI_NO_TIMESTAMP,
                     "Don't save a timestamp in the output file", NULL, 0, 0),
 
@@ -276,6 +301,11 @@ int main (const int argc, const char* argv [])
     const int new_argc = argparse_parse(&argparse_object, argc, argv);
     UNUSED(new_argc);
 
+    // Select the intersection kernel with the CPUID results (or the kernel given by the user)
+    Check_CLI_Parameter_GLOBAL_CLI_KERNEL();
+    // The block tokenizer of the input files will be selected with the CPUID results
+    const char* const tokenizer_extension = Select_Tokenize_String_Extension();
+
     if (GLOBAL_RUN_ALL_TEST_FUNCTIONS)
     {
         Run_All_Test_Functions();
@@ -321,6 +351,7 @@ int main (const int argc, const char* argv [])
         EXIT(EXIT_FAILURE);
     }
 
+    Check_CLI_Parameter_GLOBAL_CLI_THREADS();
     Check_CLI_Parameter_Logical_Consistency();
     puts("");
 
@@ -333,26 +364,8 @@ int main (const int argc, const char* argv [])
     NEWLINE
 
     // Show the used CPU extensions
-    if (! GLOBAL_CLI_NO_CPU_EXTENSIONS)
-    {
-#if defined(__AVX__) && defined(__AVX2__) && ! defined(NO_AVX2) && ! defined(NO_CPU_EXTENSIONS)
-        puts("Using " ANSI_TEXT_BOLD "AVX2" ANSI_RESET_ALL " CPU extension.");
-#elif defined(__AVX__) && ! defined(NO_AVX) && ! defined(NO_CPU_EXTENSIONS)
-        puts("Using " ANSI_TEXT_BOLD "AVX" ANSI_RESET_ALL " CPU extension.");
-#elif defined(__SSE__) && defined(__SSE2__) && defined(__SSE3__) && defined(__SSE4_1__) && ! defined(NO_SSE4_1) && ! defined(NO_CPU_EXTENSIONS)
-        puts("Using " ANSI_TEXT_BOLD "SSE4.1" ANSI_RESET_ALL " CPU extension.");
-#elif defined(__SSE__) && defined(__SSE2__) && ! defined(NO_SSE2) && ! defined(NO_CPU_EXTENSIONS)
-        puts("Using " ANSI_TEXT_BOLD "SSE2" ANSI_RESET_ALL " CPU extension.");
-#elif defined(__MMX__) && ! defined(NO_MMX) && ! defined (NO_CPU_EXTENSIONS)
-        puts("Using " ANSI_TEXT_BOLD "MMX" ANSI_RESET_ALL " CPU extension.");
-#else
-        puts("Using " ANSI_TEXT_BOLD "no" ANSI_RESET_ALL " CPU extension.");
-#endif
-    }
-    else
-    {
-        puts("Using " ANSI_TEXT_BOLD "no" ANSI_RESET_ALL " CPU extension.");
-    }
+    printf("Using " ANSI_TEXT_BOLD "%s" ANSI_RESET_ALL " CPU extension.\n", IntersectionApproach_GetKernelExtensionName());
+    printf("Using " ANSI_TEXT_BOLD "%s" ANSI_RESET_ALL " CPU extension for the tokenization.\n", tokenizer_extension);
 #ifdef I386
     puts("Using " ANSI_TEXT_BOLD "32 bit" ANSI_RESET_ALL " mode.");
 #else
@@ -361,6 +374,8 @@ int main (const int argc, const char* argv [])
 
     printf("Comparison mode: " ANSI_TEXT_BOLD "%s" ANSI_RESET_ALL "\n",
             (GLOBAL_CLI_CASE_SENSITIVE_TOKEN_COMPARISON) ? "case sensitive" : "case insensitive");
+    printf("Intersection engine: " ANSI_TEXT_BOLD "%s" ANSI_RESET_ALL "\n", Exec_Intersection_Engine_Name());
+    printf("Threads: " ANSI_TEXT_BOLD "%d" ANSI_RESET_ALL "\n", GLOBAL_CLI_THREADS);
 
     PUTS_FFLUSH("");
 
@@ -383,7 +398,18 @@ Run_All_Test_Functions (void)
     RUN(TEST_AppendDataToSpecificString);
 
     RUN(TEST_Intersection);
+    RUN(TEST_Intersection_Kernels);
+    RUN(TEST_Token_Signatures);
     RUN(TEST_Tokenize_String);
+    RUN(TEST_Tokenize_Long_String);
+    RUN(TEST_Token_Int_Mapping_Stop_Word_Flags);
+    RUN(TEST_Token_Int_Mapping_Hash_Table);
+    RUN(TEST_Token_Int_Mapping_Intern);
+    RUN(TEST_Token_Int_Mapping_Case_Folding);
+    RUN(TEST_Token_Int_Mapping_Merge);
+    RUN(TEST_Token_Int_Mapping_Frequency_Ids);
+    RUN(TEST_Token_Int_Mapping_Snapshot);
+    RUN(TEST_Token_Int_Mapping_Statistics);
 
     RUN(TEST_cJSON_Parse_JSON_Fragment);
     RUN(TEST_cJSON_Get_Token_Array_From_JSON_Fragment);
@@ -393,6 +419,20 @@ Run_All_Test_Functions (void)
     RUN(TEST_Max_Dataset_ID_Length);
     RUN(TEST_Max_Tokenarray_Length);
     RUN(TEST_Length_Of_The_First_25_Tokenarrays);
+    RUN(TEST_Token_Memory_Without_Truncation);
+    RUN(TEST_Read_Lines_Of_Text_File);
+    RUN(TEST_Skip_Text_Lines_Without_Tokens);
+    RUN(TEST_Parse_JSON_Fragments);
+    RUN(TEST_Parallel_File_Loading);
+    RUN(TEST_Parallel_Loading_Of_Nested_JSON_Objects);
+    RUN(TEST_Direct_To_Id_Ingestion);
+    RUN(TEST_Token_List_Geometric_Growth);
+
+    RUN(TEST_Engine_Equivalence);
+    RUN(TEST_Multithreaded_Calculation);
+    RUN(TEST_Full_Match_Engine);
+    RUN(TEST_Full_Match_Engine_Counters);
+    RUN(TEST_Data_Sets_Without_String_Tokens);
 
     RUN(TEST_MD5_Of_Test_Files);
 